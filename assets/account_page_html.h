@@ -8,69 +8,131 @@ const char ACCOUNT_PAGE_HTML[] PROGMEM = R"(
 <!DOCTYPE html>
 <html>
 <head>
-    <title>{{DEVICE_NAME}} - Account Settings</title>
-    <meta name="viewport" content="width=device-width, initial-scale=1">
-    <meta charset="UTF-8">
-    <link rel="stylesheet" href="/assets/style.css">
-    <link rel="icon" href="/assets/favicon.svg" type="image/svg+xml">
-    <link rel="icon" href="/assets/favicon.ico" sizes="any">
+<title>{{DEVICE_NAME}} - Account Settings</title>
+<meta name="viewport" content="width=device-width, initial-scale=1">
+<meta charset="UTF-8">
+<link rel="stylesheet" href="{{ASSET:/assets/style.css}}">
+<link rel="icon" href="{{ASSET:/assets/favicon.svg}}" type="image/svg+xml">
+<link rel="icon" href="{{ASSET:/assets/favicon.ico}}" sizes="any">
 </head>
 <body>
-    <div class="container">
-        {{NAV_MENU}}
-        <h1>Account Settings</h1>
-        
-        <div id="statusMessage" class="alert" style="display: none;"></div>
-        
-        <div class="card">
-            <h3>Update Password</h3>
-            <form id="updatePasswordForm">
-                <div class="form-group">
-                    <label for="password">New Password:</label>
-                    <input type="password" id="password" name="password" class="form-control" required minlength="4">
-                </div>
-                <div class="form-group">
-                    <label for="confirmPassword">Confirm Password:</label>
-                    <input type="password" id="confirmPassword" name="confirmPassword" class="form-control" required minlength="4">
-                </div>
-                <div class="button-group">
-                    <button type="submit" class="btn btn-primary">Update Password</button>
-                </div>
-            </form>
-        </div>
-        
-        <div class="card">
-            <h3>API Tokens</h3>
-            <p>Create API tokens to access this device's API from other applications.</p>
-            
-            <form id="createTokenForm">
-                <div class="form-group">
-                    <label for="tokenName">Token Name:</label>
-                    <input type="text" id="tokenName" name="tokenName" class="form-control" required 
-                           placeholder="e.g. 'Home Assistant Integration'">
-                </div>
-                <div class="button-group">
-                    <button type="submit" class="btn btn-primary">Create Token</button>
-                </div>
-            </form>
-            
-            
-            
-            <h4 class="mt-3">Your Tokens</h4>
-            <div id="tokenContainer">
-                <p>Loading tokens...</p>
-            </div>
-        </div>
-        
-        <div class="button-group mt-3">
-            <a href="/" class="btn btn-secondary">Back to Home</a>
-            <a href="/logout" class="btn btn-danger">Logout</a>
-        </div>
-    </div>
-    <script src="/assets/web-platform-utils.js"></script>
-    <script src="/assets/account-page.js"></script>
+<div class="container">
+{{NAV_MENU}}
+<h1>Account Settings</h1>
+<div id="statusMessage" class="alert" style="display: none;"></div>
+<div class="card">
+<h3>Update Password</h3>
+<form id="updatePasswordForm">
+<div class="form-group">
+<label for="password">New Password:</label>
+<input type="password" id="password" name="password" class="form-control" required minlength="4">
+</div>
+<div class="form-group">
+<label for="confirmPassword">Confirm Password:</label>
+<input type="password" id="confirmPassword" name="confirmPassword" class="form-control" required minlength="4">
+</div>
+<div class="button-group">
+<button type="submit" class="btn btn-primary">Update Password</button>
+</div>
+</form>
+</div>
+<div class="card">
+<h3>API Tokens</h3>
+<p>Create API tokens to access this device's API from other applications.</p>
+<form id="createTokenForm">
+<div class="form-group">
+<label for="tokenName">Token Name:</label>
+<input type="text" id="tokenName" name="tokenName" class="form-control" required
+placeholder="e.g. 'Home Assistant Integration'">
+</div>
+<div class="button-group">
+<button type="submit" class="btn btn-primary">Create Token</button>
+</div>
+</form>
+<h4 class="mt-3">Your Tokens</h4>
+<div id="tokenContainer">
+<p>Loading tokens...</p>
+</div>
+</div>
+<div class="button-group mt-3">
+<a href="/" class="btn btn-secondary">Back to Home</a>
+<a href="/logout" class="btn btn-danger">Logout</a>
+</div>
+</div>
+<script src="{{ASSET:/assets/web-platform-utils.js}}"></script>
+<script src="{{ASSET:/assets/account-page.js}}"></script>
 </body>
 </html>
 )";
 
+const uint8_t ACCOUNT_PAGE_HTML_GZ[] PROGMEM = {
+    0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xb5, 0x55,
+    0xdd, 0x4f, 0xdb, 0x30, 0x10, 0x7f, 0xef, 0x5f, 0xe1, 0xf9, 0x85, 0x87,
+    0x2d, 0x8d, 0x10, 0x3c, 0x4c, 0x2c, 0x89, 0xd4, 0x95, 0xa2, 0x21, 0x41,
+    0x57, 0x89, 0x82, 0xc4, 0x13, 0x72, 0x93, 0x6b, 0xe2, 0xe1, 0xd8, 0x99,
+    0xed, 0xb4, 0x74, 0x55, 0xff, 0xf7, 0x9d, 0x9d, 0xf4, 0x03, 0x32, 0x98,
+    0xd0, 0xb4, 0x87, 0xd6, 0xf1, 0xdd, 0xfd, 0xee, 0xeb, 0x77, 0xb9, 0xf4,
+    0xa2, 0x0f, 0xe7, 0xdf, 0x87, 0xd3, 0xfb, 0xc9, 0x88, 0x14, 0xb6, 0x14,
+    0x49, 0x2f, 0xda, 0x1e, 0xc0, 0x32, 0x3c, 0x2c, 0xb7, 0x02, 0x92, 0xf5,
+    0xfa, 0x7c, 0x74, 0x77, 0x39, 0x1c, 0x3d, 0x8c, 0x07, 0xd7, 0xa3, 0xcd,
+    0x86, 0x04, 0x64, 0x90, 0xa6, 0xaa, 0x96, 0x96, 0xdc, 0x80, 0xb5, 0x5c,
+    0xe6, 0x26, 0x0a, 0x1b, 0xcb, 0x5e, 0x54, 0x82, 0x65, 0x44, 0xb2, 0x12,
+    0x62, 0xba, 0xe0, 0xb0, 0xac, 0x94, 0xb6, 0x94, 0xa4, 0x4a, 0x5a, 0x90,
+    0x36, 0xa6, 0x4b, 0x9e, 0xd9, 0x22, 0xce, 0x60, 0xc1, 0x53, 0x08, 0xfc,
+    0xe5, 0x13, 0xe1, 0x92, 0x5b, 0xce, 0x44, 0x60, 0x52, 0x26, 0x20, 0x3e,
+    0xa6, 0x5b, 0x27, 0x69, 0xc1, 0xb4, 0x01, 0x04, 0xdd, 0x4e, 0x2f, 0x82,
+    0xcf, 0x4e, 0x2c, 0xb8, 0x7c, 0x24, 0x1a, 0x44, 0x4c, 0x8d, 0x5d, 0x09,
+    0x30, 0x05, 0x00, 0x3a, 0x2f, 0x34, 0xcc, 0x63, 0xba, 0x5e, 0x0f, 0x6e,
+    0x6e, 0x46, 0xd3, 0xb3, 0x90, 0x19, 0x04, 0x99, 0xd0, 0x5b, 0xf4, 0x53,
+    0x63, 0x36, 0x9b, 0xe7, 0x50, 0x8e, 0xc9, 0xbc, 0x06, 0x9a, 0xb3, 0x85,
+    0x53, 0xf7, 0xcd, 0x22, 0x47, 0x18, 0xb1, 0xab, 0x0a, 0xcb, 0xe0, 0x25,
+    0xcb, 0x21, 0x44, 0xd1, 0xc7, 0xa7, 0x52, 0xbc, 0xdf, 0x17, 0xfe, 0x39,
+    0x5f, 0x86, 0xff, 0x02, 0x13, 0x53, 0x26, 0x57, 0xce, 0x45, 0xd8, 0xf6,
+    0x77, 0xa6, 0xb2, 0x15, 0x1e, 0x19, 0x5f, 0x90, 0x54, 0x20, 0x30, 0xa6,
+    0xae, 0x55, 0x8c, 0x4b, 0xd0, 0x68, 0xb6, 0x5e, 0x8f, 0x07, 0x77, 0x0f,
+    0xd7, 0xa3, 0xf1, 0xed, 0x66, 0x83, 0x94, 0x1c, 0x27, 0xdd, 0xb6, 0xa3,
+    0xb0, 0x81, 0xf3, 0xcc, 0x75, 0x85, 0xd9, 0xda, 0x5c, 0x83, 0x31, 0x98,
+    0x31, 0xdd, 0x7a, 0xc4, 0xae, 0x3a, 0x0e, 0x7c, 0x43, 0x62, 0x9a, 0x71,
+    0x53, 0x09, 0xb6, 0x3a, 0x23, 0x52, 0x49, 0xf8, 0x42, 0x93, 0x28, 0x44,
+    0xf4, 0x8b, 0x14, 0x98, 0xce, 0x5c, 0x92, 0xc5, 0x49, 0x72, 0x5b, 0x65,
+    0xcc, 0x02, 0x99, 0xa0, 0x7c, 0xa9, 0x74, 0x86, 0xf1, 0x4e, 0x50, 0x31,
+    0x57, 0xba, 0xf4, 0x01, 0x6b, 0xaf, 0xde, 0x6a, 0x2f, 0x50, 0x4c, 0x9f,
+    0xbb, 0x72, 0x96, 0x41, 0xae, 0x55, 0x5d, 0xf9, 0xc6, 0xb1, 0x19, 0x08,
+    0x82, 0xb2, 0x98, 0x56, 0x2d, 0x86, 0x26, 0x63, 0x58, 0xee, 0xfc, 0x9f,
+    0x45, 0xa1, 0xb7, 0x41, 0x5b, 0x2e, 0xab, 0xda, 0xb6, 0x0c, 0xec, 0x8c,
+    0x7d, 0xd0, 0xfd, 0xad, 0x19, 0xb3, 0xfd, 0xfd, 0x30, 0xa8, 0xeb, 0xa3,
+    0x56, 0x82, 0x22, 0x51, 0x3f, 0x6b, 0xae, 0x21, 0x23, 0x25, 0x97, 0x02,
+    0x64, 0x8e, 0xf3, 0x47, 0x4f, 0x3d, 0x07, 0x9d, 0xc2, 0x5f, 0xcd, 0x16,
+    0x9d, 0xcd, 0xb9, 0x2e, 0x27, 0xbb, 0xa4, 0x87, 0x8d, 0xe0, 0x7d, 0x89,
+    0xbf, 0xf4, 0xd2, 0xe6, 0xdf, 0x11, 0xff, 0x6b, 0x19, 0xb3, 0xda, 0x5a,
+    0x25, 0xf7, 0x85, 0x34, 0xf7, 0x36, 0x25, 0x53, 0xcf, 0x4a, 0x6e, 0x77,
+    0x41, 0x66, 0x56, 0x12, 0xfc, 0x05, 0x95, 0xc6, 0x31, 0xd7, 0x38, 0x9b,
+    0x1d, 0xc6, 0x1b, 0xf4, 0x3e, 0x50, 0xe8, 0xf2, 0xfa, 0x63, 0xdc, 0x83,
+    0xb9, 0x19, 0x4c, 0x2e, 0xc9, 0x54, 0x3d, 0x82, 0x34, 0xed, 0xc8, 0x54,
+    0xc9, 0x50, 0x83, 0x73, 0xec, 0x34, 0xd6, 0x6b, 0xf0, 0x20, 0x2c, 0x4d,
+    0x71, 0x5a, 0x89, 0x2d, 0xb8, 0x21, 0xcd, 0x56, 0x38, 0x32, 0xde, 0x64,
+    0xae, 0x55, 0x49, 0x94, 0x2d, 0x40, 0x13, 0x56, 0x55, 0x82, 0xa7, 0xcc,
+    0x72, 0x25, 0x4d, 0x3f, 0x0a, 0xab, 0xc3, 0x01, 0x4c, 0xbd, 0x53, 0x1f,
+    0xe9, 0x3d, 0xd3, 0xe7, 0x13, 0x18, 0x63, 0xf7, 0x69, 0xe2, 0xb1, 0xc4,
+    0x3d, 0xbf, 0xc2, 0xa1, 0x85, 0x27, 0xdb, 0xf0, 0xb7, 0x47, 0xb5, 0xcc,
+    0x1d, 0x08, 0xde, 0xe4, 0xac, 0x87, 0x6f, 0x5c, 0x0a, 0x85, 0x12, 0x19,
+    0x60, 0x70, 0xe8, 0xe7, 0x7d, 0x72, 0xf4, 0x4d, 0x95, 0xd8, 0x0c, 0x63,
+    0x38, 0xbe, 0xb4, 0xf8, 0x46, 0x5f, 0xe2, 0x82, 0xcc, 0xb5, 0x2f, 0xf2,
+    0xe8, 0x3f, 0xb0, 0xda, 0x36, 0xdf, 0x17, 0xfb, 0x3a, 0xa5, 0xc5, 0xe9,
+    0xd6, 0x41, 0x69, 0x83, 0x13, 0x9a, 0xdc, 0xab, 0x5a, 0xef, 0x69, 0x3c,
+    0x3d, 0xd8, 0x34, 0xbe, 0xf2, 0xe1, 0xc1, 0xaa, 0x42, 0x82, 0xaf, 0x14,
+    0xcb, 0x70, 0x29, 0xb5, 0xec, 0xf6, 0xfb, 0x2d, 0x57, 0xdb, 0x18, 0x6f,
+    0x16, 0x44, 0x9a, 0x80, 0xbd, 0x88, 0xb5, 0xdb, 0x34, 0xec, 0xd4, 0x62,
+    0x00, 0xfb, 0x9a, 0xf9, 0x6a, 0xbe, 0xb2, 0xf4, 0xd1, 0x4d, 0x8f, 0xeb,
+    0x61, 0x14, 0xb2, 0x43, 0x98, 0x50, 0xb9, 0xaa, 0xbb, 0x8d, 0xc8, 0x98,
+    0xcc, 0x5d, 0x9e, 0x57, 0x5e, 0xdd, 0x60, 0x9e, 0x27, 0x66, 0x52, 0xcd,
+    0x2b, 0x4b, 0x8c, 0x4e, 0xbb, 0xab, 0x7c, 0x09, 0xb3, 0x00, 0x29, 0xb4,
+    0x9e, 0xdd, 0xda, 0x72, 0x61, 0xfa, 0x3f, 0xfc, 0x77, 0x25, 0x0a, 0x1b,
+    0xd8, 0x5f, 0xf0, 0xac, 0x59, 0xdb, 0x41, 0x85, 0x6b, 0xb9, 0x8b, 0x0c,
+    0xdb, 0x8f, 0x40, 0xd8, 0x7c, 0x7a, 0x7f, 0x03, 0x3d, 0x93, 0x3f, 0x79,
+    0x93, 0x07, 0x00, 0x00,
+};
+const size_t ACCOUNT_PAGE_HTML_GZ_LEN = 772;
+const char ACCOUNT_PAGE_HTML_HASH[] = "12c6106605e0";
+
 #endif // ACCOUNT_PAGE_HTML_H
@@ -0,0 +1,1831 @@
+// Auto-generated by scripts/generate_web_assets.py - DO NOT EDIT BY HAND
+#ifndef ASSET_BUNDLE_DATA_H
+#define ASSET_BUNDLE_DATA_H
+
+#include <Arduino.h>
+#include "platform/asset_bundle.h"
+
+const char ASSET_BUNDLE_DATA[] PROGMEM =
+    // account_page.js
+    R"(document.addEventListener('DOMContentLoaded',function(){
+loadUserTokens();
+document.getElementById('updatePasswordForm').addEventListener('submit',updatePassword);
+document.getElementById('createTokenForm').addEventListener('submit',createToken);
+async function loadUserTokens(){
+try{
+const userData=await AuthUtils.fetchJSON('/api/user');
+if(userData.success){
+const userId=userData.user.id;
+const tokensData=await AuthUtils.fetchJSON('/api/users/' + userId + '/tokens');
+if(tokensData.success){
+updateTokensTable(tokensData.tokens);
+}
+}else{
+throw new Error('Failed to get current user');
+}
+}catch(error){
+console.error('Error loading tokens:',error);
+}
+}
+function updateTokensTable(tokens){
+const tokenContainer=document.getElementById('tokenContainer');
+if(!tokens||tokens.length===0){
+tokenContainer.innerHTML='<p>No API tokens have been created yet.</p>';
+return;
+}
+let html='<table class="token-table">';
+html +='<tr><th>Name</th><th>Created</th><th>Actions</th></tr>';
+tokens.forEach(token=>{
+html +='<tr>';
+html +='<td>' + escapeHtml(token.name)+ '</td>';
+html +='<td>' + formatTimestamp(token.createdAt)+ '</td>';
+html +='<td><button class="btn btn-danger btn-sm" onclick=deleteToken("' +
+token.id + '") > Delete</ button></ td>';html +=
+'</tr>';
+});
+html +='</table>';
+tokenContainer.innerHTML=html;
+}
+async function updatePassword(e){
+e.preventDefault();
+const password=document.getElementById('password').value;
+const confirmPassword=document.getElementById('confirmPassword').value;
+if(password !==confirmPassword){
+showMessage('Passwords do not match','error');
+return;
+}
+try{
+const data=await AuthUtils.fetchJSON('/api/user',{
+method:'PUT',
+body:JSON.stringify({password:password})
+});
+if(data.success){
+showMessage('Password updated successfully','success');
+document.getElementById('password').value='';
+document.getElementById('confirmPassword').value='';
+}else{
+showMessage(data.message||'Failed to update password','error');
+}
+}catch(error){
+showMessage('An error occurred: ' + error,'error');
+}
+}
+async function createToken(e){
+e.preventDefault();
+const tokenName=document.getElementById('tokenName').value;
+try{
+const userData=await AuthUtils.fetchJSON('/api/user');
+if(userData.success){
+const userId=userData.user.id;
+const tokenData=await AuthUtils.fetchJSON('/api/users/' + userId + '/tokens',{
+method:'POST',
+body:JSON.stringify({name:tokenName})
+});
+if(tokenData.success){
+UIUtils.showTokenModal(tokenData.token);
+document.getElementById('tokenName').value='';
+loadUserTokens();
+}else{
+showMessage(tokenData.message||'Failed to create token','error');
+}
+}else{
+throw new Error('Failed to get current user');
+}
+}catch(error){
+showMessage('An error occurred: ' + error,'error');
+}
+}
+window.deleteToken=function(tokenId){
+UIUtils.showConfirm(
+'Delete Token',
+'Are you sure you want to delete this token? This cannot be undone.',
+async function(){
+try{
+const data=await AuthUtils.fetchJSON('/api/tokens/' + tokenId,{
+method:'DELETE'
+});
+if(data.success){
+showMessage('Token deleted successfully','success');
+loadUserTokens();
+}else{
+showMessage(data.message||'Failed to delete token','error');
+}
+}catch(error){
+showMessage('An error occurred: ' + error,'error');
+}
+},
+null
+);
+};
+function showMessage(message,type){
+const messageEl=document.getElementById('statusMessage');
+messageEl.textContent=message;
+messageEl.className='alert alert-' +(type||'info');
+messageEl.style.display='block';
+setTimeout(()=>{messageEl.style.display='none';},5000);
+}
+function formatTimestamp(timestamp){
+return TimeUtils.formatRelativeTime(timestamp);
+}
+function escapeHtml(text){
+const div=document.createElement('div');
+div.textContent=text;
+return div.innerHTML;
+}
+});)" "\0"
+    "\037\213\010\000\000\000\000\000\002\003\305\127\333\162\342\070"
+    "\020\175\367\127\150\362\042\123\103\114\136\366\005\060\133\154"
+    "\302\324\144\153\162\251\035\362\001\302\152\202\053\266\104\131"
+    "\062\254\213\344\337\267\165\261\261\011\044\324\356\124\355\303"
+    "\060\222\334\335\352\076\072\072\352\160\231\224\071\010\035\061"
+    "\316\147\033\034\374\110\225\006\001\105\110\157\036\356\256\245"
+    "\320\146\115\062\016\234\366\227\245\110\164\052\105\330\333\005"
+    "\031\256\075\051\050\346\362\005\204\012\173\243\200\327\241\236"
+    "\101\317\062\060\303\077\252\133\036\322\162\315\231\206\107\246"
+    "\324\126\026\374\233\054\162\332\073\262\237\052\027\171\252\151"
+    "\277\153\376\121\340\244\000\264\264\031\174\032\265\145\213\041"
+    "\231\252\104\102\352\172\310\141\061\273\100\027\325\056\110\244"
+    "\120\232\224\370\341\206\151\026\263\055\113\065\231\226\172\365"
+    "\244\323\114\105\113\320\311\352\317\237\017\367\041\035\260\165"
+    "\072\060\206\024\203\247\313\260\366\211\124\231\044\240\124\257"
+    "\035\354\226\307\315\167\063\210\122\076\362\237\265\115\340\354"
+    "\335\324\200\222\257\076\046\016\350\300\371\373\044\366\301\132"
+    "\151\070\164\135\241\163\266\310\240\155\346\206\350\375\026\274"
+    "\101\246\000\161\130\025\162\113\004\154\311\254\050\044\342\371"
+    "\215\245\031\160\114\224\340\151\220\244\054\012\204\233\324\245"
+    "\243\137\302\060\317\020\214\265\257\132\146\020\201\363\266\101"
+    "\054\334\251\170\366\325\016\151\337\131\133\367\240\071\224\123"
+    "\231\066\130\332\251\241\050\113\361\250\343\223\064\351\332\171"
+    "\160\276\270\140\257\257\356\377\050\003\361\254\127\161\034\137"
+    "\231\323\357\170\104\251\300\337\357\363\273\037\061\035\257\047"
+    "\367\222\114\037\157\175\362\144\305\066\100\026\000\202\070\206"
+    "\161\122\201\216\306\203\365\204\216\202\002\164\131\010\123\127"
+    "\206\140\255\164\236\141\004\155\152\041\111\206\004\217\057\154"
+    "\224\113\273\164\141\074\214\015\371\152\254\212\311\130\257\046"
+    "\367\054\207\361\000\007\146\162\355\166\150\346\123\013\224\162"
+    "\363\001\172\140\000\137\316\122\026\063\206\347\140\247\361\144"
+    "\327\011\334\331\207\117\014\207\100\045\154\015\337\161\325\271"
+    "\104\002\067\356\041\245\060\056\077\346\200\033\344\114\317\323"
+    "\034\224\146\371\332\173\171\014\246\372\224\353\170\121\152\215"
+    "\207\353\313\137\150\101\360\337\045\147\342\031\012\073\124\371"
+    "\005\221\042\311\322\344\045\346\200\270\071\012\204\027\270\253"
+    "\253\016\357\213\041\373\105\217\114\310\215\265\030\017\210\213"
+    "\213\060\020\273\251\337\063\240\065\056\157\275\126\042\003\013"
+    "\170\003\327\261\223\066\266\346\340\016\224\242\053\116\041\040"
+    "\131\040\132\027\140\104\347\006\226\254\314\264\321\102\107\320"
+    "\265\067\073\115\315\332\002\245\153\303\262\022\152\117\374\135"
+    "\246\105\376\370\151\200\003\303\175\034\244\170\035\234\174\211"
+    "\343\003\073\114\133\255\344\366\016\065\201\075\103\110\353\165"
+    "\105\270\044\102\152\222\233\133\114\373\324\336\114\163\145\366"
+    "\124\156\111\043\077\133\026\373\273\040\007\275\222\174\110\037"
+    "\237\346\264\037\054\044\257\206\306\052\122\272\100\061\110\227"
+    "\125\270\253\063\036\326\203\267\236\075\070\054\206\167\145\354"
+    "\150\366\376\164\070\361\166\313\062\313\052\054\302\117\351\107"
+    "\157\311\341\111\304\224\176\364\362\034\207\335\072\171\345\154"
+    "\147\150\223\317\335\344\365\265\245\241\056\341\206\050\155\300"
+    "\337\111\151\247\344\251\040\166\235\310\304\152\060\037\022\173"
+    "\215\315\132\067\310\041\203\133\017\341\047\364\265\167\303\010"
+    "\320\047\322\152\114\366\304\373\077\137\316\377\374\160\266\151"
+    "\372\360\363\044\117\215\070\016\233\332\367\044\155\222\150\145"
+    "\377\164\353\322\060\307\147\121\277\223\234\145\055\123\355\173"
+    "\222\363\101\266\064\173\337\200\035\041\336\176\227\143\354\163"
+    "\124\160\320\035\120\357\327\274\376\377\226\262\333\124\160\271"
+    "\215\132\362\037\067\275\247\315\366\226\037\040\173\355\056\144"
+    "\030\120\367\042\220\271\053\052\240\323\002\110\045\113\324\004"
+    "\077\330\062\141\350\102\134\164\242\127\251\162\020\374\116\346"
+    "\146\234\060\141\024\160\001\244\304\054\004\104\030\245\173\207"
+    "\016\032\304\263\124\320\021\314\322\316\127\320\342\332\315\354"
+    "\307\154\076\243\347\150\235\255\313\347\376\221\320\235\105\217"
+    "\223\272\124\143\163\204\031\277\344\204\373\201\300\224\003\063"
+    "\031\355\073\276\166\060\237\125\137\127\153\150\064\300\057\316"
+    "\262\323\212\204\335\210\056\225\217\142\166\153\174\042\015\177"
+    "\153\377\027\115\354\127\333\237\155\113\142\345\216\262\014\012"
+    "\115\354\357\045\126\020\232\044\020\237\124\054\145\067\244\322"
+    "\025\066\267\074\125\353\214\125\061\135\144\062\171\301\273\251"
+    "\300\166\106\262\324\141\330\303\356\353\244\203\100\176\321\321"
+    "\133\377\267\253\253\053\213\114\203\305\273\376\252\036\041\030"
+    "\356\055\046\346\243\047\233\065\376\013\062\246\323\015\230\365"
+    "\226\175\047\154\273\317\103\070\032\144\171\272\331\143\352\164"
+    "\301\303\032\122\374\146\237\316\164\323\201\320\214\353\276\300"
+    "\370\357\233\047\173\304\275\321\077\134\065\320\262\134\016\000"
+    "\000"
+    // favicon.svg
+    R"(<svg xmlns='http://www.w3.org/2000/svg' viewBox='0 0 32 32' width='32' height='32'>
+<defs>
+<radialGradient id='bg' cx='50%' cy='30%' r='70%'>
+<stop offset='0%' style='stop-color:#4a90e2;stop-opacity:1' />
+<stop offset='100%' style='stop-color:#2c3e50;stop-opacity:1' />
+</radialGradient>
+<linearGradient id='spark' x1='0%' y1='0%' x2='100%' y2='100%'>
+<stop offset='0%' style='stop-color:#ffd700;stop-opacity:1' />
+<stop offset='50%' style='stop-color:#ff8c00;stop-opacity:1' />
+<stop offset='100%' style='stop-color:#ff4500;stop-opacity:1' />
+</linearGradient>
+</defs>
+<circle cx='16' cy='16' r='15' fill='url(#bg)' stroke='#34495e' stroke-width='1'/>
+<path d='M12 8 L20 14 L15 14 L20 24 L12 18 L17 18 Z' fill='url(#spark)' stroke='#ffd700' stroke-width='0.5'/>
+<circle cx='8' cy='10' r='1' fill='#ffd700' opacity='0.8'>
+<animate attributeName='opacity' values='0.8;0.3;0.8' dur='2s' repeatCount='indefinite'/>
+</circle>
+<circle cx='24' cy='14' r='0.8' fill='#ff8c00' opacity='0.6'>
+<animate attributeName='opacity' values='0.6;0.2;0.6' dur='2.5s' repeatCount='indefinite'/>
+</circle>
+<circle cx='6' cy='22' r='0.6' fill='#ff4500' opacity='0.7'>
+<animate attributeName='opacity' values='0.7;0.1;0.7' dur='1.8s' repeatCount='indefinite'/>
+</circle>
+<circle cx='26' cy='8' r='0.5' fill='#ffd700' opacity='0.5'>
+<animate attributeName='opacity' values='0.5;0.1;0.5' dur='3s' repeatCount='indefinite'/>
+</circle>
+</svg>)" "\0"
+    "\037\213\010\000\000\000\000\000\002\003\235\224\301\216\233\060"
+    "\020\206\357\175\012\113\321\312\355\141\301\066\070\260\141\331"
+    "\303\366\320\313\266\017\320\233\003\046\130\353\000\062\316\022"
+    "\336\276\143\160\126\141\325\264\311\112\221\306\014\236\377\377"
+    "\074\143\362\330\277\355\320\161\257\233\076\307\265\265\335\046"
+    "\014\207\141\010\206\050\150\315\056\144\204\220\020\166\140\364"
+    "\246\344\360\334\036\163\114\020\101\021\203\037\106\203\052\155"
+    "\235\143\267\254\245\332\325\166\132\077\175\171\054\145\325\103"
+    "\060\242\124\102\377\160\101\066\026\251\062\307\133\220\052\100"
+    "\205\223\073\130\214\120\340\026\046\307\011\104\050\351\155\333"
+    "\241\266\252\172\011\142\356\125\157\107\055\163\354\362\367\105"
+    "\253\133\263\131\305\342\201\110\226\115\251\266\023\205\262\343"
+    "\206\142\024\176\054\247\344\202\000\053\042\311\311\137\005\302"
+    "\045\063\144\264\152\244\060\213\103\364\235\060\257\030\035\351"
+    "\214\070\372\170\144\047\317\361\264\272\362\104\125\125\046\204"
+    "\374\377\104\374\142\175\132\134\123\177\261\043\125\025\363\013"
+    "\002\341\262\001\056\343\307\133\050\123\150\071\215\223\256\347"
+    "\151\272\010\303\244\034\243\112\151\235\343\203\321\137\127\333"
+    "\335\067\347\152\332\127\260\135\105\161\374\300\345\051\161\357"
+    "\057\021\305\316\254\023\266\106\320\341\237\224\241\024\275\060"
+    "\202\150\214\136\050\237\002\074\061\367\304\020\205\167\064\161"
+    "\341\367\302\150\032\314\271\327\334\330\217\136\044\340\223\333"
+    "\331\001\122\317\117\146\376\223\352\273\200\157\212\253\115\335"
+    "\124\105\243\366\302\112\044\254\065\152\173\260\362\227\330\203"
+    "\241\337\006\237\213\320\007\331\117\333\063\022\104\231\053\103"
+    "\345\001\264\131\017\026\262\223\302\176\157\017\015\014\105\065"
+    "\320\117\325\050\053\047\250\160\246\132\342\261\330\363\305\023"
+    "\337\244\366\116\350\146\277\040\134\337\106\270\006\072\226\271"
+    "\062\117\030\360\317\060\372\053\300\230\107\134\237\041\272\333"
+    "\265\100\114\156\103\114\000\217\146\256\154\106\244\101\372\251"
+    "\066\172\306\324\043\362\177\315\231\337\206\310\075\042\367\210"
+    "\321\325\200\356\017\366\351\017\372\135\032\272\210\005\000\000"
+    // home_page.js
+    R"(document.addEventListener('DOMContentLoaded',function(){
+loadHomePageData();
+async function loadHomePageData(){
+try{
+const systemData=await AuthUtils.fetchJSON('/api/system');
+if(systemData.success){
+updateSystemInfo(systemData.status);
+}
+}catch(error){
+console.error('Error fetching system data:',error);
+}
+try{
+const networkData=await AuthUtils.fetchJSON('/api/network');
+if(networkData.success){
+updateNetworkInfo(networkData.network);
+}
+}catch(error){
+console.error('Error fetching network data:',error);
+}
+try{
+const modulesData=await AuthUtils.fetchJSON('/api/modules');
+if(modulesData.success){
+updateModuleList(modulesData.modules);
+}
+}catch(error){
+console.error('Error fetching modules data:',error);
+}
+}
+function updateSystemInfo(status){
+document.getElementById('uptime').textContent=formatUptime(status.uptime);
+document.getElementById('freeMemory').textContent=Math.round(status.memory.freeHeap / 1024);
+document.getElementById('serverProtocol').textContent=status.platform.httpsEnabled?'HTTPS (Secure)':'HTTP';
+document.getElementById('serverPort').textContent=status.platform.serverPort;
+document.getElementById('hostname').textContent=status.platform.hostname;
+}
+function updateNetworkInfo(network){
+document.getElementById('wifiSsid').textContent=network.ssid;
+document.getElementById('ipAddress').textContent=network.ipAddress;
+document.getElementById('signalStrength').textContent=network.signalStrength;
+}
+function updateModuleList(modules){
+const moduleListContainer=document.getElementById('moduleList');
+moduleListContainer.innerHTML='';
+if(modules.length===0){
+moduleListContainer.innerHTML='<p>No modules registered.</p>';
+return;
+}
+modules.forEach(module=>{
+const moduleItem=document.createElement('div');
+moduleItem.className='module-item';
+const moduleInfo=document.createElement('div');
+const moduleName=document.createElement('strong');
+moduleName.textContent=module.name;
+moduleInfo.appendChild(moduleName);
+const moduleVersion=document.createElement('small');
+moduleVersion.textContent=' v' + module.version;
+moduleInfo.appendChild(moduleVersion);
+const moduleAction=document.createElement('div');
+const moduleLink=document.createElement('a');
+moduleLink.href=module.basePath;
+let basePath=module.basePath;
+if(!basePath.endsWith('/')){
+basePath +='/';
+}
+moduleLink.href=basePath;
+moduleLink.className='btn btn-secondary';
+moduleLink.textContent='Open';
+moduleAction.appendChild(moduleLink);
+moduleItem.appendChild(moduleInfo);
+moduleItem.appendChild(moduleAction);
+moduleListContainer.appendChild(moduleItem);
+});
+}
+function formatUptime(seconds){
+const days=Math.floor(seconds / 86400);
+seconds %=86400;
+const hours=Math.floor(seconds / 3600);
+seconds %=3600;
+const minutes=Math.floor(seconds / 60);
+seconds %=60;
+let result='';
+if(days > 0)result +=days + 'd ';
+if(hours > 0||days > 0)result +=hours + 'h ';
+if(minutes > 0||hours > 0||days > 0)result +=minutes + 'm ';
+result +=seconds + 's';
+return result;
+}
+});)" "\0"
+    "\037\213\010\000\000\000\000\000\002\003\225\126\301\156\333\070"
+    "\020\275\373\053\270\207\102\022\322\062\336\335\042\130\064\125"
+    "\026\331\326\100\262\210\223\000\116\273\147\106\034\133\104\044"
+    "\122\040\051\247\106\232\177\337\241\104\131\222\145\331\315\301"
+    "\266\304\171\357\315\074\162\110\232\253\244\314\101\132\312\070"
+    "\237\255\361\341\106\030\013\022\164\030\174\275\233\177\121\322"
+    "\272\061\305\070\360\340\375\262\224\211\025\112\206\321\313\044"
+    "\303\261\053\225\303\075\133\301\127\146\131\030\235\117\230\331"
+    "\310\204\064\050\062\204\274\114\254\336\274\114\022\045\215\045"
+    "\146\203\231\162\027\210\331\063\023\226\134\226\066\375\146\105"
+    "\146\350\022\154\222\376\273\270\273\015\203\123\126\210\323\032"
+    "\032\140\012\261\014\133\036\065\145\222\200\061\250\133\026\234"
+    "\131\130\124\241\153\271\124\075\224\145\266\064\110\176\235\274"
+    "\046\014\225\103\320\132\351\250\056\104\145\100\253\367\060\230"
+    "\271\037\122\045\027\162\345\013\044\050\314\076\005\357\153\216"
+    "\023\351\170\220\140\237\225\176\372\045\023\036\353\135\164\230"
+    "\003\033\267\165\254\362\321\305\371\347\267\073\361\304\203\126"
+    "\162\305\313\014\314\057\131\361\130\157\245\303\034\130\231\127"
+    "\061\327\124\075\230\177\176\273\023\117\034\072\171\235\154\373"
+    "\156\330\013\165\003\274\114\170\323\355\053\260\263\014\334\343"
+    "\077\233\153\036\006\145\141\105\016\101\104\055\374\260\276\353"
+    "\343\245\322\071\263\337\252\220\327\240\065\020\063\216\112\055"
+    "\065\300\034\162\245\067\073\162\163\146\123\252\125\051\171\043"
+    "\226\127\060\352\030\127\300\012\162\112\176\237\376\361\361\220"
+    "\270\001\275\006\175\257\225\125\211\312\166\022\170\325\042\143"
+    "\326\225\116\123\153\013\063\223\354\061\003\376\167\160\365\360"
+    "\160\277\040\341\002\222\122\103\024\174\252\006\202\343\271\224"
+    "\266\107\362\264\300\003\152\251\062\126\262\301\034\017\152\366"
+    "\260\363\341\202\356\331\025\207\226\364\131\054\305\302\010\276"
+    "\223\320\063\251\301\320\201\162\105\161\311\271\306\116\036\241"
+    "\157\343\207\046\120\254\044\313\026\126\203\134\331\164\254\216"
+    "\036\150\217\355\341\016\212\372\133\326\205\234\052\023\170\154"
+    "\307\243\325\264\140\267\155\367\120\251\220\370\175\365\060\277"
+    "\211\203\240\273\261\151\126\325\026\307\361\024\123\037\141\176"
+    "\056\056\156\325\166\233\152\130\271\373\104\003\247\237\117\213"
+    "\013\224\325\140\113\055\235\317\106\035\327\175\306\360\000\250"
+    "\337\343\213\276\273\153\334\304\255\251\104\003\116\211\367\025"
+    "\006\134\254\133\063\016\111\223\214\031\163\213\015\024\173\303"
+    "\037\204\273\071\316\373\232\330\102\307\064\273\370\112\157\014"
+    "\157\254\126\162\325\226\341\300\275\225\256\207\151\335\325\155"
+    "\001\224\025\005\110\376\045\025\031\017\133\352\116\352\357\240"
+    "\015\366\302\170\366\234\145\131\233\334\303\173\371\003\262\016"
+    "\310\211\327\243\353\032\161\244\022\257\263\123\314\145\325\227"
+    "\157\231\271\033\041\237\106\361\254\333\210\362\211\246\032\226"
+    "\315\154\075\062\203\377\033\334\206\310\300\222\346\155\030\305"
+    "\056\375\255\171\243\150\302\374\047\154\212\267\124\020\141\253"
+    "\066\001\162\022\343\110\333\163\155\266\126\250\023\351\364\320"
+    "\243\225\004\077\037\014\240\053\316\360\114\357\041\173\323\174"
+    "\207\223\270\015\327\123\265\147\146\035\257\337\262\103\214\133"
+    "\224\143\230\072\301\310\116\336\043\211\052\356\236\214\172\047"
+    "\114\377\206\253\074\266\247\013\147\033\123\137\132\313\114\341"
+    "\125\354\343\170\113\375\165\366\161\072\105\245\146\344\135\134"
+    "\215\064\113\237\252\122\217\060\377\074\333\041\272\201\155\313"
+    "\010\131\132\030\141\236\365\171\147\323\272\063\360\010\056\063"
+    "\333\034\130\256\144\162\101\246\121\075\214\353\136\215\234\220"
+    "\200\223\032\121\325\346\040\077\177\016\301\165\020\321\251\107"
+    "\373\212\152\374\101\152\203\104\162\116\252\143\316\007\232\222"
+    "\061\140\266\307\237\057\273\372\337\022\235\377\017\177\054\175"
+    "\153\204\013\000\000"
+    // style.css
+    R"(*{box-sizing:border-box;margin:0;padding:0}body{font-family:'Segoe UI',Tahoma,Geneva,Verdana,sans-serif;margin:0;padding:20px;background:linear-gradient(135deg,#667eea 0%,#764ba2 100%);min-height:100vh;color:white}.container{max-width:800px;margin:0 auto;background:rgba(255,255,255,0.1);padding:30px;border-radius:15px;backdrop-filter:blur(10px);box-shadow:0 8px 32px rgba(0,0,0,0.3)}h1{text-align:center;margin-bottom:30px;font-size:2.5em;text-shadow:2px 2px 4px rgba(0,0,0,0.3)}h2{margin-bottom:20px;font-size:2em;text-shadow:1px 1px 2px rgba(0,0,0,0.3)}h3{margin:0 0 10px 0;color:#fff;font-size:1.2em}p{margin:5px 0;opacity:0.9}.status-grid{display:grid;grid-template-columns:repeat(auto-fit,minmax(250px,1fr));gap:20px;margin-bottom:30px}.status-card{background:rgba(255,255,255,0.15);padding:20px;border-radius:10px;border:1px solid rgba(255,255,255,0.2);margin-bottom:20px}.status-card h3{margin:0 0 10px 0;color:#fff;font-size:1.2em}.success{color:#66D56A;font-weight:bold;text-shadow:0 1px 3px rgba(0,0,0,0.3),0 0 8px rgba(102,213,106,0.3)}.info{color:#2196F3;font-weight:bold}.warning{color:#FF9800;font-weight:bold}.error{color:#f44336;font-weight:bold}.form-group{margin-bottom:15px}label{display:block;margin-bottom:8px;font-weight:bold;color:#fff}.form-control{width:100%;padding:12px;border:1px solid rgba(255,255,255,0.3);border-radius:8px;box-sizing:border-box;background:rgba(255,255,255,0.1);color:white;backdrop-filter:blur(5px)}.form-control::placeholder{color:rgba(255,255,255,0.6);opacity:1}.form-control:focus{outline:none;border-color:rgba(255,255,255,0.5);background:rgba(255,255,255,0.15)}.form-control option{background:#764ba2;color:white}.button-group{display:flex;gap:15px;margin-top:20px;justify-content:center;flex-wrap:wrap}.btn{padding:12px 24px;border:none;border-radius:25px;cursor:pointer;font-weight:bold;transition:all 0.3s ease;border:1px solid rgba(255,255,255,0.3);text-decoration:none;display:inline-block;text-align:center}.btn:hover:not(:disabled){transform:translateY(-2px)}.btn:disabled{opacity:0.5;cursor:not-allowed}.btn-primary{background:rgba(76,175,80,0.8);color:white}.btn-primary:hover:not(:disabled){background:rgba(76,175,80,1)}.btn-secondary{background:rgba(255,255,255,0.2);color:white}.btn-secondary:hover:not(:disabled){background:rgba(255,255,255,0.3)}.btn-warning{background:rgba(255,152,0,0.8);color:white}.btn-warning:hover:not(:disabled){background:rgba(255,152,0,1)}.btn-danger{background:rgba(244,67,54,0.8);color:white}.btn-danger:hover:not(:disabled){background:rgba(244,67,54,1)}.nav-links{display:flex;justify-content:center;gap:20px;margin-top:15px;margin-bottom:15px;flex-wrap:wrap}.nav-links a{background:rgba(255,255,255,0.2);color:white;text-decoration:none;padding:12px 24px;border-radius:25px;border:1px solid rgba(255,255,255,0.3);transition:all 0.3s ease}.nav-links a:hover{background:rgba(255,255,255,0.3);transform:translateY(-2px)}.status-message{padding:15px;border-radius:10px;margin-top:15px;font-weight:bold;background:rgba(255,255,255,0.1);border:1px solid rgba(255,255,255,0.2)}.status-message.error{background:rgba(244,67,54,0.2);border-color:rgba(244,67,54,0.5);color:#ffcdd2}.status-message.success{background:rgba(76,175,80,0.2);border-color:rgba(76,175,80,0.5);color:#c8e6c9}.status-message.info{background:rgba(33,150,243,0.2);border-color:rgba(33,150,243,0.5);color:#bbdefb}.status-message.warning{background:rgba(255,152,0,0.2);border-color:rgba(255,152,0,0.5);color:#ffe0b2}.hidden{display:none !important}.text-center{text-align:center}.text-left{text-align:left}.text-right{text-align:right}.mb-0{margin-bottom:0}.mb-1{margin-bottom:10px}.mb-2{margin-bottom:20px}.mb-3{margin-bottom:30px}.mt-0{margin-top:0}.mt-1{margin-top:10px}.mt-2{margin-top:20px}.mt-3{margin-top:30px}.footer{text-align:center;margin-top:40px;opacity:0.7;font-size:0.9em}@media (max-width:600px){.container{padding:20px;margin:10px}h1{font-size:2em}.status-grid{grid-template-columns:1fr;gap:15px}.nav-links{flex-direction:column;align-items:center}.button-group{flex-direction:column;align-items:center}.btn{width:100%;max-width:300px}}@keyframes pulse{0%{opacity:1}50%{opacity:0.5}100%{opacity:1}}.loading{animation:pulse 1.5s ease-in-out infinite}@keyframes spin{0%{transform:rotate(0deg)}100%{transform:rotate(360deg)}}.spinning{animation:spin 1s linear infinite}.error-page{text-align:center;padding:40px 20px}.error-page h1{font-size:3em;margin-bottom:20px;color:#fff;text-shadow:2px 2px 4px rgba(0,0,0,0.5)}.error-description{font-size:1.2em;margin-bottom:30px;color:rgba(255,255,255,0.9);line-height:1.5}.error-actions{display:flex;gap:20px;justify-content:center;flex-wrap:wrap;margin-top:30px}.error-actions .btn{min-width:150px}@media (max-width:600px){.error-page h1{font-size:2.5em}.error-description{font-size:1em}.error-actions{flex-direction:column;align-items:center}.error-actions .btn{width:100%;max-width:300px}}.modal-overlay{position:fixed;top:0;left:0;width:100%;height:100%;background:rgba(0,0,0,0.7);backdrop-filter:blur(5px);display:flex;justify-content:center;align-items:center;z-index:1000;animation:modalFadeIn 0.3s ease-out}@keyframes modalFadeIn{from{opacity:0}to{opacity:1}}.modal-container{animation:modalSlideIn 0.3s ease-out}@keyframes modalSlideIn{from{opacity:0;transform:translateY(-50px) scale(0.9)}to{opacity:1;transform:translateY(0) scale(1)}}.modal-content{background:rgba(255,255,255,0.15);backdrop-filter:blur(15px);border:1px solid rgba(255,255,255,0.3);border-radius:15px;max-width:500px;width:90vw;max-height:80vh;overflow:hidden;box-shadow:0 8px 32px rgba(0,0,0,0.4)}.modal-header{padding:20px 25px 15px;border-bottom:1px solid rgba(255,255,255,0.2);display:flex;justify-content:space-between;align-items:center}.modal-title{color:#fff;font-size:1.4em;margin:0;font-weight:500}.modal-close{background:none;border:none;color:rgba(255,255,255,0.8);font-size:24px;cursor:pointer;padding:0;width:30px;height:30px;display:flex;align-items:center;justify-content:center;border-radius:50%;transition:all 0.3s ease}.modal-close:hover{background:rgba(255,255,255,0.2);color:#fff}.modal-body{padding:20px 25px;color:#fff;max-height:400px;overflow-y:auto}.modal-footer{padding:15px 25px 20px;border-top:1px solid rgba(255,255,255,0.2);display:flex;justify-content:flex-end;gap:10px}.alert{padding:15px;border-radius:8px;margin-bottom:15px;border:1px solid transparent}.alert-success{background:rgba(76,175,80,0.2);border-color:rgba(76,175,80,0.4);color:#c8e6c9}.alert-info{background:rgba(33,150,243,0.2);border-color:rgba(33,150,243,0.4);color:#bbdefb}.alert-warning{background:rgba(255,152,0,0.2);border-color:rgba(255,152,0,0.4);color:#ffe0b2}.alert-danger{background:rgba(244,67,54,0.2);border-color:rgba(244,67,54,0.4);color:#ffcdd2}@media (max-width:600px){.modal-content{width:95vw;margin:10px}.modal-header{padding:15px 20px 10px}.modal-title{font-size:1.2em}.modal-body{padding:15px 20px}.modal-footer{padding:10px 20px 15px;flex-direction:column}.modal-footer .btn{width:100%;margin:5px 0}.token-display-box{flex-direction:column;gap:10px}.btn-copy{width:100%}}.status-value{color:rgba(255,255,255,0.9);font-weight:500;padding:5px 0}table{width:100%;border-collapse:collapse;margin-top:10px}th,td{padding:8px 12px;text-align:left;border-bottom:1px solid rgba(255,255,255,0.1);color:rgba(255,255,255,0.9)}th{font-weight:bold;color:#fff;background:rgba(255,255,255,0.05)}tr:hover{background:rgba(255,255,255,0.05)}.auth-body{background:linear-gradient(135deg,#667eea 0%,#764ba2 100%)}.auth-card{background:rgba(255,255,255,0.1);border-radius:15px;box-shadow:0 8px 32px rgba(0,0,0,0.3);border:1px solid rgba(255,255,255,0.2)}.auth-header{background:rgba(255,255,255,0.05);border-bottom:1px solid rgba(255,255,255,0.1)}.auth-title{color:#fff;font-weight:600}.auth-subtitle{color:rgba(255,255,255,0.8)}.auth-footer{background:rgba(0,0,0,0.1);border-top:1px solid rgba(255,255,255,0.1)}.auth-note{color:rgba(255,255,255,0.7)}.network-list{border:1px solid rgba(255,255,255,0.2);background:rgba(0,0,0,0.1);backdrop-filter:blur(5px)}.network-item{background:rgba(255,255,255,0.08);border:1px solid rgba(255,255,255,0.2);border-radius:10px;box-shadow:0 3px 6px rgba(0,0,0,0.15)}.network-item:hover{background:rgba(255,255,255,0.15);border-color:rgba(255,255,255,0.3);box-shadow:0 5px 10px rgba(0,0,0,0.2)}.network-item.selected{background:rgba(76,175,80,0.25);border-color:rgba(76,175,80,0.7);box-shadow:0 5px 15px rgba(76,175,80,0.4)}.network-name{color:#fff}.network-meta{color:rgba(255,255,255,0.7)}.security-icon{filter:drop-shadow(0 1px 2px rgba(0,0,0,0.3))}.signal-strength{color:#66D56A;text-shadow:0 1px 3px rgba(0,0,0,0.3),0 0 8px rgba(102,213,106,0.3)}.scan-button.scanning{background:rgba(255,152,0,0.8);color:white}.wifi-setup{background:rgba(255,255,255,0.1);border-radius:12px;border:1px solid rgba(255,255,255,0.2)}.wifi-setup h3{color:#fff}.password-toggle{background:rgba(33,150,243,0.1);border:1px solid rgba(33,150,243,0.3);color:#2196F3;border-radius:4px;backdrop-filter:blur(5px)}.password-toggle:hover{background:rgba(33,150,243,0.2);border-color:rgba(33,150,243,0.5);color:#1976D2}.network-list .loading,.network-list .error{color:rgba(255,255,255,0.7)}.network-list .loading::before{border:3px solid rgba(255,255,255,0.3);border-top:3px solid #2196F3})" "\0"
+    "\037\213\010\000\000\000\000\000\002\003\255\132\133\217\243\270"
+    "\022\376\053\034\215\106\033\216\040\342\232\244\341\145\127\132"
+    "\315\152\237\367\354\112\373\150\300\044\234\006\214\214\323\351"
+    "\136\224\377\176\312\066\027\163\113\350\071\243\121\167\047\120"
+    "\256\052\327\315\137\225\347\337\115\104\336\315\072\373\047\053"
+    "\317\101\104\150\202\251\011\117\302\002\321\163\126\006\126\130"
+    "\241\044\341\357\254\173\104\222\217\046\045\045\063\123\124\144"
+    "\371\107\360\323\037\370\114\260\366\347\357\077\031\377\101\027"
+    "\122\040\343\067\134\342\067\144\374\205\151\202\112\144\324\250"
+    "\254\315\032\323\054\235\363\163\254\352\075\214\120\374\172\246"
+    "\344\132\046\101\236\225\030\121\363\114\121\222\341\222\355\154"
+    "\327\117\360\331\370\162\070\034\061\106\232\365\325\370\162\074"
+    "\170\021\162\064\333\262\276\352\141\221\225\346\005\147\347\013"
+    "\013\340\301\333\045\214\111\116\150\160\273\144\014\337\367\061"
+    "\250\211\200\043\155\012\364\156\336\262\204\135\202\223\305\105"
+    "\166\212\150\350\312\210\252\000\075\107\150\347\370\276\321\375"
+    "\130\173\133\357\325\165\205\272\322\076\134\305\153\035\330\176"
+    "\273\203\204\222\312\114\263\234\141\032\104\371\225\356\154\040"
+    "\326\103\141\330\013\112\310\015\244\235\252\167\315\165\340\227"
+    "\020\143\031\342\337\336\325\357\027\273\141\370\235\231\050\317"
+    "\316\145\020\303\326\061\155\225\004\107\060\106\012\051\133\030"
+    "\036\374\204\003\147\357\343\042\024\213\132\366\234\057\377\361"
+    "\226\370\073\315\230\233\063\341\066\341\145\003\017\273\345\067"
+    "\343\345\066\275\371\054\215\357\122\263\132\273\177\111\323\124"
+    "\341\152\357\201\357\275\352\310\175\101\111\052\024\147\354\043"
+    "\260\366\057\367\175\315\020\273\326\340\357\054\151\222\254\256"
+    "\162\364\021\360\057\041\377\145\062\134\300\023\206\115\340\176"
+    "\055\312\072\240\270\302\210\355\270\323\300\324\314\000\367\203"
+    "\147\301\137\240\204\141\247\124\327\303\063\252\344\346\346\326"
+    "\353\305\305\210\046\315\023\247\373\372\044\110\307\136\037\036"
+    "\011\133\325\044\317\022\155\201\217\243\207\163\303\217\024\321"
+    "\076\153\317\175\175\215\143\134\327\115\113\163\070\374\352\037"
+    "\176\221\144\067\231\013\021\311\223\221\077\055\341\115\167\356"
+    "\115\203\313\074\165\317\155\313\061\034\333\065\154\353\040\175"
+    "\275\317\312\224\164\202\034\373\345\360\315\235\011\272\357\157"
+    "\210\226\140\250\216\356\333\267\027\310\262\005\072\114\051\241"
+    "\035\125\352\171\256\173\130\240\112\011\055\114\356\231\152\022"
+    "\263\074\325\356\071\212\160\336\307\112\224\223\370\165\142\341"
+    "\123\027\331\252\061\006\173\266\002\170\155\240\044\157\144\125"
+    "\340\325\244\367\267\355\154\164\256\253\117\302\342\044\026\056"
+    "\125\322\247\045\106\051\134\313\345\004\066\257\217\165\017\002"
+    "\260\101\214\057\260\077\334\231\165\201\371\101\357\163\316\236"
+    "\060\110\111\174\255\033\162\145\274\356\006\045\051\161\267\241"
+    "\125\156\220\027\117\063\147\054\105\043\025\313\110\251\046\134"
+    "\133\304\307\325\072\272\202\373\312\326\363\235\203\323\034\277"
+    "\213\234\026\165\266\165\064\043\155\216\377\367\132\263\054\375"
+    "\020\222\240\146\166\205\223\057\062\157\024\126\361\137\300\231"
+    "\225\215\352\134\315\361\006\017\253\273\156\335\350\160\131\361"
+    "\225\326\240\134\105\062\311\163\226\136\024\316\265\214\357\054"
+    "\100\171\256\101\064\324\032\106\065\336\032\071\042\075\023\034"
+    "\023\212\004\023\241\107\267\355\254\344\036\061\145\170\317\116"
+    "\006\261\243\340\102\336\204\372\154\027\300\062\024\345\070\321"
+    "\033\241\025\267\176\040\076\361\352\371\367\316\164\104\354\360"
+    "\105\035\145\063\224\141\277\333\052\260\002\061\071\271\341\104"
+    "\020\233\025\315\300\342\037\263\122\171\074\030\366\321\067\116"
+    "\274\204\234\364\211\027\207\165\313\032\256\063\263\245\216\200"
+    "\025\300\237\311\222\340\131\155\235\211\356\327\156\023\076\365"
+    "\212\144\322\325\263\045\152\333\167\214\265\175\267\353\266\213"
+    "\226\314\272\175\003\132\072\103\042\317\010\075\317\070\034\015"
+    "\337\133\221\052\227\155\024\332\363\342\102\113\364\146\102\234"
+    "\275\326\343\164\133\311\252\351\311\312\263\120\315\112\245\112"
+    "\317\062\260\227\244\241\117\071\165\071\113\326\162\171\224\277"
+    "\133\323\160\045\215\107\072\113\343\076\215\236\360\121\366\265"
+    "\107\176\001\047\067\072\343\241\036\371\313\340\142\152\344\131"
+    "\375\171\172\242\154\203\047\123\305\332\103\372\121\020\072\372"
+    "\322\051\241\020\370\372\160\336\306\111\342\314\144\164\010\346"
+    "\121\141\131\224\242\022\014\122\342\023\076\304\057\063\051\002"
+    "\273\114\105\270\200\156\174\313\160\074\167\115\306\210\142\020"
+    "\022\105\011\116\243\231\220\055\265\142\331\140\012\201\152\060"
+    "\154\105\140\260\113\226\044\270\354\363\222\207\275\366\257\254"
+    "\250\010\145\250\144\367\275\310\013\231\230\315\302\371\040\036"
+    "\345\070\145\352\113\376\275\175\105\171\034\251\357\304\203\373"
+    "\276\210\114\153\202\272\054\361\324\236\142\061\001\143\341\305"
+    "\122\143\041\136\270\315\022\002\057\330\040\200\307\266\045\036"
+    "\331\352\043\273\043\164\232\311\171\057\236\272\352\123\311\064"
+    "\045\144\321\016\152\022\171\074\251\206\103\357\250\300\152\350"
+    "\104\000\126\377\134\340\044\103\332\156\150\025\017\274\125\324"
+    "\033\245\215\034\165\004\055\150\027\352\102\377\066\152\246\306"
+    "\235\315\162\063\003\375\112\217\154\324\132\054\152\147\222\121"
+    "\034\213\252\044\311\103\261\057\023\112\142\121\017\050\100\105"
+    "\114\237\130\006\160\110\201\275\303\206\135\276\341\373\375\347"
+    "\127\374\221\122\004\021\256\125\327\274\306\215\365\265\031\020"
+    "\244\257\174\203\310\275\163\036\312\353\373\076\047\210\033\251"
+    "\101\045\240\000\241\213\340\242\331\173\137\226\126\023\134\002"
+    "\230\123\203\374\314\112\176\214\051\002\353\052\053\271\274\241"
+    "\222\122\002\226\304\073\053\301\147\135\012\233\275\163\017\362"
+    "\055\130\035\226\227\143\341\374\221\146\327\232\034\055\014\102"
+    "\145\241\063\053\136\214\347\221\323\171\232\207\215\046\143\157"
+    "\240\327\106\356\166\241\167\136\150\256\225\016\156\123\227\316"
+    "\141\263\024\221\340\072\246\231\004\315\223\346\157\151\046\260"
+    "\012\325\137\364\120\240\310\156\100\002\316\152\045\040\021\043"
+    "\365\034\145\157\107\325\341\054\013\107\254\065\021\145\174\074"
+    "\323\106\032\157\321\037\344\330\232\161\305\230\343\211\141\006"
+    "\202\156\137\333\163\141\101\351\107\251\261\057\110\202\162\223"
+    "\243\001\260\133\123\221\026\072\244\331\073\206\226\200\027\264"
+    "\220\227\131\370\243\260\031\046\124\137\147\307\166\347\376\243"
+    "\276\336\366\205\133\340\331\174\167\341\077\220\151\011\176\347"
+    "\202\255\160\310\010\261\207\157\050\301\277\227\003\336\341\031"
+    "\251\046\242\102\324\244\224\024\103\316\337\031\031\345\273\064"
+    "\311\120\044\047\202\376\000\350\361\134\122\113\065\021\265\002"
+    "\250\170\054\351\132\035\243\034\352\002\204\371\110\243\345\065"
+    "\126\107\157\353\043\225\301\120\033\046\101\313\363\075\137\316"
+    "\367\276\143\116\320\302\346\056\270\174\061\223\224\237\137\254"
+    "\267\233\170\325\006\315\211\117\065\171\274\245\320\230\005\022"
+    "\026\154\031\052\172\172\267\315\013\106\311\344\354\322\070\102"
+    "\326\124\350\331\035\353\117\146\131\017\003\261\006\027\100\317"
+    "\212\331\015\343\345\154\223\012\261\214\345\270\131\231\160\171"
+    "\175\221\013\306\043\044\060\122\357\270\234\300\251\244\270\115"
+    "\351\341\345\347\325\232\010\015\224\122\134\274\171\237\337\117"
+    "\272\303\056\361\201\246\365\205\370\074\062\301\102\322\255\244"
+    "\347\070\000\340\020\175\320\171\050\273\334\324\171\070\372\150"
+    "\276\045\227\213\101\375\314\351\352\261\244\104\231\047\042\260"
+    "\013\063\363\043\340\043\326\216\123\013\257\324\216\105\006\220"
+    "\072\030\025\310\355\377\211\036\121\263\161\231\110\114\044\116"
+    "\024\310\127\312\036\165\112\247\345\356\163\226\223\302\324\025"
+    "\242\230\103\147\301\325\374\041\055\210\067\153\101\044\363\037"
+    "\321\171\170\263\316\103\362\376\041\015\207\067\153\070\044\363"
+    "\015\043\210\247\335\237\067\355\376\326\117\375\161\035\156\013"
+    "\240\057\012\340\200\255\227\313\230\335\005\240\246\022\311\322"
+    "\062\233\230\057\144\104\277\176\055\312\255\236\177\077\320\230"
+    "\042\212\361\322\005\364\060\134\173\100\337\105\136\161\151\266"
+    "\051\300\147\302\053\050\145\010\177\076\334\211\111\365\241\360"
+    "\274\367\215\305\033\312\257\270\171\204\375\046\305\263\257\154"
+    "\122\037\306\047\104\252\266\203\123\163\124\101\341\351\076\204"
+    "\323\326\214\135\014\226\364\166\342\247\217\030\230\117\032\315"
+    "\317\034\054\375\370\173\161\043\040\260\171\060\317\177\062\010"
+    "\261\000\127\063\272\251\214\162\322\075\024\276\213\214\224\357"
+    "\277\226\154\271\154\271\146\132\104\006\233\356\014\067\317\167"
+    "\204\056\155\366\074\065\300\347\334\326\062\137\076\320\133\167"
+    "\035\370\271\055\310\352\153\244\122\056\236\316\055\151\233\214"
+    "\153\140\171\060\333\323\143\247\127\262\004\216\353\222\217\174"
+    "\034\012\310\205\320\127\150\303\153\000\205\333\056\367\036\151"
+    "\270\176\213\323\111\342\300\341\231\117\116\133\075\275\174\105"
+    "\251\104\022\277\376\073\114\003\111\134\327\250\372\154\112\025"
+    "\333\327\237\336\024\271\223\313\157\277\255\325\143\371\316\104"
+    "\374\276\306\071\024\104\234\074\076\231\375\147\107\363\161\111"
+    "\272\337\111\037\037\342\203\006\045\164\044\215\212\245\272\027"
+    "\005\146\350\161\364\324\030\220\044\164\040\146\026\363\366\124"
+    "\372\134\370\137\352\260\263\326\156\324\371\142\050\233\160\220"
+    "\324\014\040\312\031\352\335\370\152\367\207\334\344\102\373\003"
+    "\050\111\114\214\304\347\117\337\160\334\262\064\063\153\314\256"
+    "\325\247\213\232\263\371\266\134\025\303\157\306\125\137\124\250"
+    "\256\301\031\011\044\375\371\234\343\307\000\153\165\000\076\242"
+    "\162\173\254\322\136\156\217\025\367\326\376\157\207\114\343\211"
+    "\102\053\231\363\335\023\147\373\345\170\370\325\031\327\045\255"
+    "\033\257\031\223\307\352\335\372\206\372\326\363\011\202\010\103"
+    "\263\214\273\202\347\156\153\144\305\330\247\047\155\255\167\377"
+    "\037\042\200\036\032\110\044\000\000"
+    // system_status.js
+    R"(document.addEventListener('DOMContentLoaded',function(){
+loadSystemData();
+setInterval(loadSystemData,5000);
+async function loadSystemData(){
+try{
+const systemData=await AuthUtils.fetchJSON('/api/system');
+if(systemData.success){
+updateSystemStatus(systemData.status);
+}
+}catch(error){
+console.error('Error fetching system data:',error);
+}
+try{
+const networkData=await AuthUtils.fetchJSON('/api/network');
+if(networkData.success){
+updateNetworkStatus(networkData.network);
+}
+}catch(error){
+console.error('Error fetching network data:',error);
+}
+try{
+const modulesData=await AuthUtils.fetchJSON('/api/modules');
+if(modulesData.success){
+updateModulesTable(modulesData.modules);
+}
+}catch(error){
+console.error('Error fetching modules data:',error);
+}
+}
+function updateSystemStatus(status){
+document.getElementById('uptimeValue').textContent=formatUptime(status.uptime);
+document.getElementById('freeHeap').textContent=status.memory.freeHeap;
+document.getElementById('freeHeapPercent').textContent=status.memory.freeHeapPercent;
+document.getElementById('memory-gauge-fill').style.width=(100 - status.memory.freeHeapPercent)+ '%';
+document.getElementById('memory-gauge').className='gauge gauge-' + status.memory.color;
+document.getElementById('flashSize').textContent=status.storage.flashSize + ' MB';
+document.getElementById('freeSpace').textContent=status.storage.availableSpace;
+document.getElementById('freeSpacePercent').textContent=(100 - status.storage.usedSpacePercent);
+document.getElementById('storage-gauge-fill').style.width=status.storage.usedSpacePercent + '%';
+document.getElementById('storage-gauge').className='gauge gauge-' + status.storage.color;
+document.getElementById('platformMode').textContent=status.platform.mode;
+document.getElementById('httpsStatus').textContent=status.platform.httpsEnabled?'Enabled':'Disabled';
+document.getElementById('serverPort').textContent=status.platform.serverPort;
+document.getElementById('hostname').textContent=status.platform.hostname;
+document.getElementById('moduleCount').textContent=status.platform.moduleCount;
+document.getElementById('routeCount').textContent=status.platform.routeCount;
+document.getElementById('systemVersion').textContent=status.platform.systemVersion;
+document.getElementById('platformVersion').textContent=status.platform.platformVersion;
+}
+function updateNetworkStatus(network){
+document.getElementById('wifiSsid').textContent=network.ssid;
+document.getElementById('ipAddress').textContent=network.ipAddress;
+document.getElementById('macAddress').textContent=network.macAddress;
+document.getElementById('signalStrength').textContent=network.signalStrength;
+}
+function updateModulesTable(modules){
+const tableBody=document.getElementById('modulesTableBody');
+tableBody.innerHTML='';
+if(modules.length===0){
+const row=document.createElement('tr');
+const cell=document.createElement('td');
+cell.colSpan=3;
+cell.textContent='No modules registered.';
+row.appendChild(cell);
+tableBody.appendChild(row);
+return;
+}
+modules.forEach(module=>{
+const row=document.createElement('tr');
+const nameCell=document.createElement('td');
+nameCell.textContent=module.name;
+row.appendChild(nameCell);
+const versionCell=document.createElement('td');
+versionCell.textContent=module.version;
+row.appendChild(versionCell);
+const pathCell=document.createElement('td');
+pathCell.textContent=module.basePath;
+row.appendChild(pathCell);
+tableBody.appendChild(row);
+});
+}
+function formatUptime(seconds){
+const days=Math.floor(seconds / 86400);
+seconds %=86400;
+const hours=Math.floor(seconds / 3600);
+seconds %=3600;
+const minutes=Math.floor(seconds / 60);
+seconds %=60;
+let result='';
+if(days > 0)result +=days + 'd ';
+if(hours > 0||days > 0)result +=hours + 'h ';
+if(minutes > 0||hours > 0||days > 0)result +=minutes + 'm ';
+result +=seconds + 's';
+return result;
+}
+});)" "\0"
+    "\037\213\010\000\000\000\000\000\002\003\225\127\113\157\333\070"
+    "\020\276\373\127\350\122\120\106\022\305\213\356\006\213\006\152"
+    "\321\044\006\332\105\235\006\160\333\073\053\216\155\242\264\050"
+    "\220\224\275\336\064\377\175\207\042\051\113\176\110\312\051\062"
+    "\347\173\314\014\237\141\062\053\327\220\233\204\062\066\335\340"
+    "\307\027\256\015\344\240\142\362\360\165\166\057\163\143\307\044"
+    "\145\300\310\345\242\314\063\303\145\036\217\237\107\002\307\346"
+    "\073\304\256\037\250\241\361\370\166\244\301\174\106\270\332\120"
+    "\021\267\243\227\177\115\046\023\104\120\275\313\263\050\250\104"
+    "\207\022\317\043\243\166\317\243\114\346\332\104\272\016\244\164"
+    "\113\271\211\076\226\146\365\335\160\241\223\005\230\154\365\317"
+    "\374\353\143\114\256\151\301\257\035\224\240\001\137\304\173\136"
+    "\242\313\054\003\255\121\267\054\030\065\340\274\346\206\232\122"
+    "\267\160\325\010\322\137\106\057\031\105\355\030\224\222\152\354"
+    "\122\221\002\222\352\167\114\246\366\117\124\331\363\174\351\123"
+    "\214\120\232\276\043\227\216\143\105\032\125\344\140\266\122\375"
+    "\032\124\206\307\372\072\032\314\243\102\036\135\314\127\322\104"
+    "\372\357\327\327\342\211\235\305\254\045\053\005\350\101\305\170"
+    "\254\057\246\301\074\052\146\346\142\337\350\117\001\055\240\377"
+    "\176\175\055\236\170\134\313\313\250\136\173\247\126\204\133\006"
+    "\317\043\026\366\304\022\314\124\200\375\274\333\175\146\061\051"
+    "\013\303\327\360\203\212\022\310\070\061\360\257\361\033\044\135"
+    "\110\265\246\346\173\025\367\102\211\103\243\361\131\275\205\002"
+    "\370\004\264\070\020\363\374\065\254\245\332\045\001\064\100\347"
+    "\011\124\206\203\203\344\074\266\103\325\021\256\226\264\134\302"
+    "\325\202\013\201\272\332\354\260\355\133\316\314\052\215\377\230"
+    "\114\242\253\250\123\176\174\021\221\067\144\240\011\352\147\202"
+    "\152\375\110\327\220\222\152\050\162\356\044\272\070\360\311\244"
+    "\220\252\253\045\050\264\232\363\377\340\164\063\264\221\212\056"
+    "\041\251\141\150\100\242\331\035\351\351\362\274\240\131\217\044"
+    "\335\120\056\354\142\256\260\103\364\116\117\133\273\275\101\275"
+    "\324\300\232\244\256\345\345\071\347\147\260\107\073\352\233\274"
+    "\226\301\240\331\013\126\175\323\127\010\152\354\236\302\303\341"
+    "\114\273\003\302\036\023\135\135\136\031\123\150\267\303\173\204"
+    "\052\344\064\267\123\307\076\020\377\101\336\221\007\256\335\147"
+    "\127\047\360\332\003\365\044\225\351\061\331\003\273\162\226\332"
+    "\344\330\306\276\204\075\254\153\173\125\107\341\275\054\163\323"
+    "\337\306\200\354\320\123\262\064\203\344\366\300\256\256\125\307"
+    "\357\017\120\032\217\344\276\306\065\261\003\126\316\060\325\003"
+    "\364\355\361\025\161\362\256\355\272\044\266\174\301\347\232\263"
+    "\003\147\317\114\064\206\072\322\347\305\107\306\024\336\217\147"
+    "\350\165\274\153\322\151\326\055\262\007\164\115\016\137\346\124"
+    "\314\215\202\174\151\126\347\252\151\201\116\264\357\324\355\076"
+    "\016\017\012\143\107\357\044\333\245\075\013\330\361\055\322\076"
+    "\050\152\132\302\163\174\251\176\372\066\373\222\022\322\174\150"
+    "\044\242\312\047\115\323\111\155\246\344\166\157\223\051\300\344"
+    "\274\123\114\214\262\272\016\227\201\020\347\201\254\002\042\304"
+    "\036\141\170\130\346\351\133\377\273\331\036\362\050\353\127\210"
+    "\202\245\175\122\053\140\011\346\210\131\044\264\050\040\147\367"
+    "\053\056\130\154\251\255\222\232\101\004\143\114\201\051\125\265"
+    "\064\103\165\270\142\247\024\237\103\356\167\372\376\265\045\332"
+    "\103\343\276\277\314\000\153\225\346\074\023\167\356\034\126\023"
+    "\030\265\323\306\355\253\001\146\015\344\051\277\115\330\240\207"
+    "\226\015\136\355\132\120\263\032\140\031\140\247\374\176\122\015"
+    "\117\324\056\351\103\303\300\352\231\265\227\161\153\067\264\037"
+    "\210\200\171\262\375\076\140\164\247\323\031\352\342\173\104\342"
+    "\203\326\307\243\353\350\357\233\077\253\377\234\302\310\233\264"
+    "\032\011\205\256\144\251\316\060\337\336\034\020\355\100\340\255"
+    "\171\216\307\363\031\346\115\233\167\203\054\001\270\270\100\227"
+    "\302\204\215\146\123\216\336\107\223\261\033\216\056\322\152\004"
+    "\137\014\054\162\210\052\067\013\371\375\373\030\354\202\210\136"
+    "\171\264\317\310\341\073\251\001\211\344\265\045\327\201\220\062"
+    "\006\064\011\333\306\247\135\275\376\307\267\377\003\365\367\046"
+    "\121\356\016\000\000"
+    // web_platform_styles.css
+    R"(.auth-body{padding:10px;min-height:100vh;display:flex;align-items:center;justify-content:center}.auth-container{width:100%;max-width:400px;margin:0 auto}.auth-card{overflow:hidden}.auth-header{padding:30px 30px 20px;text-align:center}.auth-title{font-size:1.8em;margin:0 0 10px 0}.auth-subtitle{margin:0;font-size:0.9em;line-height:1.4}.auth-form{padding:25px 30px}.auth-submit{width:100%;padding:14px;margin-top:25px;font-size:1.1em}.auth-footer{padding:20px 30px 30px;text-align:center}.auth-note{font-size:0.85em;margin:0;line-height:1.4}.password-field{position:relative;display:flex;align-items:center}.password-field .form-control{padding-right:70px}.password-toggle{position:absolute;right:12px;font-size:12px;padding:6px 10px;font-weight:600;transition:all 0.3s ease;min-width:50px;text-align:center}.password-toggle:hover{transform:scale(1.05)}.password-toggle:active{transform:scale(0.95)}.network-scanner{margin-bottom:25px}.scan-button{width:100%;margin-bottom:15px;position:relative}.scan-button.scanning{animation:pulse 1.5s ease-in-out infinite}.network-list{max-height:400px;overflow-y:auto;margin-top:15px;padding:4px}.network-item{display:flex;justify-content:space-between;align-items:center;padding:15px 20px;margin:8px;cursor:pointer;transition:all 0.3s ease;min-height:60px}.network-item:hover{transform:translateY(-2px)}.network-item.selected{transform:translateY(-2px)}.network-name{font-weight:bold;font-size:16px;margin-bottom:4px;word-break:break-word;flex:1;margin-right:15px}.network-info{display:flex;flex-direction:column;align-items:flex-end;gap:4px;min-width:80px}.network-meta{display:flex;align-items:center;gap:8px;font-size:12px}.security-icon{font-size:16px}.signal-strength{font-size:12px;font-weight:bold}.wifi-setup{padding:25px;margin:20px auto}.wifi-setup h3{margin-bottom:20px;font-size:1.3em;display:flex;align-items:center;gap:10px}.wifi-setup h3::before{content:"📡";font-size:1.2em}.network-list .loading,.network-list .error{padding:30px 20px;text-align:center;font-style:italic}.network-list .loading::before{content:"";display:block;width:24px;height:24px;margin:0 auto 10px;border-radius:50%;animation:spin 1s linear infinite}@media (max-width:480px){.auth-body{padding:15px;align-items:flex-start;padding-top:30px}.auth-header{padding:25px 20px 15px}.auth-title{font-size:1.6em}.auth-form{padding:20px}.password-field .form-control{padding-right:80px}.password-toggle{right:10px;font-size:13px;padding:8px 10px;min-width:60px}.network-item{padding:14px 16px;margin:4px;min-height:56px}.network-item:hover{transform:none}.wifi-setup{margin:0;padding:20px}}@media (max-width:768px){.network-list{max-height:300px}.scan-button{padding:16px;font-size:16px;min-height:50px}})" "\0"
+    "\037\213\010\000\000\000\000\000\002\003\215\126\131\216\244\070"
+    "\020\275\012\052\251\245\052\151\214\040\267\316\206\237\276\106"
+    "\177\032\010\022\167\031\033\331\246\262\262\121\235\142\016\060"
+    "\232\033\316\021\046\154\126\103\326\362\203\300\204\303\021\057"
+    "\336\213\160\110\133\123\221\114\026\267\256\241\105\301\304\045"
+    "\211\243\346\065\255\231\040\025\260\113\145\360\073\172\251\322"
+    "\202\351\206\323\133\122\162\170\115\051\147\027\101\230\201\132"
+    "\047\071\010\003\052\375\335\152\303\312\033\311\045\176\012\063"
+    "\054\277\205\316\277\135\244\114\200\352\256\254\060\225\165\371"
+    "\055\255\351\053\351\077\017\221\073\222\252\013\023\111\024\340"
+    "\026\071\156\244\252\350\344\013\250\222\313\153\122\261\242\000"
+    "\061\374\252\200\026\350\160\214\172\217\056\002\367\330\131\147"
+    "\006\136\015\161\141\372\221\030\146\070\164\045\306\103\064\373"
+    "\003\111\034\236\241\236\217\216\002\233\175\020\015\326\272\315"
+    "\372\015\243\101\072\357\214\302\037\270\223\143\126\023\120\341"
+    "\141\330\127\112\125\117\221\355\216\103\144\263\323\232\231\045"
+    "\022\023\362\207\011\006\142\144\343\166\246\313\130\143\250\247"
+    "\023\244\131\144\277\233\262\337\177\224\275\300\115\335\062\205"
+    "\363\161\221\375\066\231\206\152\175\225\252\040\045\003\136\164"
+    "\215\324\314\060\051\022\005\234\032\366\002\237\261\142\355\041"
+    "\010\055\062\216\016\112\362\061\172\242\334\211\337\035\104\323"
+    "\006\043\057\027\104\176\072\223\146\132\362\326\100\332\133\307"
+    "\073\037\033\373\071\242\161\102\034\034\213\335\377\153\237\320"
+    "\051\212\122\243\250\030\335\161\036\104\341\136\007\100\065\070"
+    "\272\367\005\071\276\203\337\052\256\244\262\254\354\234\103\233"
+    "\123\242\163\312\341\061\016\243\343\323\326\230\346\026\255\215"
+    "\065\122\310\132\013\060\150\374\114\160\121\130\215\014\014\310"
+    "\244\061\262\166\044\170\013\355\077\222\265\270\042\174\015\055"
+    "\115\143\313\227\115\221\274\315\356\135\040\110\035\025\254\246"
+    "\316\260\151\271\206\040\016\217\075\030\004\035\312\326\004\114"
+    "\224\114\140\065\347\000\071\323\246\263\262\035\070\322\353\166"
+    "\224\047\271\045\126\271\113\002\367\001\015\125\071\330\074\106"
+    "\127\226\045\235\307\236\165\003\321\015\315\201\144\150\017\040"
+    "\356\165\234\111\065\307\121\364\003\221\317\370\232\267\112\113"
+    "\225\064\222\071\333\017\013\137\215\004\131\007\270\051\262\173"
+    "\103\124\341\327\043\101\302\075\371\346\241\006\016\271\201\342"
+    "\113\073\004\255\007\055\016\004\315\044\057\226\214\076\315\315"
+    "\140\250\257\155\017\216\126\231\002\372\234\270\047\261\013\251"
+    "\105\060\211\107\363\101\041\107\057\037\121\112\037\160\373\040"
+    "\005\123\030\262\305\045\107\165\325\076\320\316\002\104\221\136"
+    "\150\343\016\237\145\162\366\300\252\301\320\356\263\011\141\235"
+    "\234\067\242\105\166\002\026\213\231\033\141\130\372\316\007\000"
+    "\377\242\037\312\211\066\012\304\305\124\335\112\362\153\000\337"
+    "\302\053\053\031\321\140\332\306\353\300\043\071\134\247\354\047"
+    "\314\154\031\124\373\265\352\242\125\353\335\143\243\374\112\206"
+    "\261\003\306\163\235\044\031\040\031\240\033\251\375\360\337\077"
+    "\177\377\373\340\271\337\331\316\276\324\131\020\162\111\155\364"
+    "\177\255\226\101\051\271\032\173\367\047\336\340\337\334\260\001"
+    "\061\203\177\362\167\116\330\306\367\060\245\232\161\231\077\247"
+    "\175\315\167\226\002\203\130\166\207\365\304\356\073\156\206\154"
+    "\004\105\024\072\156\065\066\323\157\351\334\147\164\303\104\020"
+    "\353\300\216\031\252\346\376\362\263\206\202\321\340\161\161\041"
+    "\260\364\172\352\302\073\227\023\133\312\015\107\265\241\312\214"
+    "\015\301\165\236\305\274\135\135\024\166\143\273\010\172\201\274"
+    "\163\055\070\055\106\355\162\230\373\103\352\363\251\166\276\073"
+    "\325\006\205\256\110\266\137\164\313\363\070\303\146\315\155\033"
+    "\124\267\274\071\004\213\216\061\251\165\050\327\361\364\151\157"
+    "\023\122\200\247\236\351\132\340\345\176\247\132\337\117\147\127"
+    "\255\367\306\304\076\212\326\043\154\212\373\344\043\160\132\205"
+    "\355\116\374\037\027\051\001\364\244\012\000\000"
+    // web_platform_utils.js
+    R"rawliteral(const AuthUtils={
+getCsrfToken(){
+const meta=document.querySelector('meta[name="csrf-token"]');
+return meta?meta.getAttribute('content'):null;
+},
+getModulePrefix(){
+return document.body.dataset.modulePrefix||'';
+},
+getDeviceName(){
+return document.body.dataset.deviceName||'Device';
+},
+async fetch(url,options={}){
+const csrfToken=this.getCsrfToken();
+const headers={
+...options.headers
+};
+if(options.body&&!(options.body instanceof FormData)){
+headers['Content-Type']='application/x-www-form-urlencoded';
+}
+if(csrfToken){
+headers['X-CSRF-Token']=csrfToken;
+}
+return fetch(url,{
+...options,
+headers,
+credentials:'same-origin'
+});
+},
+async fetchJSON(url,options={}){
+const csrfToken=this.getCsrfToken();
+const headers={
+'Content-Type':'application/json',
+...options.headers
+};
+if(csrfToken){
+headers['X-CSRF-Token']=csrfToken;
+}
+const response=await fetch(url,{
+...options,
+headers,
+credentials:'same-origin'
+});
+return response.json();
+}
+};
+const NetworkUtils={
+async scanNetworks(){
+try{
+const response=await AuthUtils.fetchJSON('/api/scan');
+return response;
+}catch(error){
+console.error('Network scan failed:',error);
+throw error;
+}
+},
+escapeHtml(text){
+const div=document.createElement('div');
+div.textContent=text;
+return div.innerHTML;
+},
+getSignalStrengthIcon(rssi){
+if(rssi >=-50)return '📶';
+if(rssi >=-60)return '📶';
+if(rssi >=-70)return '📶';
+return '📶';
+},
+getSignalStrengthText(rssi){
+if(rssi >=-50)return 'Excellent';
+if(rssi >=-60)return 'Good';
+if(rssi >=-70)return 'Fair';
+return 'Weak';
+},
+getSignalBars(rssi){
+const bars=[];
+const strength=this.getSignalStrength(rssi);
+for(let i=1;i <=4;i++){
+bars.push(`<div class="signal-bar ${i <=strength?'active':''}"></div>`);
+}
+return `<div class="signal-bars">${bars.join('')}</div>`;
+},
+getSignalStrength(rssi){
+if(rssi >=-50)return 4;
+if(rssi >=-60)return 3;
+if(rssi >=-70)return 2;
+return 1;
+},
+renderNetworkItem(network,clickHandler){
+const div=document.createElement('div');
+div.className='network-item';
+const nameDiv=document.createElement('div');
+nameDiv.className='network-name';
+nameDiv.textContent=network.ssid;
+const infoDiv=document.createElement('div');
+infoDiv.className='network-info';
+const metaDiv=document.createElement('div');
+metaDiv.className='network-meta';
+const securityIcon=document.createElement('span');
+securityIcon.className='security-icon';
+securityIcon.innerHTML=network.encryption?'🔒':'🔓';
+securityIcon.title=network.encryption?'Secured':'Open';
+const signalSpan=document.createElement('span');
+signalSpan.className='signal-strength';
+signalSpan.textContent=this.getSignalStrengthText(network.rssi);
+signalSpan.title=`${network.rssi}dBm`;
+metaDiv.appendChild(securityIcon);
+metaDiv.appendChild(signalSpan);
+const signalBars=document.createElement('div');
+signalBars.innerHTML=this.getSignalBars(network.rssi);
+infoDiv.appendChild(metaDiv);
+infoDiv.appendChild(signalBars);
+div.appendChild(nameDiv);
+div.appendChild(infoDiv);
+if(clickHandler){
+div.style.cursor='pointer';
+div.onclick=()=> clickHandler(network.ssid,div);
+}
+return div;
+}
+};
+const FormUtils={
+async submitForm(form,endpoint,successCallback,errorCallback){
+const formData=new FormData(form);
+const csrfToken=AuthUtils.getCsrfToken();
+if(csrfToken){
+formData.append('_csrf',csrfToken);
+}
+try{
+const response=await AuthUtils.fetch(endpoint,{
+method:'POST',
+body:formData
+});
+const result=await response.json();
+if(result.success){
+if(successCallback)successCallback(result);
+}else{
+if(errorCallback)errorCallback(result.message||'Unknown error');
+}
+}catch(error){
+console.error('Form submission error:',error);
+if(errorCallback)errorCallback('Network error');
+}
+},
+clearForm(form){
+const inputs=form.querySelectorAll('input, select, textarea');
+inputs.forEach(input=>{
+if(input.type==='checkbox'||input.type==='radio'){
+input.checked=false;
+}else{
+input.value='';
+}
+});
+}
+};
+const UIUtils={
+showLoading(element,message='Loading...'){
+if(element){
+element.innerHTML=`<div class="loading">${message}</div>`;
+}
+},
+showError(element,message='An error occurred'){
+if(element){
+element.innerHTML=`<div class="error">${message}</div>`;
+}
+},
+updateButtonState(button,loading,text){
+if(!button)return;
+if(loading){
+button.disabled=true;
+button.dataset.originalText=button.textContent;
+button.textContent=text||'Loading...';
+}else{
+button.disabled=false;
+button.textContent=button.dataset.originalText||text||'Submit';
+}
+},
+selectNetworkItem(selectedElement){
+document.querySelectorAll('.network-item').forEach(item=>{
+item.classList.remove('selected');
+});
+if(selectedElement){
+selectedElement.classList.add('selected');
+}
+},
+createModal(){
+this.destroyModal();
+const modalOverlay=document.createElement('div');
+modalOverlay.id='modal-overlay';
+modalOverlay.className='modal-overlay';
+const modalContainer=document.createElement('div');
+modalContainer.className='modal-container';
+const modalContent=document.createElement('div');
+modalContent.className='modal-content';
+const modalHeader=document.createElement('div');
+modalHeader.className='modal-header';
+const modalTitle=document.createElement('h3');
+modalTitle.className='modal-title';
+const modalClose=document.createElement('button');
+modalClose.className='modal-close';
+modalClose.innerHTML='&times;';
+modalClose.onclick=()=> this.destroyModal();
+const modalBody=document.createElement('div');
+modalBody.className='modal-body';
+const modalFooter=document.createElement('div');
+modalFooter.className='modal-footer';
+modalHeader.appendChild(modalTitle);
+modalHeader.appendChild(modalClose);
+modalContent.appendChild(modalHeader);
+modalContent.appendChild(modalBody);
+modalContent.appendChild(modalFooter);
+modalContainer.appendChild(modalContent);
+modalOverlay.appendChild(modalContainer);
+modalOverlay.onclick=(e)=>{
+if(e.target===modalOverlay){
+this.destroyModal();
+}
+};
+const escapeHandler=(e)=>{
+if(e.key==='Escape'){
+this.destroyModal();
+document.removeEventListener('keydown',escapeHandler);
+}
+};
+document.addEventListener('keydown',escapeHandler);
+document.body.appendChild(modalOverlay);
+return{
+overlay:modalOverlay,
+title:modalTitle,
+body:modalBody,
+footer:modalFooter,
+close:()=> this.destroyModal()
+};
+},
+destroyModal(){
+const existingModal=document.getElementById('modal-overlay');
+if(existingModal){
+existingModal.remove();
+}
+},
+showAlert(title,message,type='info'){
+const modal=this.createModal();
+modal.title.textContent=title;
+modal.body.innerHTML=`<div class="alert alert-${type}">${message}</div>`;
+const okButton=document.createElement('button');
+okButton.className='btn btn-primary';
+okButton.textContent='OK';
+okButton.onclick=()=> modal.close();
+modal.footer.appendChild(okButton);
+setTimeout(()=> okButton.focus(),100);
+return modal;
+},
+showConfirm(title,message,onConfirm,onCancel){
+const modal=this.createModal();
+modal.title.textContent=title;
+modal.body.innerHTML=`<div class="alert alert-warning">${message}</div>`;
+const cancelButton=document.createElement('button');
+cancelButton.className='btn btn-secondary';
+cancelButton.textContent='Cancel';
+cancelButton.onclick=()=>{
+if(onCancel)onCancel();
+modal.close();
+};
+const confirmButton=document.createElement('button');
+confirmButton.className='btn btn-danger';
+confirmButton.textContent='Confirm';
+confirmButton.onclick=()=>{
+if(onConfirm)onConfirm();
+modal.close();
+};
+modal.footer.appendChild(cancelButton);
+modal.footer.appendChild(confirmButton);
+setTimeout(()=> cancelButton.focus(),100);
+return modal;
+},
+showTokenModal(token){
+const modal=this.createModal();
+modal.title.textContent='API Token Created';
+modal.body.innerHTML=`
+      <div class="alert alert-success">
+        <p><strong>Your new API token has been created successfully!</strong></p>
+        <p class="token-warning">⚠️ <strong>Important:</strong> This token will only be shown once. Please copy and save it securely.</p>
+      </div>
+      <div class="token-container">
+        <label for="new-token">API Token:</label>
+        <div class="token-display-box">
+          <input type="text" id="new-token" class="token-input" value="${token}" readonly>
+          <button class="btn btn-copy" onclick="UIUtils.copyToken()">Copy</button>
+        </div>
+      </div>
+    `;
+const closeButton=document.createElement('button');
+closeButton.className='btn btn-primary';
+closeButton.textContent='I\'ve Saved My Token';
+closeButton.onclick=()=> modal.close();
+modal.footer.appendChild(closeButton);
+setTimeout(()=>{
+const tokenInput=document.getElementById('new-token');
+if(tokenInput){
+tokenInput.select();
+tokenInput.focus();
+}
+},100);
+return modal;
+},
+copyToken(){
+const tokenInput=document.getElementById('new-token');
+if(tokenInput){
+tokenInput.select();
+document.execCommand('copy');
+const copyBtn=document.querySelector('.btn-copy');
+if(copyBtn){
+const originalText=copyBtn.textContent;
+copyBtn.textContent='Copied!';
+copyBtn.classList.add('btn-success');
+setTimeout(()=>{
+copyBtn.textContent=originalText;
+copyBtn.classList.remove('btn-success');
+},2000);
+}
+}
+}
+};
+document.addEventListener('DOMContentLoaded',function(){
+const forms=document.querySelectorAll('form');
+const csrfToken=AuthUtils.getCsrfToken();
+if(csrfToken){
+forms.forEach(form=>{
+const existingCsrf=form.querySelector('input[name="_csrf"]');
+if(!existingCsrf){
+const csrfInput=document.createElement('input');
+csrfInput.type='hidden';
+csrfInput.name='_csrf';
+csrfInput.value=csrfToken;
+form.appendChild(csrfInput);
+}
+});
+}
+});
+const TimeUtils={
+formatTimestamp(timestamp,options={}){
+try{
+if(!timestamp){
+return 'Unknown date';
+}
+let date;
+if(typeof timestamp==='string'){
+if(timestamp.includes('T')||timestamp.includes('-')){
+date=new Date(timestamp);
+}else{
+const timestampNum=parseInt(timestamp);
+date=new Date(timestampNum * 1000);
+}
+}else{
+date=new Date(timestamp * 1000);
+}
+if(isNaN(date.getTime())){
+console.warn('Invalid timestamp:',timestamp);
+return 'Invalid date';
+}
+const defaultOptions={
+year:'numeric',
+month:'short',
+day:'numeric',
+hour:'2-digit',
+minute:'2-digit',
+second:'2-digit',
+timeZoneName:'short'
+};
+const formatOptions={...defaultOptions,...options};
+return date.toLocaleString(undefined,formatOptions);
+}catch(error){
+console.error('Error formatting timestamp:',error,'for timestamp:',timestamp);
+return 'Date error';
+}
+},
+formatRelativeTime(timestamp){
+try{
+if(!timestamp){
+return 'Unknown time';
+}
+let date;
+if(typeof timestamp==='string'){
+if(timestamp.includes('T')||timestamp.includes('-')){
+date=new Date(timestamp);
+}else{
+const timestampNum=parseInt(timestamp);
+date=new Date(timestampNum * 1000);
+}
+}else{
+date=new Date(timestamp * 1000);
+}
+if(isNaN(date.getTime())){
+console.warn('Invalid timestamp for relative time:',timestamp);
+return 'Invalid date';
+}
+const now=new Date();
+const diffMs=now.getTime()- date.getTime();
+const minutes=Math.floor(diffMs / 60000);
+if(minutes < 1){
+return 'Just now';
+}else if(minutes < 60){
+return minutes===1?'1 minute ago':`${minutes} minutes ago`;
+}else if(minutes < 1440){
+const hours=Math.floor(minutes / 60);
+return hours===1?'1 hour ago':`${hours} hours ago`;
+}else{
+const days=Math.floor(minutes / 1440);
+if(days > 7){
+return this.formatTimestamp(timestamp,{
+year:'numeric',
+month:'short',
+day:'numeric'
+});
+}
+return days===1?'1 day ago':`${days} days ago`;
+}
+}catch(error){
+console.error('Error formatting relative time:',error,'for timestamp:',timestamp);
+return 'Time error';
+}
+},
+getTimezone(){
+return Intl.DateTimeFormat().resolvedOptions().timeZone;
+},
+formatTime(timestamp,options={}){
+const defaultOptions={
+hour:'2-digit',
+minute:'2-digit',
+second:'2-digit',
+timeZoneName:'short'
+};
+return this.formatTimestamp(timestamp,{...defaultOptions,...options});
+},
+formatDate(timestamp,options={}){
+const defaultOptions={
+year:'numeric',
+month:'short',
+day:'numeric'
+};
+return this.formatTimestamp(timestamp,{...defaultOptions,...options});
+}
+};
+window.escapeHtml=NetworkUtils.escapeHtml;
+window.AuthUtils=AuthUtils;
+window.NetworkUtils=NetworkUtils;
+window.FormUtils=FormUtils;
+window.UIUtils=UIUtils;
+window.TimeUtils=TimeUtils;)rawliteral" "\0"
+    "\037\213\010\000\000\000\000\000\002\003\355\032\133\162\343\306"
+    "\361\237\247\300\262\266\074\140\014\102\222\275\261\253\050\101"
+    "\133\273\132\255\127\316\152\265\145\311\225\207\343\312\216\200"
+    "\241\010\013\004\030\140\040\211\221\170\206\124\305\371\312\117"
+    "\162\212\124\316\223\013\044\107\110\367\274\060\003\002\022\145"
+    "\073\371\212\135\266\060\323\075\335\075\375\106\023\161\221\127"
+    "\334\173\121\363\331\327\074\315\252\350\166\160\301\370\101\125"
+    "\116\317\212\113\226\373\243\333\101\054\060\346\214\323\050\051"
+    "\342\172\316\162\036\376\276\146\345\362\224\145\054\346\105\351"
+    "\023\004\176\223\323\071\213\206\061\034\035\163\074\073\374\226"
+    "\214\166\007\045\343\165\231\213\343\317\361\177\041\220\177\301"
+    "\171\231\236\327\234\371\004\210\163\040\110\106\223\274\316\262"
+    "\335\301\052\100\376\307\105\122\147\354\175\311\246\351\015\212"
+    "\240\210\030\366\347\105\262\014\023\312\151\305\170\070\267\220"
+    "\357\356\010\321\104\136\261\253\064\146\357\100\252\007\111\044"
+    "\006\025\010\310\163\222\014\255\226\171\354\115\031\217\147\176"
+    "\135\146\101\261\340\051\250\043\272\135\031\305\304\132\127\021"
+    "\237\245\125\350\152\157\127\041\315\030\115\130\211\332\015\303"
+    "\120\021\011\325\346\140\265\073\110\247\276\336\105\301\076\372"
+    "\350\211\263\366\122\040\102\363\230\025\123\357\165\121\316\137"
+    "\201\334\043\220\100\121\370\206\034\110\065\216\317\226\013\106"
+    "\276\215\010\135\054\262\064\246\110\141\353\146\174\175\175\075"
+    "\236\302\261\061\134\201\345\161\221\260\004\257\207\134\215\364"
+    "\066\265\137\215\017\116\277\172\075\026\373\100\315\340\340\031"
+    "\245\307\106\045\366\225\002\115\043\030\304\045\113\100\242\224"
+    "\146\325\204\124\240\331\161\121\246\027\151\116\006\253\121\133"
+    "\265\137\236\236\274\373\211\324\353\152\142\342\050\342\273\252"
+    "\310\111\320\157\201\107\353\102\062\057\131\265\200\007\026\321"
+    "\153\232\362\037\253\031\245\137\115\064\104\241\361\242\053\024"
+    "\122\062\174\307\370\165\121\136\352\170\225\212\254\142\232\053"
+    "\100\205\376\316\313\345\155\267\200\046\326\303\106\371\144\213"
+    "\056\322\055\244\101\326\145\000\346\240\101\270\024\053\313\242"
+    "\124\226\051\062\026\212\265\117\024\133\041\202\067\245\151\306"
+    "\222\011\011\044\362\356\200\317\312\342\332\023\053\161\213\140"
+    "\300\000\161\301\336\360\171\346\163\166\303\215\251\223\364\252"
+    "\311\060\240\045\312\331\141\306\160\345\023\200\241\144\360\047"
+    "\304\063\312\312\021\076\033\171\021\230\346\071\053\337\234\035"
+    "\277\325\131\340\064\275\310\151\166\312\113\226\137\360\331\021"
+    "\160\362\313\252\112\201\051\130\034\237\274\375\150\374\363\355"
+    "\221\242\101\376\375\327\357\377\116\166\155\340\147\367\001\077"
+    "\137\003\266\226\135\122\234\201\324\367\113\161\170\023\263\054"
+    "\303\304\330\047\312\027\105\221\364\212\362\232\246\245\045\312"
+    "\057\031\275\154\211\362\222\226\225\026\101\152\377\034\166\242"
+    "\157\276\325\116\126\051\131\115\330\271\127\220\147\167\007\220"
+    "\126\374\214\161\057\215\166\166\123\157\057\172\266\233\176\374"
+    "\061\320\104\152\341\242\256\146\376\207\075\260\213\027\147\264"
+    "\252\242\141\045\210\214\001\352\075\275\105\174\315\346\071\241"
+    "\061\117\257\060\144\311\152\270\277\267\005\207\366\077\214\254"
+    "\214\323\103\247\032\356\077\275\025\334\276\053\322\334\047\144"
+    "\264\122\207\273\165\177\257\336\237\365\150\373\323\036\105\177"
+    "\142\164\274\043\270\001\013\210\161\025\017\107\234\315\375\134"
+    "\076\007\061\144\241\313\067\064\117\062\126\076\326\341\305\235"
+    "\261\070\105\104\221\033\247\100\233\150\123\141\341\175\365\060"
+    "\051\205\326\105\016\101\244\301\260\043\114\241\204\160\367\104"
+    "\063\114\363\151\261\001\103\205\326\051\077\200\214\374\330\026"
+    "\154\100\116\241\165\221\103\220\041\127\261\270\056\123\276\304"
+    "\130\357\245\131\055\144\252\263\221\155\312\172\177\234\002\200"
+    "\264\360\114\222\061\332\201\252\132\056\105\246\177\016\201\377"
+    "\347\077\201\033\303\237\357\333\007\171\312\063\326\171\350\024"
+    "\321\240\054\117\310\311\202\345\315\135\244\357\202\260\017\337"
+    "\304\240\072\367\220\201\242\303\214\070\170\116\046\355\014\163"
+    "\221\251\264\274\052\344\155\002\342\076\037\236\336\332\050\253"
+    "\344\345\374\103\143\056\250\300\020\025\007\263\064\113\174\133"
+    "\031\243\036\024\103\175\344\052\001\063\326\103\056\322\140\132"
+    "\066\162\157\046\022\137\353\106\332\121\155\071\224\154\075\320"
+    "\206\221\212\121\033\250\302\250\003\242\110\215\144\273\341\246"
+    "\004\304\255\370\022\312\052\350\250\052\312\210\054\040\241\161"
+    "\206\211\034\141\105\056\016\104\376\050\332\367\354\263\276\035"
+    "\242\101\042\310\257\254\232\350\364\016\330\075\266\032\207\372"
+    "\174\236\162\334\367\261\107\014\100\130\301\070\250\352\070\146"
+    "\125\165\100\263\354\234\306\227\262\240\353\225\311\141\123\325"
+    "\216\202\127\137\233\336\124\120\062\366\153\132\270\246\365\150"
+    "\367\161\255\366\113\123\125\332\363\311\357\020\112\202\006\007"
+    "\157\265\161\217\343\233\113\335\242\323\315\012\150\120\336\237"
+    "\234\236\101\067\210\355\365\104\263\023\035\230\041\130\147\134"
+    "\221\133\353\306\260\032\010\204\120\151\111\126\224\226\312\106"
+    "\255\265\072\203\262\263\254\142\342\210\253\125\147\245\131\314"
+    "\201\004\275\300\127\223\257\363\313\274\270\316\145\067\105\144"
+    "\127\170\157\153\206\006\221\026\006\347\050\324\101\253\071\173"
+    "\100\000\323\332\331\014\241\203\315\030\055\215\307\030\127\110"
+    "\363\105\315\253\010\367\334\027\304\027\131\346\023\001\015\040"
+    "\073\343\136\340\141\356\241\020\304\262\120\340\301\020\016\036"
+    "\122\270\213\130\106\373\102\075\342\071\344\320\314\107\121\104"
+    "\342\031\213\057\317\213\033\162\167\347\002\112\232\244\005\101"
+    "\043\210\155\201\307\222\150\012\075\066\153\264\055\140\127\064"
+    "\253\041\061\212\027\240\225\333\130\177\175\244\103\243\232\025"
+    "\327\157\013\040\232\137\370\114\046\231\100\231\041\042\012\000"
+    "\315\075\221\146\127\030\260\120\117\126\366\161\332\226\114\236"
+    "\304\226\105\121\263\232\025\324\054\362\075\024\246\133\343\372"
+    "\102\131\317\053\142\110\020\130\053\036\311\134\234\356\147\135"
+    "\057\340\155\230\275\254\071\057\362\123\016\217\376\271\170\016"
+    "\224\320\201\352\325\201\345\023\011\121\135\220\360\042\205\204"
+    "\235\237\200\205\111\132\321\163\170\023\210\170\131\203\011\364"
+    "\256\172\341\226\157\074\064\303\372\022\051\230\125\215\014\176"
+    "\273\327\207\030\260\264\157\054\333\346\251\354\336\101\344\036"
+    "\071\356\356\024\207\123\221\021\211\066\211\160\130\273\247\223"
+    "\073\054\071\064\232\357\236\213\010\267\017\235\226\155\324\070"
+    "\071\054\205\217\303\137\131\260\337\246\025\017\113\066\057\256"
+    "\030\124\165\305\103\304\234\014\324\165\266\255\035\213\014\115"
+    "\222\026\015\021\267\242\150\036\027\011\315\304\053\042\026\306"
+    "\204\101\157\120\054\325\246\151\311\160\171\162\305\312\214\056"
+    "\037\354\313\054\334\060\115\042\042\066\306\205\334\041\055\004"
+    "\253\067\151\343\131\254\321\134\064\005\067\336\210\271\301\136"
+    "\247\036\153\320\072\175\164\207\115\251\033\355\266\151\313\127"
+    "\064\213\362\033\361\232\277\021\141\211\272\116\127\116\012\134"
+    "\262\147\242\323\352\243\072\373\324\020\025\210\353\064\105\247"
+    "\326\322\101\126\124\375\044\145\240\064\112\100\344\016\025\340"
+    "\066\161\160\232\354\103\076\342\051\344\232\135\027\356\364\061"
+    "\017\271\340\113\250\316\033\351\022\021\327\305\303\342\356\136"
+    "\372\165\121\360\015\315\043\121\327\211\116\305\076\161\215\350"
+    "\264\216\306\016\243\007\220\204\106\332\176\266\206\045\117\077"
+    "\210\206\052\170\020\111\136\152\075\160\326\105\223\024\332\361"
+    "\335\211\047\110\264\061\215\235\331\110\325\162\026\102\305\207"
+    "\306\017\012\266\215\331\227\211\254\302\254\046\106\262\337\165"
+    "\050\136\262\045\326\377\103\201\100\372\110\031\163\313\364\172"
+    "\170\005\317\230\047\031\310\355\023\240\221\100\127\005\135\221"
+    "\315\106\113\140\316\102\116\335\364\240\073\145\136\323\231\276"
+    "\270\236\036\334\016\124\022\234\330\340\140\040\202\166\322\270"
+    "\223\352\126\215\265\203\201\364\305\211\145\132\354\316\300\251"
+    "\046\175\341\205\127\202\122\340\156\352\016\216\335\300\335\240"
+    "\270\212\355\046\110\300\146\052\102\136\056\217\240\260\270\211"
+    "\133\265\221\366\121\154\106\354\265\056\153\043\253\315\171\001"
+    "\252\342\276\270\242\156\162\002\321\316\021\061\034\150\176\170"
+    "\020\262\210\233\070\365\113\271\233\174\007\165\033\005\334\321"
+    "\140\141\201\236\216\210\242\010\236\370\377\370\351\055\062\137"
+    "\165\366\107\122\220\342\122\066\107\033\244\114\215\152\047\217"
+    "\163\236\173\360\337\170\121\246\163\132\142\132\062\130\266\360"
+    "\344\344\027\066\310\311\226\362\106\302\276\315\375\245\013\070"
+    "\116\246\117\213\371\006\077\203\044\134\324\334\027\044\014\341"
+    "\051\134\242\362\107\301\316\366\266\365\053\015\122\334\325\026"
+    "\002\221\246\051\064\371\256\215\212\134\355\343\023\376\046\221"
+    "\375\257\115\165\115\313\274\257\213\126\157\234\102\256\215\315"
+    "\145\243\167\231\254\142\100\066\221\106\163\160\035\303\111\145"
+    "\264\121\154\003\212\234\145\264\246\037\032\375\030\313\232\304"
+    "\027\113\125\157\176\023\033\277\353\052\011\315\057\164\157\141"
+    "\141\272\027\221\240\065\244\256\253\110\204\221\171\352\276\114"
+    "\257\247\332\252\272\317\243\035\101\072\334\332\121\371\006\256"
+    "\055\146\010\322\073\271\032\071\374\120\027\046\057\336\037\171"
+    "\202\236\167\040\116\044\244\317\241\007\236\370\247\317\257\325"
+    "\264\140\270\257\360\000\163\261\277\207\171\072\277\330\377\165"
+    "\121\227\036\316\130\220\235\220\331\233\321\312\073\147\360\040"
+    "\045\115\074\105\140\132\147\331\362\311\336\226\072\271\267\265"
+    "\260\051\152\316\202\106\023\113\377\374\313\337\376\365\217\077"
+    "\172\232\335\321\174\121\224\234\346\174\142\350\170\147\240\025"
+    "\305\372\072\315\062\257\310\263\045\010\340\241\102\163\130\305"
+    "\054\364\336\147\014\136\254\300\157\027\113\017\312\241\127\321"
+    "\053\346\245\152\050\313\262\145\150\111\043\203\266\103\051\122"
+    "\064\323\272\333\012\311\350\071\313\160\350\024\015\101\031\352"
+    "\207\346\175\143\002\220\126\140\130\047\326\350\302\133\342\002"
+    "\352\026\064\207\067\026\145\300\024\363\001\117\324\240\041\132"
+    "\170\350\301\333\214\305\306\045\043\260\207\236\034\047\014\241"
+    "\174\340\356\152\350\201\055\022\324\214\103\132\106\250\046\240"
+    "\203\021\265\064\364\164\130\015\325\370\041\304\155\065\030\033"
+    "\356\037\300\142\157\113\236\267\156\345\250\256\131\064\031\020"
+    "\243\157\363\264\321\140\337\137\262\154\104\047\010\216\176\113"
+    "\300\320\247\140\355\304\073\136\112\143\264\360\177\120\051\263"
+    "\010\254\207\275\016\132\241\372\043\061\065\352\355\131\214\031"
+    "\125\277\322\234\301\246\321\054\102\371\322\214\062\131\233\052"
+    "\243\310\356\245\047\255\130\126\373\357\312\145\110\261\033\026"
+    "\037\024\363\071\305\001\051\262\047\315\310\025\126\057\171\336"
+    "\373\301\106\250\335\117\161\125\370\106\162\147\076\243\200\356"
+    "\200\246\143\023\053\307\042\145\311\023\322\200\133\043\011\121"
+    "\115\145\226\042\335\366\134\247\152\313\322\105\130\217\114\132"
+    "\264\127\301\047\333\302\122\053\371\357\275\235\374\253\223\143"
+    "\305\016\307\113\220\302\203\151\235\307\370\323\214\357\114\272"
+    "\253\350\236\121\017\042\220\037\073\365\156\306\240\270\152\174"
+    "\134\367\323\170\276\143\304\252\346\253\352\043\034\061\055\227"
+    "\337\337\340\270\316\076\353\174\130\321\362\315\126\176\020\024"
+    "\305\205\064\252\234\267\222\131\232\044\062\274\015\100\360\125"
+    "\123\172\173\137\246\107\353\253\011\041\272\023\341\032\167\144"
+    "\115\144\215\026\321\075\364\120\026\217\122\341\060\025\247\363"
+    "\205\317\365\223\373\335\210\370\125\000\257\155\340\315\347\077"
+    "\146\202\216\263\116\061\341\303\037\257\161\041\203\017\256\127"
+    "\114\075\163\020\137\055\241\372\201\352\324\260\325\100\240\254"
+    "\307\131\015\157\121\076\071\043\243\273\273\056\300\230\340\067"
+    "\072\110\134\374\070\362\012\147\252\215\114\146\170\251\162\205"
+    "\006\274\253\347\321\202\226\025\073\312\271\203\336\103\010\360"
+    "\275\237\171\073\306\327\045\321\036\144\033\023\247\353\220\350"
+    "\337\371\210\213\256\211\232\365\107\043\353\127\004\354\016\174"
+    "\162\224\203\025\323\244\021\161\102\002\133\060\255\133\215\147"
+    "\164\253\176\345\146\123\132\147\374\104\333\150\260\144\264\234"
+    "\220\034\174\256\114\143\022\100\362\317\371\154\102\240\215\050"
+    "\071\054\023\170\017\266\240\063\150\174\046\344\023\050\333\027"
+    "\051\202\347\151\136\163\146\357\310\366\334\336\101\351\176\123"
+    "\344\342\213\056\115\270\151\252\245\037\031\171\302\060\164\105"
+    "\014\232\317\166\126\315\307\045\250\044\136\274\055\142\150\326"
+    "\116\205\117\370\165\016\007\241\103\111\002\207\344\350\241\017"
+    "\146\304\204\137\211\201\161\351\150\126\340\004\230\114\036\124"
+    "\070\332\126\375\064\243\136\254\045\315\257\130\106\361\143\012"
+    "\141\120\073\012\066\012\015\204\375\077\064\176\140\150\240\125"
+    "\241\005\224\372\027\333\217\013\026\260\100\043\233\311\202\111"
+    "\072\235\036\127\021\000\033\141\306\236\053\234\031\163\212\370"
+    "\250\242\143\312\147\341\064\053\300\341\344\161\157\313\373\154"
+    "\133\336\020\356\247\320\274\075\157\307\362\201\057\153\051\203"
+    "\376\151\305\163\060\077\333\156\120\065\233\050\332\171\116\166"
+    "\324\322\243\027\005\231\174\200\367\162\011\135\151\064\004\174"
+    "\350\244\271\363\354\331\266\251\111\030\353\216\344\032\017\105"
+    "\157\224\047\321\024\147\134\030\276\002\262\222\010\066\117\363"
+    "\305\015\135\366\320\027\162\010\315\040\216\267\357\175\336\334"
+    "\125\274\016\366\127\237\307\145\064\125\342\114\132\131\232\233"
+    "\300\263\271\010\356\257\004\124\137\343\261\071\245\355\204\217"
+    "\310\053\170\111\067\257\050\057\373\003\344\124\353\143\132\010"
+    "\303\054\104\117\105\330\153\301\332\037\101\077\006\162\301\173"
+    "\200\312\206\260\243\323\361\156\223\242\334\324\324\365\341\347"
+    "\132\331\370\051\013\301\206\206\275\267\064\214\254\353\270\251"
+    "\144\243\353\074\316\147\176\072\221\221\326\165\232\047\220\113"
+    "\232\017\061\043\373\233\122\153\337\240\066\037\210\233\047\003"
+    "\163\276\107\265\027\006\243\371\352\304\074\031\230\376\321\135"
+    "\375\065\373\115\347\147\236\166\377\003\050\232\264\041\255\056"
+    "\000\000"
+    // wifi.js
+    R"(class WiFiHandler{
+constructor(options={}){
+this.config={
+scanButtonId:options.scanButtonId||'scan-button',
+formId:options.formId||'wifi-form',
+networkListId:options.networkListId||'network-list',
+clearButtonId:options.clearButtonId||'clear-button',
+scanTextId:options.scanTextId||'scan-text',
+loadNetworkStatus:options.loadNetworkStatus||false,
+instanceName:options.instanceName||'wifiHandler',
+...options
+};
+this.selectedNetwork=null;
+this.isScanning=false;
+this.init();
+}
+init(){
+this.bindEvents();
+setTimeout(()=> this.scanNetworks(),500);
+if(this.config.loadNetworkStatus){
+this.loadCurrentNetworkStatus();
+}
+}
+bindEvents(){
+const scanBtn=document.getElementById(this.config.scanButtonId);
+const form=document.getElementById(this.config.formId);
+const clearBtn=document.getElementById(this.config.clearButtonId);
+if(scanBtn)scanBtn.onclick=()=> this.scanNetworks();
+if(form)form.onsubmit=(e)=> this.handleFormSubmit(e);
+if(clearBtn)clearBtn.onclick=()=> this.clearForm();
+}
+async scanNetworks(){
+if(this.isScanning)return;
+this.isScanning=true;
+this.updateScanButton('⟳ Scanning...',true);
+this.showLoading('Scanning for networks...');
+try{
+const data=await NetworkUtils.scanNetworks();
+if(data.networks&&data.networks.length > 0){
+this.displayNetworks(data.networks);
+}else{
+this.showMessage('No networks found. Try scanning again.');
+}
+}catch(error){
+console.error('Scan error:',error);
+this.showMessage('Scan failed. Please try again.');
+}finally{
+this.isScanning=false;
+this.updateScanButton('🔍 Scan for Networks',false);
+}
+}
+displayNetworks(networks){
+const networkList=document.getElementById(this.config.networkListId);
+if(!networkList)return;
+networkList.innerHTML='';
+networks.forEach(network=>{
+const item=NetworkUtils.renderNetworkItem(network,(ssid,element)=>{
+this.selectNetwork(ssid,element);
+});
+networkList.appendChild(item);
+});
+}
+selectNetwork(ssid,element){
+UIUtils.selectNetworkItem(element);
+this.selectedNetwork=ssid;
+const ssidInput=document.getElementById('ssid');
+const passwordInput=document.getElementById('password');
+if(ssidInput)ssidInput.value=ssid;
+if(passwordInput)passwordInput.focus();
+}
+clearForm(){
+const ssidInput=document.getElementById('ssid');
+const passwordInput=document.getElementById('password');
+if(ssidInput)ssidInput.value='';
+if(passwordInput)passwordInput.value='';
+this.selectedNetwork=null;
+UIUtils.selectNetworkItem(null);
+}
+resetWiFi(){
+UIUtils.showConfirm(
+'Reset WiFi Settings',
+'This will reset all WiFi settings and restart the device in configuration mode. This action cannot be undone.',
+()=>{
+AuthUtils.fetch('/api/reset',{method:'POST'})
+.then(()=>{
+UIUtils.showAlert('WiFi Reset','WiFi settings have been reset. The device will restart in configuration mode.','info');
+})
+.catch(()=>{
+});
+}
+);
+}
+async handleFormSubmit(event){
+event.preventDefault();
+const ssidInput=document.getElementById('ssid');
+const passwordInput=document.getElementById('password');
+const ssid=ssidInput?ssidInput.value.trim():'';
+const password=passwordInput?passwordInput.value:'';
+if(!ssid){
+UIUtils.showAlert('Network Required','Please select a network or enter a network name to continue.','warning');
+return false;
+}
+const submitBtn=event.target.querySelector('button[type="submit"]');
+UIUtils.updateButtonState(submitBtn,true,'⟳ Connecting...');
+try{
+const data=await AuthUtils.fetchJSON('/api/wifi',{
+method:'POST',
+body:JSON.stringify({
+ssid:ssid,
+password:password
+})
+});
+if(data.success){
+UIUtils.showAlert('Success!',
+`WiFi credentials saved for network "${data.ssid}". Device will restart to connect.`,
+'success');
+const form=document.getElementById(this.config.formId);
+if(form){
+const inputs=form.querySelectorAll('input, button');
+inputs.forEach(input=> input.disabled=true);
+}
+}else{
+UIUtils.showAlert('Configuration Failed',data.error||'Failed to save WiFi credentials','error');
+UIUtils.updateButtonState(submitBtn,false,'Connect to WiFi');
+}
+}catch(error){
+console.error('WiFi config error:',error);
+UIUtils.showAlert('Connection Error','Failed to communicate with device','error');
+UIUtils.updateButtonState(submitBtn,false,'Connect to WiFi');
+}
+return false;
+}
+updateScanButton(text,disabled){
+const scanText=document.getElementById(this.config.scanTextId);
+const scanBtn=document.getElementById(this.config.scanButtonId);
+if(scanText)scanText.innerHTML=text;
+if(scanBtn)scanBtn.disabled=disabled;
+}
+showLoading(message){
+const networkList=document.getElementById(this.config.networkListId);
+UIUtils.showLoading(networkList,message);
+}
+showMessage(message){
+const networkList=document.getElementById(this.config.networkListId);
+UIUtils.showError(networkList,message);
+}
+async loadCurrentNetworkStatus(){
+try{
+const response=await AuthUtils.fetch('/api/network');
+const data=await response.json();
+const elements={
+'currentSsid':data?.network?.ssid||'Not connected',
+'signalStrength':data?.network?.signalStrength?data.network.signalStrength + ' dBm':'N/A',
+'ipAddress':data?.network?.ipAddress||'N/A',
+'macAddress':data?.network?.macAddress||'N/A'
+};
+Object.entries(elements).forEach(([id,value])=>{
+const element=document.getElementById(id);
+if(element)element.textContent=value;
+});
+}catch(error){
+console.error('Failed to fetch WiFi status:',error);
+['currentSsid','signalStrength','ipAddress','macAddress'].forEach(id=>{
+const element=document.getElementById(id);
+if(element)element.textContent='Error loading data';
+});
+}
+}
+}
+function togglePassword(){
+const passwordField=document.getElementById('password');
+const toggleButton=document.querySelector('.password-toggle');
+if(!passwordField||!toggleButton)return;
+if(passwordField.type==='password'){
+passwordField.type='text';
+toggleButton.innerHTML='Hide';
+toggleButton.title='Hide password';
+}else{
+passwordField.type='password';
+toggleButton.innerHTML='Show';
+toggleButton.title='Show password';
+}
+}
+document.addEventListener('DOMContentLoaded',function(){
+const configForm=document.getElementById('wifi-form');
+const managementForm=document.getElementById('connectForm');
+let wifiHandler;
+if(configForm){
+window.configPortal=window.wifiHandler=new WiFiHandler({
+scanButtonId:'scan-button',
+formId:'wifi-form',
+networkListId:'network-list',
+clearButtonId:'clear-button',
+scanTextId:'scan-text',
+loadNetworkStatus:false,
+instanceName:'configPortal'
+});
+wifiHandler=window.configPortal;
+}else if(managementForm){
+window.wifiManager=window.wifiHandler=new WiFiHandler({
+scanButtonId:'scan-button',
+formId:'connectForm',
+networkListId:'network-list',
+clearButtonId:'clear-button',
+scanTextId:'scan-text',
+loadNetworkStatus:true,
+instanceName:'wifiManager'
+});
+wifiHandler=window.wifiManager;
+}
+const form=configForm||managementForm;
+if(form){
+form.addEventListener('submit',function(e){
+const csrf=AuthUtils.getCsrfToken();
+if(csrf){
+const existingCsrf=form.querySelector('input[name="_csrf"]');
+if(existingCsrf){
+existingCsrf.remove();
+}
+const input=document.createElement('input');
+input.type='hidden';
+input.name='_csrf';
+input.value=csrf;
+form.appendChild(input);
+}
+});
+}
+});)" "\0"
+    "\037\213\010\000\000\000\000\000\002\003\315\130\335\216\333\266"
+    "\022\276\327\123\160\027\105\051\243\212\222\233\336\070\120\026"
+    "\233\115\026\331\203\144\023\324\033\234\213\040\070\345\112\264"
+    "\315\106\226\134\211\132\327\360\372\021\172\327\373\074\104\337"
+    "\250\117\320\107\350\314\220\224\050\133\166\366\234\223\123\034"
+    "\054\260\026\311\341\314\160\176\076\316\060\315\105\135\263\177"
+    "\252\113\365\112\024\131\056\253\115\220\226\105\255\253\046\325"
+    "\145\025\226\113\255\140\230\154\266\243\115\240\347\252\216\141"
+    "\165\252\146\311\046\250\123\121\074\157\264\056\213\253\154\154"
+    "\351\142\177\362\376\236\343\360\321\055\215\171\024\114\313\152"
+    "\341\321\232\041\120\255\324\124\075\302\021\320\024\122\257\312"
+    "\352\323\153\125\153\217\264\067\013\073\354\370\121\016\023\260"
+    "\051\315\245\250\366\164\351\315\302\046\032\167\332\240\156\067"
+    "\362\027\275\243\275\231\162\272\153\030\001\155\136\212\354\332"
+    "\310\234\150\241\233\272\335\262\267\162\177\077\025\171\055\243"
+    "\100\201\025\105\221\312\153\261\220\055\271\077\151\117\156\355"
+    "\016\122\342\070\266\164\301\366\251\261\166\055\163\231\152\351"
+    "\104\044\105\223\347\166\111\325\023\320\260\120\305\054\041\211"
+    "\156\272\120\072\034\075\015\266\201\371\262\156\273\125\105\366"
+    "\362\116\026\272\306\305\132\352\033\265\220\145\243\303\160\224"
+    "\074\143\106\026\260\263\162\200\050\372\376\311\023\240\124\323"
+    "\320\163\373\376\161\035\177\134\270\150\252\012\044\364\326\215"
+    "\052\333\300\227\157\103\214\121\260\350\042\311\312\264\131\300"
+    "\122\074\223\372\145\056\361\363\371\372\052\353\011\366\003\013"
+    "\130\032\006\030\063\017\332\155\102\255\335\147\042\343\201\222"
+    "\173\141\144\054\142\025\037\331\337\270\054\322\134\245\237\222"
+    "\103\266\244\115\250\303\010\377\001\171\335\334\056\224\116\102"
+    "\331\156\230\123\024\134\302\362\204\326\140\211\166\071\125\107"
+    "\356\143\100\030\055\341\126\143\154\121\257\213\224\365\065\330"
+    "\264\216\354\302\146\124\111\335\124\305\176\070\101\362\273\150"
+    "\152\226\231\320\162\322\032\077\344\177\174\376\235\071\112\010"
+    "\130\036\041\365\310\205\353\274\134\275\206\110\200\265\220\073"
+    "\052\164\023\263\031\133\343\026\244\256\326\056\012\100\200\110"
+    "\304\112\050\315\254\276\357\265\312\007\115\210\244\016\013\352"
+    "\157\277\355\015\343\134\026\063\075\147\317\330\023\027\223\231"
+    "\252\227\271\130\267\114\172\364\150\052\011\151\263\351\064\177"
+    "\043\353\132\314\144\310\257\313\126\137\120\276\051\262\230\335"
+    "\124\153\062\051\035\110\314\204\052\350\034\020\332\251\320\351"
+    "\074\224\125\125\126\066\262\313\134\306\064\066\066\140\364\075"
+    "\346\221\241\171\072\040\220\310\246\102\345\022\104\275\003\167"
+    "\326\222\201\211\174\101\123\125\210\074\137\157\216\046\377\276"
+    "\273\376\374\374\333\257\314\260\007\057\070\123\360\210\166\331"
+    "\334\334\265\123\153\042\347\042\017\176\037\224\062\075\270\066"
+    "\256\073\361\346\332\300\363\346\000\267\012\131\275\272\171\363"
+    "\072\341\274\135\241\113\342\245\000\373\332\211\344\231\323\111"
+    "\151\271\110\172\001\003\330\223\311\312\116\135\301\262\333\024"
+    "\205\165\255\262\110\032\155\107\310\303\003\127\273\241\117\003"
+    "\206\031\365\365\023\313\045\360\277\230\253\074\013\121\266\045"
+    "\331\006\107\270\154\202\367\127\066\230\175\042\322\255\223\064"
+    "\010\364\310\307\301\025\176\137\025\313\346\260\361\071\222\360"
+    "\026\337\226\160\247\003\227\057\155\162\144\334\242\232\023\063"
+    "\152\277\342\073\221\067\322\052\003\044\075\306\243\336\010\074"
+    "\225\072\270\367\000\151\363\377\162\006\214\252\057\234\240\043"
+    "\074\162\367\036\366\050\256\323\361\053\011\367\053\226\124\241"
+    "\037\001\220\357\027\230\036\140\225\200\377\200\044\124\166\261"
+    "\211\324\032\362\030\162\062\340\067\040\227\255\124\236\063\342"
+    "\301\040\343\015\121\155\211\030\134\023\270\246\105\245\001\374"
+    "\045\313\344\235\112\045\123\005\063\271\327\124\002\053\010\266"
+    "\050\063\011\250\205\374\104\112\063\210\027\245\146\267\222\001"
+    "\240\225\205\004\350\016\102\112\206\363\106\317\215\222\123\211"
+    "\130\306\037\213\245\172\114\032\360\150\263\220\172\136\146\143"
+    "\376\356\355\344\206\157\107\101\014\142\213\320\354\364\017\167"
+    "\016\105\214\016\071\251\373\203\331\313\373\272\317\305\235\004"
+    "\371\262\060\247\103\365\332\003\270\103\323\301\206\117\003\374"
+    "\124\061\055\011\015\101\015\203\273\106\017\223\211\336\355\267"
+    "\177\235\336\231\204\244\337\170\131\321\357\013\071\025\115\116"
+    "\345\322\337\027\245\235\244\244\025\167\266\023\255\261\256\024"
+    "\044\317\030\143\261\057\050\351\111\074\033\010\340\261\215\364"
+    "\023\344\071\032\364\221\215\132\160\323\317\215\252\144\006\226"
+    "\265\227\216\211\152\046\034\344\063\270\064\340\024\262\362\246"
+    "\012\250\135\231\056\321\105\340\327\206\034\263\022\025\136\106"
+    "\170\076\003\356\314\136\113\133\167\136\162\003\326\134\306\003"
+    "\340\147\060\122\374\163\043\253\365\204\204\342\165\151\212\363"
+    "\017\172\275\224\311\251\331\162\372\021\231\272\103\230\013\316"
+    "\134\156\130\140\312\260\145\114\205\110\104\365\011\344\131\001"
+    "\034\155\205\162\260\334\330\211\373\177\114\336\136\333\330\307"
+    "\272\034\102\077\350\305\176\024\334\226\331\172\214\144\061\064"
+    "\110\300\135\115\327\041\064\102\140\347\061\341\176\340\334\061"
+    "\166\037\030\251\133\257\170\251\233\064\205\113\177\330\055\023"
+    "\263\170\002\222\176\244\314\111\301\067\140\054\005\246\144\065"
+    "\044\117\346\227\122\354\364\233\215\341\011\242\267\247\061\173"
+    "\061\220\111\306\115\150\214\370\107\300\027\053\236\377\027\025"
+    "\264\253\144\333\173\030\043\257\116\250\260\355\171\363\074\317"
+    "\103\116\253\021\263\115\027\156\047\362\366\132\247\041\324\261"
+    "\364\213\005\233\270\205\032\050\261\065\345\326\225\150\003\306"
+    "\272\350\001\304\045\325\116\074\042\203\120\235\005\335\225\231"
+    "\104\033\240\361\330\256\111\041\154\211\362\241\361\145\372\072"
+    "\156\203\013\331\042\307\207\124\201\106\062\051\274\127\014\016"
+    "\037\215\302\027\316\365\222\024\214\274\243\244\345\142\321\024"
+    "\012\344\241\253\241\340\065\000\372\065\017\263\233\301\173\125"
+    "\045\166\305\221\163\126\257\235\303\356\371\301\375\234\151\265"
+    "\073\110\374\317\333\101\333\223\041\303\221\373\360\052\112\324"
+    "\167\260\161\153\003\316\175\120\101\347\065\061\013\123\241\177"
+    "\265\112\330\367\266\223\341\321\104\116\236\323\303\165\010\377"
+    "\113\075\050\306\016\152\141\356\323\303\355\375\306\007\127\200"
+    "\235\045\174\310\141\200\265\340\152\045\165\040\344\101\262\143"
+    "\020\377\124\103\234\265\024\266\130\256\223\115\300\123\243\306"
+    "\004\357\341\061\156\075\163\247\073\043\050\204\304\277\206\072"
+    "\307\302\036\202\002\340\236\232\101\367\064\321\025\365\210\373"
+    "\333\172\313\147\176\237\270\263\306\276\143\234\145\317\027\174"
+    "\314\257\037\237\043\153\265\074\317\262\012\101\165\227\153\273"
+    "\202\032\031\342\205\110\017\121\167\113\226\034\337\200\336\336"
+    "\376\204\320\015\307\255\224\254\135\317\120\217\132\374\014\077"
+    "\300\265\103\327\376\307\121\327\033\131\272\203\221\241\154\316"
+    "\270\036\304\376\306\230\047\200\010\032\367\022\123\333\343\034"
+    "\005\267\016\232\310\311\266\136\065\257\144\035\314\175\350\371"
+    "\055\332\365\110\344\331\061\362\315\364\261\273\052\262\257\173"
+    "\100\116\161\117\221\215\075\075\272\203\273\236\016\377\246\115"
+    "\141\060\130\227\263\131\056\337\331\033\275\153\151\334\035\177"
+    "\251\144\236\375\073\265\237\141\150\340\253\333\267\123\012\305"
+    "\156\337\043\103\156\033\234\223\236\324\373\373\023\237\131\333"
+    "\130\173\215\016\321\305\124\121\045\211\247\314\046\030\240\340"
+    "\364\336\011\365\222\307\324\357\314\137\251\114\356\056\153\245"
+    "\163\151\226\132\223\360\366\161\145\110\210\107\165\110\320\004"
+    "\160\351\200\040\134\352\011\302\027\014\147\104\221\231\127\106"
+    "\204\061\011\334\102\376\342\355\033\353\161\304\133\204\003\347"
+    "\330\316\223\006\044\057\217\325\102\336\043\165\353\307\205\050"
+    "\000\045\221\344\370\126\013\105\227\166\163\016\215\235\367\360"
+    "\153\236\371\132\015\100\251\225\202\006\155\145\241\373\135\131"
+    "\151\221\047\166\316\333\227\024\162\345\077\334\207\073\117\362"
+    "\303\217\357\107\036\333\217\277\252\037\171\076\377\302\123\371"
+    "\320\173\070\367\017\307\051\353\374\243\015\130\300\106\024\003"
+    "\143\365\355\336\031\014\071\274\241\265\352\353\331\313\167\336"
+    "\337\145\061\352\144\166\014\346\035\356\240\275\074\232\256\363"
+    "\242\022\277\213\257\373\373\276\371\374\212\236\212\370\375\024"
+    "\062\125\243\227\070\135\035\222\326\325\064\351\256\171\210\374"
+    "\013\230\271\051\077\311\302\276\331\042\105\113\056\177\001\246"
+    "\200\266\110\064\320\062\330\176\341\003\166\230\311\351\277\160"
+    "\253\151\377\020\312\275\255\330\307\173\303\270\222\213\362\116"
+    "\332\267\247\256\053\351\062\022\252\176\250\140\155\122\132\051"
+    "\155\067\142\121\151\256\062\350\014\270\233\044\035\070\351\320"
+    "\316\231\007\042\234\172\152\155\345\077\012\322\213\022\341\221"
+    "\373\377\027\150\152\256\106\135\033\000\000";
+
+// Sorted by path
+const AssetBundleEntry ASSET_BUNDLE_INDEX[] = {
+    {"/assets/account-page.js", "application/javascript", 0, 3676, 3677, 1201, "12197e945fc6"},
+    {"/assets/favicon.ico", "image/svg+xml", 4878, 1416, 6295, 512, "a7616dad17c0"},
+    {"/assets/favicon.svg", "image/svg+xml", 4878, 1416, 6295, 512, "a7616dad17c0"},
+    {"/assets/home-page.js", "application/javascript", 6807, 2948, 9756, 933, "84901d3eeb24"},
+    {"/assets/style.css", "text/css", 10689, 9288, 19978, 2361, "3d77a92e6b73"},
+    {"/assets/system-status.js", "application/javascript", 22339, 3822, 26162, 1013, "f979f5b2aea7"},
+    {"/assets/web-platform-style.css", "text/css", 27175, 2724, 29900, 956, "1c93fa11824c"},
+    {"/assets/web-platform-utils.js", "application/javascript", 30856, 11949, 42806, 3346, "4aa4bb999f8e"},
+    {"/assets/wifi.js", "application/javascript", 46152, 7005, 53158, 2123, "063f78837492"},
+};
+
+const AssetBundle ASSET_BUNDLE = {
+    ASSET_BUNDLE_DATA, ASSET_BUNDLE_INDEX,
+    sizeof(ASSET_BUNDLE_INDEX) / sizeof(ASSET_BUNDLE_INDEX[0])};
+
+#endif // ASSET_BUNDLE_DATA_H
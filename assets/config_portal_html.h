@@ -5,64 +5,134 @@
 #include <Arduino.h>
 
 const char CONFIG_PORTAL_HTML[] PROGMEM = R"rawliteral(
-<!-- Configuration portal main page with enhanced UI -->
 <!DOCTYPE html>
 <html>
 <head>
-    <title>{{DEVICE_NAME}} - WiFi Setup</title>
-    <meta name="viewport" content="width=device-width, initial-scale=1.0, user-scalable=no">
-    <meta charset="UTF-8">
-    <link rel="stylesheet" href="/assets/style.css">
-    <link rel="stylesheet" href="/assets/web-platform-style.css">
-    <link rel="icon" href="/assets/favicon.svg" type="image/svg+xml">
-    <link rel="icon" href="/assets/favicon.ico" sizes="any">
+<title>{{DEVICE_NAME}} - WiFi Setup</title>
+<meta name="viewport" content="width=device-width, initial-scale=1.0, user-scalable=no">
+<meta charset="UTF-8">
+<link rel="stylesheet" href="{{ASSET:/assets/style.css}}">
+<link rel="stylesheet" href="{{ASSET:/assets/web-platform-style.css}}">
+<link rel="icon" href="{{ASSET:/assets/favicon.svg}}" type="image/svg+xml">
+<link rel="icon" href="{{ASSET:/assets/favicon.ico}}" sizes="any">
 </head>
 <body>
-    <div class="container">
-        <h1>{{DEVICE_NAME}} WiFi Setup</h1>
-        
-        {{SECURITY_NOTICE}}
-        
-        <div class="status-card wifi-setup">
-            <div class="network-scanner">
-                <h3>Available Networks</h3>
-                <button type="button" class="btn scan-button" id="scan-button">
-                    <span id="scan-text">🔍 Scan for Networks</span>
-                </button>
-                <div class="network-list" id="network-list">
-                    <div class="loading">Click "Scan for Networks" to discover WiFi networks</div>
-                </div>
-            </div>
-            
-            <form id="wifi-form">
-                <div class="form-group">
-                    <label for="ssid">Network Name (SSID):</label>
-                    <input type="text" id="ssid" name="ssid" class="form-control" placeholder="Select network or enter manually" required>
-                </div>
-                <div class="form-group">
-                    <label for="password">Password:</label>
-                    <div class="password-field">
-                        <input type="password" id="password" name="password" class="form-control" placeholder="Leave empty for open networks">
-                        <button type="button" class="password-toggle" onclick="togglePassword()" title="Show password">
-                            Show
-                        </button>
-                    </div>
-                </div>
-                <div class="button-group">
-                    <button type="submit" class="btn btn-primary">Connect to WiFi</button>
-                    <button type="button" class="btn btn-secondary" id="clear-button">Clear Form</button>
-                </div>
-            </form>
-            
-            <div class="mt-3">
-                <p><small><strong>Note:</strong> Device will restart after saving credentials to establish connection.</small></p>
-            </div>
-        </div>
-    </div>
-    <script src="/assets/web-platform-utils.js"></script>
-    <script src="/assets/wifi.js"></script>
+<div class="container">
+<h1>{{DEVICE_NAME}} WiFi Setup</h1>
+{{SECURITY_NOTICE}}
+<div class="status-card wifi-setup">
+<div class="network-scanner">
+<h3>Available Networks</h3>
+<button type="button" class="btn scan-button" id="scan-button">
+<span id="scan-text">🔍 Scan for Networks</span>
+</button>
+<div class="network-list" id="network-list">
+<div class="loading">Click "Scan for Networks" to discover WiFi networks</div>
+</div>
+</div>
+<form id="wifi-form">
+<div class="form-group">
+<label for="ssid">Network Name (SSID):</label>
+<input type="text" id="ssid" name="ssid" class="form-control" placeholder="Select network or enter manually" required>
+</div>
+<div class="form-group">
+<label for="password">Password:</label>
+<div class="password-field">
+<input type="password" id="password" name="password" class="form-control" placeholder="Leave empty for open networks">
+<button type="button" class="password-toggle" onclick="togglePassword()" title="Show password">
+Show
+</button>
+</div>
+</div>
+<div class="button-group">
+<button type="submit" class="btn btn-primary">Connect to WiFi</button>
+<button type="button" class="btn btn-secondary" id="clear-button">Clear Form</button>
+</div>
+</form>
+<div class="mt-3">
+<p><small><strong>Note:</strong> Device will restart after saving credentials to establish connection.</small></p>
+</div>
+</div>
+</div>
+<script src="{{ASSET:/assets/web-platform-utils.js}}"></script>
+<script src="{{ASSET:/assets/wifi.js}}"></script>
 </body>
 </html>
 )rawliteral";
 
+const uint8_t CONFIG_PORTAL_HTML_GZ[] PROGMEM = {
+    0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0x95, 0x55,
+    0xc1, 0x6e, 0xdb, 0x30, 0x0c, 0xbd, 0xe7, 0x2b, 0x34, 0x9d, 0x5a, 0xac,
+    0x8e, 0x57, 0xf4, 0x32, 0x14, 0xb1, 0x81, 0x22, 0x4d, 0x81, 0x02, 0x5b,
+    0x5a, 0x2c, 0xe9, 0x86, 0x9e, 0x0a, 0x45, 0x66, 0x62, 0xad, 0xb2, 0xe4,
+    0x49, 0x72, 0xd2, 0x2c, 0xc8, 0x27, 0xec, 0xb6, 0xfb, 0x7e, 0x71, 0x9f,
+    0x30, 0xca, 0x76, 0x12, 0xbb, 0x69, 0x91, 0xf5, 0x90, 0xc8, 0x94, 0xc8,
+    0x47, 0xf2, 0x91, 0x94, 0x3a, 0xbd, 0x77, 0x97, 0x37, 0xfd, 0xf1, 0xfd,
+    0xed, 0x80, 0xa4, 0x2e, 0x93, 0x71, 0xa7, 0xb7, 0x59, 0x80, 0x25, 0xb8,
+    0x38, 0xe1, 0x24, 0xc4, 0xab, 0xd5, 0xe5, 0xe0, 0xeb, 0x75, 0x7f, 0xf0,
+    0x30, 0xbc, 0xf8, 0x3c, 0x58, 0xaf, 0x49, 0x40, 0xbe, 0x89, 0x2b, 0x41,
+    0x46, 0xe0, 0x8a, 0xbc, 0x17, 0x56, 0x3a, 0x9d, 0x5e, 0x06, 0x8e, 0x11,
+    0xc5, 0x32, 0x88, 0xe8, 0x5c, 0xc0, 0x22, 0xd7, 0xc6, 0x51, 0xc2, 0xb5,
+    0x72, 0xa0, 0x5c, 0x44, 0x17, 0x22, 0x71, 0x69, 0x94, 0xc0, 0x5c, 0x70,
+    0x08, 0x4a, 0xe1, 0x84, 0x08, 0x25, 0x9c, 0x60, 0x32, 0xb0, 0x9c, 0x49,
+    0x88, 0x4e, 0xbb, 0x1f, 0x4e, 0x48, 0x61, 0xc1, 0x94, 0x32, 0x9b, 0xe0,
+    0x96, 0xd2, 0x74, 0x03, 0xcc, 0x53, 0x66, 0x2c, 0x20, 0xd0, 0xdd, 0xf8,
+    0x2a, 0xf8, 0xe8, 0xb7, 0xa5, 0x50, 0x8f, 0xc4, 0x80, 0x8c, 0xa8, 0x75,
+    0x4b, 0x09, 0x36, 0x05, 0x40, 0x87, 0xa9, 0x81, 0x69, 0x44, 0x57, 0xab,
+    0x8b, 0xd1, 0x68, 0x30, 0x3e, 0x0f, 0x99, 0x45, 0x23, 0x1b, 0x96, 0x1a,
+    0x5d, 0x6e, 0xed, 0x7a, 0xfd, 0x56, 0xd3, 0x05, 0x4c, 0x82, 0x5c, 0x32,
+    0x37, 0xd5, 0x26, 0x0b, 0x5e, 0xc5, 0x11, 0x98, 0xe8, 0x6b, 0x08, 0x53,
+    0x36, 0xf7, 0xc7, 0x5d, 0x3b, 0x9f, 0xa1, 0x19, 0x71, 0xcb, 0x1c, 0x29,
+    0x12, 0x19, 0x9b, 0x41, 0x88, 0x5b, 0xef, 0x9f, 0x32, 0xf9, 0x76, 0x2c,
+    0xfc, 0xf3, 0x58, 0x56, 0xfc, 0x04, 0x1b, 0x51, 0xa6, 0x96, 0x1e, 0x22,
+    0xac, 0xab, 0x36, 0xd1, 0xc9, 0x12, 0x97, 0x44, 0xcc, 0x09, 0x97, 0x68,
+    0x18, 0x51, 0x5f, 0x06, 0x26, 0x14, 0x18, 0xaf, 0x96, 0x9e, 0xee, 0x55,
+    0xb4, 0x59, 0x4f, 0x3c, 0xee, 0xac, 0x56, 0xa3, 0x41, 0xff, 0xee, 0xcb,
+    0xf5, 0xf8, 0xfe, 0x61, 0x78, 0x33, 0x46, 0xc5, 0xf5, 0xba, 0x85, 0x67,
+    0x1d, 0x73, 0x85, 0x0d, 0x38, 0x33, 0x09, 0x59, 0x88, 0xa9, 0x08, 0xac,
+    0xb7, 0xa5, 0x6d, 0xa7, 0x0a, 0xdc, 0x42, 0x9b, 0x47, 0x5f, 0x4e, 0xb5,
+    0x71, 0x7d, 0x16, 0x5f, 0xcc, 0x99, 0x28, 0xab, 0x4b, 0x86, 0xd5, 0xb9,
+    0x45, 0x97, 0x67, 0x3e, 0xea, 0xc2, 0x39, 0xad, 0x6a, 0x7a, 0x2a, 0x81,
+    0x6e, 0xa0, 0x26, 0x4e, 0x11, 0x0f, 0x13, 0x6c, 0xf6, 0x45, 0x82, 0x41,
+    0x34, 0x36, 0xd0, 0xde, 0xe6, 0x4c, 0xed, 0xf6, 0x1d, 0x3c, 0x39, 0x1a,
+    0xff, 0xfd, 0xf3, 0xfb, 0x17, 0x19, 0xa1, 0x4c, 0xb0, 0x7c, 0x0d, 0x87,
+    0x5e, 0xd7, 0x13, 0x56, 0x59, 0xbf, 0x1c, 0xb6, 0x14, 0xd6, 0x55, 0x8e,
+    0x5a, 0x3b, 0x6d, 0x65, 0xa9, 0x59, 0x22, 0xd4, 0x8c, 0xc6, 0x7d, 0x29,
+    0xf8, 0x23, 0xa1, 0x7b, 0xbe, 0xb0, 0xde, 0x9a, 0x24, 0xc2, 0x72, 0x3d,
+    0x07, 0x53, 0xf1, 0xac, 0xb6, 0x61, 0x20, 0x90, 0x8f, 0xa2, 0xb5, 0xf8,
+    0x3e, 0x2b, 0xbd, 0x96, 0xbc, 0x7a, 0xe9, 0x99, 0xcb, 0xb2, 0x11, 0x67,
+    0x46, 0x57, 0x7c, 0x23, 0x95, 0x20, 0xbd, 0x47, 0xcc, 0xdb, 0x8a, 0x84,
+    0xc6, 0xb5, 0x63, 0x32, 0xc4, 0x49, 0x24, 0x47, 0xa3, 0xd1, 0xf5, 0xe5,
+    0xf1, 0x79, 0x2f, 0x2c, 0xd5, 0x50, 0x5d, 0xa8, 0xbc, 0x70, 0x35, 0xc7,
+    0x25, 0x45, 0x15, 0x63, 0xde, 0xb2, 0x9e, 0xdd, 0xea, 0xbb, 0xe9, 0xcb,
+    0x37, 0x8f, 0xd1, 0x92, 0x12, 0x1c, 0x03, 0x0e, 0xa9, 0x96, 0x09, 0xa0,
+    0xb7, 0x11, 0x48, 0xe0, 0x6e, 0x93, 0x0c, 0xc1, 0x94, 0x71, 0xce, 0x31,
+    0xc5, 0x8c, 0xa9, 0x82, 0x49, 0xb9, 0xa4, 0xd8, 0xcc, 0x3f, 0x0a, 0x61,
+    0x20, 0xd9, 0xe5, 0xf6, 0x3f, 0x59, 0xe4, 0x78, 0x8c, 0x88, 0x98, 0xc9,
+    0x6d, 0xfd, 0xd5, 0x08, 0xbf, 0x01, 0xb0, 0xd1, 0x0b, 0xa6, 0x02, 0x64,
+    0x42, 0x9f, 0xe5, 0xb6, 0x45, 0x29, 0xf3, 0xdb, 0x49, 0x55, 0x8e, 0x3b,
+    0xf9, 0x70, 0x9e, 0x9f, 0x80, 0xcd, 0x81, 0x40, 0x96, 0xbb, 0x65, 0x59,
+    0x58, 0x9d, 0x83, 0xda, 0x96, 0x90, 0x1e, 0xe8, 0xdb, 0x6d, 0x90, 0x4e,
+    0xcf, 0x66, 0x12, 0x28, 0xd1, 0x8a, 0xfb, 0x46, 0x41, 0xf2, 0xcb, 0x8d,
+    0x4d, 0x8a, 0x47, 0xc7, 0xd8, 0x27, 0xfe, 0x1e, 0x45, 0x5e, 0x53, 0xbd,
+    0x20, 0x3b, 0x12, 0x3a, 0x5e, 0x6e, 0x76, 0x6a, 0xbb, 0x5b, 0x1a, 0x84,
+    0x54, 0x1a, 0x3b, 0x4e, 0x5b, 0x71, 0xd9, 0x62, 0x92, 0x09, 0xd7, 0x9a,
+    0x27, 0xfc, 0x05, 0xb9, 0xc1, 0x7b, 0xc8, 0xe0, 0xe5, 0xd1, 0xd7, 0x38,
+    0xa2, 0x58, 0x4e, 0x6c, 0x56, 0xdf, 0xa3, 0x0d, 0x7f, 0x87, 0xc6, 0xd2,
+    0xc3, 0x58, 0x40, 0xee, 0x12, 0x0f, 0x54, 0xd2, 0xcd, 0x25, 0x30, 0xb3,
+    0x9d, 0xcc, 0xbe, 0x97, 0xc8, 0x15, 0x32, 0xfc, 0x42, 0x16, 0x9e, 0xf8,
+    0x76, 0x1a, 0x99, 0x0b, 0xce, 0x7c, 0xf8, 0x79, 0xdc, 0xb3, 0x19, 0x36,
+    0x12, 0x2e, 0x58, 0x15, 0x35, 0x8b, 0x87, 0xda, 0x01, 0xb6, 0x42, 0x2d,
+    0x91, 0xcb, 0xf2, 0x29, 0xc1, 0xdb, 0x47, 0x4a, 0xec, 0x34, 0xbc, 0x90,
+    0x8c, 0x23, 0x6c, 0xea, 0x3b, 0xd0, 0xe2, 0x1d, 0xa9, 0x66, 0x84, 0x63,
+    0xeb, 0x61, 0x4b, 0xe2, 0x03, 0x63, 0x7d, 0x5a, 0x5e, 0x65, 0x82, 0x13,
+    0x9c, 0xfa, 0x37, 0xc9, 0xe7, 0x2a, 0xf0, 0x1a, 0x45, 0xb8, 0xca, 0x47,
+    0x98, 0xef, 0x51, 0x5b, 0x2f, 0x96, 0x1b, 0x91, 0x3b, 0x62, 0x0d, 0x3f,
+    0xf0, 0x36, 0x14, 0x4e, 0x48, 0xdb, 0xfd, 0x5e, 0x3e, 0x0d, 0x88, 0x5b,
+    0x9a, 0x1d, 0xb2, 0xc7, 0x11, 0xdf, 0xb7, 0x08, 0xeb, 0xfb, 0x3b, 0xac,
+    0xde, 0xe2, 0x7f, 0xb8, 0xfb, 0xf9, 0x31, 0xa4, 0x07, 0x00, 0x00,
+};
+const size_t CONFIG_PORTAL_HTML_GZ_LEN = 839;
+const char CONFIG_PORTAL_HTML_HASH[] = "1c10306215eb";
+
 #endif // CONFIG_PORTAL_HTML_H
@@ -8,67 +8,119 @@ const char CONNECTED_HOME_HTML[] PROGMEM = R"(
 <!DOCTYPE html>
 <html>
 <head>
-    <title>{{DEVICE_NAME}} - Home</title>
-    <meta name="viewport" content="width=device-width, initial-scale=1">
-    <meta charset="UTF-8">
-    <link rel="stylesheet" href="/assets/style.css">
-    <link rel="icon" href="/assets/favicon.svg" type="image/svg+xml">
-    <link rel="icon" href="/assets/favicon.ico" sizes="any">
+<title>{{DEVICE_NAME}} - Home</title>
+<meta name="viewport" content="width=device-width, initial-scale=1">
+<meta charset="UTF-8">
+<link rel="stylesheet" href="{{ASSET:/assets/style.css}}">
+<link rel="icon" href="{{ASSET:/assets/favicon.svg}}" type="image/svg+xml">
+<link rel="icon" href="{{ASSET:/assets/favicon.ico}}" sizes="any">
 </head>
 <body>
-    <div class="container">
-        {{NAV_MENU}}
-        <h1>{{DEVICE_NAME}} Web Interface</h1>
-        
-        <div class="status-grid">
-            <div class="status-card">
-                <h3>Device Status</h3>
-                <div class="form-group">
-                    <label>SSID:</label>
-                    <div class="status-value" id="wifiSsid">Loading...</div>
-                </div>
-                <div class="form-group">
-                    <label>IP Address:</label>
-                    <div class="status-value" id="ipAddress">Loading...</div>
-                </div>
-                <div class="form-group">
-                    <label>Signal Strength:</label>
-                    <div class="status-value" id="signalStrength">Loading...</div>
-                </div>
-                <div class="form-group">
-                    <label>Uptime:</label>
-                    <div class="status-value" id="uptime">Loading...</div>
-                </div>
-                <div class="form-group">
-                    <label>Server:</label>
-                    <div class="status-value" id="serverProtocol">Loading...</div>
-                </div>
-                <div class="form-group">
-                    <label>Port:</label>
-                    <div class="status-value" id="serverPort">Loading...</div>
-                </div>
-                <div class="form-group">
-                    <label>Hostname:</label>
-                    <div class="status-value" id="hostname">Loading...</div>
-                </div>
-                <div class="form-group">
-                    <label>Free Memory:</label>
-                    <div class="status-value"><span id="freeMemory">Loading...</span> KB</div>
-                </div>
-            </div>
-        </div>
-        
-        <div class="status-card">
-            <h3>Available Modules</h3>
-            <div id="moduleList">
-                <p>Loading modules...</p>
-            </div>
-        </div>
-    </div>
-    <script src="/assets/home-page.js"></script>
-    <script src="/assets/web-platform-utils.js"></script>
+<div class="container">
+{{NAV_MENU}}
+<h1>{{DEVICE_NAME}} Web Interface</h1>
+<div class="status-grid">
+<div class="status-card">
+<h3>Device Status</h3>
+<div class="form-group">
+<label>SSID:</label>
+<div class="status-value" id="wifiSsid">Loading...</div>
+</div>
+<div class="form-group">
+<label>IP Address:</label>
+<div class="status-value" id="ipAddress">Loading...</div>
+</div>
+<div class="form-group">
+<label>Signal Strength:</label>
+<div class="status-value" id="signalStrength">Loading...</div>
+</div>
+<div class="form-group">
+<label>Uptime:</label>
+<div class="status-value" id="uptime">Loading...</div>
+</div>
+<div class="form-group">
+<label>Server:</label>
+<div class="status-value" id="serverProtocol">Loading...</div>
+</div>
+<div class="form-group">
+<label>Port:</label>
+<div class="status-value" id="serverPort">Loading...</div>
+</div>
+<div class="form-group">
+<label>Hostname:</label>
+<div class="status-value" id="hostname">Loading...</div>
+</div>
+<div class="form-group">
+<label>Free Memory:</label>
+<div class="status-value"><span id="freeMemory">Loading...</span> KB</div>
+</div>
+</div>
+</div>
+<div class="status-card">
+<h3>Available Modules</h3>
+<div id="moduleList">
+<p>Loading modules...</p>
+</div>
+</div>
+</div>
+<script src="{{ASSET:/assets/home-page.js}}"></script>
+<script src="{{ASSET:/assets/web-platform-utils.js}}"></script>
 </body>
 </html>
 )";
 
+const uint8_t CONNECTED_HOME_HTML_GZ[] PROGMEM = {
+    0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xa5, 0x95,
+    0x51, 0x6f, 0x9b, 0x30, 0x10, 0xc7, 0xdf, 0xfb, 0x29, 0x3c, 0x5e, 0x37,
+    0x82, 0xaa, 0xbe, 0x4c, 0x15, 0x20, 0x65, 0x0d, 0x55, 0xa3, 0x35, 0x59,
+    0x24, 0x92, 0x4e, 0x7b, 0xaa, 0x1c, 0x38, 0xc0, 0x9b, 0xc1, 0xc8, 0x36,
+    0x64, 0x19, 0xe2, 0xbb, 0xf7, 0xec, 0x24, 0xd2, 0xb2, 0x34, 0x2a, 0xcd,
+    0x5e, 0xb0, 0xf0, 0xdd, 0xff, 0xff, 0x3b, 0x9f, 0xc5, 0x71, 0xe5, 0x7f,
+    0x98, 0x7c, 0xbb, 0x5b, 0xfe, 0x58, 0x44, 0xa4, 0xd0, 0x25, 0x0f, 0xaf,
+    0xfc, 0xc3, 0x02, 0x34, 0xc5, 0x45, 0x33, 0xcd, 0x21, 0xec, 0xba, 0x49,
+    0xf4, 0x34, 0xbd, 0x8b, 0x9e, 0xe7, 0xe3, 0x59, 0xd4, 0xf7, 0xc4, 0x25,
+    0x0f, 0xa2, 0x04, 0xdf, 0xdb, 0x45, 0xaf, 0xfc, 0x12, 0x34, 0x25, 0x15,
+    0x2d, 0x21, 0x70, 0x5a, 0x06, 0x9b, 0x5a, 0x48, 0xed, 0x90, 0x44, 0x54,
+    0x1a, 0x2a, 0x1d, 0x38, 0x1b, 0x96, 0xea, 0x22, 0x48, 0xa1, 0x65, 0x09,
+    0xb8, 0xf6, 0xe5, 0x13, 0x61, 0x15, 0xd3, 0x8c, 0x72, 0x57, 0x25, 0x94,
+    0x43, 0x70, 0xed, 0x1c, 0x4c, 0x92, 0x82, 0x4a, 0x05, 0x28, 0x5a, 0x2d,
+    0xef, 0xdd, 0xcf, 0x66, 0x9b, 0xb3, 0xea, 0x17, 0x91, 0xc0, 0x03, 0x47,
+    0xe9, 0x2d, 0x07, 0x55, 0x00, 0xa0, 0x79, 0x21, 0x21, 0x0b, 0x9c, 0xae,
+    0x1b, 0xc7, 0x71, 0xb4, 0xbc, 0xf5, 0xa8, 0x42, 0x91, 0xf2, 0x6c, 0xc6,
+    0x28, 0x51, 0xaa, 0xef, 0x8f, 0xa5, 0x0c, 0x8b, 0x39, 0x27, 0xca, 0x68,
+    0x6b, 0xc2, 0x23, 0xd5, 0xe6, 0x28, 0x23, 0x7a, 0x5b, 0xe3, 0x31, 0x58,
+    0x49, 0x73, 0xf0, 0x70, 0xeb, 0xe3, 0xef, 0x92, 0xbf, 0xdf, 0x0b, 0x1f,
+    0xc6, 0x4b, 0xb1, 0x3f, 0xa0, 0x02, 0x87, 0x56, 0x5b, 0x63, 0xe1, 0xed,
+    0x7b, 0xba, 0x16, 0xe9, 0x16, 0x97, 0x94, 0xb5, 0x24, 0xe1, 0x28, 0x0c,
+    0x1c, 0xd3, 0x2a, 0xca, 0x2a, 0x90, 0x98, 0xd6, 0x75, 0xf3, 0xf1, 0xd3,
+    0xf3, 0x2c, 0x9a, 0xaf, 0xfa, 0x1e, 0xaf, 0xe1, 0xfa, 0xa4, 0xf9, 0xdf,
+    0x61, 0x4d, 0xa6, 0xd8, 0x5a, 0x99, 0xd1, 0x04, 0xef, 0x00, 0x33, 0x8e,
+    0xbc, 0x94, 0xa6, 0xba, 0x51, 0x6e, 0x2e, 0x59, 0xea, 0xbc, 0x1a, 0x49,
+    0xa8, 0xb4, 0x91, 0xe2, 0x26, 0x9c, 0xd8, 0x3b, 0x21, 0xb1, 0x0d, 0xa0,
+    0xd5, 0xcd, 0xb1, 0x20, 0x13, 0xb2, 0x44, 0x23, 0xd1, 0xd4, 0xb6, 0x03,
+    0x74, 0x0d, 0x3c, 0x8c, 0xe3, 0xe9, 0xe4, 0xd6, 0xf7, 0x76, 0x2f, 0xaf,
+    0xd9, 0xb7, 0x94, 0x37, 0xe0, 0x10, 0x96, 0x9a, 0x8b, 0xcf, 0x58, 0xac,
+    0x4c, 0x1d, 0x8f, 0x82, 0xa6, 0xac, 0xca, 0x47, 0xa3, 0x91, 0xef, 0xa1,
+    0xc4, 0x34, 0x63, 0xb7, 0xbc, 0x41, 0x9b, 0x2e, 0xc8, 0x38, 0x4d, 0x25,
+    0x28, 0x35, 0x94, 0xc9, 0xea, 0xbd, 0xe0, 0x72, 0x68, 0xcc, 0xf2, 0x8a,
+    0x72, 0xec, 0x8a, 0x84, 0x2a, 0xd7, 0xc5, 0x50, 0xb2, 0xb2, 0xb2, 0x83,
+    0xea, 0x72, 0xfc, 0xaa, 0xd6, 0xac, 0x84, 0xa1, 0xd4, 0xc6, 0x66, 0xff,
+    0xc7, 0x61, 0x41, 0xb6, 0x20, 0x07, 0x9f, 0xd1, 0x66, 0x2f, 0xa4, 0xd0,
+    0x22, 0x11, 0xfc, 0x72, 0xea, 0x02, 0x27, 0xc4, 0x3b, 0x99, 0x66, 0xa6,
+    0x5c, 0xcc, 0x7b, 0x10, 0x4a, 0x9b, 0xf9, 0x34, 0x94, 0x59, 0xec, 0xf3,
+    0x2f, 0x27, 0xde, 0x4b, 0x00, 0x32, 0x83, 0x52, 0xc8, 0xed, 0x00, 0x68,
+    0xe8, 0xab, 0x9a, 0x56, 0x16, 0x9d, 0xa1, 0x70, 0xa7, 0x3b, 0x86, 0x9b,
+    0x84, 0x90, 0x7c, 0xfd, 0xf2, 0x4f, 0x19, 0x67, 0x8b, 0x3a, 0xfd, 0xda,
+    0xc7, 0x2d, 0x65, 0x58, 0x08, 0xc7, 0xba, 0x44, 0xda, 0xe0, 0x28, 0xfd,
+    0xeb, 0x8b, 0x37, 0xe4, 0xd2, 0xee, 0x3e, 0x32, 0xa5, 0x8d, 0xa0, 0x3e,
+    0xd0, 0xc9, 0x6e, 0x5f, 0xd9, 0x2a, 0xea, 0x73, 0x64, 0x95, 0x48, 0x56,
+    0x6b, 0xa2, 0x64, 0x72, 0x3a, 0x15, 0x0b, 0xfc, 0x59, 0xb8, 0x35, 0x0e,
+    0xd4, 0xd1, 0x4f, 0x3b, 0x99, 0xf1, 0x30, 0x36, 0xfb, 0x0d, 0xd9, 0x06,
+    0xd6, 0x6e, 0xcd, 0xa9, 0xb6, 0xed, 0x6d, 0x34, 0xe3, 0xea, 0x54, 0xef,
+    0xed, 0x87, 0xa9, 0xb7, 0xfb, 0x6d, 0xbd, 0x00, 0xb3, 0xb8, 0xc4, 0x69,
+    0xcf, 0x06, 0x00, 0x00,
+};
+const size_t CONNECTED_HOME_HTML_GZ_LEN = 580;
+const char CONNECTED_HOME_HTML_HASH[] = "40709241d5d1";
+
 #endif // CONNECTED_HOME_HTML_H
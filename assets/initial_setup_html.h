@@ -8,134 +8,238 @@ const char INITIAL_SETUP_HTML[] PROGMEM = R"rawliteral(
 <!DOCTYPE html>
 <html lang="en">
 <head>
-  <meta charset="UTF-8">
-  <meta name="viewport" content="width=device-width, initial-scale=1.0, user-scalable=no, maximum-scale=1.0">
-  <title>Initial Setup - {{DEVICE_NAME}}</title>
-  <link rel="stylesheet" href="/assets/style.css">
-  <link rel="stylesheet" href="/assets/web-platform-style.css">
-  <link rel="icon" href="/assets/favicon.svg" type="image/svg+xml">
-  <link rel="icon" href="/assets/favicon.ico" sizes="any">
+<meta charset="UTF-8">
+<meta name="viewport" content="width=device-width, initial-scale=1.0, user-scalable=no, maximum-scale=1.0">
+<title>Initial Setup - {{DEVICE_NAME}}</title>
+<link rel="stylesheet" href="{{ASSET:/assets/style.css}}">
+<link rel="stylesheet" href="{{ASSET:/assets/web-platform-style.css}}">
+<link rel="icon" href="{{ASSET:/assets/favicon.svg}}" type="image/svg+xml">
+<link rel="icon" href="{{ASSET:/assets/favicon.ico}}" sizes="any">
 </head>
 <body class="auth-body">
-  <div class="auth-container">
-    <div class="auth-card">
-      <div class="auth-header">
-        <h1 class="auth-title">Initial Setup</h1>
-        <p class="auth-subtitle">Welcome to {{DEVICE_NAME}}! Create your admin account to get started.</p>
-      </div>
-      
-      <form id="setupForm" class="auth-form" method="POST" action="/setup">
-        <input type="hidden" name="_csrf" value="{{csrfToken}}">
-        
-        <div class="form-group">
-          <label for="username" class="form-label">Username</label>
-          <input type="text" id="username" name="username" class="form-control" required 
-                 minlength="3" placeholder="Choose a username">
-          <div class="form-help">Username must be at least 3 characters long.</div>
-        </div>
-        
-        <div class="form-group">
-          <label for="password" class="form-label">Password</label>
-          <div class="password-field">
-            <input type="password" id="password" name="password" class="form-control" required 
-                   minlength="6" placeholder="Enter a secure password">
-            <button type="button" class="password-toggle" onclick="togglePassword('password')" title="Show password">
-              Show
-            </button>
-          </div>
-          <div class="form-help">Password must be at least 6 characters long.</div>
-        </div>
-        
-        <div class="form-group">
-          <label for="confirmPassword" class="form-label">Confirm Password</label>
-          <div class="password-field">
-            <input type="password" id="confirmPassword" name="confirmPassword" class="form-control" 
-                   required minlength="6" placeholder="Confirm your password">
-            <button type="button" class="password-toggle" onclick="togglePassword('confirmPassword')" title="Show password">
-              Show
-            </button>
-          </div>
-        </div>
-        
-        <button type="submit" class="btn btn-primary auth-submit">
-          Create Account & Continue
-        </button>
-      </form>
-      
-      <div class="auth-footer">
-        <p class="auth-note">
-          This will be your admin account for managing the device.
-          Choose a secure username and password.
-        </p>
-      </div>
-    </div>
-  </div>
-
-  <script src="/assets/web-platform-utils.js"></script>
-  <script>
-    // Password toggle functionality
-    function togglePassword(fieldId) {
-      const passwordField = document.getElementById(fieldId);
-      const toggleButton = passwordField.nextElementSibling;
-      
-      if (passwordField.type === 'password') {
-        passwordField.type = 'text';
-        toggleButton.textContent = 'Hide';
-        toggleButton.title = 'Hide password';
-      } else {
-        passwordField.type = 'password';
-        toggleButton.textContent = 'Show';
-        toggleButton.title = 'Show password';
-      }
-    }
-    
-    document.getElementById('setupForm').addEventListener('submit', function(e) {
-      e.preventDefault();
-      
-      const username = document.getElementById('username').value;
-      const password = document.getElementById('password').value;
-      const confirmPassword = document.getElementById('confirmPassword').value;
-      
-      if (username.length < 3) {
-        UIUtils.showAlert('Username must be at least 3 characters long', 'error');
-        return;
-      }
-      
-      if (password !== confirmPassword) {
-        UIUtils.showAlert('Passwords do not match', 'error');
-        return;
-      }
-      
-      if (password.length < 6) {
-        UIUtils.showAlert('Password must be at least 6 characters long', 'error');
-        return;
-      }
-      
-      // Submit the form using AuthUtils.fetch for automatic CSRF handling
-      const formData = new FormData(this);
-      
-      AuthUtils.fetch('/api/user', {
-        method: 'POST',
-        body: formData
-      }).then(response => {
-        if (response.ok) {
-          UIUtils.showAlert('Account created successfully! Redirecting...', 'success');
-          setTimeout(() => {
-            window.location.href = '/portal';
-          }, 1500);
-        } else {
-          return response.text().then(text => {
-            throw new Error(text || 'Failed to create account');
-          });
-        }
-      }).catch(error => {
-        console.error('Setup error:', error);
-        UIUtils.showAlert(error.message || 'Account creation failed. Please try again.', 'error');
-      });
-    });
-  </script>
+<div class="auth-container">
+<div class="auth-card">
+<div class="auth-header">
+<h1 class="auth-title">Initial Setup</h1>
+<p class="auth-subtitle">Welcome to {{DEVICE_NAME}}! Create your admin account to get started.</p>
+</div>
+<form id="setupForm" class="auth-form" method="POST" action="/setup">
+<input type="hidden" name="_csrf" value="{{csrfToken}}">
+<div class="form-group">
+<label for="username" class="form-label">Username</label>
+<input type="text" id="username" name="username" class="form-control" required
+minlength="3" placeholder="Choose a username">
+<div class="form-help">Username must be at least 3 characters long.</div>
+</div>
+<div class="form-group">
+<label for="password" class="form-label">Password</label>
+<div class="password-field">
+<input type="password" id="password" name="password" class="form-control" required
+minlength="6" placeholder="Enter a secure password">
+<button type="button" class="password-toggle" onclick="togglePassword('password')" title="Show password">
+Show
+</button>
+</div>
+<div class="form-help">Password must be at least 6 characters long.</div>
+</div>
+<div class="form-group">
+<label for="confirmPassword" class="form-label">Confirm Password</label>
+<div class="password-field">
+<input type="password" id="confirmPassword" name="confirmPassword" class="form-control"
+required minlength="6" placeholder="Confirm your password">
+<button type="button" class="password-toggle" onclick="togglePassword('confirmPassword')" title="Show password">
+Show
+</button>
+</div>
+</div>
+<button type="submit" class="btn btn-primary auth-submit">
+Create Account & Continue
+</button>
+</form>
+<div class="auth-footer">
+<p class="auth-note">
+This will be your admin account for managing the device.
+Choose a secure username and password.
+</p>
+</div>
+</div>
+</div>
+<script src="{{ASSET:/assets/web-platform-utils.js}}"></script>
+<script>function togglePassword(fieldId){
+const passwordField=document.getElementById(fieldId);
+const toggleButton=passwordField.nextElementSibling;
+if(passwordField.type==='password'){
+passwordField.type='text';
+toggleButton.textContent='Hide';
+toggleButton.title='Hide password';
+}else{
+passwordField.type='password';
+toggleButton.textContent='Show';
+toggleButton.title='Show password';
+}
+}
+document.getElementById('setupForm').addEventListener('submit',function(e){
+e.preventDefault();
+const username=document.getElementById('username').value;
+const password=document.getElementById('password').value;
+const confirmPassword=document.getElementById('confirmPassword').value;
+if(username.length < 3){
+UIUtils.showAlert('Username must be at least 3 characters long','error');
+return;
+}
+if(password !==confirmPassword){
+UIUtils.showAlert('Passwords do not match','error');
+return;
+}
+if(password.length < 6){
+UIUtils.showAlert('Password must be at least 6 characters long','error');
+return;
+}
+const formData=new FormData(this);
+AuthUtils.fetch('/api/user',{
+method:'POST',
+body:formData
+}).then(response=>{
+if(response.ok){
+UIUtils.showAlert('Account created successfully! Redirecting...','success');
+setTimeout(()=>{
+window.location.href='/portal';
+},1500);
+}else{
+return response.text().then(text=>{
+throw new Error(text||'Failed to create account');
+});
+}
+}).catch(error=>{
+console.error('Setup error:',error);
+UIUtils.showAlert(error.message||'Account creation failed. Please try again.','error');
+});
+});</script>
 </body>
 </html>
 )rawliteral";
 
+const uint8_t INITIAL_SETUP_HTML_GZ[] PROGMEM = {
+    0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xad, 0x57,
+    0x6d, 0x6f, 0xdb, 0x36, 0x10, 0xfe, 0xae, 0x5f, 0xc1, 0xe8, 0xc3, 0x64,
+    0x63, 0xb6, 0xdc, 0x20, 0x58, 0x31, 0x24, 0x56, 0x80, 0x34, 0x71, 0xb0,
+    0x00, 0xdb, 0x1a, 0x2c, 0xce, 0x86, 0x7d, 0x2a, 0x18, 0xe9, 0x6c, 0x71,
+    0xa1, 0x48, 0x8f, 0xa4, 0xec, 0x7a, 0xae, 0xff, 0xfb, 0xee, 0x28, 0xc9,
+    0xb6, 0x1c, 0x3b, 0x6d, 0x80, 0xa2, 0x48, 0x65, 0x1e, 0xef, 0x8d, 0xf7,
+    0xdc, 0x0b, 0x19, 0x0c, 0x4f, 0x6e, 0x3e, 0x5e, 0x8f, 0xff, 0xbe, 0x1f,
+    0xb1, 0xdc, 0x15, 0xf2, 0x32, 0x18, 0xd2, 0x87, 0x49, 0xae, 0xa6, 0x49,
+    0x08, 0x2a, 0x24, 0x02, 0xf0, 0x0c, 0x3f, 0x05, 0x38, 0xce, 0xd2, 0x9c,
+    0x1b, 0x0b, 0x2e, 0x09, 0x1f, 0xc7, 0xb7, 0xfd, 0x9f, 0xc3, 0x86, 0xac,
+    0x78, 0x01, 0x49, 0x38, 0x17, 0xb0, 0x98, 0x69, 0xe3, 0x42, 0x96, 0x6a,
+    0xe5, 0x40, 0x21, 0xdb, 0x42, 0x64, 0x2e, 0x4f, 0x32, 0x98, 0x8b, 0x14,
+    0xfa, 0x7e, 0xd1, 0x63, 0x42, 0x09, 0x27, 0xb8, 0xec, 0xdb, 0x94, 0x4b,
+    0x48, 0x4e, 0xe3, 0x77, 0x3d, 0x56, 0x5a, 0x30, 0x7e, 0xcd, 0x9f, 0x90,
+    0xa4, 0x74, 0x8f, 0x15, 0xfc, 0xb3, 0x28, 0xca, 0x62, 0xcb, 0x44, 0xb6,
+    0x9c, 0x70, 0x12, 0x2e, 0xef, 0x2a, 0x79, 0xf6, 0x00, 0xae, 0x9c, 0xb1,
+    0x3e, 0x5b, 0xad, 0x6e, 0x46, 0x7f, 0xde, 0x5d, 0x8f, 0x3e, 0xfd, 0x7e,
+    0xf5, 0xdb, 0x68, 0xbd, 0x1e, 0x0e, 0x2a, 0xb6, 0x60, 0x28, 0x85, 0x7a,
+    0x66, 0x06, 0x64, 0x12, 0x5a, 0xb7, 0x94, 0x60, 0x73, 0x00, 0xf4, 0x2d,
+    0x37, 0x30, 0x49, 0xc2, 0xd5, 0xea, 0xea, 0xe1, 0x61, 0x34, 0x3e, 0x1f,
+    0x70, 0x8b, 0xe7, 0xb1, 0x03, 0xcf, 0x11, 0xa7, 0xd6, 0xae, 0xd7, 0xe1,
+    0x1b, 0x45, 0x17, 0xf0, 0xd4, 0x9f, 0x49, 0xee, 0x26, 0xda, 0xa0, 0xbf,
+    0xc7, 0xf4, 0x08, 0x8c, 0xc9, 0x31, 0x0d, 0x13, 0x3e, 0xa7, 0xed, 0xd8,
+    0xce, 0xa7, 0x28, 0xc6, 0xdc, 0x72, 0x86, 0xd1, 0x14, 0x05, 0x9f, 0xc2,
+    0x00, 0x49, 0x3f, 0x7e, 0x2e, 0xe4, 0xdb, 0x75, 0xe1, 0x7f, 0xa4, 0xcb,
+    0x8a, 0xff, 0xc0, 0x26, 0x21, 0x57, 0x4b, 0x52, 0x31, 0xa8, 0xb1, 0x7c,
+    0xd2, 0xd9, 0x92, 0xa5, 0x12, 0x45, 0x70, 0xab, 0x74, 0x79, 0x9f, 0x08,
+    0xc4, 0x90, 0x89, 0x79, 0x8b, 0x4e, 0x40, 0x72, 0xa1, 0xc0, 0x1c, 0xdc,
+    0xe4, 0x26, 0x3b, 0x44, 0x27, 0x23, 0x95, 0x44, 0x7e, 0xda, 0xda, 0xf0,
+    0xc0, 0x84, 0x6d, 0x00, 0xd1, 0xa7, 0x53, 0xe4, 0x9c, 0xb5, 0x18, 0x6d,
+    0xf9, 0x54, 0xf3, 0xfe, 0x05, 0x32, 0xd5, 0x05, 0x30, 0xa7, 0xf7, 0x71,
+    0x3e, 0x61, 0xd7, 0x06, 0xb8, 0x03, 0xb6, 0xd4, 0xa5, 0x61, 0x3c, 0x2b,
+    0x84, 0x62, 0x3c, 0x4d, 0x75, 0xa9, 0x1c, 0x71, 0x4f, 0xc1, 0x31, 0xeb,
+    0xb8, 0x71, 0x90, 0xc5, 0xc3, 0xc1, 0x8c, 0x0e, 0x8f, 0x7e, 0xe2, 0x87,
+    0x60, 0x62, 0x22, 0x43, 0x64, 0xc9, 0xfc, 0x2d, 0xae, 0xc2, 0x96, 0xed,
+    0x89, 0xa7, 0x60, 0x5a, 0xe7, 0x1a, 0x99, 0xee, 0x3f, 0x3e, 0x8c, 0x43,
+    0xd4, 0xeb, 0x84, 0x56, 0x49, 0x38, 0xf0, 0x32, 0x74, 0x32, 0xa1, 0x66,
+    0xa5, 0xab, 0x91, 0xca, 0x45, 0x96, 0x61, 0xa9, 0xd4, 0x55, 0xf0, 0x29,
+    0xb5, 0x66, 0x12, 0xb2, 0x39, 0x97, 0x25, 0x10, 0x3c, 0xb4, 0x1c, 0xeb,
+    0x67, 0x50, 0x55, 0x46, 0xec, 0x04, 0xcb, 0x27, 0xcc, 0xd4, 0xe8, 0x4a,
+    0x23, 0xe6, 0x3e, 0x48, 0x86, 0xb4, 0x24, 0xa4, 0x72, 0x20, 0x65, 0x61,
+    0x8b, 0xd3, 0x33, 0x84, 0x97, 0x8f, 0xf5, 0xe6, 0x70, 0xe0, 0x09, 0x7b,
+    0xbe, 0x38, 0xf8, 0x8c, 0x89, 0x4a, 0xc7, 0xdb, 0x2a, 0xa9, 0xfc, 0x3a,
+    0xac, 0x94, 0x00, 0x36, 0x5a, 0x86, 0x98, 0x58, 0xff, 0x96, 0xc2, 0x40,
+    0x16, 0x60, 0x1c, 0x25, 0xa8, 0x29, 0x96, 0x6d, 0x78, 0x16, 0x32, 0x4c,
+    0xec, 0x14, 0x72, 0x2d, 0x11, 0xd0, 0x24, 0xbc, 0xce, 0xb5, 0xb6, 0xc0,
+    0x38, 0xdb, 0xe8, 0x3a, 0x70, 0xa0, 0x1c, 0xe4, 0x6c, 0xeb, 0x25, 0x2b,
+    0x4a, 0xeb, 0xd8, 0x13, 0x0a, 0x39, 0x26, 0x81, 0xe3, 0xef, 0x33, 0xdf,
+    0x44, 0x30, 0xa2, 0x60, 0x2c, 0x93, 0x5a, 0x4d, 0xe3, 0x06, 0x99, 0xfa,
+    0xf3, 0x2d, 0x11, 0x9a, 0xe1, 0xf6, 0x42, 0x63, 0xfa, 0x1d, 0x8a, 0xd0,
+    0x7d, 0xbd, 0xb9, 0x8d, 0xd0, 0x8e, 0xca, 0x46, 0xb2, 0x3f, 0x11, 0x20,
+    0xb3, 0x7d, 0x28, 0xb7, 0x7a, 0x29, 0x84, 0xdb, 0x55, 0x15, 0xc2, 0xc3,
+    0x56, 0x5f, 0x0d, 0xe1, 0xfb, 0xbd, 0x10, 0x8e, 0xb0, 0x31, 0x62, 0xb6,
+    0x32, 0x0b, 0x69, 0x69, 0x80, 0x6d, 0x34, 0x52, 0x51, 0x96, 0xce, 0x69,
+    0x55, 0x3b, 0x52, 0x2d, 0xc2, 0x17, 0x5e, 0x3b, 0x3d, 0x9d, 0x62, 0x5d,
+    0x30, 0xad, 0x52, 0x29, 0xd2, 0x67, 0x04, 0xdc, 0x13, 0x9a, 0x23, 0x77,
+    0xa2, 0x86, 0x33, 0xea, 0x62, 0x23, 0xa1, 0x1a, 0x4a, 0xc2, 0x87, 0x5c,
+    0x2f, 0x76, 0x2d, 0xd1, 0x1a, 0xa3, 0x5d, 0x99, 0x38, 0x1e, 0xf7, 0x0a,
+    0xc8, 0x46, 0xf3, 0x4b, 0x20, 0xdf, 0x7f, 0x0f, 0x20, 0x31, 0x78, 0x13,
+    0x61, 0x8a, 0xfb, 0xd7, 0xf0, 0xbc, 0xae, 0x78, 0xd8, 0x77, 0xc3, 0xf5,
+    0x85, 0xd1, 0x0a, 0xde, 0x57, 0x7d, 0x69, 0x50, 0x0e, 0x1a, 0x94, 0xd9,
+    0x2b, 0x28, 0x37, 0x1e, 0xfb, 0xd6, 0xf4, 0xfd, 0x31, 0xde, 0x73, 0xf4,
+    0xed, 0x50, 0xd7, 0x9f, 0x96, 0x37, 0xd8, 0x73, 0x0b, 0xe1, 0x36, 0xde,
+    0x3c, 0x39, 0xc5, 0xf0, 0xaf, 0x3f, 0x33, 0x38, 0x88, 0xcc, 0x92, 0x35,
+    0x7d, 0x99, 0x78, 0x2e, 0x83, 0xba, 0xf5, 0x5e, 0xd5, 0xfd, 0xf6, 0x07,
+    0x86, 0x27, 0x76, 0x42, 0x95, 0xd0, 0x32, 0x46, 0x81, 0x3b, 0x30, 0x1f,
+    0x26, 0x5a, 0xbb, 0x6a, 0x3e, 0xb4, 0xbb, 0xbe, 0x42, 0x32, 0x52, 0xc7,
+    0xb9, 0xb0, 0x6c, 0x21, 0xa4, 0xa4, 0x6c, 0x3b, 0xd0, 0xdc, 0x51, 0x2b,
+    0x5e, 0x0f, 0x14, 0x9f, 0x0a, 0x35, 0x65, 0x2e, 0x07, 0x56, 0x5d, 0x2f,
+    0xe2, 0x60, 0xd3, 0x9e, 0xea, 0xe2, 0x6a, 0xba, 0x14, 0xe3, 0x2a, 0xdb,
+    0x04, 0x25, 0x0e, 0x5a, 0xd3, 0xa0, 0xfd, 0xb1, 0xa9, 0x11, 0x33, 0x9c,
+    0x1b, 0x26, 0xfd, 0xca, 0x98, 0x2f, 0x9d, 0x90, 0x36, 0xfe, 0xc7, 0x4f,
+    0xf9, 0xe1, 0xa0, 0x12, 0xdb, 0xc8, 0x5f, 0x4e, 0x4a, 0xe5, 0x07, 0x06,
+    0xdb, 0x03, 0xce, 0xa7, 0xe6, 0x5d, 0xd6, 0x5d, 0x05, 0x88, 0x20, 0x56,
+    0x50, 0xe3, 0xd3, 0x2d, 0xd1, 0x93, 0x4c, 0xa7, 0x65, 0x81, 0xb7, 0xa6,
+    0x18, 0x47, 0xd7, 0x48, 0x02, 0xfd, 0xfc, 0xb0, 0xbc, 0xdb, 0x4a, 0x5d,
+    0xd4, 0x52, 0x95, 0xd2, 0x0f, 0x3e, 0xca, 0x49, 0x4b, 0x45, 0xac, 0xb0,
+    0xfb, 0xd7, 0xa2, 0x0f, 0xe2, 0x09, 0x2f, 0x0c, 0xd3, 0x8b, 0x40, 0x4c,
+    0x3a, 0x6d, 0x26, 0x0f, 0x77, 0x92, 0xec, 0x74, 0x8a, 0x55, 0x70, 0x80,
+    0x23, 0xa2, 0x51, 0x12, 0x5d, 0x04, 0xbb, 0xe6, 0x62, 0xa2, 0x5d, 0xd7,
+    0x97, 0xbb, 0xe8, 0x17, 0x91, 0xc1, 0x0b, 0x06, 0x9f, 0x87, 0x7e, 0x6b,
+    0x73, 0x3c, 0xe4, 0x59, 0x83, 0xb4, 0x70, 0xd8, 0xcc, 0x0e, 0xd7, 0x71,
+    0x53, 0x94, 0xc7, 0x47, 0x4c, 0xb5, 0x52, 0x9e, 0x4c, 0xe1, 0xbf, 0x63,
+    0xa1, 0x8c, 0x36, 0x33, 0x3f, 0xea, 0xc6, 0x3c, 0xcb, 0x46, 0x73, 0xdc,
+    0xf9, 0x55, 0x58, 0x34, 0x02, 0x06, 0x77, 0x7d, 0x7a, 0x47, 0xbd, 0x06,
+    0xbf, 0x0e, 0x60, 0x68, 0x20, 0x9e, 0x19, 0x20, 0xbe, 0x1b, 0x98, 0xf0,
+    0x52, 0xba, 0xce, 0x06, 0x88, 0x26, 0xbf, 0x8e, 0x22, 0x17, 0x35, 0x1c,
+    0x68, 0xcd, 0xdf, 0x07, 0x2e, 0xf6, 0x80, 0x3f, 0x2e, 0xb9, 0x05, 0xa7,
+    0x2d, 0xb9, 0x57, 0xfa, 0xc7, 0x15, 0xbc, 0xe8, 0x11, 0x8d, 0x1e, 0xcc,
+    0x87, 0xc6, 0xad, 0xb8, 0xea, 0x5f, 0x6c, 0xc8, 0xce, 0xf0, 0xa0, 0x8f,
+    0x77, 0x8f, 0x3e, 0xab, 0x2d, 0x06, 0xf4, 0x4a, 0x82, 0x71, 0x9d, 0xe8,
+    0x0d, 0x53, 0x3c, 0xea, 0x45, 0x60, 0x8c, 0x36, 0x11, 0x86, 0xc7, 0x60,
+    0x94, 0x8d, 0x22, 0x28, 0x76, 0x92, 0x8f, 0x9d, 0x24, 0xc9, 0x9e, 0x53,
+    0x87, 0x8d, 0x36, 0xbb, 0x96, 0x65, 0x9a, 0x61, 0x4f, 0xc0, 0x62, 0x77,
+    0x69, 0xfe, 0x55, 0xfd, 0xdb, 0xc3, 0xbc, 0x7f, 0x5d, 0xef, 0x37, 0x4c,
+    0xb2, 0xc3, 0xc6, 0x2a, 0x04, 0xa8, 0xfe, 0x6f, 0xb8, 0xe3, 0x89, 0x82,
+    0x05, 0xbb, 0xad, 0x17, 0x1d, 0x87, 0x4d, 0x0b, 0x99, 0xaf, 0xb0, 0x8f,
+    0x55, 0x86, 0x27, 0x80, 0x4e, 0x77, 0xa2, 0x01, 0x9f, 0x89, 0x01, 0xc5,
+    0x3b, 0xea, 0xad, 0x82, 0xea, 0x52, 0x79, 0x1e, 0xd1, 0xa5, 0x32, 0xea,
+    0x05, 0x74, 0xe9, 0x3e, 0x6f, 0xd4, 0x05, 0xeb, 0x6e, 0x8c, 0xcd, 0x4c,
+    0x75, 0x0c, 0xd8, 0x19, 0x1a, 0x82, 0xe4, 0x72, 0x45, 0xc7, 0x6b, 0x96,
+    0xb1, 0x7e, 0x3e, 0x7c, 0xac, 0xa6, 0x07, 0xa7, 0xbe, 0x25, 0x67, 0xcc,
+    0x96, 0x69, 0x0a, 0xd6, 0x4e, 0x4a, 0x29, 0x97, 0x27, 0xec, 0x0f, 0xc8,
+    0x70, 0x58, 0x61, 0x36, 0xe3, 0x78, 0x8e, 0x63, 0x3c, 0x57, 0xbd, 0x4d,
+    0x27, 0xc3, 0x62, 0x18, 0x8b, 0x02, 0x74, 0xe9, 0x3a, 0x9d, 0x2e, 0x99,
+    0x5b, 0x08, 0x95, 0xe9, 0x45, 0x2c, 0x75, 0xca, 0x29, 0xfd, 0x63, 0xff,
+    0xc2, 0x88, 0x06, 0xf4, 0xa6, 0xe3, 0x92, 0x4a, 0xab, 0x77, 0xfa, 0xd3,
+    0xbb, 0x77, 0xdd, 0x4d, 0x39, 0x57, 0xa1, 0x61, 0x1b, 0x17, 0xa9, 0x64,
+    0x3b, 0xf5, 0x31, 0xe8, 0x37, 0xe9, 0x74, 0xb9, 0xc1, 0xfa, 0xa4, 0x58,
+    0x8d, 0x28, 0xa2, 0x9e, 0xfe, 0xe5, 0x4b, 0x74, 0xcb, 0x85, 0x44, 0x67,
+    0xf1, 0xa2, 0x5e, 0xf9, 0xdd, 0x74, 0x77, 0xf2, 0x6b, 0xdd, 0xf5, 0x55,
+    0xdc, 0x8d, 0x53, 0x02, 0xbe, 0xe3, 0x91, 0x20, 0x55, 0x14, 0x7f, 0x8d,
+    0xaf, 0x2b, 0x4f, 0xe8, 0x44, 0xd5, 0xfb, 0xcf, 0x2f, 0xce, 0xa3, 0x9e,
+    0xff, 0xa2, 0xe0, 0xcb, 0x08, 0xf9, 0x9d, 0xb8, 0xc0, 0x43, 0xe3, 0x83,
+    0x0a, 0x4d, 0xb7, 0x02, 0x46, 0x5d, 0x7a, 0xe2, 0x7d, 0x89, 0xd9, 0x3d,
+    0x65, 0x03, 0x3e, 0x35, 0x68, 0xda, 0x4d, 0xf1, 0xd5, 0x13, 0xef, 0xa6,
+    0xc1, 0xba, 0xfa, 0xdb, 0x69, 0xf6, 0x03, 0xc2, 0xcf, 0x3f, 0xaa, 0xfc,
+    0xc3, 0xf9, 0x7f, 0xae, 0xa6, 0x78, 0xdb, 0x4a, 0x0f, 0x00, 0x00,
+};
+const size_t INITIAL_SETUP_HTML_GZ_LEN = 1415;
+const char INITIAL_SETUP_HTML_HASH[] = "17260a29ca1e";
+
 #endif // INITIAL_SETUP_HTML_H
@@ -8,29 +8,72 @@ const char LOGIN_PAGE_ERROR_HTML[] PROGMEM = R"(
 <!DOCTYPE html>
 <html>
 <head>
-  <title>Login - {{DEVICE_NAME}}</title>
-  <link rel="stylesheet" href="/assets/style.css">
-  <meta name="viewport" content="width=device-width, initial-scale=1">
+<title>Login - {{DEVICE_NAME}}</title>
+<link rel="stylesheet" href="{{ASSET:/assets/style.css}}">
+<meta name="viewport" content="width=device-width, initial-scale=1">
 </head>
 <body>
-  <div class="container">
-    <h1>Login</h1>
-    <div class="card error">Invalid username or password</div>
-    <form method="post" action="/api/login?redirect={{redirectUrl}}">
-      <input type="hidden" name="_csrf" value="{{csrfToken}}">
-      <div class="form-group">
-        <label for="username">Username:</label>
-        <input type="text" id="username" name="username" class="form-control" value="{{username}}" required>
-      </div>
-      <div class="form-group">
-        <label for="password">Password:</label>
-        <input type="password" id="password" name="password" class="form-control" required>
-      </div>
-      <button type="submit" class="btn btn-primary">Login</button>
-    </form>
-  </div>
+<div class="container">
+<h1>Login</h1>
+<div class="card error">Invalid username or password</div>
+<form method="post" action="/api/login?redirect={{redirectUrl}}">
+<input type="hidden" name="_csrf" value="{{csrfToken}}">
+<div class="form-group">
+<label for="username">Username:</label>
+<input type="text" id="username" name="username" class="form-control" value="{{username}}" required>
+</div>
+<div class="form-group">
+<label for="password">Password:</label>
+<input type="password" id="password" name="password" class="form-control" required>
+</div>
+<button type="submit" class="btn btn-primary">Login</button>
+</form>
+</div>
 </body>
 </html>
 )";
 
+const uint8_t LOGIN_PAGE_ERROR_HTML_GZ[] PROGMEM = {
+    0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0x8d, 0x93,
+    0x4d, 0x6f, 0xdb, 0x30, 0x0c, 0x86, 0xef, 0xf9, 0x15, 0x9a, 0xce, 0xf3,
+    0x84, 0x5c, 0x0b, 0x2b, 0x43, 0xd1, 0xe6, 0x50, 0x60, 0x1f, 0x05, 0x9a,
+    0x0e, 0xd8, 0xa9, 0x90, 0x2d, 0xa6, 0x26, 0x2a, 0x4b, 0x9e, 0x44, 0x27,
+    0x0b, 0x8c, 0xfc, 0xf7, 0x51, 0xb1, 0xdd, 0x04, 0xed, 0x06, 0xec, 0x60,
+    0x48, 0xb4, 0xde, 0x97, 0x7c, 0x48, 0xcb, 0x8b, 0xf2, 0xc3, 0xed, 0xf7,
+    0x9b, 0xcd, 0xcf, 0xfb, 0xb5, 0x68, 0xa8, 0x75, 0xab, 0x45, 0x39, 0x2f,
+    0x60, 0x2c, 0x2f, 0x84, 0xe4, 0x60, 0xf5, 0x25, 0x3c, 0xa3, 0x17, 0x85,
+    0x18, 0x86, 0xdb, 0xf5, 0x8f, 0xbb, 0x9b, 0xf5, 0xd3, 0xb7, 0xeb, 0xaf,
+    0xeb, 0xe3, 0xb1, 0x54, 0xe3, 0xf1, 0xa2, 0x74, 0xe8, 0x5f, 0x44, 0x04,
+    0xa7, 0x65, 0xa2, 0x83, 0x83, 0xd4, 0x00, 0x90, 0x14, 0x4d, 0x84, 0xad,
+    0x96, 0xc3, 0x70, 0xfd, 0xf0, 0xb0, 0xde, 0x5c, 0x29, 0x93, 0x12, 0x50,
+    0x52, 0x27, 0xc5, 0xa7, 0x3a, 0xa5, 0xe3, 0x51, 0xb2, 0xb5, 0x05, 0x32,
+    0xc2, 0x9b, 0x16, 0xb4, 0xdc, 0x21, 0xec, 0xbb, 0x10, 0xd9, 0x59, 0x07,
+    0x4f, 0xe0, 0x49, 0xcb, 0x3d, 0x5a, 0x6a, 0xb4, 0x85, 0x1d, 0xd6, 0x50,
+    0x9c, 0x82, 0x8f, 0x02, 0x3d, 0x12, 0x1a, 0x57, 0xa4, 0xda, 0x38, 0xd0,
+    0xcb, 0x9c, 0x44, 0x4d, 0xb8, 0x55, 0xb0, 0x07, 0x5e, 0x2c, 0xee, 0x44,
+    0xed, 0xb8, 0x9e, 0x96, 0x39, 0x93, 0x41, 0x0f, 0x31, 0xcb, 0x9a, 0xe5,
+    0xd8, 0x0a, 0xeb, 0x97, 0x6f, 0x64, 0x26, 0x5a, 0x01, 0x31, 0x06, 0xd6,
+    0xdd, 0xf9, 0x9d, 0x71, 0x68, 0x45, 0x9f, 0x20, 0x66, 0x30, 0x11, 0xa2,
+    0xe8, 0x58, 0xb5, 0x0f, 0xd1, 0x96, 0x8a, 0x4d, 0x6c, 0xdd, 0x86, 0xd8,
+    0x0a, 0x46, 0x6f, 0x82, 0xd5, 0xb2, 0x0b, 0x89, 0x99, 0x4d, 0x4d, 0x18,
+    0xbc, 0x96, 0xca, 0x74, 0xa8, 0x5c, 0x2e, 0xf3, 0x39, 0x82, 0xc5, 0x08,
+    0x35, 0xe9, 0x61, 0x98, 0xb7, 0x8f, 0xd1, 0x8d, 0x7d, 0xa3, 0xef, 0x7a,
+    0x12, 0x74, 0xe8, 0xb8, 0xf1, 0x06, 0xad, 0x05, 0x2f, 0xa7, 0x31, 0x3c,
+    0xd5, 0x29, 0x6e, 0xa5, 0x60, 0x88, 0x1e, 0xf2, 0xf8, 0x72, 0xb8, 0x09,
+    0x2f, 0xe0, 0x47, 0xe3, 0x05, 0x75, 0xa6, 0x28, 0x9e, 0x63, 0xe8, 0xbb,
+    0x7c, 0xe0, 0x4c, 0x05, 0x4e, 0xf0, 0x3b, 0x2d, 0x67, 0x74, 0xb9, 0x7a,
+    0x9c, 0x76, 0x57, 0xa5, 0x3a, 0x9d, 0xbf, 0xa9, 0x4c, 0xf0, 0x9b, 0xd1,
+    0xd1, 0x5e, 0x58, 0x26, 0x8a, 0x73, 0x7c, 0x59, 0x2c, 0x8f, 0x33, 0x06,
+    0x77, 0x41, 0x37, 0xeb, 0x18, 0x8e, 0x6f, 0xc0, 0xaf, 0x9e, 0xbb, 0xcc,
+    0x5f, 0x62, 0x9a, 0xd3, 0xff, 0xc0, 0xce, 0xb3, 0x95, 0xab, 0xfb, 0x69,
+    0xf7, 0x0f, 0xd8, 0x57, 0xe1, 0x09, 0xf8, 0x1c, 0x8d, 0xc0, 0xe7, 0xf8,
+    0xaf, 0xc0, 0xef, 0xd9, 0xaa, 0x9e, 0x28, 0xf8, 0x29, 0x77, 0xea, 0xab,
+    0x16, 0xe9, 0xd5, 0x5b, 0x91, 0x17, 0xfc, 0x14, 0x5d, 0xc4, 0xd6, 0xc4,
+    0x83, 0x9c, 0xef, 0xcd, 0xe8, 0xc9, 0x39, 0x72, 0xf6, 0x73, 0x2e, 0x35,
+    0xdd, 0x3c, 0x35, 0xfe, 0x3e, 0x7f, 0x00, 0xa9, 0x61, 0x54, 0x16, 0x57,
+    0x03, 0x00, 0x00,
+};
+const size_t LOGIN_PAGE_ERROR_HTML_GZ_LEN = 447;
+const char LOGIN_PAGE_ERROR_HTML_HASH[] = "e6a14d3baa21";
+
 #endif // LOGIN_PAGE_ERROR_HTML_H
@@ -8,30 +8,73 @@ const char LOGIN_PAGE_HTML[] PROGMEM = R"(
 <!DOCTYPE html>
 <html>
 <head>
-  <title>Login - {{DEVICE_NAME}}</title>
-  <link rel="stylesheet" href="/assets/style.css">
-  <link rel="icon" href="/assets/favicon.svg" type="image/svg+xml">
-  <link rel="icon" href="/assets/favicon.ico" sizes="any">
-  <meta name="viewport" content="width=device-width, initial-scale=1">
+<title>Login - {{DEVICE_NAME}}</title>
+<link rel="stylesheet" href="{{ASSET:/assets/style.css}}">
+<link rel="icon" href="{{ASSET:/assets/favicon.svg}}" type="image/svg+xml">
+<link rel="icon" href="{{ASSET:/assets/favicon.ico}}" sizes="any">
+<meta name="viewport" content="width=device-width, initial-scale=1">
 </head>
 <body>
-  <div class="container">
-    <h1>Login</h1>
-    <form method="post" action="/api/login?redirect={{redirectUrl}}">
-      <input type="hidden" name="_csrf" value="{{csrfToken}}">
-      <div class="form-group">
-        <label for="username">Username:</label>
-        <input type="text" id="username" name="username" class="form-control" required>
-      </div>
-      <div class="form-group">
-        <label for="password">Password:</label>
-        <input type="password" id="password" name="password" class="form-control" required>
-      </div>
-      <button type="submit" class="btn btn-primary">Login</button>
-    </form>
-  </div>
+<div class="container">
+<h1>Login</h1>
+<form method="post" action="/api/login?redirect={{redirectUrl}}">
+<input type="hidden" name="_csrf" value="{{csrfToken}}">
+<div class="form-group">
+<label for="username">Username:</label>
+<input type="text" id="username" name="username" class="form-control" required>
+</div>
+<div class="form-group">
+<label for="password">Password:</label>
+<input type="password" id="password" name="password" class="form-control" required>
+</div>
+<button type="submit" class="btn btn-primary">Login</button>
+</form>
+</div>
 </body>
 </html>
 )";
 
+const uint8_t LOGIN_PAGE_HTML_GZ[] PROGMEM = {
+    0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0x95, 0x53,
+    0xc1, 0x6e, 0xdc, 0x20, 0x10, 0xbd, 0xef, 0x57, 0x50, 0xae, 0x8d, 0x83,
+    0xf6, 0x1a, 0x99, 0xad, 0xa2, 0xc4, 0x87, 0x4a, 0x6d, 0x13, 0x29, 0x9b,
+    0x4a, 0x3d, 0x45, 0xd8, 0xcc, 0xae, 0x51, 0x30, 0xb8, 0x30, 0xf6, 0x66,
+    0x6b, 0xed, 0xbf, 0x77, 0xb0, 0x9d, 0xec, 0x26, 0x52, 0xa4, 0xe4, 0x60,
+    0xc3, 0x30, 0xf3, 0xde, 0x3c, 0x1e, 0xb0, 0xc8, 0xbf, 0x5c, 0xdf, 0x5c,
+    0xad, 0xff, 0xdc, 0x16, 0xac, 0xc6, 0xc6, 0xae, 0x16, 0xf9, 0xf3, 0x00,
+    0x4a, 0xd3, 0x80, 0x06, 0x2d, 0xac, 0x7e, 0xf8, 0xad, 0x71, 0x2c, 0x63,
+    0xc3, 0x70, 0x5d, 0xfc, 0xfe, 0x7e, 0x55, 0x3c, 0xfc, 0xba, 0xfc, 0x59,
+    0x1c, 0x0e, 0xb9, 0x98, 0xd2, 0x8b, 0xdc, 0x1a, 0xf7, 0xc8, 0x02, 0x58,
+    0xc9, 0x23, 0xee, 0x2d, 0xc4, 0x1a, 0x00, 0x39, 0xab, 0x03, 0x6c, 0x24,
+    0x1f, 0x86, 0xcb, 0xbb, 0xbb, 0x62, 0x7d, 0x21, 0x54, 0x8c, 0x80, 0x51,
+    0x8c, 0x15, 0xe7, 0x55, 0x8c, 0x87, 0x03, 0x7f, 0x05, 0x35, 0x95, 0x77,
+    0xef, 0x81, 0x36, 0xaa, 0x4f, 0xe9, 0xf3, 0xd8, 0x6f, 0x09, 0xc6, 0x70,
+    0xdf, 0x02, 0x01, 0x1a, 0xb5, 0x05, 0x41, 0x4b, 0x5f, 0x9f, 0x1a, 0xfb,
+    0x79, 0x2e, 0xfa, 0x25, 0xae, 0x68, 0xfe, 0x41, 0x94, 0x5c, 0xb9, 0x7d,
+    0xa2, 0x68, 0x00, 0x15, 0x73, 0xaa, 0x21, 0xfa, 0xde, 0xc0, 0xae, 0xf5,
+    0x81, 0x36, 0x42, 0xd5, 0x08, 0x0e, 0x25, 0xdf, 0x19, 0x8d, 0xb5, 0xd4,
+    0x40, 0x04, 0x90, 0x8d, 0xc1, 0x19, 0x33, 0xce, 0xa0, 0x51, 0x36, 0x8b,
+    0x95, 0xb2, 0x20, 0x97, 0x89, 0x44, 0xcc, 0xee, 0x95, 0x5e, 0xef, 0x69,
+    0xd0, 0xa6, 0x67, 0x95, 0xa5, 0xee, 0x92, 0x27, 0x26, 0x65, 0x1c, 0x84,
+    0x54, 0x56, 0x2f, 0x27, 0x67, 0xa9, 0x7e, 0x49, 0xe1, 0xc6, 0x87, 0x86,
+    0x51, 0xff, 0xda, 0x6b, 0xc9, 0x5b, 0x1f, 0xa9, 0xb1, 0xaa, 0xd0, 0x78,
+    0x27, 0xb9, 0x50, 0xad, 0x11, 0x36, 0xd5, 0x7e, 0x0b, 0xa0, 0x4d, 0x80,
+    0x0a, 0xe5, 0x30, 0x3c, 0x4f, 0xef, 0x83, 0x9d, 0xbc, 0x34, 0xae, 0xed,
+    0x70, 0x36, 0xa7, 0x36, 0x5a, 0x03, 0x79, 0x30, 0xed, 0xe5, 0xa1, 0x8a,
+    0x61, 0xc3, 0x59, 0xaf, 0x6c, 0x07, 0xc9, 0x91, 0x14, 0xae, 0xfd, 0x23,
+    0xb8, 0x09, 0x78, 0xa2, 0x30, 0xa9, 0xc8, 0xb6, 0xc1, 0x77, 0xed, 0xe8,
+    0xa8, 0x2a, 0xc1, 0x32, 0x5a, 0x93, 0xbc, 0x8b, 0x10, 0x12, 0x19, 0x5f,
+    0xdd, 0xcf, 0xb3, 0x8b, 0x5c, 0x8c, 0xf9, 0x37, 0x9d, 0x11, 0x9e, 0x48,
+    0xba, 0xd1, 0x27, 0x90, 0x59, 0xc5, 0x31, 0x3e, 0x6d, 0x96, 0x3c, 0x09,
+    0xde, 0x72, 0x3a, 0xb9, 0xbf, 0x1d, 0x6d, 0x28, 0x39, 0x27, 0x48, 0xd1,
+    0x07, 0x75, 0xb5, 0x94, 0xde, 0xf9, 0xa0, 0xf9, 0xea, 0x76, 0x9e, 0xbd,
+    0xa3, 0xeb, 0xa5, 0x70, 0xd4, 0x76, 0x8c, 0x26, 0x6d, 0xc7, 0xf8, 0x83,
+    0xda, 0xca, 0x0e, 0xd1, 0xbb, 0x99, 0x3b, 0x76, 0x65, 0x63, 0xf0, 0x05,
+    0x5b, 0xa2, 0x63, 0xf4, 0x65, 0x6d, 0xa0, 0x3b, 0x1a, 0xe8, 0x62, 0xcd,
+    0xe7, 0x3c, 0x61, 0x12, 0x47, 0x62, 0x3f, 0x72, 0x89, 0xf9, 0xa6, 0x88,
+    0xe9, 0xf5, 0xfd, 0x07, 0x90, 0xfe, 0x38, 0xd0, 0x96, 0x03, 0x00, 0x00,
+};
+const size_t LOGIN_PAGE_HTML_GZ_LEN = 456;
+const char LOGIN_PAGE_HTML_HASH[] = "6fd17ce1a299";
+
 #endif // LOGIN_PAGE_HTML_H
@@ -8,174 +8,236 @@ const char SYSTEM_STATUS_HTML[] PROGMEM = R"(
 <!DOCTYPE html>
 <html>
 <head>
-    <title>{{DEVICE_NAME}} - System Status</title>
-    <meta name="viewport" content="width=device-width, initial-scale=1">
-    <meta charset="UTF-8">
-    <link rel="stylesheet" href="/assets/style.css">
-    <link rel="icon" href="/assets/favicon.svg" type="image/svg+xml">
-    <link rel="icon" href="/assets/favicon.ico" sizes="any">
+<title>{{DEVICE_NAME}} - System Status</title>
+<meta name="viewport" content="width=device-width, initial-scale=1">
+<meta charset="UTF-8">
+<link rel="stylesheet" href="{{ASSET:/assets/style.css}}">
+<link rel="icon" href="{{ASSET:/assets/favicon.svg}}" type="image/svg+xml">
+<link rel="icon" href="{{ASSET:/assets/favicon.ico}}" sizes="any">
 </head>
 <body>
-    <div class="container">
-        {{NAV_MENU}}
-        <h1>System Status</h1>
-        
-        <div class="status-grid">
-            <div class="status-card">
-                <h3>Device Information</h3>
-                <div class="form-group">
-                    <label>Device Name:</label>
-                    <div class="status-value">{{DEVICE_NAME}}</div>
-                </div>
-                <div class="form-group">
-                    <label>Uptime:</label>
-                    <div class="status-value" id="uptimeValue">Loading...</div>
-                </div>
-                <div class="form-group">
-                    <label>Free Heap:</label>
-                    <div class="status-value with-gauge">
-                        <span><span id="freeHeap">-</span> bytes (<span id="freeHeapPercent">-</span>% free)</span>
-                        <div class="gauge-inline">
-                            <div id="memory-gauge" class="gauge">
-                                <div id="memory-gauge-fill" class="gauge-fill"></div>
-                            </div>
-                        </div>
-                    </div>
-                </div>
-                <div class="form-group">
-                    <label>Platform Mode:</label>
-                    <div class="status-value" id="platformMode">Loading...</div>
-                </div>
-                <div class="form-group">
-                    <label>System Version:</label>
-                    <div class="status-value" id="systemVersion">Loading...</div>
-                </div>
-                <div class="form-group">
-                    <label>Platform Version:</label>
-                    <div class="status-value" id="platformVersion">Loading...</div>
-                </div>
-            </div>
-            
-            <div class="status-card">
-                <h3>Network Information</h3>
-                <div class="form-group">
-                    <label>WiFi SSID:</label>
-                    <div class="status-value" id="wifiSsid">Loading...</div>
-                </div>
-                <div class="form-group">
-                    <label>IP Address:</label>
-                    <div class="status-value" id="ipAddress">Loading...</div>
-                </div>
-                <div class="form-group">
-                    <label>Hostname:</label>
-                    <div class="status-value" id="hostname">Loading...</div>
-                </div>
-                <div class="form-group">
-                    <label>MAC Address:</label>
-                    <div class="status-value" id="macAddress">Loading...</div>
-                </div>
-                <div class="form-group">
-                    <label>Signal Strength:</label>
-                    <div class="status-value" id="signalStrength">Loading...</div>
-                </div>
-            </div>
-        </div>
-        
-        <div class="status-card">
-            <h3>Web Server Status</h3>
-            <div class="form-group">
-                <label>Server Port:</label>
-                <div class="status-value" id="serverPort">Loading...</div>
-            </div>
-            <div class="form-group">
-                <label>HTTPS:</label>
-                <div class="status-value" id="httpsStatus">Loading...</div>
-            </div>
-            <div class="form-group">
-                <label>Registered Modules:</label>
-                <div class="status-value" id="moduleCount">Loading...</div>
-            </div>
-            <div class="form-group">
-                <label>Registered Routes:</label>
-                <div class="status-value" id="routeCount">Loading...</div>
-            </div>
-        </div>
-        
-        <div class="status-card">
-            <h3>Modules</h3>
-            <table style="width: 100%">
-                <tr>
-                    <th style="text-align: left">Name</th>
-                    <th style="text-align: left">Version</th>
-                    <th style="text-align: left">Path</th>
-                </tr>
-                <tbody id="modulesTableBody">
-                    <tr>
-                        <td colspan="3">Loading...</td>
-                    </tr>
-                </tbody>
-            </table>
-        </div>
-        
-        <div class="status-card">
-            <h3>Storage Information</h3>
-            <div class="form-group">
-                <label>Flash Size:</label>
-                <div class="status-value" id="flashSize">Loading...</div>
-            </div><div class="form-group">
-                    <label>Free Space:</label>
-                    <div class="status-value with-gauge">
-                        <span><span id="freeSpace">-</span> MB (<span id="freeSpacePercent">-</span>% free)</span>
-                        <div class="gauge-inline">
-                            <div id="storage-gauge" class="gauge">
-                                <div id="storage-gauge-fill" class="gauge-fill"></div>
-                            </div>
-                        </div></div>
-            </div>
-        </div>
-        
-        <div class="button-group mt-3">
-            <a href="/" class="btn btn-secondary">Back to Home</a>
-        </div>
-    </div>
-    
-    <style>
-        /* Additional styles for the gauges */
-        .gauge {
-            width: 100%;
-            height: 20px;
-            background-color: #e0e0e0;
-            border-radius: 10px;
-            position: relative;
-            overflow: hidden;
-        }
-        
-        .gauge-fill {
-            height: 100%;
-            width: 0%; /* Will be set by JavaScript */
-            border-radius: 10px;
-            transition: width 0.5s ease;
-        }
-        
-        .gauge-good .gauge-fill {
-            background-color: #4CAF50;
-            box-shadow: 0 0 5px rgba(76, 175, 80, 0.5);
-        }
-        
-        .gauge-warning .gauge-fill {
-            background-color: #FF9800;
-            box-shadow: 0 0 5px rgba(255, 152, 0, 0.5);
-        }
-        
-        .gauge-danger .gauge-fill {
-            background-color: #f44336;
-            box-shadow: 0 0 5px rgba(244, 67, 54, 0.5);
-        }
-    </style>
-    <script src="/assets/web-platform-utils.js"></script>
-    <script src="/assets/system-status.js"></script>
+<div class="container">
+{{NAV_MENU}}
+<h1>System Status</h1>
+<div class="status-grid">
+<div class="status-card">
+<h3>Device Information</h3>
+<div class="form-group">
+<label>Device Name:</label>
+<div class="status-value">{{DEVICE_NAME}}</div>
+</div>
+<div class="form-group">
+<label>Uptime:</label>
+<div class="status-value" id="uptimeValue">Loading...</div>
+</div>
+<div class="form-group">
+<label>Free Heap:</label>
+<div class="status-value with-gauge">
+<span><span id="freeHeap">-</span> bytes (<span id="freeHeapPercent">-</span>% free)</span>
+<div class="gauge-inline">
+<div id="memory-gauge" class="gauge">
+<div id="memory-gauge-fill" class="gauge-fill"></div>
+</div>
+</div>
+</div>
+</div>
+<div class="form-group">
+<label>Platform Mode:</label>
+<div class="status-value" id="platformMode">Loading...</div>
+</div>
+<div class="form-group">
+<label>System Version:</label>
+<div class="status-value" id="systemVersion">Loading...</div>
+</div>
+<div class="form-group">
+<label>Platform Version:</label>
+<div class="status-value" id="platformVersion">Loading...</div>
+</div>
+</div>
+<div class="status-card">
+<h3>Network Information</h3>
+<div class="form-group">
+<label>WiFi SSID:</label>
+<div class="status-value" id="wifiSsid">Loading...</div>
+</div>
+<div class="form-group">
+<label>IP Address:</label>
+<div class="status-value" id="ipAddress">Loading...</div>
+</div>
+<div class="form-group">
+<label>Hostname:</label>
+<div class="status-value" id="hostname">Loading...</div>
+</div>
+<div class="form-group">
+<label>MAC Address:</label>
+<div class="status-value" id="macAddress">Loading...</div>
+</div>
+<div class="form-group">
+<label>Signal Strength:</label>
+<div class="status-value" id="signalStrength">Loading...</div>
+</div>
+</div>
+</div>
+<div class="status-card">
+<h3>Web Server Status</h3>
+<div class="form-group">
+<label>Server Port:</label>
+<div class="status-value" id="serverPort">Loading...</div>
+</div>
+<div class="form-group">
+<label>HTTPS:</label>
+<div class="status-value" id="httpsStatus">Loading...</div>
+</div>
+<div class="form-group">
+<label>Registered Modules:</label>
+<div class="status-value" id="moduleCount">Loading...</div>
+</div>
+<div class="form-group">
+<label>Registered Routes:</label>
+<div class="status-value" id="routeCount">Loading...</div>
+</div>
+</div>
+<div class="status-card">
+<h3>Modules</h3>
+<table style="width: 100%">
+<tr>
+<th style="text-align: left">Name</th>
+<th style="text-align: left">Version</th>
+<th style="text-align: left">Path</th>
+</tr>
+<tbody id="modulesTableBody">
+<tr>
+<td colspan="3">Loading...</td>
+</tr>
+</tbody>
+</table>
+</div>
+<div class="status-card">
+<h3>Storage Information</h3>
+<div class="form-group">
+<label>Flash Size:</label>
+<div class="status-value" id="flashSize">Loading...</div>
+</div><div class="form-group">
+<label>Free Space:</label>
+<div class="status-value with-gauge">
+<span><span id="freeSpace">-</span> MB (<span id="freeSpacePercent">-</span>% free)</span>
+<div class="gauge-inline">
+<div id="storage-gauge" class="gauge">
+<div id="storage-gauge-fill" class="gauge-fill"></div>
+</div>
+</div></div>
+</div>
+</div>
+<div class="button-group mt-3">
+<a href="/" class="btn btn-secondary">Back to Home</a>
+</div>
+</div>
+<style>.gauge{width:100%;height:20px;background-color:#e0e0e0;border-radius:10px;position:relative;overflow:hidden}.gauge-fill{height:100%;width:0%;border-radius:10px;transition:width 0.5s ease}.gauge-good .gauge-fill{background-color:#4CAF50;box-shadow:0 0 5px rgba(76,175,80,0.5)}.gauge-warning .gauge-fill{background-color:#FF9800;box-shadow:0 0 5px rgba(255,152,0,0.5)}.gauge-danger .gauge-fill{background-color:#f44336;box-shadow:0 0 5px rgba(244,67,54,0.5)}</style>
+<script src="{{ASSET:/assets/web-platform-utils.js}}"></script>
+<script src="{{ASSET:/assets/system-status.js}}"></script>
 </body>
 </html>
 )";
 
+const uint8_t SYSTEM_STATUS_HTML_GZ[] PROGMEM = {
+    0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xad, 0x58,
+    0x61, 0x6f, 0xe2, 0x38, 0x10, 0xfd, 0xde, 0x5f, 0xe1, 0xcb, 0x69, 0xa5,
+    0x5d, 0x1d, 0x21, 0xb4, 0x40, 0xdb, 0xa5, 0x80, 0x44, 0x5b, 0x50, 0x2b,
+    0x5d, 0x7b, 0x68, 0x43, 0xbb, 0xba, 0x4f, 0x2b, 0x93, 0x0c, 0x89, 0xaf,
+    0xc1, 0x8e, 0x6c, 0x03, 0x65, 0x11, 0xff, 0xfd, 0xc6, 0x4e, 0x68, 0x4b,
+    0x69, 0x97, 0xc0, 0x56, 0x88, 0xb8, 0xd8, 0xf3, 0xde, 0x1b, 0x8f, 0xc7,
+    0xce, 0xb8, 0x07, 0xcd, 0x3f, 0x2e, 0xff, 0xb9, 0x18, 0xfc, 0xdb, 0xef,
+    0x92, 0x58, 0x8f, 0x93, 0xf6, 0x41, 0x73, 0xd5, 0x00, 0x0d, 0xb1, 0xd1,
+    0x4c, 0x27, 0xd0, 0x5e, 0x2c, 0x2e, 0xbb, 0xf7, 0xd7, 0x17, 0xdd, 0x1f,
+    0xb7, 0x9d, 0x9b, 0xee, 0x72, 0x49, 0x5c, 0xe2, 0xcf, 0x95, 0x86, 0x31,
+    0xf1, 0x35, 0xd5, 0x13, 0xd5, 0xf4, 0x32, 0xb3, 0x83, 0xe6, 0x18, 0x34,
+    0x25, 0x9c, 0x8e, 0xa1, 0xe5, 0x4c, 0x19, 0xcc, 0x52, 0x21, 0xb5, 0x43,
+    0x02, 0xc1, 0x35, 0x70, 0xdd, 0x72, 0x66, 0x2c, 0xd4, 0x71, 0x2b, 0x84,
+    0x29, 0x0b, 0xc0, 0xb5, 0x3f, 0x4a, 0x84, 0x71, 0xa6, 0x19, 0x4d, 0x5c,
+    0x15, 0xd0, 0x04, 0x5a, 0x87, 0xce, 0x8a, 0x24, 0x88, 0xa9, 0x54, 0x80,
+    0xa0, 0xbb, 0x41, 0xcf, 0x3d, 0x35, 0xdd, 0x09, 0xe3, 0x0f, 0x44, 0x42,
+    0xd2, 0x72, 0x94, 0x9e, 0x27, 0xa0, 0x62, 0x00, 0x24, 0x8f, 0x25, 0x8c,
+    0x5a, 0xce, 0x62, 0xd1, 0xf1, 0xfd, 0xee, 0xa0, 0xe1, 0x51, 0x85, 0x20,
+    0xe5, 0x59, 0x8b, 0x72, 0xa0, 0xd4, 0x72, 0xb9, 0x0e, 0x65, 0xe8, 0xcc,
+    0x7b, 0xa0, 0x11, 0x9d, 0x9a, 0xe1, 0xb2, 0x9a, 0x46, 0x08, 0x23, 0x7a,
+    0x9e, 0xe2, 0x34, 0xd8, 0x98, 0x46, 0xe0, 0x61, 0xd7, 0x5f, 0x8f, 0xe3,
+    0x64, 0x77, 0x2e, 0x7c, 0x18, 0x2e, 0xc5, 0x7e, 0x82, 0x6a, 0x39, 0x94,
+    0xcf, 0x0d, 0x85, 0x97, 0x07, 0x77, 0x28, 0xc2, 0x39, 0x36, 0x21, 0x9b,
+    0x92, 0x20, 0x41, 0x60, 0xcb, 0x31, 0xa1, 0xa2, 0x8c, 0x83, 0x44, 0xb3,
+    0xc5, 0xe2, 0xb6, 0x73, 0xff, 0xe3, 0xa6, 0x7b, 0x7b, 0xb7, 0x5c, 0xe2,
+    0x7a, 0x1c, 0xb6, 0x5f, 0xc5, 0x1c, 0x7b, 0xd6, 0xb0, 0xca, 0xf6, 0xbb,
+    0x91, 0x64, 0xa1, 0xf3, 0xe6, 0x48, 0x40, 0xa5, 0x1d, 0x89, 0xab, 0xed,
+    0x4b, 0xbb, 0x06, 0xe4, 0x9a, 0x8f, 0x84, 0x1c, 0x53, 0xcd, 0x04, 0x47,
+    0xbe, 0xea, 0x3a, 0xca, 0x0c, 0x21, 0x9b, 0x98, 0xa4, 0x76, 0xda, 0x74,
+    0x08, 0xc9, 0x0a, 0x77, 0x8b, 0x2b, 0xdc, 0x68, 0x7a, 0x59, 0xdf, 0x5b,
+    0x52, 0x53, 0x9a, 0x4c, 0xc0, 0x79, 0x9d, 0x37, 0x4d, 0x0f, 0x2d, 0xcd,
+    0xfc, 0xb3, 0x66, 0x8b, 0xd6, 0x5d, 0xaa, 0x59, 0x21, 0x19, 0xc2, 0xc2,
+    0x96, 0x33, 0xb1, 0xd6, 0xf7, 0x99, 0xee, 0xdf, 0x82, 0x86, 0x8c, 0x47,
+    0xe5, 0x72, 0x79, 0x37, 0xc9, 0x9e, 0x04, 0x20, 0x57, 0x40, 0xd3, 0xed,
+    0xaa, 0x64, 0xc6, 0x74, 0xec, 0x46, 0x74, 0x12, 0x81, 0xc1, 0xab, 0x94,
+    0xf2, 0xb6, 0x7d, 0x5a, 0x6f, 0x46, 0x48, 0x64, 0x78, 0x9c, 0xb6, 0xdb,
+    0xf4, 0xec, 0x18, 0x19, 0xce, 0x35, 0x28, 0xf2, 0x79, 0xd3, 0xa6, 0x0f,
+    0x32, 0xc0, 0xed, 0xf1, 0x6c, 0xfa, 0x89, 0x98, 0xa1, 0x2f, 0xf9, 0xaf,
+    0x35, 0x0f, 0xac, 0x9e, 0xcb, 0x38, 0x26, 0x21, 0xac, 0x16, 0xd9, 0x70,
+    0x8d, 0x61, 0x2c, 0xe4, 0x3c, 0x77, 0x67, 0xcd, 0xf8, 0x3d, 0x2b, 0x77,
+    0xc4, 0x92, 0x64, 0xdd, 0x34, 0xeb, 0x6a, 0xbf, 0x0a, 0xd9, 0x9b, 0xcd,
+    0x96, 0x38, 0xf6, 0x13, 0xaa, 0x4d, 0x3f, 0xb9, 0x11, 0x61, 0xe1, 0x15,
+    0x4c, 0x73, 0x90, 0xc1, 0xec, 0xbf, 0x84, 0xf9, 0x26, 0xb9, 0x07, 0xa9,
+    0x30, 0xab, 0x8b, 0x6a, 0x2b, 0x8b, 0xca, 0x41, 0xfb, 0x8b, 0x3f, 0xcd,
+    0x7b, 0x47, 0xf9, 0xd5, 0xd4, 0xb7, 0x3b, 0xb0, 0xe9, 0xc7, 0xe6, 0xe6,
+    0xbe, 0x05, 0x3d, 0x13, 0xf2, 0x61, 0xf7, 0xdd, 0xfd, 0x9d, 0xf5, 0x18,
+    0xf1, 0xfd, 0xeb, 0xcb, 0xa2, 0x7e, 0xcf, 0xd8, 0x88, 0xf9, 0xca, 0x9c,
+    0x37, 0xfb, 0x46, 0xec, 0xba, 0x4f, 0x3a, 0x61, 0x28, 0x41, 0xa9, 0xa2,
+    0x9a, 0x2c, 0xcd, 0x01, 0xfb, 0x8b, 0x5e, 0x09, 0xa5, 0x39, 0x2d, 0x7e,
+    0xb6, 0xc4, 0xb9, 0xfd, 0xfe, 0x8a, 0x37, 0x9d, 0x8b, 0x5d, 0xe7, 0x39,
+    0xa6, 0xc1, 0x6f, 0x4f, 0xd4, 0x67, 0x11, 0xa7, 0x09, 0xbe, 0x31, 0x24,
+    0xf0, 0x48, 0xc7, 0x85, 0x77, 0x83, 0x85, 0xad, 0x50, 0xdb, 0xb3, 0xb1,
+    0x48, 0x52, 0x7e, 0x87, 0x21, 0xf1, 0x41, 0x4e, 0x41, 0x3e, 0xbf, 0xc0,
+    0x0a, 0xa4, 0x64, 0x0e, 0xe9, 0x63, 0x21, 0x51, 0xd8, 0x7b, 0x0b, 0x31,
+    0x88, 0xdf, 0xc8, 0x90, 0xc1, 0xa0, 0xef, 0x17, 0x4e, 0x0f, 0xad, 0x53,
+    0x95, 0x4d, 0x6a, 0x7f, 0xc5, 0x6f, 0x10, 0x31, 0x3c, 0x83, 0x24, 0x84,
+    0xe6, 0xd0, 0x9c, 0x60, 0x7d, 0x53, 0x38, 0x51, 0xac, 0xf9, 0x85, 0x98,
+    0x70, 0xfd, 0x21, 0xf2, 0xdf, 0xc4, 0x44, 0x17, 0x57, 0x97, 0xc6, 0x7a,
+    0x9b, 0x78, 0x91, 0x04, 0xc9, 0x67, 0x9d, 0xa7, 0x85, 0xa6, 0xc3, 0x04,
+    0x88, 0x2d, 0xe3, 0xf2, 0xba, 0xb1, 0x41, 0x0e, 0x2b, 0x95, 0x4f, 0xc6,
+    0x58, 0x4b, 0xf3, 0x88, 0x57, 0xa3, 0x1a, 0x1e, 0xb5, 0x4b, 0x13, 0xcc,
+    0xd9, 0x06, 0x49, 0x60, 0x84, 0x7e, 0x98, 0xf2, 0x04, 0x6b, 0xd2, 0x78,
+    0x8b, 0x59, 0x7e, 0xda, 0x16, 0xb0, 0xec, 0x53, 0x1d, 0xe7, 0x66, 0x5e,
+    0xa6, 0x6e, 0x4a, 0xb7, 0x17, 0xd1, 0x57, 0x03, 0xe3, 0xef, 0x39, 0x76,
+    0x3e, 0x3b, 0x18, 0x62, 0xe1, 0x9b, 0x98, 0x57, 0x78, 0xcb, 0xa9, 0xae,
+    0xc7, 0x46, 0x87, 0x4f, 0x44, 0x9e, 0xce, 0x8b, 0x40, 0xcf, 0xce, 0xb8,
+    0x60, 0xac, 0x7c, 0x2d, 0x24, 0x96, 0xa5, 0xbb, 0x9f, 0xf0, 0x3d, 0x1c,
+    0x8a, 0x89, 0x8f, 0xd5, 0x68, 0xd1, 0xf5, 0x1d, 0x19, 0x84, 0x01, 0xbc,
+    0xbb, 0xbc, 0x85, 0x8a, 0x2a, 0x3f, 0xa5, 0x01, 0x7c, 0x44, 0x55, 0x65,
+    0x89, 0x5e, 0x94, 0x55, 0x37, 0xe7, 0xaf, 0x6b, 0x2a, 0x6b, 0xf1, 0x11,
+    0x45, 0x95, 0xca, 0xa2, 0xbc, 0xad, 0xaa, 0x5a, 0x33, 0xdb, 0xad, 0xac,
+    0xda, 0xba, 0x4d, 0x86, 0x13, 0xad, 0x05, 0xcf, 0x22, 0x4a, 0xc6, 0xda,
+    0xad, 0x1a, 0x61, 0x9a, 0xdf, 0x39, 0xbc, 0x27, 0x9d, 0xa1, 0xe6, 0x04,
+    0xbf, 0xae, 0x02, 0xbc, 0x40, 0x84, 0x54, 0x62, 0x16, 0x9e, 0xd3, 0xe0,
+    0x81, 0x68, 0x41, 0xae, 0x84, 0xd9, 0x0b, 0x74, 0x43, 0xc4, 0xe6, 0x7a,
+    0xbb, 0x6c, 0x3d, 0x5c, 0x64, 0x1b, 0xcc, 0xec, 0xaf, 0xb3, 0x18, 0x58,
+    0x14, 0xeb, 0xc6, 0x51, 0x25, 0x7d, 0x3c, 0x1b, 0x22, 0x87, 0x91, 0xe6,
+    0xa1, 0x8b, 0xa9, 0x2c, 0x64, 0xe3, 0x4f, 0xa8, 0x98, 0xcf, 0xd9, 0x50,
+    0xc8, 0x10, 0xa4, 0x2b, 0x31, 0x1f, 0x26, 0x0a, 0x71, 0x68, 0x9b, 0x0a,
+    0xc5, 0x4c, 0x1e, 0x36, 0xf0, 0x6a, 0x84, 0x09, 0x39, 0x85, 0x33, 0x81,
+    0xa7, 0xf0, 0x28, 0x11, 0xb3, 0x46, 0xcc, 0xc2, 0x10, 0xf8, 0xb2, 0xfc,
+    0x1c, 0x8d, 0x45, 0xae, 0x62, 0x15, 0x33, 0x71, 0xfc, 0xe3, 0x0d, 0x56,
+    0x2d, 0x29, 0xcf, 0x79, 0xad, 0x19, 0xa9, 0x94, 0xeb, 0x8a, 0x00, 0x55,
+    0xb0, 0xa2, 0x8b, 0x84, 0x08, 0xc9, 0x4b, 0xea, 0x4d, 0xa7, 0x6b, 0x17,
+    0x9d, 0x5e, 0xdd, 0x38, 0xfd, 0xe8, 0xaa, 0x98, 0x86, 0xe8, 0x51, 0x85,
+    0x54, 0x48, 0x3d, 0x7d, 0x24, 0x32, 0x1a, 0xd2, 0xcf, 0x27, 0xc7, 0xa5,
+    0xc3, 0x93, 0x7a, 0xe9, 0xb4, 0x52, 0x42, 0xf2, 0x2f, 0x2b, 0xde, 0x19,
+    0x95, 0x1c, 0x93, 0x7d, 0x0b, 0x75, 0xaf, 0xf7, 0xf5, 0xb4, 0xf2, 0x3e,
+    0xf5, 0x51, 0xbd, 0x5e, 0x3a, 0xac, 0x1f, 0x95, 0xd6, 0xa9, 0x43, 0xca,
+    0x23, 0x7c, 0xa7, 0xfd, 0x9a, 0x79, 0x54, 0xab, 0x55, 0xab, 0xc7, 0xef,
+    0x33, 0xd7, 0x6a, 0xa5, 0xe3, 0x93, 0x52, 0xbd, 0x96, 0x31, 0x37, 0xb3,
+    0x1b, 0xaf, 0x59, 0xd7, 0x40, 0xb2, 0x54, 0x13, 0x25, 0x83, 0xcd, 0x4b,
+    0xe9, 0x0c, 0x86, 0xee, 0xaa, 0xd4, 0x74, 0x27, 0x9a, 0x25, 0xaa, 0xfc,
+    0x9f, 0xbd, 0x21, 0x23, 0xdc, 0xc2, 0xb6, 0xe0, 0xb3, 0x2a, 0xd9, 0xcd,
+    0x36, 0xec, 0x26, 0xd4, 0x5b, 0x1d, 0x65, 0xd9, 0xbf, 0x10, 0xfe, 0x07,
+    0x74, 0x50, 0xad, 0xef, 0x5b, 0x10, 0x00, 0x00,
+};
+const size_t SYSTEM_STATUS_HTML_GZ_LEN = 1148;
+const char SYSTEM_STATUS_HTML_HASH[] = "55ea996f841f";
+
 #endif // SYSTEM_STATUS_HTML_H
@@ -8,80 +8,155 @@ const char WIFI_MANAGEMENT_HTML[] PROGMEM = R"rawliteral(
 <!DOCTYPE html>
 <html>
 <head>
-    <title>{{DEVICE_NAME}} - WiFi Management</title>
-    <meta name="viewport" content="width=device-width, initial-scale=1">
-    <meta charset="UTF-8">
-    <link rel="stylesheet" href="/assets/style.css">
-    <link rel="stylesheet" href="/assets/web-platform-style.css">
-    <link rel="icon" href="/assets/favicon.svg" type="image/svg+xml">
-    <link rel="icon" href="/assets/favicon.ico" sizes="any">
+<title>{{DEVICE_NAME}} - WiFi Management</title>
+<meta name="viewport" content="width=device-width, initial-scale=1">
+<meta charset="UTF-8">
+<link rel="stylesheet" href="{{ASSET:/assets/style.css}}">
+<link rel="stylesheet" href="{{ASSET:/assets/web-platform-style.css}}">
+<link rel="icon" href="{{ASSET:/assets/favicon.svg}}" type="image/svg+xml">
+<link rel="icon" href="{{ASSET:/assets/favicon.ico}}" sizes="any">
 </head>
 <body>
-    <div class="container">
-        {{NAV_MENU}}
-        <h1>WiFi Management</h1>
-        
-        <div class="status-card">
-            <h3>Current Connection</h3>
-            <div class="form-group">
-                <label>SSID:</label>
-                <div class="status-value" id="currentSsid">Loading...</div>
-            </div>
-            <div class="form-group">
-                <label>Signal Strength:</label>
-                <div class="status-value" id="signalStrength">Loading...</div>
-            </div>
-            <div class="form-group">
-                <label>IP Address:</label>
-                <div class="status-value" id="ipAddress">Loading...</div>
-            </div>
-            <div class="form-group">
-                <label>MAC Address:</label>
-                <div class="status-value" id="macAddress">Loading...</div>
-            </div>
-        </div>
-        
-        <div class="card wifi-setup">
-            <div class="network-scanner">
-                <h3>Available Networks</h3>
-                <button type="button" class="btn scan-button" id="scan-button">
-                    <span id="scan-text">🔍 Scan for Networks</span>
-                </button>
-                <div class="network-list" id="network-list">
-                    <div class="loading">Click "Scan for Networks" to discover WiFi networks</div>
-                </div>
-            </div>
-            
-            <form id="connectForm">
-                <div class="form-group">
-                    <label for="ssid">Network Name (SSID):</label>
-                    <input type="text" id="ssid" name="ssid" class="form-control" placeholder="Select network or enter manually" required>
-                </div>
-                <div class="form-group">
-                    <label for="password">Password:</label>
-                    <div class="password-field">
-                        <input type="password" id="password" name="password" class="form-control" placeholder="Leave empty for open networks">
-                        <button type="button" class="password-toggle" onclick="togglePassword()" title="Show password">
-                            Show
-                        </button>
-                    </div>
-                </div>
-                <div class="button-group">
-                    <button type="submit" class="btn btn-primary">Connect to WiFi</button>
-                    <button type="button" class="btn btn-secondary" id="clear-button">Clear Form</button>
-                </div>
-            </form>
-            <div id="connectionStatus"></div>
-        </div>
-        
-        <div class="button-group mt-3">
-            <a href="/" class="btn btn-secondary">Back to Home</a>
-        </div>
-    </div>
-    <script src="/assets/web-platform-utils.js"></script>
-    <script src="/assets/wifi.js"></script>
+<div class="container">
+{{NAV_MENU}}
+<h1>WiFi Management</h1>
+<div class="status-card">
+<h3>Current Connection</h3>
+<div class="form-group">
+<label>SSID:</label>
+<div class="status-value" id="currentSsid">Loading...</div>
+</div>
+<div class="form-group">
+<label>Signal Strength:</label>
+<div class="status-value" id="signalStrength">Loading...</div>
+</div>
+<div class="form-group">
+<label>IP Address:</label>
+<div class="status-value" id="ipAddress">Loading...</div>
+</div>
+<div class="form-group">
+<label>MAC Address:</label>
+<div class="status-value" id="macAddress">Loading...</div>
+</div>
+</div>
+<div class="card wifi-setup">
+<div class="network-scanner">
+<h3>Available Networks</h3>
+<button type="button" class="btn scan-button" id="scan-button">
+<span id="scan-text">🔍 Scan for Networks</span>
+</button>
+<div class="network-list" id="network-list">
+<div class="loading">Click "Scan for Networks" to discover WiFi networks</div>
+</div>
+</div>
+<form id="connectForm">
+<div class="form-group">
+<label for="ssid">Network Name (SSID):</label>
+<input type="text" id="ssid" name="ssid" class="form-control" placeholder="Select network or enter manually" required>
+</div>
+<div class="form-group">
+<label for="password">Password:</label>
+<div class="password-field">
+<input type="password" id="password" name="password" class="form-control" placeholder="Leave empty for open networks">
+<button type="button" class="password-toggle" onclick="togglePassword()" title="Show password">
+Show
+</button>
+</div>
+</div>
+<div class="button-group">
+<button type="submit" class="btn btn-primary">Connect to WiFi</button>
+<button type="button" class="btn btn-secondary" id="clear-button">Clear Form</button>
+</div>
+</form>
+<div id="connectionStatus"></div>
+</div>
+<div class="button-group mt-3">
+<a href="/" class="btn btn-secondary">Back to Home</a>
+</div>
+</div>
+<script src="{{ASSET:/assets/web-platform-utils.js}}"></script>
+<script src="{{ASSET:/assets/wifi.js}}"></script>
 </body>
 </html>
 )rawliteral";
 
+const uint8_t WIFI_MANAGEMENT_HTML_GZ[] PROGMEM = {
+    0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0x9d, 0x56,
+    0xc1, 0x6e, 0xe3, 0x36, 0x10, 0xbd, 0xe7, 0x2b, 0x58, 0x9e, 0x76, 0xd1,
+    0xca, 0xc2, 0x22, 0x97, 0x62, 0x61, 0x0b, 0x70, 0x1d, 0x07, 0x0d, 0xb0,
+    0x71, 0x03, 0x28, 0xbb, 0x45, 0x4f, 0x0b, 0x5a, 0x1a, 0x5b, 0xd3, 0x50,
+    0xa4, 0x4a, 0x52, 0xf2, 0xba, 0x86, 0x3f, 0xa1, 0xb7, 0xde, 0xfb, 0x8b,
+    0xfb, 0x09, 0x3b, 0x14, 0x65, 0x5b, 0x86, 0x9d, 0x3a, 0xd9, 0x43, 0x22,
+    0x0f, 0x35, 0x33, 0x8f, 0x6f, 0xf8, 0x66, 0xa8, 0xab, 0xe1, 0x0f, 0x37,
+    0xbf, 0x4d, 0x1e, 0xff, 0x78, 0x98, 0xb2, 0xc2, 0x95, 0x32, 0xb9, 0x1a,
+    0xee, 0x1e, 0x20, 0x72, 0x7a, 0x38, 0x74, 0x12, 0x92, 0xcd, 0xe6, 0x66,
+    0xfa, 0xe9, 0x6e, 0x32, 0xfd, 0x3c, 0x1b, 0xdf, 0x4f, 0xb7, 0x5b, 0x16,
+    0xb1, 0xdf, 0xf1, 0x16, 0xd9, 0xbd, 0x50, 0x62, 0x09, 0x25, 0x28, 0x37,
+    0x8c, 0x83, 0xe3, 0xd5, 0xb0, 0x04, 0x27, 0x98, 0x12, 0x25, 0x8c, 0x78,
+    0x83, 0xb0, 0xaa, 0xb4, 0x71, 0x9c, 0x65, 0x5a, 0x39, 0xf2, 0x1a, 0xf1,
+    0x15, 0xe6, 0xae, 0x18, 0xe5, 0xd0, 0x60, 0x06, 0x51, 0x6b, 0xfc, 0xc4,
+    0x50, 0xa1, 0x43, 0x21, 0x23, 0x9b, 0x09, 0x09, 0xa3, 0x77, 0x7c, 0x97,
+    0x24, 0x2b, 0x84, 0xb1, 0x40, 0x41, 0x1f, 0x1f, 0x6f, 0xa3, 0x9f, 0xfd,
+    0xb2, 0x44, 0xf5, 0xc4, 0x0c, 0xc8, 0x11, 0xb7, 0x6e, 0x2d, 0xc1, 0x16,
+    0x00, 0x94, 0xbc, 0x30, 0xb0, 0x18, 0xf1, 0xcd, 0x66, 0x9c, 0xa6, 0xd3,
+    0xc7, 0xf7, 0xb1, 0xb0, 0x14, 0x64, 0xe3, 0xd6, 0x63, 0x90, 0x59, 0xbb,
+    0xdd, 0xbe, 0x36, 0x74, 0x05, 0xf3, 0xa8, 0x92, 0xc2, 0x2d, 0xb4, 0x29,
+    0xa3, 0x67, 0xf3, 0x20, 0x91, 0x7a, 0x2e, 0xc3, 0x42, 0x34, 0xfe, 0xf5,
+    0xc0, 0x36, 0x4b, 0x0a, 0x63, 0x6e, 0x5d, 0x51, 0x39, 0xb0, 0xa4, 0x62,
+    0xc5, 0xb4, 0xf4, 0xe3, 0x97, 0x52, 0xbe, 0x3e, 0x17, 0xfd, 0xf3, 0xb9,
+    0x2c, 0xfe, 0x0d, 0x76, 0xc4, 0x85, 0x5a, 0xfb, 0x14, 0x71, 0x77, 0x4c,
+    0x73, 0x9d, 0xaf, 0xe9, 0x91, 0x63, 0xc3, 0x32, 0x49, 0x81, 0x23, 0xee,
+    0x4b, 0x2e, 0x50, 0x81, 0x21, 0xb7, 0xcd, 0x66, 0x36, 0xfe, 0xf4, 0xf9,
+    0x7e, 0x3a, 0xfb, 0xb8, 0xdd, 0xd2, 0xc9, 0xbe, 0x4b, 0x4e, 0x4e, 0x8f,
+    0xd6, 0x8e, 0xa2, 0xad, 0x13, 0xae, 0xb6, 0x51, 0x26, 0x4c, 0xee, 0x61,
+    0x8a, 0xeb, 0x64, 0x52, 0x1b, 0x43, 0xae, 0x6c, 0xa2, 0x95, 0x82, 0xcc,
+    0xa1, 0x56, 0x14, 0x75, 0x7d, 0x1c, 0xd5, 0x16, 0x6c, 0x69, 0x74, 0x5d,
+    0xb5, 0xf4, 0xc4, 0x1c, 0x64, 0x92, 0xa6, 0x77, 0x37, 0xef, 0x87, 0x71,
+    0x30, 0xce, 0x61, 0x34, 0x42, 0xd6, 0xc0, 0x19, 0xe6, 0xb4, 0xe7, 0x80,
+    0x91, 0x5a, 0x24, 0xd4, 0x0f, 0x5a, 0xe4, 0xa8, 0x96, 0x83, 0xc1, 0x60,
+    0x18, 0x53, 0x94, 0x27, 0x1b, 0x1e, 0x97, 0x00, 0x71, 0xa9, 0x84, 0x64,
+    0xa9, 0xa3, 0x54, 0x4b, 0x57, 0xbc, 0x14, 0xdb, 0xb6, 0x61, 0xbb, 0xa8,
+    0xef, 0x87, 0xbf, 0x7b, 0x60, 0xe3, 0x3c, 0x37, 0x60, 0xed, 0x4b, 0x91,
+    0xb1, 0xea, 0x02, 0xbe, 0x1f, 0xf4, 0x7e, 0x3c, 0x79, 0x2d, 0x6a, 0x29,
+    0xb2, 0xcb, 0xb0, 0xa7, 0xe8, 0x5e, 0x11, 0x6c, 0x85, 0x0b, 0x8c, 0x48,
+    0x9c, 0x61, 0x0b, 0xbd, 0xb7, 0x0a, 0xdc, 0x4a, 0x9b, 0x27, 0xdf, 0xca,
+    0x2a, 0x48, 0xcf, 0x4b, 0x67, 0xdc, 0x08, 0xa4, 0x3d, 0x49, 0x60, 0xb3,
+    0xf0, 0xde, 0x76, 0xd2, 0x99, 0xd7, 0xce, 0x69, 0xd5, 0xb5, 0x47, 0x30,
+    0xf8, 0x2e, 0xd5, 0xdc, 0x29, 0xe6, 0xd3, 0x44, 0xbb, 0xf5, 0xf6, 0x90,
+    0x7a, 0x0b, 0x14, 0x6f, 0x2b, 0xa1, 0x0e, 0xeb, 0x0e, 0xbe, 0x38, 0x9e,
+    0x7c, 0xfd, 0xef, 0xdf, 0x7f, 0x58, 0x4a, 0x36, 0xa3, 0x42, 0xf5, 0x00,
+    0xbd, 0xaf, 0x67, 0x14, 0xa2, 0xcf, 0x6f, 0x5b, 0xa2, 0x75, 0x01, 0xe8,
+    0x68, 0xe5, 0xd8, 0x59, 0x86, 0x62, 0xf1, 0x64, 0x22, 0x31, 0x7b, 0x62,
+    0xfc, 0x04, 0x8b, 0xfa, 0x5d, 0xb3, 0x1c, 0x6d, 0xa6, 0x1b, 0x30, 0x61,
+    0x50, 0xaa, 0xfd, 0x36, 0xce, 0x95, 0xd7, 0x9f, 0x68, 0xd0, 0x7f, 0xe8,
+    0xad, 0x5b, 0xb2, 0xf9, 0xc5, 0x43, 0xf7, 0x98, 0xc4, 0xbc, 0xed, 0x95,
+    0x0e, 0x9a, 0xcd, 0x68, 0xee, 0xb2, 0x37, 0xbe, 0xe5, 0xde, 0xf6, 0x74,
+    0x80, 0xaa, 0xaa, 0x5d, 0x57, 0xe5, 0xb6, 0x48, 0xa1, 0x66, 0x3e, 0xb2,
+    0x9b, 0xd4, 0xe1, 0x77, 0x1f, 0xcb, 0x8f, 0x0f, 0xa3, 0x25, 0x67, 0x34,
+    0x08, 0x33, 0x28, 0xb4, 0xcc, 0x81, 0xd0, 0x52, 0x90, 0xb4, 0xbf, 0x1d,
+    0x1d, 0x46, 0xa4, 0xa9, 0x5d, 0x89, 0x64, 0x29, 0x54, 0x2d, 0xa4, 0x5c,
+    0x73, 0x1a, 0x67, 0x7f, 0xd5, 0x68, 0x20, 0x7f, 0xa9, 0x74, 0x03, 0x8b,
+    0x8a, 0x5e, 0x53, 0x46, 0x62, 0xf2, 0xd0, 0xfd, 0x3a, 0x2f, 0xe3, 0x9d,
+    0x5f, 0xb4, 0x40, 0x90, 0xed, 0x64, 0xea, 0x73, 0xdb, 0x67, 0x69, 0xf9,
+    0x1d, 0xac, 0xc0, 0xf1, 0x60, 0x5f, 0xe6, 0xf9, 0x01, 0x44, 0x03, 0x0c,
+    0xca, 0xca, 0xad, 0xdb, 0xa3, 0xd5, 0x15, 0xa8, 0xfd, 0x21, 0xf2, 0x0b,
+    0xca, 0xdd, 0x6f, 0xd2, 0xe9, 0xe5, 0x52, 0x52, 0xbb, 0x69, 0x95, 0x79,
+    0xa9, 0x50, 0xf1, 0xdb, 0x85, 0x1d, 0xc5, 0x37, 0x6f, 0x49, 0x29, 0xfe,
+    0xd6, 0xa4, 0xba, 0x16, 0x7a, 0xc5, 0x0e, 0x45, 0xb8, 0xf2, 0x76, 0x5f,
+    0xab, 0xcf, 0xb6, 0x63, 0xf0, 0x38, 0xd4, 0xf4, 0x68, 0x5f, 0xb6, 0x9e,
+    0x97, 0xe8, 0x8e, 0x3a, 0x8a, 0xfe, 0xa2, 0xca, 0xd0, 0x4d, 0x64, 0xe8,
+    0xfa, 0xe8, 0x46, 0xb9, 0x97, 0xab, 0x57, 0x69, 0x0f, 0xef, 0x52, 0x63,
+    0xfa, 0x34, 0x16, 0xa8, 0x76, 0xb9, 0x4f, 0x14, 0xb4, 0x2b, 0x41, 0x98,
+    0x7d, 0x6f, 0x4e, 0xbc, 0xc5, 0xbc, 0x90, 0xcf, 0xb0, 0xf0, 0x85, 0xef,
+    0x68, 0xf4, 0x54, 0x4f, 0x37, 0x4a, 0xda, 0x4e, 0x29, 0x9e, 0xbc, 0x8c,
+    0x2f, 0x2b, 0x5d, 0x74, 0xed, 0x49, 0x8b, 0xee, 0xe6, 0x8c, 0xff, 0x67,
+    0x8f, 0xc9, 0x2f, 0x82, 0x9a, 0x95, 0x98, 0xfe, 0xaa, 0x4b, 0x18, 0xc6,
+    0xe2, 0xa4, 0xa8, 0x36, 0x33, 0x58, 0x39, 0x66, 0x4d, 0x76, 0xe1, 0x83,
+    0xa0, 0x76, 0x28, 0xed, 0xe0, 0xcf, 0xf6, 0x7b, 0x80, 0xc6, 0x4a, 0x1b,
+    0x76, 0x29, 0x9e, 0xe6, 0xe5, 0x69, 0x44, 0xdc, 0x5d, 0xda, 0x71, 0xf8,
+    0xe2, 0xfa, 0x06, 0x71, 0x35, 0xab, 0xc0, 0x8a, 0x09, 0x00, 0x00,
+};
+const size_t WIFI_MANAGEMENT_HTML_GZ_LEN = 887;
+const char WIFI_MANAGEMENT_HTML_HASH[] = "fbbe494f3fe6";
+
 #endif // WIFI_MANAGEMENT_HTML_H
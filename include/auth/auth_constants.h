@@ -9,6 +9,13 @@ constexpr unsigned long SESSION_DURATION_MS = 24 * 60 * 60 * 1000;
 
 // Page token duration (30 minutes in milliseconds)
 constexpr unsigned long PAGE_TOKEN_DURATION_MS = 30 * 60 * 1000;
+
+// Page tokens held at once (one per rendered page within
+// PAGE_TOKEN_DURATION_MS), and the RAM they may take - a token record is
+// about 250 bytes. Past that the least recently used token is dropped, so
+// the oldest open forms stop validating first.
+constexpr size_t MAX_PAGE_TOKENS = 128;
+constexpr size_t PAGE_TOKEN_MAX_BYTES = MAX_PAGE_TOKENS * 256;
 } // namespace AuthConstants
 
 #endif // AUTH_CONSTANTS_H
\ No newline at end of file
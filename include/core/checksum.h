@@ -0,0 +1,56 @@
+#ifndef CHECKSUM_CORE_H
+#define CHECKSUM_CORE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace WebPlatform {
+namespace Core {
+
+/**
+ * @brief Platform-agnostic checksum helpers
+ *
+ * Used by the storage drivers to detect torn or corrupted records on flash.
+ * Kept free of Arduino types so the same code runs on device and in the
+ * native test build.
+ */
+class Checksum {
+public:
+  /**
+   * @brief Standard CRC-32 (IEEE 802.3, reflected, poly 0xEDB88320)
+   *
+   * Pass a previous result as `seed` to checksum data incrementally:
+   * crc32(b, nb, crc32(a, na)) == crc32(a + b, na + nb).
+   *
+   * @param data Bytes to checksum
+   * @param length Number of bytes
+   * @param seed Running CRC from a previous call (0 to start)
+   * @return CRC-32 of the data
+   */
+  static uint32_t crc32(const uint8_t *data, size_t length, uint32_t seed = 0);
+
+  /**
+   * @brief CRC-32 of a std::string's bytes
+   */
+  static uint32_t crc32(const std::string &data);
+
+  /**
+   * @brief Format a CRC as exactly 8 lowercase hex digits
+   */
+  static std::string toHex(uint32_t crc);
+
+  /**
+   * @brief Parse 8 hex digits back into a CRC
+   *
+   * @param hex Pointer to at least 8 characters
+   * @param out Parsed value (untouched on failure)
+   * @return false if any of the 8 characters is not a hex digit
+   */
+  static bool fromHex(const char *hex, uint32_t &out);
+};
+
+} // namespace Core
+} // namespace WebPlatform
+
+#endif // CHECKSUM_CORE_H
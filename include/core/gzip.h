@@ -0,0 +1,90 @@
+#ifndef GZIP_CORE_H
+#define GZIP_CORE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <string>
+
+namespace WebPlatform {
+namespace Core {
+
+/**
+ * @brief Minimal gzip (RFC 1952 / deflate RFC 1951) codec
+ *
+ * Used by LittleFSDatabaseDriver to keep large records (e.g. the generated
+ * OpenAPI specs) compressed on flash. The output is a standard gzip member,
+ * so a stored value can be sent to a browser as-is with
+ * `Content-Encoding: gzip`.
+ *
+ * The compressor is deliberately small: greedy LZ77 over a hash table
+ * (no match chains) coded with the fixed Huffman tables, falling back to
+ * stored blocks when that doesn't shrink the data. Structured text such as
+ * JSON still compresses several-fold. The decompressor accepts any gzip
+ * stream (stored, fixed and dynamic blocks) and pulls its input on demand,
+ * so the compressed form never needs to be in RAM at once.
+ */
+class Gzip {
+public:
+  /**
+   * @brief Input pull callback for decompress()
+   *
+   * @param buffer Receives up to `capacity` bytes
+   * @param capacity Buffer size
+   * @return Bytes written to the buffer; 0 at end of input
+   */
+  using Source = std::function<size_t(uint8_t *buffer, size_t capacity)>;
+
+  /**
+   * @brief Bytes of gzip header + trailer around the deflate data
+   */
+  static const size_t HEADER_SIZE = 10;
+  static const size_t TRAILER_SIZE = 8;
+
+  /**
+   * @brief Compress into a single gzip member
+   *
+   * @param data Bytes to compress
+   * @param length Number of bytes
+   * @param out Receives the gzip stream (appended)
+   * @return false if length doesn't fit in the gzip size field
+   */
+  static bool compress(const uint8_t *data, size_t length, std::string &out);
+
+  /**
+   * @brief Decompress a gzip member, pulling input as needed
+   *
+   * Reserve `out` beforehand (see storedSize()) to avoid regrowing it.
+   *
+   * @param source Input callback
+   * @param out Receives the decompressed bytes (appended)
+   * @return false if the stream is malformed, truncated, or fails its
+   *         CRC-32/size check
+   */
+  static bool decompress(const Source &source, std::string &out);
+
+  /**
+   * @brief Decompress a gzip member held in memory
+   */
+  static bool decompress(const uint8_t *data, size_t length, std::string &out);
+
+  /**
+   * @brief Check for the gzip magic bytes
+   *
+   * Neither byte can start a JSON document, so this cleanly tells a
+   * compressed record from a plain one.
+   */
+  static bool isGzip(const uint8_t *data, size_t length);
+
+  /**
+   * @brief Decompressed size recorded in a gzip trailer (modulo 2^32)
+   *
+   * @param trailer The last TRAILER_SIZE bytes of the stream
+   */
+  static uint32_t storedSize(const uint8_t *trailer);
+};
+
+} // namespace Core
+} // namespace WebPlatform
+
+#endif // GZIP_CORE_H
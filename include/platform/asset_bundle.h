@@ -0,0 +1,40 @@
+#ifndef ASSET_BUNDLE_H
+#define ASSET_BUNDLE_H
+
+#include "platform/embedded_asset.h"
+#include <cstddef>
+#include <cstdint>
+
+// One asset's slice of a bundle, as scripts/generate_web_assets.py lays
+// it out in assets/asset_bundle.h
+struct AssetBundleEntry {
+  const char *path;     // URL, e.g. "/assets/style.css"
+  const char *mimeType; // Content-Type it is served with
+  uint32_t offset;      // Text at data + offset, NUL-terminated
+  uint32_t length;      // Text bytes, excluding the NUL
+  uint32_t gzipOffset;  // Gzip copy at data + gzipOffset
+  uint32_t gzipLength;  // 0 = no gzip copy (it wouldn't have been smaller)
+  const char *hash;     // Hex content hash - ETag and fingerprint
+};
+
+// A generated bundle: every asset's bytes packed into one PROGMEM blob,
+// plus an index sorted by path (strcmp order) so lookups can binary-search
+struct AssetBundle {
+  const char *data; // PROGMEM
+  const AssetBundleEntry *index;
+  size_t count;
+};
+
+namespace AssetBundles {
+
+// The entry serving path, or nullptr. O(log n) - relies on the index
+// being sorted, which the generator guarantees.
+const AssetBundleEntry *find(const AssetBundle &bundle, const char *path);
+
+// An entry's bytes in the form WebPlatform::setEmbeddedAssetContent takes
+EmbeddedAsset embeddedAsset(const AssetBundle &bundle,
+                            const AssetBundleEntry &entry);
+
+} // namespace AssetBundles
+
+#endif // ASSET_BUNDLE_H
@@ -0,0 +1,29 @@
+#ifndef ASSET_FINGERPRINT_H
+#define ASSET_FINGERPRINT_H
+
+#include <string>
+
+// Fingerprinted asset URLs: the asset's content hash (<NAME>_HASH from
+// scripts/generate_web_assets.py) spliced into its file name, so the URL
+// changes whenever the content does and can be cached forever. Pure string
+// handling, kept apart from WebPlatform so it can be unit tested natively.
+namespace AssetFingerprint {
+
+// Inserts ".<hash>" before the file name's extension (or appends it when
+// the name has none).
+//   fingerprint("/assets/style.css", "3f9c2a1b7d4e")
+//     -> "/assets/style.3f9c2a1b7d4e.css"
+std::string fingerprint(const std::string &path, const std::string &hash);
+
+// Reverses fingerprint(): true, with the plain path and the hash, if the
+// file name carries a hex hash segment as its last dot-separated part
+// before the extension. Only hashes of hashLength hex digits count, so an
+// ordinary dotted name ("jquery.min.js") isn't mistaken for one.
+//   parse("/assets/style.3f9c2a1b7d4e.css", 12, path, hash)
+//     -> true, "/assets/style.css", "3f9c2a1b7d4e"
+bool parse(const std::string &fingerprinted, size_t hashLength,
+           std::string &path, std::string &hash);
+
+} // namespace AssetFingerprint
+
+#endif // ASSET_FINGERPRINT_H
@@ -0,0 +1,21 @@
+#ifndef EMBEDDED_ASSET_H
+#define EMBEDDED_ASSET_H
+
+#include <cstddef>
+#include <cstdint>
+
+// The constants scripts/generate_web_assets.py emits for one asset
+// (assets/*.h), gathered so they can be passed around together:
+//   EmbeddedAsset{PAGE_HTML, PAGE_HTML_GZ, PAGE_HTML_GZ_LEN, PAGE_HTML_HASH}
+// Bundled assets are turned into one by AssetBundles::embeddedAsset().
+struct EmbeddedAsset {
+  const char *text;     // <NAME> - PROGMEM, NUL-terminated
+  const uint8_t *gzip;  // <NAME>_GZ - PROGMEM
+  size_t gzipLength;    // <NAME>_GZ_LEN
+  const char *hash;     // <NAME>_HASH - hex content hash
+};
+
+// Hex digits in <NAME>_HASH (HASH_LENGTH in generate_web_assets.py)
+const size_t EMBEDDED_ASSET_HASH_LENGTH = 12;
+
+#endif // EMBEDDED_ASSET_H
@@ -0,0 +1,58 @@
+#ifndef HTML_TEMPLATE_H
+#define HTML_TEMPLATE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+// Page templates pre-parsed into segments: literal spans of the source
+// and the markers WebPlatform::prepareHtml fills in. A page is scanned once
+// (WebPlatform caches the segments of PROGMEM pages), and rendering is a
+// walk over the segments that writes each literal span straight from the
+// source. Pure parsing, kept apart from WebPlatform so it can be unit
+// tested natively.
+namespace HtmlTemplate {
+
+enum class Marker : uint8_t {
+  Literal,        // Source text, copied as-is
+  NavMenu,        // {{NAV_MENU}}
+  Username,       // {{username}}
+  CsrfToken,      // {{csrfToken}}
+  DeviceName,     // {{DEVICE_NAME}}
+  RedirectUrl,    // {{redirectUrl}}
+  ModulePrefix,   // {{MODULE_PREFIX}}
+  SecurityNotice, // {{SECURITY_NOTICE}}
+  Asset,          // {{ASSET:<path>}} - argument is the path
+  HeadOpen,       // <head> - the CSRF meta tag goes after it
+  BodyOpen,       // <body ...> - argument is the attributes as written
+};
+
+// offset/length locate the literal text, or the marker's argument (empty
+// for markers without one), in the source
+struct Segment {
+  Marker marker;
+  uint32_t offset;
+  uint32_t length;
+};
+
+using Segments = std::vector<Segment>;
+
+// Receives rendered output, in order, as it is produced
+using Writer = std::function<void(const char *data, size_t length)>;
+
+// Writes one marker's value; argument points into the source
+using MarkerWriter = std::function<void(
+    Marker marker, const char *argument, size_t length, const Writer &write)>;
+
+// Splits source into segments. Markers that aren't listed above, and an
+// unclosed "{{", stay part of the literal text.
+Segments compile(const char *source, size_t length);
+
+// Writes source with every marker segment replaced by writeMarker's output
+void render(const char *source, const Segments &segments,
+            const MarkerWriter &writeMarker, const Writer &write);
+
+} // namespace HtmlTemplate
+
+#endif // HTML_TEMPLATE_H
@@ -0,0 +1,60 @@
+#ifndef HTTP_NEGOTIATION_H
+#define HTTP_NEGOTIATION_H
+
+#include <cstddef>
+#include <string>
+
+// Pure request-header parsing behind how responses are encoded - kept out
+// of WebResponse/WebPlatform so it can be unit tested with plain strings
+// (WebRequest/WebResponse can't be constructed natively; see
+// auth_decision.h for the same split).
+namespace HttpNegotiation {
+
+// Whether an Accept-Encoding value allows a gzip-encoded response: gzip
+// (or "*") has to be listed without q=0, and an explicit gzip entry wins
+// over "*". Coding names are case-insensitive.
+//   acceptsGzip("gzip, deflate, br") -> true
+//   acceptsGzip("gzip;q=0, deflate") -> false
+bool acceptsGzip(const std::string &acceptEncoding);
+
+// Whether an If-None-Match value matches a response's ETag, i.e. the
+// client's copy is current and a 304 will do. Uses the weak comparison
+// RFC 9110 prescribes for If-None-Match (W/ prefixes are ignored); "*"
+// matches anything.
+//   etagMatches("\"a1\", W/\"b2\"", "\"b2\"") -> true
+bool etagMatches(const std::string &ifNoneMatch, const std::string &etag);
+
+// How a Range header applies to a body of a known length
+enum class RangeResult {
+  Full,         // No usable range - send the whole body (200)
+  Partial,      // Send bytes first..last inclusive (206)
+  Unsatisfiable // The range lies past the end of the body (416)
+};
+
+// Resolves a single "bytes=" range - "first-last", "first-" or the suffix
+// "-count" - against totalLength, clamping last to the end of the body.
+// Anything else (other units, several ranges, malformed values) is Full,
+// which RFC 9110 allows a server to answer with the whole body.
+//   parseRange("bytes=100-", 1000, first, last) -> Partial, 100..999
+//   parseRange("bytes=-10", 1000, first, last) -> Partial, 990..999
+//   parseRange("bytes=2000-", 1000, first, last) -> Unsatisfiable
+RangeResult parseRange(const std::string &range, size_t totalLength,
+                       size_t &first, size_t &last);
+
+// Whether a Range request may be answered with a part of the body: always
+// without an If-Range header, otherwise only if it names the response's
+// ETag (strong comparison, as RFC 9110 requires here). If-Range dates
+// never match - responses here carry no Last-Modified.
+bool ifRangeMatches(const std::string &ifRange, const std::string &etag);
+
+// Whether a response body may be run through the template engine: HTML or
+// plain text, and not content-encoded - a gzip body is binary, and
+// substituting into it would corrupt it.
+//   isTemplatable("text/html", "") -> true
+//   isTemplatable("text/html", "gzip") -> false
+bool isTemplatable(const std::string &mimeType,
+                   const std::string &contentEncoding);
+
+} // namespace HttpNegotiation
+
+#endif // HTTP_NEGOTIATION_H
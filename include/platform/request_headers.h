@@ -0,0 +1,18 @@
+#ifndef REQUEST_HEADERS_H
+#define REQUEST_HEADERS_H
+
+#include <cstddef>
+
+// Request headers the platform reads on top of COMMON_HTTP_HEADERS (which
+// web_platform_interface defines). Arduino WebServer drops any header it
+// wasn't told to collect, so ServerManager collects both lists and
+// WebRequest copies both into its header map. Defined in web_request.cpp.
+//
+// - Accept-Encoding: whether embedded assets can go out gzip-compressed
+// - If-None-Match: the ETag of a client's cached asset (304 if current)
+// - Range / If-Range: the part of a PROGMEM or storage body a client wants
+//   (206), e.g. to resume a download
+extern const char *const PLATFORM_HTTP_HEADERS[];
+extern const size_t PLATFORM_HTTP_HEADERS_COUNT;
+
+#endif // REQUEST_HEADERS_H
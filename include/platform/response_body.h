@@ -0,0 +1,82 @@
+#ifndef RESPONSE_BODY_H
+#define RESPONSE_BODY_H
+
+#include <Arduino.h>
+#include <cstddef>
+#include <functional>
+
+class WebResponse;
+
+// Response bodies written to the socket as they are produced, rather than
+// built as one String first - how Router sends templated PROGMEM pages
+// (see Router::sendResponse). WebResponse's layout belongs to
+// web_platform_interface, so a producer is attached to a response through
+// Scope and looked up by WebResponse::sendTo, which sends it chunked.
+namespace ResponseBody {
+
+// Receives body bytes, in order, as they are produced
+using Writer = std::function<void(const char *data, size_t length)>;
+
+// Writes a whole body through write
+using Producer = std::function<void(const Writer &write)>;
+
+// Attaches producer to response until the scope ends. An empty producer
+// attaches nothing.
+class Scope {
+public:
+  Scope(const WebResponse &response, Producer producer);
+  ~Scope();
+
+  Scope(const Scope &) = delete;
+  Scope &operator=(const Scope &) = delete;
+
+private:
+  const WebResponse *response;
+};
+
+// The producer attached to response, or an empty Producer
+Producer find(const WebResponse &response);
+
+// Gathers writes of any size into chunks of a fixed buffer, so a body
+// made of many small pieces goes out in a few full-size sends and needs no
+// more memory than the buffer. Once a send fails, later writes are dropped.
+class ChunkWriter {
+public:
+  // Sends one chunk; false stops the body
+  using SendChunk = std::function<bool(const char *data, size_t length)>;
+
+  ChunkWriter(char *buffer, size_t capacity, SendChunk sendChunk);
+
+  void write(const char *data, size_t length);
+
+  // Sends whatever is buffered
+  // @return false if this or any earlier send failed
+  bool flush();
+
+  bool failed() const { return sendFailed; }
+
+private:
+  char *buffer;
+  size_t capacity;
+  size_t used;
+  SendChunk sendChunk;
+  bool sendFailed;
+};
+
+// Print over a ChunkWriter, for serializers that write to a Print
+// (serializeJson). Runs of bytes arrive through the bulk write and are copied
+// into the buffer in one go, rather than one virtual call per byte.
+class ChunkPrint : public Print {
+public:
+  explicit ChunkPrint(ChunkWriter &writer) : writer(writer) {}
+
+  size_t write(uint8_t c) override;
+  size_t write(const uint8_t *data, size_t length) override;
+
+private:
+  ChunkWriter &writer;
+};
+
+} // namespace ResponseBody
+
+#endif // RESPONSE_BODY_H
@@ -12,6 +12,7 @@
 // from WebPlatform at construction so Router takes explicit dependencies
 // instead of reaching back into WebPlatform's private state.
 
+#include "platform/response_body.h"
 #include "route_entry.h"
 #include <functional>
 #include <interface/auth_types.h>
@@ -40,8 +41,12 @@ public:
       std::function<void(const String &, WebModule::Method,
                          const OpenAPIDocumentation &, const AuthRequirements &)>;
   using ErrorPageResolver = std::function<String(int)>;
-  using HtmlPreparer = std::function<String(String, WebRequest)>;
+  using HtmlPreparer = std::function<String(const String &, WebRequest &)>;
   using RedirectResolver = std::function<String(const String &)>;
+  // Body producer that expands a templated PROGMEM response while it is
+  // sent (see sendResponse)
+  using TemplateBodyFactory =
+      std::function<ResponseBody::Producer(WebRequest &, WebResponse &)>;
 
   struct Callbacks {
     AuthCallback authenticate;
@@ -53,6 +58,7 @@ public:
     ErrorPageResolver getErrorPage;
     HtmlPreparer prepareHtml;
     RedirectResolver getRedirectTarget;
+    TemplateBodyFactory templateBody;
   };
 
   Router() = default;
@@ -119,6 +125,19 @@ private:
   void executeRouteWithAuth(const RouteEntry &route, WebRequest &request,
                             WebResponse &response, const String &serverType);
 
+  // Whether response is a templated PROGMEM page that sendResponse expands
+  // on the way out, rather than processResponseTemplates up front
+  bool streamsTemplate(WebResponse &response) const;
+
+  // response.sendTo(), with a templated PROGMEM page rendered straight into
+  // the chunked body - peak memory is a fixed chunk buffer, not the page
+#ifdef ESP_PLATFORM
+  void sendResponse(WebRequest &request, WebResponse &response,
+                    WebServerClass *server);
+  esp_err_t sendResponse(WebRequest &request, WebResponse &response,
+                         httpd_req_t *req);
+#endif
+
   std::vector<RouteEntry> routeRegistry;
 #ifdef ESP_PLATFORM
   std::vector<String> httpsRoutePaths; // stable c_str() storage for httpd_uri_t.uri
@@ -62,6 +62,10 @@ public:
 private:
   void configureHttpsServer(const Config &config);
 
+  // Tells the HTTP server to keep COMMON_HTTP_HEADERS plus
+  // PLATFORM_HTTP_HEADERS - everything WebRequest reads
+  void collectRequestHeaders();
+
   Router &router;
 
 #ifdef ESP_PLATFORM
@@ -0,0 +1,217 @@
+#ifndef ASYNC_DATABASE_DRIVER_H
+#define ASYNC_DATABASE_DRIVER_H
+
+#include "database_driver_interface.h"
+#include <atomic>
+#include <condition_variable>
+#include <map>
+#include <memory>
+#include <mutex>
+
+#ifdef NATIVE_PLATFORM
+#include <thread>
+#else
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+#endif
+
+/**
+ * AsyncDatabaseDriver - Write-behind decorator for any driver
+ *
+ * store()/remove() only record the write in a pending map and return; a
+ * background worker (a FreeRTOS task on device, a std::thread in native
+ * tests) hands everything pending to the wrapped driver as one
+ * applyBatch(). NVS commits and flash erases then happen off the HTTP
+ * handler's task, and repeated writes to a key between drains cost one
+ * write (last write wins).
+ *
+ * - Reads see pending writes (read-your-writes): retrieve(), exists(),
+ *   listKeys(), forEach(), count() and the key scans merge the pending map
+ *   over the wrapped driver
+ * - The pending map is bounded; a write that would overflow it drains the
+ *   backlog on the caller's task first, so a burst degrades to synchronous
+ *   writes instead of growing without limit
+ * - Names the wrapped driver can't store (acceptsName()) fail store() and
+ *   applyBatch() up front. If a drain's batch is rejected anyway, its
+ *   writes are applied one at a time; the ones still refused stay pending
+ *   and are retried every RETRY_DELAY_MS.
+ * - flush() drains synchronously; shutdown() (also run by the destructor)
+ *   stops the worker after a final drain. StorageManager::flush() flushes
+ *   every driver and WebPlatform calls it before a scheduled restart.
+ * - Writes are acknowledged before they reach flash, so a crash or power
+ *   loss drops whatever is still pending. Use it for data where that is
+ *   acceptable (sessions, counters, caches).
+ *
+ * Not registered by default. Wrap the driver a collection lives on:
+ *   StorageManager::configureDriver(
+ *       "json", std::unique_ptr<IDatabaseDriver>(new AsyncDatabaseDriver(
+ *                   std::unique_ptr<IDatabaseDriver>(
+ *                       new JsonDatabaseDriver()))));
+ */
+class AsyncDatabaseDriver : public IDatabaseDriver {
+public:
+  static const size_t DEFAULT_MAX_PENDING = 32;
+  static const unsigned long DEFAULT_COALESCE_DELAY_MS = 50;
+  // Wait after a drain left refused writes pending
+  static const unsigned long RETRY_DELAY_MS = 1000;
+
+private:
+  struct PendingWrite {
+    bool isRemove;
+    String data;
+    uint32_t sequence; // Changes on every write to the key
+  };
+
+  std::unique_ptr<IDatabaseDriver> innerDriver;
+  size_t maxPending;
+  unsigned long coalesceDelayMs;
+
+  // Guards the pending map and worker state
+  std::mutex queueMutex;
+  std::condition_variable queueChanged;
+  std::map<String, std::map<String, PendingWrite>> pending;
+  size_t pendingCount;
+  uint32_t nextSequence;
+  bool stopping;
+  bool workerRunning;
+  size_t failedDrains;
+  // forEach() scans in progress; writes then never drain inline
+  std::atomic<int> scanDepth;
+
+  // Serializes every call into the wrapped driver (worker vs. readers).
+  // Recursive so a forEach() callback can write back through this driver.
+  std::recursive_mutex driverMutex;
+
+#ifdef NATIVE_PLATFORM
+  std::thread worker;
+#else
+  TaskHandle_t workerHandle;
+  static const uint32_t WORKER_STACK_SIZE = 6144;
+  static const UBaseType_t WORKER_PRIORITY = 1;
+
+  /**
+   * FreeRTOS task entry point
+   * @param self The driver
+   */
+  static void workerTask(void *self);
+#endif
+
+  /**
+   * Worker body: wait for writes, let a burst settle for coalesceDelayMs,
+   * then drain. Returns once shutdown() is requested.
+   */
+  void workerLoop();
+
+  /**
+   * Start the background worker
+   */
+  void startWorker();
+
+  /**
+   * Record a write in the pending map, draining first if it's full
+   * @return false if the worker has stopped, or the map is still full of
+   *         refused writes after draining (write it directly instead)
+   */
+  bool enqueue(const String &collection, const String &key, bool isRemove,
+               const String &data);
+
+  /**
+   * Apply everything pending to the wrapped driver as one batch, or write
+   * by write if the batch is rejected. Entries stay visible to readers
+   * until applied; ones rewritten meanwhile or refused are kept for the
+   * next drain.
+   * @return true if everything was applied (or nothing was pending)
+   */
+  bool drain();
+
+  /**
+   * Look up a pending write
+   * @param found Receives the write if there is one
+   * @return true if the key has a pending write
+   */
+  bool findPending(const String &collection, const String &key,
+                   PendingWrite &found);
+
+  /**
+   * Copy of a collection's pending writes
+   */
+  std::map<String, PendingWrite> pendingFor(const String &collection);
+
+  /**
+   * Merge a sorted scan of the wrapped driver with the collection's
+   * pending writes, keeping key order
+   * @param innerScan Runs the same scan on the wrapped driver
+   * @param inRange Whether a pending key falls in the scan
+   */
+  size_t mergeScan(const String &collection,
+                   const std::function<size_t(RecordCallback)> &innerScan,
+                   const std::function<bool(const String &)> &inRange,
+                   RecordCallback callback);
+
+public:
+  /**
+   * @param driver Driver the writes end up in (owned)
+   * @param maxPending Most keys held pending before writers drain inline
+   * @param coalesceDelayMs How long the worker waits after the first write
+   *        of a burst before draining, so later writes join the batch
+   */
+  explicit AsyncDatabaseDriver(
+      std::unique_ptr<IDatabaseDriver> driver,
+      size_t maxPending = DEFAULT_MAX_PENDING,
+      unsigned long coalesceDelayMs = DEFAULT_COALESCE_DELAY_MS);
+
+  virtual ~AsyncDatabaseDriver();
+
+  // IDatabaseDriver interface implementation
+  bool store(const String &collection, const String &key,
+             const String &data) override;
+  String retrieve(const String &collection, const String &key) override;
+  bool remove(const String &collection, const String &key) override;
+  std::vector<String> listKeys(const String &collection) override;
+  bool exists(const String &collection, const String &key) override;
+  size_t forEach(const String &collection, RecordCallback callback) override;
+  size_t scanPrefix(const String &collection, const String &prefix,
+                    RecordCallback callback) override;
+  size_t scanRange(const String &collection, const String &from,
+                   const String &to, RecordCallback callback) override;
+  size_t count(const String &collection) override;
+  bool applyBatch(const WriteBatch &batch) override;
+  bool setRecordFormat(const String &collection, RecordFormat format) override;
+  size_t compressedSize(const String &collection, const String &key) override;
+  bool streamCompressed(const String &collection, const String &key,
+                        ChunkCallback callback) override;
+  size_t recordLength(const String &collection, const String &key) override;
+  bool readRange(const String &collection, const String &key, size_t offset,
+                 size_t length, ChunkCallback callback) override;
+  bool setCollectionTtl(const String &collection,
+                        unsigned long ttlSeconds) override;
+  void maintain() override;
+  bool flush() override;
+  bool acceptsName(const String &collection, const String &key) override;
+  String getDriverName() const override;
+
+  // Async-specific methods
+
+  /**
+   * Drain, stop the worker and wait for it to exit. Later writes go
+   * straight to the wrapped driver. Safe to call more than once.
+   */
+  void shutdown();
+
+  /**
+   * @return Keys with a write not yet applied to the wrapped driver
+   */
+  size_t getPendingCount();
+
+  /**
+   * @return Drains that left writes the wrapped driver refused pending
+   */
+  size_t getFailedDrainCount();
+
+  /**
+   * @return The wrapped driver
+   */
+  IDatabaseDriver &getInnerDriver();
+};
+
+#endif // ASYNC_DATABASE_DRIVER_H
@@ -4,6 +4,7 @@
 #include "../models/data_models.h"
 #include "storage_manager.h"
 #include <Arduino.h>
+#include <functional>
 #include <vector>
 
 /**
@@ -38,6 +39,8 @@ private:
   // Helper methods
   static void ensureInitialized();
   static void cleanExpiredData();
+  // Drop page tokens left on flash from before they moved to RAM
+  static void purgePersistedPageTokens();
 
 public:
   /**
@@ -108,6 +111,16 @@ public:
    */
   static std::vector<AuthUser> getAllUsers();
 
+  /**
+   * Visit users a page at a time, ordered by username
+   * @param callback Called per user (may move from it); return false to stop
+   * @param limit Maximum users to visit (0 = all)
+   * @param cursor Cursor returned for the previous page ("" = first page)
+   * @return Cursor for the next page, empty when no users remain
+   */
+  static String forEachUser(std::function<bool(AuthUser &)> callback,
+                            size_t limit = 0, const String &cursor = "");
+
   /**
    * Check if initial setup is required (no users exist)
    * @return true if no users exist (setup needed)
@@ -190,6 +203,20 @@ public:
    */
   static std::vector<AuthApiToken> getUserApiTokens(const String &userId);
 
+  /**
+   * Visit a user's API tokens a page at a time, oldest first
+   * @param userId User ID
+   * @param callback Called per token (may move from it); return false to
+   *        stop
+   * @param limit Maximum tokens to visit (0 = all)
+   * @param cursor Cursor returned for the previous page ("" = first page)
+   * @return Cursor for the next page, empty when no tokens remain
+   */
+  static String
+  forEachUserApiToken(const String &userId,
+                      std::function<bool(AuthApiToken &)> callback,
+                      size_t limit = 0, const String &cursor = "");
+
   /**
    * Clean expired API tokens
    * @return Number of tokens cleaned
@@ -0,0 +1,191 @@
+#ifndef CACHING_DATABASE_DRIVER_H
+#define CACHING_DATABASE_DRIVER_H
+
+#include "database_driver_interface.h"
+#include <list>
+#include <map>
+#include <memory>
+#include <set>
+
+/**
+ * CachingDatabaseDriver - LRU read cache in front of any driver
+ *
+ * retrieve() results are kept in a bounded LRU so repeated reads skip the
+ * wrapped driver (and flash). Record bytes live in buffers from a pluggable
+ * allocator - PSRAM when the board has it, the normal heap otherwise - so
+ * boards with PSRAM can spend megabytes on it without touching internal
+ * RAM. Only the key index stays on the internal heap.
+ *
+ * - Write-through: store()/remove()/applyBatch() go straight to the wrapped
+ *   driver and drop the cached copy, so the cache never holds a value the
+ *   driver doesn't
+ * - Scans (forEach, listKeys, key scans, queries) go to the wrapped driver
+ *   and don't fill the cache, so one pass can't flush out hot records
+ * - Collections with a TTL (setCollectionTtl) bypass the cache - the
+ *   wrapped driver decides when a record expires
+ * - Records over maxRecordBytes are never cached
+ *
+ * StorageManager registers "cached:littlefs" (a LittleFS store in
+ * /openapi_cached_storage behind a default-sized cache). It doesn't share
+ * records with "littlefs" - everything it reads was written through it, so
+ * the cache can't go stale. Route a collection to it:
+ *   StorageManager::routeCollection("openapi", "cached:littlefs");
+ */
+class CachingDatabaseDriver : public IDatabaseDriver {
+public:
+  /**
+   * Where cached record bytes are allocated
+   */
+  struct Allocator {
+    void *(*allocate)(size_t size);
+    void (*release)(void *ptr);
+    bool external; // true if the memory is PSRAM
+  };
+
+  /**
+   * @return malloc()/free()
+   */
+  static Allocator heapAllocator();
+
+  /**
+   * @return PSRAM (heap_caps_malloc(MALLOC_CAP_SPIRAM)) if the board has
+   *         it, else heapAllocator(). Always the heap in native builds.
+   */
+  static Allocator defaultAllocator();
+
+  // Budgets used when the constructor is given maxBytes = 0
+  static const size_t DEFAULT_PSRAM_MAX_BYTES = 512 * 1024;
+  static const size_t DEFAULT_HEAP_MAX_BYTES = 16 * 1024;
+
+private:
+  // LRU entries point at the map keys rather than copying them - std::map
+  // nodes don't move, so the pointers stay valid until the entry is erased
+  struct EntryRef {
+    const String *collection;
+    const String *key;
+  };
+
+  struct Entry {
+    char *data; // NUL-terminated, from allocator
+    size_t length;
+    std::list<EntryRef>::iterator lruPosition;
+  };
+
+  std::unique_ptr<IDatabaseDriver> innerDriver;
+  Allocator allocator;
+  size_t maxBytes;
+  size_t maxRecordBytes;
+
+  std::map<String, std::map<String, Entry>> entries;
+  std::list<EntryRef> lru; // Least recently used first
+  std::set<String> uncachedCollections;
+  size_t usedBytes;
+  size_t hitCount;
+  size_t missCount;
+
+  /**
+   * @return Cached entry, moved to the most recently used end, or nullptr
+   */
+  Entry *find(const String &collection, const String &key);
+
+  /**
+   * Cache a value read from the wrapped driver, evicting as needed
+   */
+  void insert(const String &collection, const String &key,
+              const String &data);
+
+  /**
+   * Drop a cached entry if there is one
+   */
+  void invalidate(const String &collection, const String &key);
+
+  /**
+   * Drop the least recently used entry
+   */
+  void evictOldest();
+
+  /**
+   * Bytes an entry counts against maxBytes
+   */
+  static size_t entrySize(const String &key, size_t length);
+
+public:
+  /**
+   * @param driver Driver to cache reads from (owned)
+   * @param maxBytes Most key + data bytes cached (0 = DEFAULT_PSRAM_MAX_BYTES
+   *        on PSRAM, DEFAULT_HEAP_MAX_BYTES on the heap)
+   * @param allocator Where record bytes are allocated
+   * @param maxRecordBytes Largest record cached (0 = maxBytes / 8)
+   */
+  explicit CachingDatabaseDriver(std::unique_ptr<IDatabaseDriver> driver,
+                                 size_t maxBytes = 0,
+                                 Allocator allocator = defaultAllocator(),
+                                 size_t maxRecordBytes = 0);
+
+  virtual ~CachingDatabaseDriver();
+
+  // IDatabaseDriver interface implementation
+  bool store(const String &collection, const String &key,
+             const String &data) override;
+  String retrieve(const String &collection, const String &key) override;
+  bool remove(const String &collection, const String &key) override;
+  std::vector<String> listKeys(const String &collection) override;
+  bool exists(const String &collection, const String &key) override;
+  size_t forEach(const String &collection, RecordCallback callback) override;
+  size_t scanPrefix(const String &collection, const String &prefix,
+                    RecordCallback callback) override;
+  size_t scanRange(const String &collection, const String &from,
+                   const String &to, RecordCallback callback) override;
+  size_t count(const String &collection) override;
+  bool applyBatch(const WriteBatch &batch) override;
+  bool hasIndex(const String &collection, const String &field) override;
+  bool lookupIndex(const String &collection, const String &field,
+                   const String &value, std::vector<String> &keys) override;
+  bool setRecordFormat(const String &collection, RecordFormat format) override;
+  size_t compressedSize(const String &collection, const String &key) override;
+  bool streamCompressed(const String &collection, const String &key,
+                        ChunkCallback callback) override;
+  size_t recordLength(const String &collection, const String &key) override;
+  bool readRange(const String &collection, const String &key, size_t offset,
+                 size_t length, ChunkCallback callback) override;
+  bool setCollectionTtl(const String &collection,
+                        unsigned long ttlSeconds) override;
+  void maintain() override;
+  bool flush() override;
+  bool acceptsName(const String &collection, const String &key) override;
+  String getDriverName() const override;
+
+  // Cache-specific methods
+
+  /**
+   * Drop every cached record
+   */
+  void clear();
+
+  /**
+   * @return Key + data bytes cached
+   */
+  size_t getUsedBytes() const;
+
+  /**
+   * @return Most key + data bytes cached
+   */
+  size_t getMaxBytes() const;
+
+  /**
+   * @return retrieve() calls served from the cache since construction
+   */
+  size_t getHitCount() const;
+
+  /**
+   * @return retrieve() calls that went to the wrapped driver
+   */
+  size_t getMissCount() const;
+
+  /**
+   * @return The wrapped driver
+   */
+  IDatabaseDriver &getInnerDriver();
+};
+
+#endif // CACHING_DATABASE_DRIVER_H
@@ -0,0 +1,65 @@
+#ifndef COLLECTION_CODEC_H
+#define COLLECTION_CODEC_H
+
+#include <Arduino.h>
+#include <map>
+#include <string>
+
+/**
+ * CollectionCodec - Encode a collection's records as one blob
+ *
+ * Used by JsonDatabaseDriver to turn its in-RAM key -> record map into the
+ * value written to NVS, and back.
+ *
+ * JSON (legacy, text):
+ *   [{"key":"u1","data":"{\"username\":\"alice\"}"}, ...]
+ *   Each record is an escaped string inside the array - encoded twice.
+ *
+ * MessagePack (binary):
+ *   0x01 {"u1": {"username": "alice"}, "u2": "not-json", ...}
+ *   A version byte, then one map. Records that are JSON objects/arrays are
+ *   stored as documents; anything else is stored as a string. The value's
+ *   type tags which one it is, so a record always reads back as the text
+ *   it was written as (modulo JSON whitespace).
+ */
+class CollectionCodec {
+public:
+  using Records = std::map<String, String>;
+
+  /**
+   * Leading byte of a MessagePack collection blob
+   */
+  static const uint8_t MSGPACK_VERSION = 0x01;
+
+  /**
+   * @param records Records to encode
+   * @param out Receives the JSON array text (appended)
+   * @return false if encoding failed (out of memory)
+   */
+  static bool encodeJson(const Records &records, std::string &out);
+
+  /**
+   * @param text JSON array text
+   * @param records Receives the records
+   * @return false if the text isn't a collection array
+   */
+  static bool decodeJson(const char *text, Records &records);
+
+  /**
+   * @param records Records to encode
+   * @param out Receives the version byte and MessagePack map (appended)
+   * @return false if encoding failed (out of memory)
+   */
+  static bool encodeMsgPack(const Records &records, std::string &out);
+
+  /**
+   * @param data Blob starting with the version byte
+   * @param length Blob length
+   * @param records Receives the records
+   * @return false if the blob is malformed or from an unknown version
+   */
+  static bool decodeMsgPack(const uint8_t *data, size_t length,
+                            Records &records);
+};
+
+#endif // COLLECTION_CODEC_H
@@ -1,18 +1,48 @@
 #ifndef DATABASE_DRIVER_INTERFACE_H
 #define DATABASE_DRIVER_INTERFACE_H
 
+#include "write_batch.h"
 #include <Arduino.h>
+#include <algorithm>
+#include <functional>
 #include <vector>
 
+/**
+ * On-flash encoding of a collection's records
+ * - Json: text, readable with any tool (the default)
+ * - MessagePack: binary, records stored as documents rather than escaped
+ *   strings - smaller, and no double encoding
+ * - Gzip: each large record gzip-compressed; can be sent to HTTP clients
+ *   as-is with Content-Encoding: gzip (see streamCompressed())
+ */
+enum class RecordFormat { Json, MessagePack, Gzip };
+
 /**
  * IDatabaseDriver - Interface for all storage drivers
  * 
  * Provides abstract interface for different storage backends:
  * - JsonDatabaseDriver (Preferences/EEPROM)
  * - LittleFSDriver (flash files)
+ * - LogDatabaseDriver (append-only segment files)
  */
 class IDatabaseDriver {
 public:
+    /**
+     * Callback for forEach()
+     * @param key Record key
+     * @param data Record data
+     * @return true to continue, false to stop iterating
+     */
+    using RecordCallback = std::function<bool(const String& key, const String& data)>;
+
+    /**
+     * Callback for streamCompressed() and readRange()
+     * @param data Next chunk of stored bytes
+     * @param length Chunk length
+     * @return true to continue, false to stop streaming
+     */
+    using ChunkCallback = std::function<bool(const uint8_t* data, size_t length)>;
+
     /**
      * Store data in a collection with a specific key
      * @param collection Logical grouping (like table name)
@@ -53,6 +83,234 @@ public:
      */
     virtual bool exists(const String& collection, const String& key) = 0;
     
+    /**
+     * Visit every record in a collection without materializing the key list.
+     * The callback must not store to or remove from the collection being
+     * iterated - collect keys and act on them after forEach returns.
+     *
+     * The default walks listKeys() + retrieve(); drivers override it with a
+     * single native pass over their storage.
+     * @param collection Logical grouping
+     * @param callback Called once per record; return false to stop early
+     * @return number of records passed to the callback
+     */
+    virtual size_t forEach(const String& collection, RecordCallback callback) {
+        size_t visited = 0;
+        for (const String& key : listKeys(collection)) {
+            String data = retrieve(collection, key);
+            if (data.length() == 0) continue;
+            visited++;
+            if (!callback(key, data)) break;
+        }
+        return visited;
+    }
+
+    /**
+     * Visit the records whose key starts with a prefix, in ascending key
+     * order. Same callback rules as forEach().
+     *
+     * The default filters listKeys(); drivers override it to seek into their
+     * sorted key index so only matching keys are read.
+     * @param collection Logical grouping
+     * @param prefix Key prefix ("" visits every record)
+     * @param callback Called once per record; return false to stop early
+     * @return number of records passed to the callback
+     */
+    virtual size_t scanPrefix(const String& collection, const String& prefix,
+                              RecordCallback callback) {
+        std::vector<String> keys;
+        for (const String& key : listKeys(collection)) {
+            if (key.startsWith(prefix)) keys.push_back(key);
+        }
+        return visitSorted(collection, keys, callback);
+    }
+
+    /**
+     * Visit the records with from <= key < to, in ascending key order
+     * (plain byte-wise comparison, so zero-pad numbers and timestamps in
+     * keys). Same callback rules as forEach().
+     * @param collection Logical grouping
+     * @param from First key of the range (inclusive; "" = from the start)
+     * @param to End of the range (exclusive; "" = to the end)
+     * @param callback Called once per record; return false to stop early
+     * @return number of records passed to the callback
+     */
+    virtual size_t scanRange(const String& collection, const String& from,
+                             const String& to, RecordCallback callback) {
+        std::vector<String> keys;
+        for (const String& key : listKeys(collection)) {
+            if (key >= from && (to.length() == 0 || key < to)) keys.push_back(key);
+        }
+        return visitSorted(collection, keys, callback);
+    }
+
+    /**
+     * Count records in a collection
+     * @param collection Logical grouping
+     * @return number of records
+     */
+    virtual size_t count(const String& collection) {
+        return listKeys(collection).size();
+    }
+
+    /**
+     * Apply a batch of puts/removes
+     *
+     * The default applies each operation in order through store()/remove().
+     * Drivers override it to write each collection once, and to apply the
+     * batch all-or-nothing where their storage allows.
+     * @param batch Operations to apply
+     * @return true if every operation was applied
+     */
+    virtual bool applyBatch(const WriteBatch& batch) {
+        bool ok = true;
+        for (const WriteBatch::Operation& op : batch.operations()) {
+            if (op.isRemove) {
+                remove(op.collection, op.key); // Missing keys aren't an error
+            } else if (!store(op.collection, op.key, op.data)) {
+                ok = false;
+            }
+        }
+        return ok;
+    }
+
+    /**
+     * Check whether an equality index exists on a field
+     * @param collection Logical grouping
+     * @param field Top-level JSON field name
+     * @return true if lookupIndex() can answer for this field
+     */
+    virtual bool hasIndex(const String& collection, const String& field) {
+        return false;
+    }
+
+    /**
+     * Find the keys of records whose field equals a value, using an index.
+     * Results are candidates: callers re-check the record itself.
+     * @param collection Logical grouping
+     * @param field Top-level JSON field name
+     * @param value Field value as text (numbers/booleans as serialized)
+     * @param keys Receives candidate keys
+     * @return false if the field isn't indexed (keys untouched)
+     */
+    virtual bool lookupIndex(const String& collection, const String& field,
+                             const String& value, std::vector<String>& keys) {
+        return false;
+    }
+
+    /**
+     * Choose how a collection is encoded on flash. Existing data in the
+     * other format stays readable and is converted on the collection's next
+     * write. Record strings passed to/returned from the driver are JSON
+     * either way.
+     * @param collection Logical grouping
+     * @param format Encoding for future writes
+     * @return false if the driver has a single fixed format
+     */
+    virtual bool setRecordFormat(const String& collection, RecordFormat format) {
+        return false;
+    }
+
+    /**
+     * Size of a record as stored, if it is stored gzip-compressed
+     * @param collection Logical grouping
+     * @param key Unique identifier
+     * @return gzip stream length, or 0 if the record is missing or stored
+     *         uncompressed
+     */
+    virtual size_t compressedSize(const String& collection, const String& key) {
+        return 0;
+    }
+
+    /**
+     * Stream a gzip-compressed record's stored bytes without inflating them,
+     * e.g. straight into an HTTP response sent with Content-Encoding: gzip.
+     * retrieve() still returns the decompressed record.
+     * @param collection Logical grouping
+     * @param key Unique identifier
+     * @param callback Called with each chunk; return false to stop early
+     * @return false if the record isn't stored compressed, can't be read, or
+     *         the callback stopped early
+     */
+    virtual bool streamCompressed(const String& collection, const String& key,
+                                  ChunkCallback callback) {
+        return false;
+    }
+
+    /**
+     * Length of a record as retrieve() returns it
+     *
+     * The default retrieves the record; drivers override it to answer from
+     * their storage without reading the data.
+     * @param collection Logical grouping
+     * @param key Unique identifier
+     * @return length in bytes, or 0 if the record is missing
+     */
+    virtual size_t recordLength(const String& collection, const String& key) {
+        return retrieve(collection, key).length();
+    }
+
+    /**
+     * Stream part of a record (bytes of what retrieve() returns), e.g. for
+     * an HTTP Range request
+     *
+     * The default retrieves the whole record; drivers override it to seek
+     * to offset and read only the requested bytes.
+     * @param collection Logical grouping
+     * @param key Unique identifier
+     * @param offset First byte to read
+     * @param length Bytes to read; clamped to the end of the record
+     * @param callback Called with each chunk; return false to stop early
+     * @return false if the record is missing, offset is past its end, or
+     *         the callback stopped early
+     */
+    virtual bool readRange(const String& collection, const String& key,
+                           size_t offset, size_t length,
+                           ChunkCallback callback) {
+        String data = retrieve(collection, key);
+        if (!callback || offset >= data.length()) return false;
+        size_t count = std::min(length, (size_t)data.length() - offset);
+        return callback(
+            reinterpret_cast<const uint8_t*>(data.c_str()) + offset, count);
+    }
+
+    /**
+     * Make a collection's records expire a fixed time after they are stored.
+     * Expired records read as missing.
+     * @param collection Logical grouping
+     * @param ttlSeconds Lifetime of records stored from now on; 0 = no expiry
+     * @return false if the driver doesn't support expiry
+     */
+    virtual bool setCollectionTtl(const String& collection, unsigned long ttlSeconds) {
+        return false;
+    }
+
+    /**
+     * Do a bounded slice of deferred housekeeping (e.g. log compaction).
+     * Called periodically from the main loop via StorageManager::maintain(),
+     * so it must return quickly. The default does nothing.
+     */
+    virtual void maintain() {}
+
+    /**
+     * Write out anything the driver has buffered (e.g. a write-behind queue)
+     * and wait until it is stored. Called before a restart via
+     * StorageManager::flush(). The default has nothing to flush.
+     * @return false if buffered writes could not be stored
+     */
+    virtual bool flush() { return true; }
+
+    /**
+     * Check a collection and key against the driver's naming rules (e.g.
+     * filesystem-safe names), without touching storage. Decorators that
+     * acknowledge writes before passing them on use it to reject a write
+     * the driver would refuse while the caller can still be told.
+     * @return true if store() would accept the names
+     */
+    virtual bool acceptsName(const String& collection, const String& key) {
+        return collection.length() > 0 && key.length() > 0;
+    }
+
     /**
      * Get driver name for debugging/logging
      * @return driver name (e.g. "json", "littlefs", "aws-rds")
@@ -63,6 +321,24 @@ public:
      * Virtual destructor for proper cleanup
      */
     virtual ~IDatabaseDriver() = default;
+
+protected:
+    /**
+     * Sort keys and pass each record to the callback (default scans)
+     */
+    size_t visitSorted(const String& collection, std::vector<String>& keys,
+                       RecordCallback callback) {
+        size_t visited = 0;
+        if (!callback) return visited;
+        std::sort(keys.begin(), keys.end());
+        for (const String& key : keys) {
+            String data = retrieve(collection, key);
+            if (data.length() == 0) continue;
+            visited++;
+            if (!callback(key, data)) break;
+        }
+        return visited;
+    }
 };
 
 #endif // DATABASE_DRIVER_INTERFACE_H
\ No newline at end of file
@@ -0,0 +1,172 @@
+#ifndef INDEXED_DATABASE_DRIVER_H
+#define INDEXED_DATABASE_DRIVER_H
+
+#include "database_driver_interface.h"
+#include <map>
+#include <memory>
+#include <vector>
+
+/**
+ * IndexedDatabaseDriver - Secondary-index decorator for any driver
+ *
+ * Wraps another IDatabaseDriver and maintains equality indexes on declared
+ * (collection, field) pairs as records are stored and removed through it.
+ * QueryBuilder asks the driver for index lookups via lookupIndex(), so a
+ * where("userId", id) on an indexed field reads only the matching records
+ * instead of scanning the collection.
+ *
+ * Indexes are declared through StorageManager::declareIndex(), which wraps
+ * the target driver on demand - application code doesn't construct this
+ * directly.
+ *
+ * Storage structure (in the wrapped driver):
+ * _indexes/
+ *   users.username   {"n":2,"v":{"alice":["id1"],"bob":["id2"]}}
+ *   sessions.userId  {"n":3,"v":{"id1":["sess_a","sess_b"],...}}
+ *
+ * "n" is the record count the index was built against. A write that
+ * changes an index persists it first, in one batch with the write's other
+ * index records: the written keys are listed under "p" (pending) and held
+ * under both their old and new values, so the record is right whether or
+ * not the data write that follows lands. That costs one index write per
+ * mutation. When first loaded, pending keys are settled against the stored
+ * records; an index whose count doesn't match the collection (an insert or
+ * remove cut off by a reboot, or records written before the index was
+ * declared) is rebuilt from a scan. Index hits are always re-checked
+ * against the full WHERE clause, so an extra entry can't produce a wrong
+ * result.
+ *
+ *   sessions.userId  {"n":3,"v":{"id1":["s1"],"id2":["s1"]},"p":["s1"]}
+ */
+class IndexedDatabaseDriver : public IDatabaseDriver {
+private:
+  struct FieldIndex {
+    String field;
+    bool loaded = false;
+    size_t recordCount = 0; // records in the collection, persisted as "n"
+    std::map<String, std::vector<String>> entries; // value -> keys
+  };
+
+  std::unique_ptr<IDatabaseDriver> innerDriver;
+  std::map<String, std::vector<FieldIndex>> indexes; // collection -> fields
+
+  /**
+   * Find the index for a collection/field
+   * @return Index or nullptr if not declared
+   */
+  FieldIndex *findIndex(const String &collection, const String &field);
+
+  /**
+   * Load an index from its record, rebuilding it if missing or stale
+   */
+  void ensureLoaded(const String &collection, FieldIndex &index);
+
+  /**
+   * Rebuild an index by scanning the collection, then persist it
+   */
+  void rebuild(const String &collection, FieldIndex &index);
+
+  /**
+   * Encode an index as its persisted record
+   * @param pending Keys whose data write is yet to happen ("p")
+   */
+  static String
+  serialize(const FieldIndex &index,
+            const std::vector<String> &pending = std::vector<String>());
+
+  /**
+   * Write an index record to the wrapped driver
+   */
+  void persist(const String &collection, const FieldIndex &index);
+
+  /**
+   * Re-index keys whose data write may not have happened, from the
+   * records as stored
+   */
+  void settlePending(const String &collection, FieldIndex &index,
+                     const std::vector<String> &keys);
+
+  /**
+   * Extract the indexed value of each declared field from a record
+   * @param collection Collection the record belongs to
+   * @param data JSON record (may be empty)
+   * @param values One entry per declared field; empty if absent
+   */
+  void extractValues(const String &collection, const String &data,
+                     std::vector<String> &values);
+
+  static void addKey(FieldIndex &index, const String &value, const String &key);
+  static void removeKey(FieldIndex &index, const String &value,
+                        const String &key);
+
+public:
+  /**
+   * Collection holding persisted index records
+   */
+  static const char *const INDEX_COLLECTION;
+
+  /**
+   * Constructor
+   * @param inner Driver to wrap (ownership is taken)
+   */
+  explicit IndexedDatabaseDriver(std::unique_ptr<IDatabaseDriver> inner);
+
+  /**
+   * Maintain an equality index on a field. Idempotent.
+   * @param collection Collection name
+   * @param field Top-level JSON field name
+   */
+  void addIndex(const String &collection, const String &field);
+
+  /**
+   * Get the fields indexed on a collection
+   * @param collection Collection name
+   * @return Field names
+   */
+  std::vector<String> getIndexedFields(const String &collection) const;
+
+  /**
+   * Rebuild every index of a collection from a full scan
+   * @param collection Collection name
+   */
+  void rebuildIndexes(const String &collection);
+
+  /**
+   * Access the wrapped driver (e.g. for driver-specific methods)
+   * @return Wrapped driver
+   */
+  IDatabaseDriver &inner();
+
+  // IDatabaseDriver interface implementation
+  bool store(const String &collection, const String &key,
+             const String &data) override;
+  String retrieve(const String &collection, const String &key) override;
+  bool remove(const String &collection, const String &key) override;
+  std::vector<String> listKeys(const String &collection) override;
+  bool exists(const String &collection, const String &key) override;
+  size_t forEach(const String &collection, RecordCallback callback) override;
+  size_t scanPrefix(const String &collection, const String &prefix,
+                    RecordCallback callback) override;
+  size_t scanRange(const String &collection, const String &from,
+                   const String &to, RecordCallback callback) override;
+  size_t count(const String &collection) override;
+  bool applyBatch(const WriteBatch &batch) override;
+  bool setRecordFormat(const String &collection, RecordFormat format) override;
+  size_t compressedSize(const String &collection, const String &key) override;
+  bool streamCompressed(const String &collection, const String &key,
+                        ChunkCallback callback) override;
+  size_t recordLength(const String &collection, const String &key) override;
+  bool readRange(const String &collection, const String &key, size_t offset,
+                 size_t length, ChunkCallback callback) override;
+  bool setCollectionTtl(const String &collection,
+                        unsigned long ttlSeconds) override;
+  void maintain() override;
+  bool flush() override;
+  bool acceptsName(const String &collection, const String &key) override;
+  bool hasIndex(const String &collection, const String &field) override;
+  bool lookupIndex(const String &collection, const String &field,
+                   const String &value, std::vector<String> &keys) override;
+  String getDriverName() const override;
+};
+
+#endif // INDEXED_DATABASE_DRIVER_H
@@ -1,6 +1,7 @@
 #ifndef JSON_DATABASE_DRIVER_H
 #define JSON_DATABASE_DRIVER_H
 
+#include "collection_codec.h"
 #include "database_driver_interface.h"
 #include <map>
 
@@ -19,6 +20,19 @@
  *   {"key": "admin", "data": {"username": "admin", "hash": "...", ...}},
  *   {"key": "user1", "data": {"username": "user1", "hash": "...", ...}}
  * ]
+ *
+ * Collections set to RecordFormat::MessagePack (setRecordFormat) are kept
+ * as a binary NVS blob under "~<collection>" instead - see CollectionCodec.
+ * A collection still in the other format is read from its old key and
+ * converted on its next write, so switching formats needs no migration
+ * step. NVS keys are limited to 15 characters, so MessagePack needs a
+ * collection name of 14 or fewer.
+ *
+ * Every store/remove rewrites the whole collection blob, so multi-record
+ * updates should go through a WriteBatch: applyBatch() writes each touched
+ * collection once. Each collection's write is a single NVS put and lands
+ * whole or not at all; a batch spanning collections is atomic per
+ * collection, not across them.
  */
 class JsonDatabaseDriver : public IDatabaseDriver {
 private:
@@ -27,10 +41,20 @@ private:
 
   // In-memory cache for performance
   std::map<String, std::map<String, String>> cache;
+
+  // Per-collection on-flash encoding (absent = Json)
+  std::map<String, RecordFormat> formats;
+
+  // Non-zero while forEach() holds an iterator into cache - eviction is
+  // deferred so a callback reading another collection can't invalidate it
+  int iterationDepth;
   
   // Cache management
   static const size_t MAX_CACHED_COLLECTIONS = 5;
 
+  // ESP32 NVS key length limit
+  static const size_t MAX_NVS_KEY_LENGTH = 15;
+
   // Internal methods
   void loadCollection(const String &collection);
   void saveCollection(const String &collection);
@@ -38,6 +62,14 @@ private:
   void evictOldCollections();
   size_t calculateJsonSize(const std::map<String, String>& collectionData);
 
+  // NVS key of a collection's MessagePack blob
+  static String getBlobKey(const String &collection);
+
+  // Visit records from the first key >= from while inRange(key) holds
+  size_t scanFrom(const String &collection, const String &from,
+                  const std::function<bool(const String &)> &inRange,
+                  RecordCallback callback);
+
 public:
   JsonDatabaseDriver();
   virtual ~JsonDatabaseDriver();
@@ -49,8 +81,22 @@ public:
   bool remove(const String &collection, const String &key) override;
   std::vector<String> listKeys(const String &collection) override;
   bool exists(const String &collection, const String &key) override;
+  size_t forEach(const String &collection, RecordCallback callback) override;
+  size_t scanPrefix(const String &collection, const String &prefix,
+                    RecordCallback callback) override;
+  size_t scanRange(const String &collection, const String &from,
+                   const String &to, RecordCallback callback) override;
+  size_t count(const String &collection) override;
+  bool applyBatch(const WriteBatch &batch) override;
+  bool setRecordFormat(const String &collection, RecordFormat format) override;
   String getDriverName() const override;
 
+  /**
+   * @param collection Collection name
+   * @return Format the collection is written in
+   */
+  RecordFormat getRecordFormat(const String &collection) const;
+
   // Additional methods for JsonDatabaseDriver
   void clearCache();
   void clearCollection(const String &collection);
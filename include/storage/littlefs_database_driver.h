@@ -4,6 +4,7 @@
 #include "database_driver_interface.h"
 #include <LittleFS.h>
 #include <map>
+#include <set>
 
 /**
  * LittleFSDatabaseDriver - File-based storage using ESP32 LittleFS
@@ -16,18 +17,65 @@
  *   /collection2/
  *     key1.json
  *
+ * With sharding enabled (setShardingEnabled) records are spread over
+ * SHARD_COUNT subdirectories by key hash. LittleFS lookups walk a directory
+ * linearly, so a few hundred records cost a short walk of the shard list
+ * plus one small shard instead of a walk of every record:
+ * /storage/
+ *   /collection1/
+ *     /0a/key1.json
+ *     /03/key2.json
+ *
  * Features:
  * - Each key stored as separate file for efficient access
  * - Collections organized in directories
  * - Automatic directory creation
  * - File-level caching for frequently accessed data
- * - Memory-efficient streaming for large files
+ * - Memory-efficient streaming for large files, and seeking reads of part
+ *   of a record (readRange) for HTTP Range requests. Partial reads skip
+ *   the CRC32 check, which needs the whole record; gzip records are
+ *   inflated in full.
+ * - Crash-safe writes: each store() writes key.json.tmp and renames it over
+ *   key.json, so a power loss mid-write leaves the previous value intact.
+ *   Orphaned .tmp files are resolved on first use after boot: dropped when
+ *   key.json exists, promoted to it when it doesn't and they read back
+ *   whole.
+ * - Crash-atomic batches: applyBatch() stages each value as
+ *   key.json.staged, then commits by renaming a manifest of the batch
+ *   (/.batch) into place before swapping the values in. Recovery finishes
+ *   a committed batch from the manifest and drops the staged files of one
+ *   that never committed, so a reboot leaves all of it or none.
+ * - Optional CRC32 trailer (setChecksumEnabled) verified on retrieve
+ * - Optional per-collection gzip (setRecordFormat(collection,
+ *   RecordFormat::Gzip)): large records are stored as standard gzip
+ *   files, inflated on retrieve and streamable as-is to HTTP clients
+ *   (streamCompressed). gzip's own CRC32 replaces the checksum trailer.
+ * - Key directory: each collection's keys are read into RAM on first use
+ *   and kept current on store/remove, so exists(), listKeys(), count() and
+ *   misses in retrieve() make no filesystem calls after warmup. Loading a
+ *   collection also moves records written under the other layout into
+ *   place. The directory is sorted, so scanPrefix()/scanRange() open only
+ *   the records in range.
  */
 class LittleFSDatabaseDriver : public IDatabaseDriver {
 private:
   String driverName;
   bool initialized;
   String basePath;
+  bool checksumEnabled;
+  bool shardingEnabled;
+  std::map<String, RecordFormat> formats;
+
+  // Collection -> keys on flash, loaded on first use (see loadKeyDirectory)
+  std::map<String, std::set<String>> keyDirectory;
+
+  // Shard subdirectories per collection, named by two hex digits so the
+  // count can grow to 256 (records are moved on load if it changes)
+  static const uint32_t SHARD_COUNT = 16;
+
+  // Records shorter than this stay plain even in a Gzip collection - the
+  // 18 bytes of gzip framing eat most of the savings
+  static const size_t MIN_COMPRESSED_SIZE = 512;
 
   // Simple cache for frequently accessed small files
   static const size_t MAX_CACHE_SIZE = 10;
@@ -48,6 +96,37 @@ private:
    */
   String getFilePath(const String &collection, const String &key);
 
+  /**
+   * Get the shard subdirectory name for a key (two hex digits of its hash)
+   * @param key Key name
+   * @return Shard name
+   */
+  static String getShardName(const String &key);
+
+  /**
+   * Get the directory a record's file lives in
+   * @param collection Collection name
+   * @param key Key name
+   * @return Collection path, plus the shard if sharding is enabled
+   */
+  String getRecordDirectory(const String &collection, const String &key);
+
+  /**
+   * Get the temporary path a record is written to before being renamed
+   * into place
+   * @param filePath Final file path
+   * @return Temporary file path
+   */
+  String getTempFilePath(const String &filePath);
+
+  /**
+   * Get the path a batch stages a record's new value at until the batch
+   * commits (see applyBatch)
+   * @param filePath Final file path
+   * @return Staged file path
+   */
+  String getStagedFilePath(const String &filePath);
+
   /**
    * Get collection directory path
    * @param collection Collection name
@@ -62,6 +141,114 @@ private:
    */
   bool ensureCollectionDirectory(const String &collection);
 
+  /**
+   * Ensure the directory a record is written to exists (collection and,
+   * when sharding, its shard)
+   * @param collection Collection name
+   * @param key Key name
+   * @return true if the directory exists or was created
+   */
+  bool ensureRecordDirectory(const String &collection, const String &key);
+
+  /**
+   * Get a collection's key directory, scanning the collection on first use.
+   * Records found outside the current layout's path are renamed into it.
+   * @param collection Collection name (must be valid)
+   * @return Keys of every record file in the collection
+   */
+  std::set<String> &loadKeyDirectory(const String &collection);
+
+  /**
+   * Add or drop a key in a collection's directory, if it's loaded
+   * @param collection Collection name
+   * @param key Key name
+   * @param present true if the record now exists
+   */
+  void updateKeyDirectory(const String &collection, const String &key,
+                          bool present);
+
+  /**
+   * Check a record exists without touching the filesystem after warmup
+   * @param collection Collection name (must be valid)
+   * @param key Key name
+   * @return true if the key is in the collection's directory
+   */
+  bool hasKey(const String &collection, const String &key);
+
+  /**
+   * Walk the key directory from the first key >= from while inRange(key)
+   * holds, reading only those records
+   */
+  size_t scanFrom(const String &collection, const String &from,
+                  const std::function<bool(const String &)> &inRange,
+                  RecordCallback callback);
+
+  /**
+   * Check whether a directory entry name is a shard subdirectory
+   * @param name Entry name
+   * @return true for two lowercase hex digits
+   */
+  static bool isShardName(const String &name);
+
+  /**
+   * Get the bare name of a directory entry (older cores return full paths)
+   * @param file Directory entry
+   * @return Name without any leading path
+   */
+  static String entryName(File &file);
+
+  /**
+   * Write a record (plus checksum trailer if enabled) to a temp file
+   * @param tempPath Temporary file path
+   * @param data Record data
+   * @param compress true to write it gzip-compressed (kept plain if that
+   *        doesn't make it smaller)
+   * @return true if fully written; the temp file is removed on failure
+   */
+  bool writeTempFile(const String &tempPath, const String &data,
+                     bool compress);
+
+  /**
+   * Check whether a record should be written compressed
+   * @param collection Collection name
+   * @param data Record data
+   * @return true if the collection is Gzip and the record is large enough
+   */
+  bool shouldCompress(const String &collection, const String &data) const;
+
+  /**
+   * Check an open file for the gzip magic bytes. Rewinds the file.
+   * @param file Open file handle
+   * @return true if the record is stored compressed
+   */
+  bool isCompressedFile(File &file);
+
+  /**
+   * Rename a written temp file over the record's final path
+   * @param tempPath Temporary file path
+   * @param filePath Final file path
+   * @return true if the record now holds the new value
+   */
+  bool commitTempFile(const String &tempPath, const String &filePath);
+
+  /**
+   * Finish a batch whose manifest was committed but whose staged values
+   * weren't all swapped in before a reboot, then drop the manifest
+   * @return Number of batch operations applied
+   */
+  size_t replayBatchManifest();
+
+  /**
+   * Settle one temp file found at startup: drop it if its record exists,
+   * otherwise promote it to the record if it reads back as a complete
+   * document (an interrupted remove + rename in commitTempFile)
+   * @param collection Collection the file belongs to
+   * @param tempPath Path of the .tmp file
+   * @return true if the file was removed or promoted
+   */
+  bool resolveInterruptedWrite(const String &collection,
+                               const String &tempPath);
+
   /**
    * Add content to cache with LRU eviction
    * @param path File path
@@ -103,6 +290,40 @@ private:
    */
   String retrieveLargeFile(File &file, size_t fileSize, const String &filePath);
 
+  /**
+   * Read a whole record from an open file, verifying size and checksum.
+   * Does not close the file.
+   * @param file Open file handle
+   * @param filePath Path for debugging
+   * @return Record data or empty string on failure
+   */
+  String readRecord(File &file, const String &filePath);
+
+  /**
+   * Inflate a gzip record from an open file, reading it in chunks.
+   * Does not close the file.
+   * @param file Open file handle, positioned at the start
+   * @param filePath Path for debugging
+   * @return Record data or empty string if the stream is corrupt
+   */
+  String readCompressedRecord(File &file, const String &filePath);
+
+  /**
+   * Length of a plain record's data - the file minus its CRC32 trailer, if
+   * it carries one. Reads only the tail; rewinds the file.
+   * @param file Open file handle of an uncompressed record
+   * @return Data length in bytes
+   */
+  size_t plainRecordLength(File &file);
+
+  /**
+   * Verify and remove a CRC32 trailer if the content carries one
+   * @param content File content, trailer stripped in place on success
+   * @param filePath Path for debugging
+   * @return false if a trailer is present but does not match the data
+   */
+  bool verifyAndStripChecksum(String &content, const String &filePath);
+
 public:
   /**
    * Constructor
@@ -122,12 +343,70 @@ public:
   bool remove(const String &collection, const String &key) override;
   std::vector<String> listKeys(const String &collection) override;
   bool exists(const String &collection, const String &key) override;
+  size_t forEach(const String &collection, RecordCallback callback) override;
+  size_t scanPrefix(const String &collection, const String &prefix,
+                    RecordCallback callback) override;
+  size_t scanRange(const String &collection, const String &from,
+                   const String &to, RecordCallback callback) override;
+  size_t count(const String &collection) override;
+  bool applyBatch(const WriteBatch &batch) override;
+  bool setRecordFormat(const String &collection, RecordFormat format) override;
+  size_t compressedSize(const String &collection, const String &key) override;
+  bool streamCompressed(const String &collection, const String &key,
+                        ChunkCallback callback) override;
+  size_t recordLength(const String &collection, const String &key) override;
+  bool readRange(const String &collection, const String &key, size_t offset,
+                 size_t length, ChunkCallback callback) override;
+  bool acceptsName(const String &collection, const String &key) override;
   String getDriverName() const override;
 
   // LittleFS-specific methods
 
   /**
-   * Clear all cached data
+   * Append a CRC32 trailer to every record written from now on. Records
+   * that carry a trailer are always verified on retrieve (a mismatch reads
+   * as missing); records without one are still accepted, so this can be
+   * turned on for an existing store.
+   * @param enabled true to write checksums
+   */
+  void setChecksumEnabled(bool enabled);
+
+  /**
+   * @return true if new records are written with a CRC32 trailer
+   */
+  bool isChecksumEnabled() const;
+
+  /**
+   * Store records in hash-sharded subdirectories (/collection/ab/key.json)
+   * instead of one flat directory per collection. Worth it for collections
+   * of more than a few dozen records. Existing records are moved to the new
+   * layout as each collection is next loaded, so this can be changed for an
+   * existing store; set it before the first store() to avoid the move.
+   * @param enabled true to shard
+   */
+  void setShardingEnabled(bool enabled);
+
+  /**
+   * @return true if records are stored in shard subdirectories
+   */
+  bool isShardingEnabled() const;
+
+  /**
+   * @param collection Collection name
+   * @return Format new records in the collection are written with
+   */
+  RecordFormat getRecordFormat(const String &collection) const;
+
+  /**
+   * Resolve temporary files left behind by writes that were interrupted
+   * before their rename. Runs automatically on initialization.
+   * @return Number of orphaned temporary files removed or promoted
+   */
+  size_t recoverInterruptedWrites();
+
+  /**
+   * Clear all cached data, including key directories (reloaded on next
+   * use - call this after changing files behind the driver's back)
    */
   void clearCache();
 
@@ -148,7 +427,8 @@ public:
    * Get size of a specific key's data
    * @param collection Collection name
    * @param key Key name
-   * @return Size in bytes, 0 if not found
+   * @return Size in bytes as stored (compressed for gzip records), 0 if
+   *         not found
    */
   size_t getKeySize(const String &collection, const String &key);
 
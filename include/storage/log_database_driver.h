@@ -0,0 +1,233 @@
+#ifndef LOG_DATABASE_DRIVER_H
+#define LOG_DATABASE_DRIVER_H
+
+#include "database_driver_interface.h"
+#include <LittleFS.h>
+#include <map>
+#include <vector>
+
+/**
+ * LogDatabaseDriver - Append-only log-structured storage on LittleFS
+ *
+ * For high-churn collections (sessions, counters, event logs) where
+ * JsonDatabaseDriver's whole-collection rewrites and LittleFSDatabaseDriver's
+ * file-per-key create/rename/remove cost too many flash erases. Every put
+ * and remove is appended to the active segment file; a key -> location index
+ * in RAM points at the latest value of each record.
+ *
+ * Storage structure:
+ * /logdb/
+ *   00000001.log   sealed segment
+ *   00000002.log   sealed segment
+ *   00000003.log   active segment (appended to)
+ *
+ * Record format (text header, raw payload, trailing newline):
+ *   P <collectionLen> <keyLen> <dataLen> <crc32>\n<collection><key><data>\n
+ *   D <collectionLen> <keyLen> 0 <crc32>\n<collection><key>\n
+ *   B 0 0 <payloadLen> <crc32>\n<P/D records>\n         (applyBatch)
+ *
+ * - The index is rebuilt at mount by replaying segments oldest first. A torn
+ *   or corrupt record ends the replay of its segment, and writing resumes in
+ *   a fresh segment, so a power loss mid-append loses only that append. A
+ *   batch is one "B" frame, so it replays all-or-nothing.
+ * - Overwritten and removed records are dead space. When the dead share of
+ *   the log crosses the compaction threshold, maintain() copies the live
+ *   records of the oldest sealed segment forward and deletes it - one
+ *   segment per call, so the work is spread over several loop iterations.
+ * - RAM cost is one index entry (key strings + 20 bytes) per live record.
+ *
+ * Register it like any other driver:
+ *   StorageManager::configureDriver("log",
+ *       std::unique_ptr<IDatabaseDriver>(new LogDatabaseDriver()));
+ */
+class LogDatabaseDriver : public IDatabaseDriver {
+private:
+  struct Location {
+    uint32_t segment;     // Segment id holding the record
+    uint32_t offset;      // Position of the data within the segment
+    uint32_t length;      // Data length
+    uint32_t recordBytes; // Whole record including header
+    uint32_t crc;         // Record checksum, verified on read
+  };
+
+  struct Segment {
+    uint32_t id;
+    size_t bytes;     // File size
+    size_t liveBytes; // Bytes of records the index still points at
+  };
+
+  // One record parsed from a segment during replay
+  struct ParsedRecord {
+    char op;
+    String collection;
+    String key;
+    Location location;
+  };
+
+  String driverName;
+  bool initialized;
+  String basePath;
+  size_t maxSegmentBytes;
+  float compactionThreshold;
+
+  std::map<String, std::map<String, Location>> index; // collection -> key
+  std::vector<Segment> segments; // Oldest first; back() is active
+
+  /**
+   * Mount LittleFS and rebuild the index from the segment files
+   */
+  void ensureInitialized();
+
+  /**
+   * Replay one segment file into the index
+   * @param segment Segment to replay; bytes/liveBytes are filled in
+   * @return false if the segment ends in a torn or corrupt record
+   */
+  bool replaySegment(Segment &segment);
+
+  /**
+   * Parse the records in a buffer, expanding batch frames
+   * @param buffer Segment content (or batch payload)
+   * @param start First byte to parse
+   * @param end One past the last byte to parse
+   * @param segmentId Segment the buffer belongs to
+   * @param records Receives the parsed records in log order
+   * @param allowBatch false inside a batch frame (frames don't nest)
+   * @return Position where parsing stopped (== end if every record is intact)
+   */
+  size_t parseRecords(const String &buffer, size_t start, size_t end,
+                      uint32_t segmentId, std::vector<ParsedRecord> &records,
+                      bool allowBatch);
+
+  /**
+   * Apply a put/remove to the index and the live-byte accounting
+   */
+  void applyToIndex(char op, const String &collection, const String &key,
+                    const Location &location);
+
+  /**
+   * Append an encoded record to a buffer
+   * @param out Buffer to append to
+   * @param op 'P' or 'D'
+   * @param dataOffset Receives the data position relative to out's start
+   * @return Record checksum
+   */
+  static uint32_t encodeRecord(String &out, char op, const String &collection,
+                               const String &key, const String &data,
+                               size_t &dataOffset);
+
+  /**
+   * Checksum of a record's op, collection, key and data
+   */
+  static uint32_t recordCrc(char op, const String &collection,
+                            const String &key, const char *data,
+                            size_t dataLength);
+
+  /**
+   * Append bytes to the active segment, rolling to a new segment first if
+   * they would overflow it
+   * @param bytes Encoded records
+   * @param segmentId Receives the segment written to
+   * @param offset Receives the position of bytes within the segment
+   * @return true if everything was written
+   */
+  bool append(const String &bytes, uint32_t &segmentId, size_t &offset);
+
+  /**
+   * Read a record's data from an open segment file and verify it
+   * @return Data, or empty string on a read error or checksum mismatch
+   */
+  String readData(File &file, const String &collection, const String &key,
+                  const Location &location);
+
+  /**
+   * Visit records in key order from the first key >= from while
+   * inRange(key) holds. Only those records are read.
+   */
+  size_t scanFrom(const String &collection, const String &from,
+                  const std::function<bool(const String &)> &inRange,
+                  RecordCallback callback);
+
+  String getSegmentPath(uint32_t id) const;
+  Segment *findSegment(uint32_t id);
+  bool isValidName(const String &name) const;
+
+  /**
+   * Copy the live records of the oldest sealed segment to the active one,
+   * then delete it
+   * @return true if a segment was compacted
+   */
+  bool compactOldestSegment();
+
+public:
+  /**
+   * Default size at which the active segment is sealed and a new one started
+   */
+  static const size_t DEFAULT_MAX_SEGMENT_BYTES = 16384;
+
+  /**
+   * Constructor
+   * @param baseStoragePath Directory holding the segment files
+   * @param maxSegmentBytes Roll to a new segment past this size
+   */
+  explicit LogDatabaseDriver(const String &baseStoragePath = "/logdb",
+                             size_t maxSegmentBytes = DEFAULT_MAX_SEGMENT_BYTES);
+
+  // IDatabaseDriver interface implementation
+  bool store(const String &collection, const String &key,
+             const String &data) override;
+  String retrieve(const String &collection, const String &key) override;
+  bool remove(const String &collection, const String &key) override;
+  std::vector<String> listKeys(const String &collection) override;
+  bool exists(const String &collection, const String &key) override;
+  size_t forEach(const String &collection, RecordCallback callback) override;
+  size_t scanPrefix(const String &collection, const String &prefix,
+                    RecordCallback callback) override;
+  size_t scanRange(const String &collection, const String &from,
+                   const String &to, RecordCallback callback) override;
+  size_t count(const String &collection) override;
+  bool applyBatch(const WriteBatch &batch) override;
+  void maintain() override;
+  bool acceptsName(const String &collection, const String &key) override;
+  String getDriverName() const override;
+
+  // Log-specific methods
+
+  /**
+   * Set the dead-space share that triggers compaction (default 0.5). At
+   * least one segment's worth of dead space is also required, so a small
+   * log is never compacted.
+   * @param ratio Dead bytes / total bytes, 0..1
+   */
+  void setCompactionThreshold(float ratio);
+
+  /**
+   * @return true if maintain() would compact now
+   */
+  bool needsCompaction();
+
+  /**
+   * Compact until the dead share is below the threshold (or only the active
+   * segment is left). Blocks - prefer letting maintain() do it.
+   * @return Number of segments compacted
+   */
+  size_t compact();
+
+  /**
+   * @return Number of segment files (including the active one)
+   */
+  size_t getSegmentCount();
+
+  /**
+   * @return Bytes used by all segments
+   */
+  size_t getTotalBytes();
+
+  /**
+   * @return Bytes of overwritten/removed records, tombstones and headers
+   *         that compaction can reclaim
+   */
+  size_t getDeadBytes();
+};
+
+#endif // LOG_DATABASE_DRIVER_H
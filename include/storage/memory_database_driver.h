@@ -0,0 +1,182 @@
+#ifndef MEMORY_DATABASE_DRIVER_H
+#define MEMORY_DATABASE_DRIVER_H
+
+#include "database_driver_interface.h"
+#include <list>
+#include <map>
+#include <time.h>
+
+/**
+ * MemoryDatabaseDriver - Bounded RAM-only storage for ephemeral collections
+ *
+ * Nothing is written to flash, so records are gone after a reboot. Meant for
+ * data that never needs to survive one (page tokens, caches) and would
+ * otherwise cost a flash erase or NVS write on every change. Registered by
+ * StorageManager as "memory"; send a collection here with
+ * StorageManager::routeCollection().
+ *
+ * - Bounded by record count and by bytes (key + data) across all
+ *   collections
+ * - When full it evicts the least recently used record, or refuses the
+ *   write with EvictionPolicy::RejectWhenFull
+ * - Optional per-collection TTL (setCollectionTtl, or
+ *   StorageManager::declareTtl): a record expires that many seconds after
+ *   it was stored. Expired records read as missing straight away;
+ *   maintain() frees them.
+ */
+class MemoryDatabaseDriver : public IDatabaseDriver {
+public:
+  enum class EvictionPolicy { LeastRecentlyUsed, RejectWhenFull };
+
+  /**
+   * Time source in seconds (time(nullptr) by default, like the auth
+   * models' expiry fields)
+   */
+  using Clock = std::function<time_t()>;
+
+  static const size_t DEFAULT_MAX_RECORDS = 64;
+  static const size_t DEFAULT_MAX_BYTES = 16384;
+
+private:
+  // LRU entries point at the map keys rather than copying them - std::map
+  // nodes don't move, so the pointers stay valid until the record is erased
+  struct RecordRef {
+    const String *collection;
+    const String *key;
+  };
+
+  struct Entry {
+    String data;
+    time_t expiresAt; // 0 = never
+    std::list<RecordRef>::iterator lruPosition;
+  };
+
+  String driverName;
+  size_t maxRecords;
+  size_t maxBytes;
+  EvictionPolicy policy;
+  Clock clock;
+
+  std::map<String, std::map<String, Entry>> collections;
+  std::list<RecordRef> lru; // Least recently used first
+  std::map<String, unsigned long> ttls; // Collection -> seconds
+  size_t recordCount;
+  size_t usedBytes;
+  size_t evictionCount;
+
+  /**
+   * @return Current time, or 0 if no collection has a TTL (the clock
+   *         isn't consulted then)
+   */
+  time_t now() const;
+
+  /**
+   * @param entry Record
+   * @param currentTime Result of now()
+   * @return true if the record's TTL has passed
+   */
+  static bool isExpired(const Entry &entry, time_t currentTime);
+
+  /**
+   * Bytes a record counts against maxBytes
+   */
+  static size_t recordSize(const String &key, const String &data);
+
+  /**
+   * Find a record, expired or not
+   * @return Entry or nullptr
+   */
+  Entry *findEntry(const String &collection, const String &key);
+
+  /**
+   * Find a record that hasn't expired. Drops it if it has.
+   * @return Entry or nullptr
+   */
+  Entry *findLive(const String &collection, const String &key);
+
+  /**
+   * Remove a record and release its budget
+   * @return true if the record existed
+   */
+  bool erase(const String &collection, const String &key);
+
+  /**
+   * Drop every expired record
+   * @return Number dropped
+   */
+  size_t removeExpired();
+
+  /**
+   * Visit live records from the first key >= from while inRange(key) holds
+   */
+  size_t scanFrom(const String &collection, const String &from,
+                  const std::function<bool(const String &)> &inRange,
+                  RecordCallback callback);
+
+  /**
+   * @return true if a record of this size fits once `freedRecords`
+   *         records / `freedBytes` bytes have been released
+   */
+  bool fits(size_t size, size_t freedRecords, size_t freedBytes) const;
+
+public:
+  /**
+   * @param maxRecords Most records held across all collections
+   * @param maxBytes Most key + data bytes held across all collections
+   * @param policy What to do when a store doesn't fit
+   */
+  explicit MemoryDatabaseDriver(
+      size_t maxRecords = DEFAULT_MAX_RECORDS,
+      size_t maxBytes = DEFAULT_MAX_BYTES,
+      EvictionPolicy policy = EvictionPolicy::LeastRecentlyUsed);
+
+  virtual ~MemoryDatabaseDriver() = default;
+
+  // IDatabaseDriver interface implementation
+  bool store(const String &collection, const String &key,
+             const String &data) override;
+  String retrieve(const String &collection, const String &key) override;
+  bool remove(const String &collection, const String &key) override;
+  std::vector<String> listKeys(const String &collection) override;
+  bool exists(const String &collection, const String &key) override;
+  size_t forEach(const String &collection, RecordCallback callback) override;
+  size_t scanPrefix(const String &collection, const String &prefix,
+                    RecordCallback callback) override;
+  size_t scanRange(const String &collection, const String &from,
+                   const String &to, RecordCallback callback) override;
+  size_t count(const String &collection) override;
+  bool setCollectionTtl(const String &collection,
+                        unsigned long ttlSeconds) override;
+  void maintain() override;
+  String getDriverName() const override;
+
+  // Memory-specific methods
+
+  /**
+   * Replace the time source (for tests)
+   * @param source Returns the current time in seconds
+   */
+  void setClock(Clock source);
+
+  /**
+   * Drop every record in every collection
+   */
+  void clear();
+
+  /**
+   * @return Records held, including expired ones not yet freed
+   */
+  size_t getRecordCount() const;
+
+  /**
+   * @return Key + data bytes held
+   */
+  size_t getUsedBytes() const;
+
+  /**
+   * @return Records evicted to make room since construction
+   */
+  size_t getEvictionCount() const;
+};
+
+#endif // MEMORY_DATABASE_DRIVER_H
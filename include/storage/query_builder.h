@@ -3,20 +3,132 @@
 
 #include "database_driver_interface.h"
 #include <Arduino.h>
-#include <map>
+#include <ArduinoJson.h>
+#include <vector>
 
 /**
  * QueryBuilder - Fluent interface for database operations
  * 
  * Provides Laravel-style query building with method chaining.
  * Executes operations on the specified driver.
+ *
+ * Conditions are pushed down into parsing: each record is deserialized once
+ * through an ArduinoJson filter that keeps only the fields named in WHERE
+ * clauses, and compared in place without building intermediate Strings.
+ *
+ * When an equality condition names a field the driver has indexed (see
+ * StorageManager::declareIndex), only the records the index points at are
+ * read; explain() reports which plan a query will use.
+ *
+ * Results are ordered by key, or by orderBy(field). limit(n) caps the number
+ * of matches returned, and only that many are held in RAM while scanning;
+ * nextCursor() then yields an opaque token for after() to resume from.
  */
 class QueryBuilder {
+public:
+    /**
+     * WHERE comparison operators
+     */
+    enum class Operator {
+        Equal,          // "=" / "=="
+        NotEqual,       // "!=" / "<>"
+        Less,           // "<"
+        LessOrEqual,    // "<="
+        Greater,        // ">"
+        GreaterOrEqual, // ">="
+        StartsWith,     // "prefix" / "startsWith"
+        Contains,       // "contains"
+        Invalid         // Unrecognized operator string - matches nothing
+    };
+
+    /**
+     * Parse an operator string as accepted by where(field, op, value)
+     * @param op Operator text
+     * @return Parsed operator, Operator::Invalid if unrecognized
+     */
+    static Operator parseOperator(const String& op);
+
 private:
+    struct Condition {
+        String field;
+        Operator op;
+        String value;
+        bool numeric;  // value parsed as a number
+        double number; // parsed value when numeric
+    };
+
+    // Ordering key of a matched record (null/missing sorts as "")
+    struct SortValue {
+        bool numeric = false;
+        double number = 0;
+        String text;
+    };
+
+    struct Row {
+        SortValue value;
+        String key;
+        String data;
+    };
+
     IDatabaseDriver* targetDriver;
     String collection;
-    std::map<String, String> conditions;
+    std::vector<Condition> conditions;
     int limitCount;
+    String orderField;
+    bool orderDescending;
+    String afterCursor;
+    String nextCursorValue;
+
+    // Filter document selecting only the WHERE fields; rebuilt lazily when
+    // conditions change
+    JsonDocument fieldFilter;
+    bool filterDirty;
+
+    /**
+     * Check a record against every WHERE condition
+     * @param data JSON record
+     * @param doc Scratch document reused across records
+     * @return true if all conditions match (or there are none)
+     */
+    bool matchesConditions(const String& data, JsonDocument& doc);
+
+    /**
+     * Evaluate one condition against a parsed field
+     * @param condition Condition to test
+     * @param field Field value from the record (may be null)
+     * @return true if the field satisfies the condition
+     */
+    static bool evaluate(const Condition& condition, JsonVariantConst field);
+
+    QueryBuilder& addCondition(const String& key, Operator op, const String& value);
+
+    /**
+     * Pick the equality condition to drive the query from an index
+     * @return Condition on an indexed field, or nullptr to scan
+     */
+    const Condition* indexedCondition() const;
+
+    /**
+     * Visit candidate records - index hits if an indexed condition exists,
+     * otherwise the whole collection. Candidates still need matching.
+     * @param keyOrder Visit in ascending key order; otherwise in whatever
+     *                 order is cheapest for the driver
+     * @param afterKey With keyOrder, skip keys up to and including this one
+     *                 ("" visits all)
+     * @param callback Called per candidate; return false to stop
+     */
+    void forEachCandidate(bool keyOrder, const String& afterKey,
+                          IDatabaseDriver::RecordCallback callback);
+
+    /**
+     * Compare rows in result order (sort value, then key)
+     * @return true if a comes before b
+     */
+    bool rowBefore(const Row& a, const Row& b) const;
+
+    static void readSortValue(JsonVariantConst field, SortValue& value);
+    static String encodeCursor(const Row& row);
+    static bool decodeCursor(const String& cursor, Row& row);
 
 public:
     /**
@@ -27,20 +139,63 @@ public:
     QueryBuilder(IDatabaseDriver* driver, const String& collectionName);
     
     /**
-     * Add WHERE condition
+     * Add WHERE equality condition
      * @param key Field name
      * @param value Field value to match
      * @return Reference to this QueryBuilder for chaining
      */
     QueryBuilder& where(const String& key, const String& value);
+
+    /**
+     * Add WHERE condition with an explicit operator
+     *
+     * Operators: "=", "!=" (or "<>"), "<", "<=", ">", ">=", "prefix" (or
+     * "startsWith") and "contains". When both the stored field and the value
+     * are numeric the comparison is numeric, otherwise it is a byte-wise
+     * string comparison. A missing field only satisfies "!=".
+     *
+     * @param key Field name
+     * @param op Comparison operator
+     * @param value Value to compare against
+     * @return Reference to this QueryBuilder for chaining
+     */
+    QueryBuilder& where(const String& key, const String& op, const String& value);
+
+    /**
+     * Add WHERE condition comparing against a number
+     * @param key Field name
+     * @param op Comparison operator (see above)
+     * @param value Number to compare against
+     * @return Reference to this QueryBuilder for chaining
+     */
+    QueryBuilder& where(const String& key, const String& op, double value);
     
     /**
      * Limit number of results
-     * @param count Maximum number of results
+     * @param count Maximum number of matching records returned
      * @return Reference to this QueryBuilder for chaining
      */
     QueryBuilder& limit(int count);
 
+    /**
+     * Order results by a field (numbers numerically, otherwise byte-wise;
+     * ties broken by key). Without orderBy results are in key order.
+     *
+     * Without a limit every match is buffered for sorting - pair orderBy
+     * with limit() to keep memory bounded.
+     * @param field Field name
+     * @param descending true for largest first
+     * @return Reference to this QueryBuilder for chaining
+     */
+    QueryBuilder& orderBy(const String& field, bool descending = false);
+
+    /**
+     * Resume after the last record of a previous page
+     * @param cursor Value from nextCursor() (empty starts from the top)
+     * @return Reference to this QueryBuilder for chaining
+     */
+    QueryBuilder& after(const String& cursor);
+
     // Execution methods
     
     /**
@@ -55,6 +210,24 @@ public:
      */
     std::vector<String> getAll();
     
+    /**
+     * Stream matching records to a callback in result order
+     *
+     * With a limit or orderBy, at most limit() records are buffered; with
+     * neither, records are passed straight through, read in key order
+     * (scanRange(), or sorted index hits) whatever order the driver's
+     * forEach() uses.
+     * @param callback Called per match; return false to stop early
+     * @return Number of records passed to the callback
+     */
+    size_t each(IDatabaseDriver::RecordCallback callback);
+
+    /**
+     * Cursor for the page after the last each()/getAll() call
+     * @return Opaque cursor for after(), empty if no records remain
+     */
+    String nextCursor() const;
+    
     /**
      * Check if any matching record exists
      * @return true if at least one match exists
@@ -74,6 +247,12 @@ public:
      * @return true if any records were removed
      */
     bool remove();
+
+    /**
+     * Describe how get()/getAll()/remove() will find records
+     * @return "INDEX <field>" when an index drives the query, else "SCAN"
+     */
+    String explain() const;
     
     /**
      * Get the target driver
@@ -6,6 +6,9 @@
 #include <Arduino.h>
 #include <map>
 #include <memory>
+#include <vector>
+
+class IndexedDatabaseDriver;
 
 /**
  * StorageManager - Laravel DB-inspired storage manager
@@ -17,6 +20,16 @@
  * - StorageManager::query("users").where("username", "admin").get()
  * - StorageManager::driver("cloud").query("logs").getAll()
  * - StorageManager::setDefaultDriver("json")
+ * - StorageManager::declareIndex("users", "username")
+ * - StorageManager::declareFormat("sessions", RecordFormat::MessagePack)
+ * - StorageManager::declareFormat("openapi", RecordFormat::Gzip, "littlefs")
+ * - StorageManager::batch().remove("a", "k1").remove("b", "k2").commit()
+ * - StorageManager::routeCollection("page_tokens", "memory")
+ * - StorageManager::declareTtl("page_tokens", 3600)
+ * - StorageManager::routeCollection("openapi", "cached:littlefs")
+ * - StorageManager::maintain() from the main loop (WebPlatform::handle()
+ *   does this)
+ * - StorageManager::flush() before a restart
  */
 class StorageManager {
 private:
@@ -24,9 +37,48 @@ private:
   static String defaultDriverName;
   static bool initialized;
 
+  struct IndexDeclaration {
+    String driverName;
+    String collection;
+    String field;
+  };
+  static std::vector<IndexDeclaration> indexDeclarations;
+
+  struct FormatDeclaration {
+    String driverName;
+    String collection;
+    RecordFormat format;
+  };
+  static std::vector<FormatDeclaration> formatDeclarations;
+
+  struct TtlDeclaration {
+    String driverName;
+    String collection;
+    unsigned long ttlSeconds;
+  };
+  static std::vector<TtlDeclaration> ttlDeclarations;
+  // Collection -> driver name, for collections kept off the default driver
+  static std::map<String, String> collectionRoutes;
+  // Drivers wrapped for indexing, by name (the wrapper is owned by drivers)
+  static std::map<String, IndexedDatabaseDriver *> indexedDrivers;
+
   // Ensure default JSON driver exists
   static void ensureInitialized();
 
+  // Wrap a driver and add its declared indexes (no-op without declarations)
+  static void applyIndexDeclarations(const String &name);
+
+  // Pass a driver its declared record formats
+  static void applyFormatDeclarations(const String &name);
+
+  // Pass a driver its declared TTLs
+  static void applyTtlDeclarations(const String &name);
+
+  // Driver a declaration targets: explicit name, else the collection's
+  // route, else the default
+  static String resolveDriverName(const String &collection,
+                                  const String &driverName);
+
 public:
   /**
    * Configure a named database driver
@@ -51,7 +103,28 @@ public:
   static IDatabaseDriver &driver(const String &name = "");
 
   /**
-   * Start a query on the default driver
+   * Get the driver a collection lives on
+   * @param collection Collection name
+   * @param fallbackName Driver to use if the collection isn't routed
+   *                     ("" for default driver)
+   * @return The routed driver, else the fallback
+   */
+  static IDatabaseDriver &driverFor(const String &collection,
+                                    const String &fallbackName = "");
+
+  /**
+   * Keep a collection on a specific driver, e.g. ephemeral data on
+   * "memory" so it never costs a flash write. query() and driverFor()
+   * follow the route. Routes survive configureDriver() and
+   * clearAllDrivers(), like declarations.
+   * @param collection Collection name
+   * @param driverName Driver to hold it ("" removes the route)
+   */
+  static void routeCollection(const String &collection,
+                              const String &driverName);
+
+  /**
+   * Start a query on the collection's driver (see routeCollection())
    * @param collection Collection name
    * @return QueryBuilder instance
    */
@@ -76,6 +149,67 @@ public:
    */
   static bool removeDriver(const String &name);
 
+  /**
+   * Start a write batch on a driver; nothing is written until commit()
+   * @param name Driver name ("" for default driver)
+   * @return WriteBatch bound to the driver
+   */
+  static WriteBatch batch(const String &name = "");
+
+  /**
+   * Declare an equality index on a collection field
+   *
+   * The driver is wrapped in an IndexedDatabaseDriver that keeps the index up
+   * to date on store/remove, and QueryBuilder uses it for where() equality
+   * on that field. Declarations survive configureDriver() and
+   * clearAllDrivers() - they describe the schema, not a driver instance.
+   * @param collection Collection name
+   * @param field Top-level JSON field name
+   * @param driverName Driver holding the collection ("" for the routed or
+   *                   default driver)
+   */
+  static void declareIndex(const String &collection, const String &field,
+                           const String &driverName = "");
+
+  /**
+   * Give every driver a slice of deferred housekeeping (see
+   * IDatabaseDriver::maintain()). Cheap when there's nothing to do.
+   */
+  static void maintain();
+
+  /**
+   * Write out every driver's buffered writes (see IDatabaseDriver::flush()).
+   * Call before restarting; WebPlatform does this for scheduled restarts.
+   * @return false if any driver failed to flush
+   */
+  static bool flush();
+
+  /**
+   * Declare the on-flash encoding of a collection
+   *
+   * Like declareIndex(), the declaration survives configureDriver() and
+   * clearAllDrivers(). Drivers with a single fixed format ignore it.
+   * @param collection Collection name
+   * @param format Encoding for the collection's writes
+   * @param driverName Driver holding the collection ("" for the routed or
+   *                   default driver)
+   */
+  static void declareFormat(const String &collection, RecordFormat format,
+                            const String &driverName = "");
+
+  /**
+   * Declare how long a collection's records live
+   *
+   * Like declareIndex(), the declaration survives configureDriver() and
+   * clearAllDrivers(). Drivers without expiry (the flash drivers) ignore it.
+   * @param collection Collection name
+   * @param ttlSeconds Record lifetime; 0 = no expiry
+   * @param driverName Driver holding the collection ("" for the routed or
+   *                   default driver)
+   */
+  static void declareTtl(const String &collection, unsigned long ttlSeconds,
+                         const String &driverName = "");
+
   /**
    * Clear all drivers (useful for testing)
    */
@@ -84,8 +218,11 @@ public:
 
 // Inline implementation for driver-specific query builder
 inline QueryBuilder StorageManager::query(const String &collection) {
-  ensureInitialized();
-  return QueryBuilder(&driver(), collection);
+  return QueryBuilder(&driverFor(collection), collection);
+}
+
+inline WriteBatch StorageManager::batch(const String &name) {
+  return WriteBatch(&driver(name));
 }
 
 #endif // STORAGE_MANAGER_H
\ No newline at end of file
@@ -0,0 +1,87 @@
+#ifndef WRITE_BATCH_H
+#define WRITE_BATCH_H
+
+#include <Arduino.h>
+#include <vector>
+
+class IDatabaseDriver;
+
+/**
+ * WriteBatch - Buffered puts and removes applied to a driver in one go
+ *
+ * Collects writes across any number of collections and hands them to
+ * IDatabaseDriver::applyBatch() on commit(). Drivers that rewrite a whole
+ * collection per write (JsonDatabaseDriver) then write each touched
+ * collection once instead of once per operation.
+ *
+ * Usage:
+ *   WriteBatch batch = StorageManager::batch();
+ *   batch.remove("users", userId);
+ *   batch.remove("sessions", sessionId);
+ *   batch.commit();
+ */
+class WriteBatch {
+public:
+  struct Operation {
+    bool isRemove;
+    String collection;
+    String key;
+    String data; // Empty for removes
+  };
+
+private:
+  IDatabaseDriver *targetDriver;
+  std::vector<Operation> ops;
+
+public:
+  /**
+   * Constructor
+   * @param driver Driver commit() applies to (nullptr = commit fails)
+   */
+  explicit WriteBatch(IDatabaseDriver *driver = nullptr);
+
+  /**
+   * Queue a store
+   * @return Reference to this batch for chaining
+   */
+  WriteBatch &put(const String &collection, const String &key,
+                  const String &data);
+
+  /**
+   * Queue a remove (removing a missing key is not an error)
+   * @return Reference to this batch for chaining
+   */
+  WriteBatch &remove(const String &collection, const String &key);
+
+  /**
+   * Apply all queued operations, then clear the batch
+   * @return true if every operation was applied
+   */
+  bool commit();
+
+  /**
+   * Drop all queued operations without applying them
+   */
+  void clear();
+
+  bool empty() const;
+  size_t size() const;
+
+  /**
+   * Queued operations in the order they were added
+   */
+  const std::vector<Operation> &operations() const;
+
+  /**
+   * Collections touched by the batch, in first-use order
+   */
+  std::vector<String> collections() const;
+
+  /**
+   * Final operation per (collection, key) - earlier operations on the same
+   * record are superseded. Order follows each record's first operation.
+   */
+  std::vector<Operation> collapsed() const;
+};
+
+#endif // WRITE_BATCH_H
@@ -3,6 +3,8 @@
 
 #include "interface/openapi_generation_context.h"
 #include "interface/platform_service.h"
+#include "platform/asset_bundle.h"
+#include "platform/html_template.h"
 #include "platform/ntp_client.h"
 #include "platform/router.h"
 #include "platform/server_manager.h"
@@ -20,6 +22,7 @@
 #include <interface/web_request.h>
 #include <interface/web_response.h>
 #include <map>
+#include <mutex>
 #include <utility> // for std::move
 #include <vector>
 #include <web_platform_interface.h>
@@ -223,7 +226,22 @@ public:
   void addRedirect(const String &fromPath, const String &toPath);
   String getRedirectTarget(const String &requestPath) const;
 
-  String prepareHtml(String html, WebRequest req, const String &csrfToken = "");
+  // Static assets served under /assets/* alongside the platform's own -
+  // a module runs scripts/generate_web_assets.py on its project and adds
+  // the resulting bundle (ASSET_BUNDLE from assets/asset_bundle_data.h).
+  // The platform's assets win if a path is in both.
+  void addAssetBundle(const AssetBundle &bundle);
+
+  // The fingerprinted URL of a bundled asset ("/assets/style.css" ->
+  // "/assets/style.<hash>.css"), or path unchanged if no bundle has it.
+  // What the {{ASSET:<path>}} template marker expands to.
+  String assetUrl(const String &path) const;
+
+  // Expand template markers ({{NAV_MENU}}, {{ASSET:<path>}}, ...) and the
+  // <head>/<body> injections in html. Pages set with setProgmemContent skip
+  // this parse - their segments are compiled once and cached.
+  String prepareHtml(const String &html, WebRequest &req,
+                     const String &csrfToken = "");
 
   // Pre-generated OpenAPI serving
   void streamPreGeneratedOpenAPISpec(WebResponse &res) const;
@@ -283,16 +301,24 @@ private:
   void loginApiHandler(WebRequest &req, WebResponse &res);
   void logoutPageHandler(WebRequest &req, WebResponse &res);
   void accountPageHandler(WebRequest &req, WebResponse &res);
-  void accountPageJSAssetHandler(WebRequest &req, WebResponse &res);
   void configPortalPageHandler(WebRequest &req, WebResponse &res);
   void initialSetupPageHandler(WebRequest &req, WebResponse &res);
-  void webPlatformCSSAssetHandler(WebRequest &req, WebResponse &res);
-  void webPlatformJSAssetHandler(WebRequest &req, WebResponse &res);
-  void wifiJSAssetHandler(WebRequest &req, WebResponse &res);
-  void styleCSSAssetHandler(WebRequest &req, WebResponse &res);
-  void webPlatformFaviconHandler(WebRequest &req, WebResponse &res);
-  void systemStatusJSAssetHandler(WebRequest &req, WebResponse &res);
-  void homePageJSAssetHandler(WebRequest &req, WebResponse &res);
+
+  // The one /assets/* route: serves bundled assets by plain URL, or by
+  // fingerprinted URL (see assetUrl()) as immutable for a year
+  void embeddedAssetHandler(WebRequest &req, WebResponse &res);
+
+  // Looks path up in the platform bundle, then the module bundles
+  const AssetBundleEntry *findAsset(const String &path,
+                                    const AssetBundle **bundle) const;
+
+  // Serves a generated asset: the gzip bytes with Content-Encoding: gzip
+  // when the request's Accept-Encoding allows it, else the plain text.
+  // Sends its content hash as the ETag and answers a matching
+  // If-None-Match with a bodiless 304.
+  void setEmbeddedAssetContent(WebRequest &req, WebResponse &res,
+                               const EmbeddedAsset &asset,
+                               const String &mimeType);
 
   // RESTful API handlers - User management
   void getUsersApiHandler(WebRequest &req, WebResponse &res);
@@ -353,8 +379,17 @@ private:
 
   // UI management storage
   std::vector<NavigationItem> navigationMenu;
+  // navigationMenu rendered once per visibility state (setNavigationMenu)
+  String authenticatedNavigationHtml;
+  String anonymousNavigationHtml;
   std::map<int, String> errorPages;        // Custom error pages by status code
   std::vector<RedirectRule> redirectRules; // URL redirect rules
+  std::vector<AssetBundle> moduleAssetBundles; // See addAssetBundle()
+
+  // Compiled segments of PROGMEM templates, keyed by address (PROGMEM is
+  // static, so an address always holds the same page)
+  std::map<const char *, HtmlTemplate::Segments> compiledTemplates;
+  std::mutex templateCacheMutex;
 
   // Module registry structures
   struct PendingModule {
@@ -438,6 +473,18 @@ private:
   // Template processing helpers
   bool shouldProcessResponse(const WebResponse &response);
   void processResponseTemplates(WebRequest &request, WebResponse &response);
+  const HtmlTemplate::Segments &compiledTemplate(const char *progmemSource);
+  const String &navigationHtml(bool isAuthenticated) const;
+  String buildNavigationHtml(bool isAuthenticated) const;
+  void renderTemplate(const char *source,
+                      const HtmlTemplate::Segments &segments, WebRequest &req,
+                      const String &csrfToken,
+                      const HtmlTemplate::Writer &write);
+  String renderTemplateToString(const char *source, size_t length,
+                                const HtmlTemplate::Segments &segments,
+                                WebRequest &req, const String &csrfToken);
+  ResponseBody::Producer templateBody(WebRequest &request,
+                                      WebResponse &response);
 
   // HTTPS server lifecycle and certificate wiring moved to ServerManager.
 
@@ -450,6 +497,8 @@ public:
   void updateConnectionState();
   unsigned long lastConnectionCheck = 0;
   static const unsigned long CONNECTION_CHECK_INTERVAL = 5000; // 5 seconds
+  unsigned long lastStorageMaintenance = 0;
+  static const unsigned long STORAGE_MAINTENANCE_INTERVAL = 1000; // 1 second
 
   // Restart scheduling
   bool restartScheduled = false;
@@ -12,17 +12,43 @@ headers must always be up to date. Run it (via `pio run`/`pio test`, which
 invoke it automatically as an extra_script) after touching any file under
 assets/src/ and commit the regenerated header alongside your source change.
 
+Every header also carries a gzip-compressed copy of the asset as
+<NAME>_<EXT>_GZ (a uint8_t PROGMEM array) and its byte count
+<NAME>_<EXT>_GZ_LEN, so handlers can send it as-is with
+`Content-Encoding: gzip` to clients that accept it (see
+WebPlatform::setEmbeddedAssetContent and GUIDE.md). Compression uses a
+fixed timestamp, so unchanged sources keep byte-identical headers. Arrays
+a firmware never references are dropped by the compiler. <NAME>_<EXT>_HASH
+is a short SHA-256 of the embedded text, used as the asset's ETag and in
+its fingerprinted URL (/assets/<name>.<hash>.<ext>).
+
+CSS, JS, HTML and SVG sources are minified first (comments, indentation
+and blank lines stripped - see minify() below; template markers such as
+{{NAV_MENU}} are left alone), and each asset's source -> minified ->
+gzipped sizes are printed in the build log. Set "minify": false in an
+asset's manifest entry to embed it as written.
+
+Files whose manifest entry has a "url" (a string, or a list for aliases)
+are bundled instead: no header of their own, but their text and gzip copy
+go into one PROGMEM string in assets/asset_bundle_data.h, indexed by URL
+(sorted, so AssetBundles::find can binary-search it). WebPlatform serves
+the bundle from a single /assets/* route; a module generates its own and
+hands it to WebPlatform::addAssetBundle. "mime" overrides the
+Content-Type guessed from the extension.
+
 Naming convention (no config needed for the common case): a source file
 assets/src/<name>.<ext> generates assets/<name>_<ext>.h, with the PROGMEM
 array named <NAME>_<EXT> and the include guard <NAME>_<EXT>_H. Add an
 entry to assets/asset_manifest.json (relative source path -> partial
 override dict) for the rare file that needs a different header filename,
-variable name, or guard than the mechanical convention would produce -
-see that file's comment for the exact schema.
+variable name, or guard than the mechanical convention would produce (or
+"minify": false) - see that file's comment for the exact schema.
 
 Works standalone too: `python scripts/generate_web_assets.py [project_dir]`.
 """
 
+import gzip
+import hashlib
 import json
 import os
 import re
@@ -80,7 +106,276 @@ def pick_delimiter(content):
     )
 
 
-def render_header(guard, var, content):
+# --- Minification -----------------------------------------------------------
+#
+# Deliberately conservative: comments go, indentation and blank lines go,
+# runs of whitespace collapse - nothing is renamed or rewritten, and string,
+# template-literal and regex contents are copied untouched. JS keeps its
+# line breaks so automatic semicolon insertion sees the same code. Template
+# markers ({{NAV_MENU}}, {{csrfToken}}, ...) are swapped out before and back
+# in after, so no pass can touch them.
+
+TEMPLATE_MARKER = re.compile(r"\{\{[^{}]*\}\}")
+
+# A "/" after one of these (or after nothing) starts a regex literal, not a
+# division
+JS_REGEX_PRECEDERS = set("(,=:[!&|?{};+-*%<>~^")
+JS_REGEX_KEYWORDS = {
+    "return", "typeof", "instanceof", "in", "of", "new", "delete", "void",
+    "throw", "case", "do", "else", "yield", "await",
+}
+
+# Whitespace next to these goes entirely. JS leaves out "<", "!", "+", "-"
+# and "/" so "a < !--b" or "a - -b" can't fuse into a different token.
+CSS_TIGHT_CHARS = set("{};,")
+JS_TIGHT_CHARS = set("{}()[];,:=?&|")
+
+
+def protect_markers(content):
+    markers = []
+
+    def stash(match):
+        markers.append(match.group(0))
+        return f"__WP_MARKER_{len(markers) - 1}__"
+
+    return TEMPLATE_MARKER.sub(stash, content), markers
+
+
+def restore_markers(content, markers):
+    return re.sub(
+        r"__WP_MARKER_(\d+)__", lambda m: markers[int(m.group(1))], content
+    )
+
+
+def skip_string(src, i):
+    """Index just past the quoted string starting at src[i]."""
+    quote = src[i]
+    i += 1
+    while i < len(src) and src[i] != quote:
+        if src[i] == "\\":
+            i += 1
+        elif src[i] == "\n" and quote != "`":
+            return i  # unterminated - let the caller resync on the newline
+        i += 1
+    return i + 1
+
+
+class _Output:
+    """Collects minified code, collapsing whitespace between tokens."""
+
+    def __init__(self):
+        self.parts = []
+        self.pending = ""  # "", " " or "\n" owed before the next token
+
+    def space(self, newline):
+        if newline:
+            self.pending = "\n"
+        elif not self.pending:
+            self.pending = " "
+
+    def token(self, text, tight_chars=()):
+        if self.parts and self.pending:
+            last = self.parts[-1][-1]
+            if self.pending == "\n" or not (
+                last in tight_chars or text[0] in tight_chars
+            ):
+                self.parts.append(self.pending)
+        self.pending = ""
+        self.parts.append(text)
+
+    def last_char(self):
+        return self.parts[-1][-1] if self.parts else ""
+
+    def last_word(self):
+        return self.parts[-1] if self.parts else ""
+
+    def text(self):
+        return "".join(self.parts)
+
+
+def minify_js(src):
+    out = _Output()
+    i = 0
+    n = len(src)
+    # Brace depth of each open ${ ... } inside template literals
+    template_stack = []
+    depth = 0
+    while i < n:
+        c = src[i]
+        if c in " \t\r\n":
+            out.space(c == "\n")
+            i += 1
+        elif src.startswith("//", i):
+            end = src.find("\n", i)
+            i = n if end < 0 else end
+        elif src.startswith("/*", i):
+            end = src.find("*/", i + 2)
+            end = n if end < 0 else end + 2
+            # A comment spanning lines still ends a statement for ASI
+            out.space("\n" in src[i:end])
+            i = end
+        elif c in "'\"":
+            end = skip_string(src, i)
+            out.token(src[i:end], JS_TIGHT_CHARS)
+            i = end
+        elif c == "`" or (c == "}" and template_stack and
+                          template_stack[-1] == depth):
+            # Template literal text, up to the closing ` or the next ${
+            if c == "}":
+                template_stack.pop()
+            start = i
+            i += 1
+            while i < n and src[i] != "`" and not src.startswith("${", i):
+                i += 2 if src[i] == "\\" else 1
+            if src.startswith("${", i):
+                i += 2
+                template_stack.append(depth)
+            else:
+                i += 1
+            out.token(src[start:i], JS_TIGHT_CHARS)
+        elif c == "/" and (
+            out.last_char() in JS_REGEX_PRECEDERS
+            or out.last_char() == ""
+            or out.last_word() in JS_REGEX_KEYWORDS
+        ):
+            start = i
+            i += 1
+            in_class = False
+            while i < n and src[i] != "\n":
+                if src[i] == "\\":
+                    i += 1
+                elif src[i] == "[":
+                    in_class = True
+                elif src[i] == "]":
+                    in_class = False
+                elif src[i] == "/" and not in_class:
+                    break
+                i += 1
+            i += 1
+            while i < n and (src[i].isalnum() or src[i] == "_"):
+                i += 1  # flags
+            out.token(src[start:i], JS_TIGHT_CHARS)
+        else:
+            if c == "{":
+                depth += 1
+            elif c == "}":
+                depth -= 1
+            start = i
+            if c.isalnum() or c in "_$":
+                while i < n and (src[i].isalnum() or src[i] in "_$"):
+                    i += 1
+            else:
+                i += 1
+            out.token(src[start:i], JS_TIGHT_CHARS)
+    return out.text()
+
+
+def minify_css(src):
+    out = _Output()
+    i = 0
+    n = len(src)
+    while i < n:
+        c = src[i]
+        if c in " \t\r\n":
+            out.space(False)
+            i += 1
+        elif src.startswith("/*", i):
+            end = src.find("*/", i + 2)
+            i = n if end < 0 else end + 2
+            out.space(False)
+        else:
+            # "color: red" -> "color:red"; a space *before* ":" can matter
+            # in selectors ("a :hover"), so only the one after goes
+            if out.last_char() == ":":
+                out.pending = ""
+            if c in "'\"":
+                end = skip_string(src, i)
+                out.token(src[i:end], CSS_TIGHT_CHARS)
+                i = end
+                continue
+            if c == "}" and out.last_char() == ";":
+                out.parts.pop()
+            out.token(c, CSS_TIGHT_CHARS)
+            i += 1
+    return out.text()
+
+
+def minify_html(src):
+    # Comments go; <script>/<style> bodies get the JS/CSS passes and
+    # <pre>/<textarea> stay byte-for-byte. Everything else loses indentation
+    # and blank lines only - the line breaks themselves stay, since one
+    # between inline elements renders as a space.
+    blocks = []
+
+    def stash(match):
+        tag = (match.group(1) or "").lower()
+        if not tag:
+            return ""  # comment
+        whole = match.group(0)
+        body_start = match.start(2) - match.start()
+        body_end = match.end(2) - match.start()
+        body = match.group(2)
+        if tag == "script":
+            body = minify_js(body)
+        elif tag == "style":
+            body = minify_css(body)
+        blocks.append(whole[:body_start] + body + whole[body_end:])
+        return f"__WP_BLOCK_{len(blocks) - 1}__"
+
+    html = re.sub(
+        r"<!--.*?-->|<(script|style|pre|textarea)\b[^>]*>(.*?)</\1\s*>",
+        stash,
+        src,
+        flags=re.S | re.I,
+    )
+    lines = (line.strip() for line in html.split("\n"))
+    html = "\n".join(line for line in lines if line)
+    return re.sub(r"__WP_BLOCK_(\d+)__", lambda m: blocks[int(m.group(1))], html)
+
+
+MINIFIERS = {
+    "css": minify_css,
+    "js": minify_js,
+    "html": minify_html,
+    "svg": minify_html,
+}
+
+
+def minify(content, ext):
+    minifier = MINIFIERS.get(ext)
+    if minifier is None:
+        return content
+    protected, markers = protect_markers(content)
+    return restore_markers(minifier(protected), markers).strip("\n")
+
+
+# Bytes per line in the emitted gzip arrays
+GZIP_BYTES_PER_LINE = 12
+
+# Hex digits of SHA-256 kept for <NAME>_HASH - keep in step with
+# EMBEDDED_ASSET_HASH_LENGTH (include/platform/embedded_asset.h)
+HASH_LENGTH = 12
+
+
+def compress(content):
+    # mtime=0 keeps the output stable across runs - the header only gets
+    # rewritten when the source actually changed
+    return gzip.compress(content.encode("utf-8"), compresslevel=9, mtime=0)
+
+
+def content_hash(content):
+    return hashlib.sha256(content.encode("utf-8")).hexdigest()[:HASH_LENGTH]
+
+
+def render_byte_array(data):
+    lines = []
+    for i in range(0, len(data), GZIP_BYTES_PER_LINE):
+        chunk = data[i : i + GZIP_BYTES_PER_LINE]
+        lines.append("    " + ", ".join(f"0x{b:02x}" for b in chunk) + ",")
+    return "\n".join(lines)
+
+
+def render_header(guard, var, content, packed):
     delim = pick_delimiter(content)
     return (
         f"{AUTOGEN_BANNER}\n"
@@ -90,16 +385,131 @@ def render_header(guard, var, content):
         f'const char {var}[] PROGMEM = R"{delim}(\n'
         f"{content}\n"
         f'){delim}";\n\n'
+        f"const uint8_t {var}_GZ[] PROGMEM = {{\n"
+        f"{render_byte_array(packed)}\n"
+        f"}};\n"
+        f"const size_t {var}_GZ_LEN = {len(packed)};\n"
+        f'const char {var}_HASH[] = "{content_hash(content)}";\n\n'
         f"#endif // {guard}\n"
     )
 
 
+# Bytes per line of octal escapes in the bundle's gzip copies
+OCTAL_BYTES_PER_LINE = 16
+
+# Header holding every asset that has a "url" in the manifest
+BUNDLE_HEADER = "asset_bundle_data.h"
+BUNDLE_GUARD = "ASSET_BUNDLE_DATA_H"
+
+# Content-Type per extension for bundled assets ("mime" in the manifest
+# overrides it)
+MIME_TYPES = {
+    "html": "text/html",
+    "css": "text/css",
+    "js": "application/javascript",
+    "svg": "image/svg+xml",
+    "json": "application/json",
+    "txt": "text/plain",
+}
+
+
+def bundle_urls(names):
+    urls = names.get("url")
+    if urls is None:
+        return []
+    return [urls] if isinstance(urls, str) else list(urls)
+
+
+def render_octal_string(data):
+    # Octal escapes take at most three digits, so unlike \x escapes they
+    # can't run into whatever follows
+    lines = []
+    for i in range(0, len(data), OCTAL_BYTES_PER_LINE):
+        chunk = data[i : i + OCTAL_BYTES_PER_LINE]
+        lines.append('    "' + "".join(f"\\{b:03o}" for b in chunk) + '"')
+    return "\n".join(lines)
+
+
+def render_bundle(assets):
+    # assets: (source name, urls, mime type, content) per bundled file.
+    # Each asset's text (NUL-terminated) and then its gzip copy go into one
+    # string literal; the index rows point into it and are sorted by URL so
+    # the firmware can binary-search them (AssetBundles::find).
+    offset = 0
+    pieces = []
+    rows = []
+    for entry, urls, mime, content in assets:
+        text = content.encode("utf-8")
+        text_offset = offset
+        offset += len(text) + 1
+        delim = pick_delimiter(content)
+        pieces.append(f"    // {entry}")
+        pieces.append(f'    R"{delim}({content}){delim}" "\\0"')
+
+        packed = compress(content)
+        gzip_offset, gzip_length = 0, 0
+        if len(packed) < len(text):
+            gzip_offset, gzip_length = offset, len(packed)
+            offset += len(packed)
+            pieces.append(render_octal_string(packed))
+
+        for url in urls:
+            rows.append(
+                (url, mime, text_offset, len(text), gzip_offset, gzip_length,
+                 content_hash(content))
+            )
+
+    rows.sort(key=lambda row: row[0].encode("utf-8"))
+    for previous, row in zip(rows, rows[1:]):
+        if previous[0] == row[0]:
+            raise ValueError(f"Asset URL {row[0]} is bundled twice")
+
+    index_lines = [
+        f'    {{"{url}", "{mime}", {text_offset}, {length}, {gzip_offset}, '
+        f'{gzip_length}, "{digest}"}},'
+        for url, mime, text_offset, length, gzip_offset, gzip_length, digest
+        in rows
+    ]
+    return (
+        f"{AUTOGEN_BANNER}\n"
+        f"#ifndef {BUNDLE_GUARD}\n"
+        f"#define {BUNDLE_GUARD}\n\n"
+        f"#include <Arduino.h>\n"
+        f'#include "platform/asset_bundle.h"\n\n'
+        "const char ASSET_BUNDLE_DATA[] PROGMEM =\n"
+        + "\n".join(pieces)
+        + ";\n\n"
+        "// Sorted by path\n"
+        "const AssetBundleEntry ASSET_BUNDLE_INDEX[] = {\n"
+        + "\n".join(index_lines)
+        + "\n};\n\n"
+        "const AssetBundle ASSET_BUNDLE = {\n"
+        "    ASSET_BUNDLE_DATA, ASSET_BUNDLE_INDEX,\n"
+        "    sizeof(ASSET_BUNDLE_INDEX) / sizeof(ASSET_BUNDLE_INDEX[0])};\n\n"
+        f"#endif // {BUNDLE_GUARD}\n"
+    )
+
+
+def write_if_changed(filename, content, source):
+    path = os.path.join(ASSETS_DIR, filename)
+    existing = None
+    if os.path.isfile(path):
+        with open(path, "r", encoding="utf-8") as f:
+            existing = f.read()
+
+    if existing != content:
+        with open(path, "w", encoding="utf-8", newline="\n") as f:
+            f.write(content)
+        print(f"[generate_web_assets] Wrote {filename} (from {source})")
+
+
 def generate():
     if not os.path.isdir(SRC_DIR):
         return  # nothing to do - this project has no assets/src yet
 
     manifest = load_manifest()
     generated_headers = set()
+    bundled = []
 
     for entry in sorted(os.listdir(SRC_DIR)):
         src_path = os.path.join(SRC_DIR, entry)
@@ -112,23 +522,37 @@ def generate():
 
         names = default_names(entry)
         names.update(manifest.get(entry, {}))
-        generated_headers.add(names["header"])
 
         with open(src_path, "r", encoding="utf-8") as f:
-            content = f.read().rstrip("\n")
+            source = f.read().rstrip("\n")
+
+        content = minify(source, ext) if names.get("minify", True) else source
+        urls = bundle_urls(names)
+        # The text array holds content plus the newline R"( adds on each side
+        packed = compress(content if urls else f"\n{content}\n")
+        print(
+            f"[generate_web_assets] {entry}: {len(source.encode('utf-8'))} -> "
+            f"{len(content.encode('utf-8'))} bytes ({len(packed)} gzipped)"
+        )
 
-        header_content = render_header(names["guard"], names["var"], content)
-        header_path = os.path.join(ASSETS_DIR, names["header"])
+        if urls:
+            mime = names.get("mime", MIME_TYPES[ext])
+            bundled.append((entry, urls, mime, content))
+            continue
 
-        existing = None
-        if os.path.isfile(header_path):
-            with open(header_path, "r", encoding="utf-8") as f:
-                existing = f.read()
+        generated_headers.add(names["header"])
+        header_content = render_header(
+            names["guard"], names["var"], content, packed
+        )
+        write_if_changed(names["header"], header_content, entry)
 
-        if existing != header_content:
-            with open(header_path, "w", encoding="utf-8", newline="\n") as f:
-                f.write(header_content)
-            print(f"[generate_web_assets] Wrote {names['header']} (from {entry})")
+    if bundled:
+        generated_headers.add(BUNDLE_HEADER)
+        write_if_changed(
+            BUNDLE_HEADER,
+            render_bundle(bundled),
+            ", ".join(entry for entry, _, _, _ in bundled),
+        )
 
     # Flag generated .h files under assets/ that no longer have a matching
     # source/manifest entry - likely a rename that needs cleanup, but we
@@ -0,0 +1,59 @@
+#include "core/checksum.h"
+
+namespace WebPlatform {
+namespace Core {
+
+uint32_t Checksum::crc32(const uint8_t *data, size_t length, uint32_t seed) {
+  // Bitwise variant - no 1 KB lookup table in RAM/flash. Records are small
+  // and written rarely, so table-driven speed isn't worth the footprint.
+  uint32_t crc = ~seed;
+  for (size_t i = 0; i < length; ++i) {
+    crc ^= data[i];
+    for (int bit = 0; bit < 8; ++bit) {
+      crc = (crc >> 1) ^ (0xEDB88320u & (0u - (crc & 1u)));
+    }
+  }
+  return ~crc;
+}
+
+uint32_t Checksum::crc32(const std::string &data) {
+  return crc32(reinterpret_cast<const uint8_t *>(data.data()), data.size());
+}
+
+std::string Checksum::toHex(uint32_t crc) {
+  static const char digits[] = "0123456789abcdef";
+  std::string hex(8, '0');
+  for (int i = 7; i >= 0; --i) {
+    hex[i] = digits[crc & 0xF];
+    crc >>= 4;
+  }
+  return hex;
+}
+
+bool Checksum::fromHex(const char *hex, uint32_t &out) {
+  if (!hex) {
+    return false;
+  }
+
+  uint32_t value = 0;
+  for (int i = 0; i < 8; ++i) {
+    char c = hex[i];
+    uint32_t nibble;
+    if (c >= '0' && c <= '9') {
+      nibble = c - '0';
+    } else if (c >= 'a' && c <= 'f') {
+      nibble = c - 'a' + 10;
+    } else if (c >= 'A' && c <= 'F') {
+      nibble = c - 'A' + 10;
+    } else {
+      return false;
+    }
+    value = (value << 4) | nibble;
+  }
+
+  out = value;
+  return true;
+}
+
+} // namespace Core
+} // namespace WebPlatform
@@ -0,0 +1,640 @@
+#include "core/gzip.h"
+#include "core/checksum.h"
+#include <algorithm>
+#include <cstring>
+#include <memory>
+#include <vector>
+
+namespace WebPlatform {
+namespace Core {
+
+namespace {
+const uint8_t MAGIC_0 = 0x1f;
+const uint8_t MAGIC_1 = 0x8b;
+const uint8_t METHOD_DEFLATE = 8;
+const uint8_t OS_UNKNOWN = 0xff;
+
+const uint8_t FLAG_HCRC = 0x02;
+const uint8_t FLAG_EXTRA = 0x04;
+const uint8_t FLAG_NAME = 0x08;
+const uint8_t FLAG_COMMENT = 0x10;
+const uint8_t FLAG_RESERVED = 0xe0;
+
+// RFC 1951 section 3.2.5
+const uint16_t LENGTH_BASE[29] = {3,  4,  5,  6,   7,   8,   9,   10,  11, 13,
+                                  15, 17, 19, 23,  27,  31,  35,  43,  51, 59,
+                                  67, 83, 99, 115, 131, 163, 195, 227, 258};
+const uint8_t LENGTH_EXTRA[29] = {0, 0, 0, 0, 0, 0, 0, 0, 1, 1,
+                                  1, 1, 2, 2, 2, 2, 3, 3, 3, 3,
+                                  4, 4, 4, 4, 5, 5, 5, 5, 0};
+const uint16_t DIST_BASE[30] = {
+    1,    2,    3,    4,    5,    7,     9,     13,    17,  25,
+    33,   49,   65,   97,   129,  193,   257,   385,   513, 769,
+    1025, 1537, 2049, 3073, 4097, 6145,  8193,  12289, 16385, 24577};
+const uint8_t DIST_EXTRA[30] = {0, 0, 0, 0, 1, 1, 2,  2,  3,  3,
+                                4, 4, 5, 5, 6, 6, 7,  7,  8,  8,
+                                9, 9, 10, 10, 11, 11, 12, 12, 13, 13};
+const uint8_t CODE_LENGTH_ORDER[19] = {16, 17, 18, 0, 8,  7, 9,  6, 10, 5,
+                                       11, 4,  12, 3, 13, 2, 14, 1, 15};
+
+const size_t WINDOW_SIZE = 32768;
+const size_t MIN_MATCH = 3;
+const size_t MAX_MATCH = 258;
+const size_t MAX_STORED_BLOCK = 65535;
+const size_t END_OF_BLOCK = 256;
+
+// 2K heads = 8 KB while compressing. No chains: each position only tries
+// the most recent earlier occurrence of its 3-byte prefix.
+const unsigned HASH_BITS = 11;
+const size_t HASH_SIZE = 1u << HASH_BITS;
+
+const size_t MAX_CODE_BITS = 15;
+const size_t MAX_LITERAL_CODES = 288;
+const size_t MAX_DISTANCE_CODES = 30;
+
+void putLE32(std::string &out, uint32_t value) {
+  for (int i = 0; i < 4; i++) {
+    out.push_back(static_cast<char>((value >> (8 * i)) & 0xff));
+  }
+}
+
+uint32_t getLE32(const uint8_t *data) {
+  return static_cast<uint32_t>(data[0]) |
+         (static_cast<uint32_t>(data[1]) << 8) |
+         (static_cast<uint32_t>(data[2]) << 16) |
+         (static_cast<uint32_t>(data[3]) << 24);
+}
+
+uint32_t hashPrefix(const uint8_t *data) {
+  uint32_t prefix = (static_cast<uint32_t>(data[0]) << 16) |
+                    (static_cast<uint32_t>(data[1]) << 8) | data[2];
+  return (prefix * 2654435761u) >> (32 - HASH_BITS);
+}
+
+// Deflate packs data elements LSB-first, but Huffman codes MSB-first
+class BitWriter {
+public:
+  explicit BitWriter(std::string &out) : out(out), buffer(0), count(0) {}
+
+  void write(uint32_t value, unsigned bits) {
+    buffer |= value << count;
+    count += bits;
+    while (count >= 8) {
+      out.push_back(static_cast<char>(buffer & 0xff));
+      buffer >>= 8;
+      count -= 8;
+    }
+  }
+
+  void writeCode(uint32_t code, unsigned bits) {
+    uint32_t reversed = 0;
+    for (unsigned i = 0; i < bits; i++) {
+      reversed = (reversed << 1) | ((code >> i) & 1);
+    }
+    write(reversed, bits);
+  }
+
+  void flush() {
+    if (count > 0) {
+      out.push_back(static_cast<char>(buffer & 0xff));
+      buffer = 0;
+      count = 0;
+    }
+  }
+
+private:
+  std::string &out;
+  uint32_t buffer;
+  unsigned count;
+};
+
+void writeLiteral(BitWriter &writer, unsigned symbol) {
+  // Fixed literal/length code (RFC 1951 section 3.2.6)
+  if (symbol < 144) {
+    writer.writeCode(0x30 + symbol, 8);
+  } else if (symbol < 256) {
+    writer.writeCode(0x190 + symbol - 144, 9);
+  } else if (symbol < 280) {
+    writer.writeCode(symbol - 256, 7);
+  } else {
+    writer.writeCode(0xc0 + symbol - 280, 8);
+  }
+}
+
+void writeMatch(BitWriter &writer, size_t length, size_t distance) {
+  unsigned code = 0;
+  while (code < 28 && LENGTH_BASE[code + 1] <= length) {
+    code++;
+  }
+  writeLiteral(writer, 257 + code);
+  writer.write(length - LENGTH_BASE[code], LENGTH_EXTRA[code]);
+
+  unsigned distCode = 0;
+  while (distCode < 29 && DIST_BASE[distCode + 1] <= distance) {
+    distCode++;
+  }
+  writer.writeCode(distCode, 5);
+  writer.write(distance - DIST_BASE[distCode], DIST_EXTRA[distCode]);
+}
+
+void deflateFixed(const uint8_t *data, size_t length, std::string &out) {
+  BitWriter writer(out);
+  writer.write(1, 1); // BFINAL
+  writer.write(1, 2); // BTYPE = fixed Huffman
+
+  std::vector<int32_t> head(HASH_SIZE, -1);
+  size_t pos = 0;
+  while (pos < length) {
+    size_t matchLength = 0;
+    size_t matchDistance = 0;
+    if (pos + MIN_MATCH <= length) {
+      uint32_t hash = hashPrefix(data + pos);
+      int32_t candidate = head[hash];
+      head[hash] = static_cast<int32_t>(pos);
+      if (candidate >= 0 && pos - candidate <= WINDOW_SIZE) {
+        size_t limit = std::min(MAX_MATCH, length - pos);
+        size_t n = 0;
+        while (n < limit && data[candidate + n] == data[pos + n]) {
+          n++;
+        }
+        if (n >= MIN_MATCH) {
+          matchLength = n;
+          matchDistance = pos - candidate;
+        }
+      }
+    }
+
+    if (matchLength > 0) {
+      writeMatch(writer, matchLength, matchDistance);
+      // Index the positions inside the match so later repeats can find them
+      for (size_t i = pos + 1; i < pos + matchLength && i + MIN_MATCH <= length;
+           i++) {
+        head[hashPrefix(data + i)] = static_cast<int32_t>(i);
+      }
+      pos += matchLength;
+    } else {
+      writeLiteral(writer, data[pos]);
+      pos++;
+    }
+  }
+
+  writeLiteral(writer, END_OF_BLOCK);
+  writer.flush();
+}
+
+void deflateStored(const uint8_t *data, size_t length, std::string &out) {
+  size_t pos = 0;
+  do {
+    size_t blockLength = std::min(MAX_STORED_BLOCK, length - pos);
+    bool final = pos + blockLength == length;
+    out.push_back(final ? 1 : 0); // BFINAL + BTYPE = stored, byte aligned
+    out.push_back(static_cast<char>(blockLength & 0xff));
+    out.push_back(static_cast<char>(blockLength >> 8));
+    out.push_back(static_cast<char>(~blockLength & 0xff));
+    out.push_back(static_cast<char>((~blockLength >> 8) & 0xff));
+    out.append(reinterpret_cast<const char *>(data + pos), blockLength);
+    pos += blockLength;
+  } while (pos < length);
+}
+
+struct Huffman {
+  uint16_t count[MAX_CODE_BITS + 1];
+  uint16_t symbol[MAX_LITERAL_CODES];
+};
+
+// Canonical Huffman decoding in the style of zlib's puff.c - compact tables
+// and bit-at-a-time decoding rather than zlib's large lookup tables.
+class Inflater {
+public:
+  Inflater(const Gzip::Source &source, std::string &out)
+      : source(source), out(out), start(out.size()), inputPos(0),
+        inputLength(0), bitBuffer(0), bitCount(0) {}
+
+  bool run() {
+    if (!readHeader()) {
+      return false;
+    }
+
+    uint32_t final = 0;
+    do {
+      uint32_t type = 0;
+      if (!bits(1, final) || !bits(2, type)) {
+        return false;
+      }
+      bool ok = false;
+      if (type == 0) {
+        ok = inflateStored();
+      } else if (type == 1) {
+        ok = inflateFixed();
+      } else if (type == 2) {
+        ok = inflateDynamic();
+      }
+      if (!ok) {
+        return false;
+      }
+    } while (!final);
+
+    return readTrailer();
+  }
+
+private:
+  const Gzip::Source &source;
+  std::string &out;
+  size_t start;
+
+  uint8_t input[256];
+  size_t inputPos;
+  size_t inputLength;
+  uint32_t bitBuffer;
+  unsigned bitCount;
+
+  Huffman literals;
+  Huffman distances;
+  uint8_t lengths[MAX_LITERAL_CODES + MAX_DISTANCE_CODES];
+
+  bool nextByte(uint8_t &value) {
+    if (inputPos == inputLength) {
+      inputLength = source(input, sizeof(input));
+      inputPos = 0;
+      if (inputLength == 0) {
+        return false; // Truncated
+      }
+    }
+    value = input[inputPos++];
+    return true;
+  }
+
+  bool bits(unsigned needed, uint32_t &value) {
+    while (bitCount < needed) {
+      uint8_t next = 0;
+      if (!nextByte(next)) {
+        return false;
+      }
+      bitBuffer |= static_cast<uint32_t>(next) << bitCount;
+      bitCount += 8;
+    }
+    value = bitBuffer & ((1u << needed) - 1);
+    bitBuffer >>= needed;
+    bitCount -= needed;
+    return true;
+  }
+
+  void alignToByte() {
+    // bits() never buffers a whole unread byte, so this only drops padding
+    bitBuffer = 0;
+    bitCount = 0;
+  }
+
+  bool skip(size_t count) {
+    uint8_t ignored = 0;
+    for (size_t i = 0; i < count; i++) {
+      if (!nextByte(ignored)) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  bool skipZeroTerminated() {
+    uint8_t value = 0;
+    do {
+      if (!nextByte(value)) {
+        return false;
+      }
+    } while (value != 0);
+    return true;
+  }
+
+  bool readHeader() {
+    uint8_t header[Gzip::HEADER_SIZE];
+    for (size_t i = 0; i < sizeof(header); i++) {
+      if (!nextByte(header[i])) {
+        return false;
+      }
+    }
+    if (!Gzip::isGzip(header, sizeof(header)) ||
+        header[2] != METHOD_DEFLATE || (header[3] & FLAG_RESERVED)) {
+      return false;
+    }
+
+    uint8_t flags = header[3];
+    if (flags & FLAG_EXTRA) {
+      uint8_t low = 0;
+      uint8_t high = 0;
+      if (!nextByte(low) || !nextByte(high) || !skip(low | (high << 8))) {
+        return false;
+      }
+    }
+    if ((flags & FLAG_NAME) && !skipZeroTerminated()) {
+      return false;
+    }
+    if ((flags & FLAG_COMMENT) && !skipZeroTerminated()) {
+      return false;
+    }
+    if ((flags & FLAG_HCRC) && !skip(2)) {
+      return false;
+    }
+    return true;
+  }
+
+  bool readTrailer() {
+    alignToByte();
+    uint8_t trailer[Gzip::TRAILER_SIZE];
+    for (size_t i = 0; i < sizeof(trailer); i++) {
+      if (!nextByte(trailer[i])) {
+        return false;
+      }
+    }
+
+    size_t length = out.size() - start;
+    uint32_t crc = Checksum::crc32(
+        reinterpret_cast<const uint8_t *>(out.data() + start), length);
+    return getLE32(trailer) == crc &&
+           Gzip::storedSize(trailer) == static_cast<uint32_t>(length);
+  }
+
+  static bool build(Huffman &table, const uint8_t *codeLengths, size_t n) {
+    memset(table.count, 0, sizeof(table.count));
+    for (size_t i = 0; i < n; i++) {
+      table.count[codeLengths[i]]++;
+    }
+
+    // Reject over-subscribed codes; incomplete ones are allowed (a block
+    // may use a single distance code)
+    int left = 1;
+    for (size_t len = 1; len <= MAX_CODE_BITS; len++) {
+      left <<= 1;
+      left -= table.count[len];
+      if (left < 0) {
+        return false;
+      }
+    }
+
+    uint16_t offsets[MAX_CODE_BITS + 1];
+    offsets[1] = 0;
+    for (size_t len = 1; len < MAX_CODE_BITS; len++) {
+      offsets[len + 1] = offsets[len] + table.count[len];
+    }
+    for (size_t symbol = 0; symbol < n; symbol++) {
+      if (codeLengths[symbol] != 0) {
+        table.symbol[offsets[codeLengths[symbol]]++] =
+            static_cast<uint16_t>(symbol);
+      }
+    }
+    return true;
+  }
+
+  bool decode(const Huffman &table, unsigned &symbol) {
+    int code = 0;
+    int first = 0;
+    int index = 0;
+    for (size_t len = 1; len <= MAX_CODE_BITS; len++) {
+      uint32_t bit = 0;
+      if (!bits(1, bit)) {
+        return false;
+      }
+      code |= static_cast<int>(bit);
+      int count = table.count[len];
+      if (code - count < first) {
+        symbol = table.symbol[index + (code - first)];
+        return true;
+      }
+      index += count;
+      first += count;
+      first <<= 1;
+      code <<= 1;
+    }
+    return false; // Ran past the longest code
+  }
+
+  bool inflateStored() {
+    alignToByte();
+    uint8_t header[4];
+    for (size_t i = 0; i < sizeof(header); i++) {
+      if (!nextByte(header[i])) {
+        return false;
+      }
+    }
+    size_t length = header[0] | (header[1] << 8);
+    size_t complement = header[2] | (header[3] << 8);
+    if (length != (~complement & 0xffff)) {
+      return false;
+    }
+
+    uint8_t value = 0;
+    for (size_t i = 0; i < length; i++) {
+      if (!nextByte(value)) {
+        return false;
+      }
+      out.push_back(static_cast<char>(value));
+    }
+    return true;
+  }
+
+  bool inflateCodes() {
+    for (;;) {
+      unsigned symbol = 0;
+      if (!decode(literals, symbol)) {
+        return false;
+      }
+      if (symbol < END_OF_BLOCK) {
+        out.push_back(static_cast<char>(symbol));
+        continue;
+      }
+      if (symbol == END_OF_BLOCK) {
+        return true;
+      }
+
+      symbol -= 257;
+      uint32_t extra = 0;
+      if (symbol >= 29 || !bits(LENGTH_EXTRA[symbol], extra)) {
+        return false;
+      }
+      size_t length = LENGTH_BASE[symbol] + extra;
+
+      unsigned distSymbol = 0;
+      if (!decode(distances, distSymbol) || distSymbol >= 30 ||
+          !bits(DIST_EXTRA[distSymbol], extra)) {
+        return false;
+      }
+      size_t distance = DIST_BASE[distSymbol] + extra;
+      if (distance > out.size() - start) {
+        return false; // Points before the start of the data
+      }
+
+      // The output doubles as the history window. Copy byte by byte -
+      // matches may overlap what they produce, and push_back may move
+      // the buffer.
+      size_t from = out.size() - distance;
+      for (size_t i = 0; i < length; i++) {
+        char value = out[from + i];
+        out.push_back(value);
+      }
+    }
+  }
+
+  bool inflateFixed() {
+    size_t symbol = 0;
+    for (; symbol < 144; symbol++) {
+      lengths[symbol] = 8;
+    }
+    for (; symbol < 256; symbol++) {
+      lengths[symbol] = 9;
+    }
+    for (; symbol < 280; symbol++) {
+      lengths[symbol] = 7;
+    }
+    for (; symbol < MAX_LITERAL_CODES; symbol++) {
+      lengths[symbol] = 8;
+    }
+    build(literals, lengths, MAX_LITERAL_CODES);
+
+    for (symbol = 0; symbol < MAX_DISTANCE_CODES; symbol++) {
+      lengths[symbol] = 5;
+    }
+    build(distances, lengths, MAX_DISTANCE_CODES);
+    return inflateCodes();
+  }
+
+  bool inflateDynamic() {
+    uint32_t literalCount = 0;
+    uint32_t distanceCount = 0;
+    uint32_t codeLengthCount = 0;
+    if (!bits(5, literalCount) || !bits(5, distanceCount) ||
+        !bits(4, codeLengthCount)) {
+      return false;
+    }
+    literalCount += 257;
+    distanceCount += 1;
+    codeLengthCount += 4;
+    if (literalCount > 286 || distanceCount > MAX_DISTANCE_CODES) {
+      return false;
+    }
+
+    // Code lengths for the code-length alphabet, decoded with `literals`
+    // as scratch before it's rebuilt for the block itself
+    memset(lengths, 0, 19);
+    for (size_t i = 0; i < codeLengthCount; i++) {
+      uint32_t length = 0;
+      if (!bits(3, length)) {
+        return false;
+      }
+      lengths[CODE_LENGTH_ORDER[i]] = static_cast<uint8_t>(length);
+    }
+    if (!build(literals, lengths, 19)) {
+      return false;
+    }
+
+    size_t total = literalCount + distanceCount;
+    size_t index = 0;
+    while (index < total) {
+      unsigned symbol = 0;
+      if (!decode(literals, symbol)) {
+        return false;
+      }
+      if (symbol < 16) {
+        lengths[index++] = static_cast<uint8_t>(symbol);
+        continue;
+      }
+
+      uint8_t repeated = 0;
+      uint32_t repeat = 0;
+      if (symbol == 16) {
+        if (index == 0 || !bits(2, repeat)) {
+          return false;
+        }
+        repeated = lengths[index - 1];
+        repeat += 3;
+      } else if (symbol == 17) {
+        if (!bits(3, repeat)) {
+          return false;
+        }
+        repeat += 3;
+      } else {
+        if (!bits(7, repeat)) {
+          return false;
+        }
+        repeat += 11;
+      }
+      if (index + repeat > total) {
+        return false;
+      }
+      while (repeat--) {
+        lengths[index++] = repeated;
+      }
+    }
+
+    if (lengths[END_OF_BLOCK] == 0 ||
+        !build(literals, lengths, literalCount) ||
+        !build(distances, lengths + literalCount, distanceCount)) {
+      return false;
+    }
+    return inflateCodes();
+  }
+};
+} // namespace
+
+bool Gzip::compress(const uint8_t *data, size_t length, std::string &out) {
+  if (static_cast<uint64_t>(length) > 0xffffffffu) {
+    return false;
+  }
+
+  const char header[HEADER_SIZE] = {
+      static_cast<char>(MAGIC_0), static_cast<char>(MAGIC_1),
+      METHOD_DEFLATE, 0, 0, 0, 0, 0, 0, static_cast<char>(OS_UNKNOWN)};
+  out.append(header, sizeof(header));
+
+  size_t bodyStart = out.size();
+  deflateFixed(data, length, out);
+
+  // Already-compressed or random input grows under the fixed code; store
+  // it instead (5 bytes per 64 KB block)
+  size_t storedLength = length + 5 * (length / MAX_STORED_BLOCK + 1);
+  if (out.size() - bodyStart > storedLength) {
+    out.resize(bodyStart);
+    deflateStored(data, length, out);
+  }
+
+  putLE32(out, Checksum::crc32(data, length));
+  putLE32(out, static_cast<uint32_t>(length));
+  return true;
+}
+
+bool Gzip::decompress(const Source &source, std::string &out) {
+  if (!source) {
+    return false;
+  }
+
+  // ~1.5 KB of tables - kept off the stack, since this runs inside web
+  // handlers with small task stacks
+  std::unique_ptr<Inflater> inflater(new Inflater(source, out));
+  size_t start = out.size();
+  if (!inflater->run()) {
+    out.resize(start);
+    return false;
+  }
+  return true;
+}
+
+bool Gzip::decompress(const uint8_t *data, size_t length, std::string &out) {
+  size_t pos = 0;
+  Source source = [&](uint8_t *buffer, size_t capacity) {
+    size_t count = std::min(capacity, length - pos);
+    memcpy(buffer, data + pos, count);
+    pos += count;
+    return count;
+  };
+  return decompress(source, out);
+}
+
+bool Gzip::isGzip(const uint8_t *data, size_t length) {
+  return data != nullptr && length >= 2 && data[0] == MAGIC_0 &&
+         data[1] == MAGIC_1;
+}
+
+uint32_t Gzip::storedSize(const uint8_t *trailer) {
+  return getLE32(trailer + 4);
+}
+
+} // namespace Core
+} // namespace WebPlatform
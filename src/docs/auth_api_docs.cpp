@@ -11,8 +11,32 @@ const std::vector<String> AuthApiDocs::TOKEN_MANAGEMENT_TAGS = {
 OpenAPIDocumentation AuthApiDocs::createListUsers() {
   return OpenAPIFactory::create(
              "List all users",
-             "Retrieves all user accounts. Admin privileges required.",
+             "Retrieves user accounts ordered by username. Admin privileges "
+             "required. Pass limit to page through results; nextCursor is "
+             "returned while more remain.",
              "listUsers", USER_MANAGEMENT_TAGS)
+      .withParameters(R"([
+        {
+          "name": "limit",
+          "in": "query",
+          "required": false,
+          "schema": {
+            "type": "integer",
+            "minimum": 1,
+            "maximum": 100,
+            "description": "Page size; omit to return every item"
+          }
+        },
+        {
+          "name": "cursor",
+          "in": "query",
+          "required": false,
+          "schema": {
+            "type": "string",
+            "description": "nextCursor from the previous page"
+          }
+        }
+      ])")
       .withResponseExample(R"({
         "success": true,
         "users": [
@@ -22,7 +46,8 @@ OpenAPIDocumentation AuthApiDocs::createListUsers() {
             "isAdmin": true,
             "createdAt": "2024-01-01T00:00:00Z"
           }
-        ]
+        ],
+        "nextCursor": "7361646d696e0a35353065..."
       })")
       .withResponseSchema(
           OpenAPIFactory::createSuccessResponse("List of user accounts"));
@@ -251,6 +276,26 @@ OpenAPIDocumentation AuthApiDocs::createGetUserTokens() {
             "format": "uuid",
             "description": "User UUID"
           }
+        },
+        {
+          "name": "limit",
+          "in": "query",
+          "required": false,
+          "schema": {
+            "type": "integer",
+            "minimum": 1,
+            "maximum": 100,
+            "description": "Page size; omit to return every item"
+          }
+        },
+        {
+          "name": "cursor",
+          "in": "query",
+          "required": false,
+          "schema": {
+            "type": "string",
+            "description": "nextCursor from the previous page"
+          }
         }
       ])")
       .withResponseExample(R"({
@@ -1,5 +1,4 @@
 #include "../../assets/account_page_html.h"
-#include "../../assets/account_page_js.h"
 #include "../../assets/login_page_error_html.h"
 #include "../../assets/login_page_html.h"
 #include "auth/auth_constants.h"
@@ -126,11 +125,6 @@ void WebPlatform::accountPageHandler(WebRequest &req, WebResponse &res) {
                     "; SameSite=Strict; HttpOnly");
 }
 
-void WebPlatform::accountPageJSAssetHandler(WebRequest &req, WebResponse &res) {
-  res.setProgmemContent(ACCOUNT_PAGE_JS, "application/javascript");
-  res.setHeader("Cache-Control", "public, max-age=3600");
-}
-
 void WebPlatform::deleteTokenApiHandler(WebRequest &req, WebResponse &res) {
 #ifdef NATIVE_PLATFORM
   // Simple JSON responses for native testing (no ArduinoJson dependency)
@@ -1,32 +1,101 @@
-#include "../../assets/favicon_ico.h"
-#include "../../assets/style_css.h"
-#include "../../assets/web_platform_styles_css.h"
-#include "../../assets/web_platform_utils_js.h"
-#include "../../assets/wifi_js.h"
+#include "../../assets/asset_bundle_data.h"
+#include "platform/asset_fingerprint.h"
+#include "platform/http_negotiation.h"
 #include "web_platform.h"
 
-void WebPlatform::webPlatformCSSAssetHandler(WebRequest &req,
-                                             WebResponse &res) {
-  res.setProgmemContent(WEB_PLATFORM_STYLES_CSS, "text/css");
-  res.setHeader("Cache-Control", "public, max-age=3600");
+namespace {
+// Plain URLs can be revalidated cheaply thanks to the ETag; fingerprinted
+// ones name exactly one content and never need to be
+const char PLAIN_CACHE_CONTROL[] = "public, max-age=3600";
+const char FINGERPRINTED_CACHE_CONTROL[] =
+    "public, max-age=31536000, immutable";
+} // namespace
+
+void WebPlatform::setEmbeddedAssetContent(WebRequest &req, WebResponse &res,
+                                          const EmbeddedAsset &asset,
+                                          const String &mimeType) {
+  bool gzip =
+      asset.gzip && asset.gzipLength > 0 &&
+      HttpNegotiation::acceptsGzip(req.getHeader("Accept-Encoding").c_str());
+
+  // Shared caches must keep the two encodings apart, and so must the
+  // validator - a strong ETag names one exact byte sequence
+  res.setHeader("Vary", "Accept-Encoding");
+  String etag = "\"" + String(asset.hash) + (gzip ? "-gz\"" : "\"");
+  res.setHeader("ETag", etag);
+
+  if (HttpNegotiation::etagMatches(req.getHeader("If-None-Match").c_str(),
+                                   etag.c_str())) {
+    res.setStatus(304);
+    res.setContent("", mimeType);
+  } else if (gzip) {
+    // Binary PROGMEM - Content-Length tells WebResponse how much to send
+    res.setProgmemContent(reinterpret_cast<const char *>(asset.gzip),
+                          mimeType);
+    res.setHeader("Content-Encoding", "gzip");
+    res.setHeader("Content-Length", String(asset.gzipLength));
+  } else {
+    res.setProgmemContent(asset.text, mimeType);
+  }
 }
 
-void WebPlatform::webPlatformJSAssetHandler(WebRequest &req, WebResponse &res) {
-  res.setProgmemContent(WEB_PLATFORM_UTILS_JS, "application/javascript");
-  res.setHeader("Cache-Control", "public, max-age=3600");
+void WebPlatform::addAssetBundle(const AssetBundle &bundle) {
+  moduleAssetBundles.push_back(bundle);
 }
 
-void WebPlatform::styleCSSAssetHandler(WebRequest &req, WebResponse &res) {
-  res.setProgmemContent(DEFAULT_STYLE_CSS, "text/css");
-  res.setHeader("Cache-Control", "public, max-age=3600");
+const AssetBundleEntry *
+WebPlatform::findAsset(const String &path, const AssetBundle **bundle) const {
+  const AssetBundleEntry *entry =
+      AssetBundles::find(ASSET_BUNDLE, path.c_str());
+  if (entry) {
+    *bundle = &ASSET_BUNDLE;
+    return entry;
+  }
+  for (const AssetBundle &moduleBundle : moduleAssetBundles) {
+    entry = AssetBundles::find(moduleBundle, path.c_str());
+    if (entry) {
+      *bundle = &moduleBundle;
+      return entry;
+    }
+  }
+  return nullptr;
 }
 
-void WebPlatform::webPlatformFaviconHandler(WebRequest &req, WebResponse &res) {
-  res.setProgmemContent(WEB_PLATFORM_FAVICON, "image/svg+xml");
-  res.setHeader("Cache-Control", "public, max-age=3600");
+String WebPlatform::assetUrl(const String &path) const {
+  const AssetBundle *bundle = nullptr;
+  const AssetBundleEntry *entry = findAsset(path, &bundle);
+  if (!entry) {
+    return path;
+  }
+  return String(
+      AssetFingerprint::fingerprint(path.c_str(), entry->hash).c_str());
 }
 
-void WebPlatform::wifiJSAssetHandler(WebRequest &req, WebResponse &res) {
-  res.setProgmemContent(WIFI_JS, "application/javascript");
-  res.setHeader("Cache-Control", "public, max-age=3600");
-}
\ No newline at end of file
+void WebPlatform::embeddedAssetHandler(WebRequest &req, WebResponse &res) {
+  String path = req.getPath();
+  const AssetBundle *bundle = nullptr;
+  const AssetBundleEntry *entry = findAsset(path, &bundle);
+
+  bool immutable = false;
+  std::string plainPath;
+  std::string hash;
+  if (!entry && AssetFingerprint::parse(path.c_str(),
+                                        EMBEDDED_ASSET_HASH_LENGTH,
+                                        plainPath, hash)) {
+    entry = findAsset(String(plainPath.c_str()), &bundle);
+    // A page cached from an older firmware can still ask for the old hash -
+    // give it today's content, but don't let that be cached as the old one
+    immutable = entry && hash == entry->hash;
+  }
+  if (!entry) {
+    res.setStatus(404);
+    res.setContent("Not Found", "text/plain");
+    return;
+  }
+
+  setEmbeddedAssetContent(req, res,
+                          AssetBundles::embeddedAsset(*bundle, *entry),
+                          entry->mimeType);
+  res.setHeader("Cache-Control",
+                immutable ? FINGERPRINTED_CACHE_CONTROL : PLAIN_CACHE_CONTROL);
+}
@@ -1,7 +1,5 @@
 #include "../../assets/connected_home_html.h"
-#include "../../assets/home_page_js.h"
 #include "../../assets/system_status_html.h"
-#include "../../assets/system_status_js.h"
 #include "../../assets/wifi_management_html.h"
 #include "storage/auth_storage.h"
 #include "web_platform.h"
@@ -11,17 +9,6 @@
 #include <WebServer.h>
 #endif
 
-void WebPlatform::systemStatusJSAssetHandler(WebRequest &req,
-                                             WebResponse &res) {
-  res.setProgmemContent(SYSTEM_STATUS_JS, "application/javascript");
-  res.setHeader("Cache-Control", "public, max-age=3600");
-}
-
-void WebPlatform::homePageJSAssetHandler(WebRequest &req, WebResponse &res) {
-  res.setProgmemContent(HOME_PAGE_JS, "application/javascript");
-  res.setHeader("Cache-Control", "public, max-age=3600");
-}
-
 void WebPlatform::rootPageHandler(WebRequest &req, WebResponse &res) {
   res.setProgmemContent(CONNECTED_HOME_HTML, "text/html");
 }
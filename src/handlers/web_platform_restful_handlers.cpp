@@ -26,6 +26,25 @@ bool requireSelfOrAdmin(const AuthUser &currentUser, const String &targetUserId,
   return true;
 }
 
+// Largest page a list endpoint hands out when ?limit= is given
+const size_t MAX_PAGE_SIZE = 100;
+
+// Reads ?limit= (0 = unpaged, clamped to MAX_PAGE_SIZE) and ?cursor=
+size_t readPaging(WebRequest &req, String &cursor) {
+  cursor = req.getParam("cursor");
+  long limit = req.getParam("limit").toInt();
+  if (limit <= 0) {
+    return 0;
+  }
+  return (size_t)limit > MAX_PAGE_SIZE ? MAX_PAGE_SIZE : (size_t)limit;
+}
+
+// Estimate for createDynamicResponse: sized by the page when paged,
+// otherwise left to the builder's default
+size_t estimatePageSize(size_t limit, size_t bytesPerItem) {
+  return limit > 0 ? 256 + limit * bytesPerItem : 8192;
+}
+
 } // namespace
 
 // RESTful API Handlers - User Management
@@ -37,24 +56,31 @@ void WebPlatform::getUsersApiHandler(WebRequest &req, WebResponse &res) {
   if (!requireAdmin(currentUser, res))
     return;
 
-  std::vector<AuthUser> users = AuthStorage::getAllUsers();
+  String cursor;
+  size_t limit = readPaging(req, cursor);
 
-  // Use JsonResponseBuilder with automatic sizing based on user count
-  size_t estimatedSize = 256 + (users.size() * 128);
+  // Users are written straight into the response as they are read, so only
+  // the current page is ever held in memory
   JsonResponseBuilder::createDynamicResponse(
       res,
       [&](JsonObject &root) {
         root["success"] = true;
         JsonArray usersArray = root["users"].to<JsonArray>();
 
-        for (const auto &user : users) {
-          JsonObject userObj = usersArray.add<JsonObject>();
-          userObj["id"] = user.id;
-          userObj["username"] = user.username;
-          userObj["createdAt"] = user.createdAt;
+        String nextCursor = AuthStorage::forEachUser(
+            [&](AuthUser &user) {
+              JsonObject userObj = usersArray.add<JsonObject>();
+              userObj["id"] = user.id;
+              userObj["username"] = user.username;
+              userObj["createdAt"] = user.createdAt;
+              return true;
+            },
+            limit, cursor);
+        if (nextCursor.length() > 0) {
+          root["nextCursor"] = nextCursor;
         }
       },
-      estimatedSize);
+      estimatePageSize(limit, 128));
 }
 
 void WebPlatform::createUserApiHandler(WebRequest &req, WebResponse &res) {
@@ -290,26 +316,32 @@ void WebPlatform::getUserTokensApiHandler(WebRequest &req, WebResponse &res) {
   if (!requireSelfOrAdmin(currentUser, userId, res))
     return;
 
-  std::vector<AuthApiToken> tokens = AuthStorage::getUserApiTokens(userId);
+  String cursor;
+  size_t limit = readPaging(req, cursor);
 
-  // Use JsonResponseBuilder with dynamic sizing based on token count
-  size_t estimatedSize = 256 + (tokens.size() * 256);
   JsonResponseBuilder::createDynamicResponse(
       res,
       [&](JsonObject &root) {
         root["success"] = true;
         JsonArray tokensArray = root["tokens"].to<JsonArray>();
 
-        for (const auto &token : tokens) {
-          JsonObject tokenObj = tokensArray.add<JsonObject>();
-          tokenObj["id"] = token.id;
-          tokenObj["token"] = token.token;
-          tokenObj["name"] = token.name;
-          tokenObj["createdAt"] = token.createdAt;
-          tokenObj["expiresAt"] = token.expiresAt;
+        String nextCursor = AuthStorage::forEachUserApiToken(
+            userId,
+            [&](AuthApiToken &token) {
+              JsonObject tokenObj = tokensArray.add<JsonObject>();
+              tokenObj["id"] = token.id;
+              tokenObj["token"] = token.token;
+              tokenObj["name"] = token.name;
+              tokenObj["createdAt"] = token.createdAt;
+              tokenObj["expiresAt"] = token.expiresAt;
+              return true;
+            },
+            limit, cursor);
+        if (nextCursor.length() > 0) {
+          root["nextCursor"] = nextCursor;
         }
       },
-      estimatedSize);
+      estimatePageSize(limit, 256));
 }
 
 void WebPlatform::createUserTokenApiHandler(WebRequest &req, WebResponse &res) {
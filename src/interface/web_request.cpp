@@ -1,4 +1,5 @@
 #include "models/data_models.h"
+#include "platform/request_headers.h"
 #include "storage/auth_storage.h"
 #include "utilities/debug_macros.h"
 #include <ArduinoJson.h>
@@ -20,6 +21,12 @@
 // COMMON_HTTP_HEADERS is now defined in
 // web_platform_interface/src/web_request_constants.cpp
 
+const char *const PLATFORM_HTTP_HEADERS[] = {"Accept-Encoding",
+                                             "If-None-Match", "Range",
+                                             "If-Range"};
+const size_t PLATFORM_HTTP_HEADERS_COUNT =
+    sizeof(PLATFORM_HTTP_HEADERS) / sizeof(PLATFORM_HTTP_HEADERS[0]);
+
 // Constructor for Arduino WebServer
 WebRequest::WebRequest(WebServerClass *server) {
   if (!server)
@@ -40,6 +47,10 @@ WebRequest::WebRequest(WebServerClass *server) {
   for (size_t i = 0; i < COMMON_HTTP_HEADERS_COUNT; i++) {
     headers[COMMON_HTTP_HEADERS[i]] = server->header(COMMON_HTTP_HEADERS[i]);
   }
+  for (size_t i = 0; i < PLATFORM_HTTP_HEADERS_COUNT; i++) {
+    headers[PLATFORM_HTTP_HEADERS[i]] =
+        server->header(PLATFORM_HTTP_HEADERS[i]);
+  }
 
   // Get request body for POST, PUT, PATCH requests
   if (server->method() == HTTP_POST || server->method() == HTTP_PUT ||
@@ -82,8 +93,12 @@ WebRequest::WebRequest(httpd_req *req) {
     delete[] query;
   }
 
-  for (size_t i = 0; i < COMMON_HTTP_HEADERS_COUNT; i++) {
-    const char *headerName = COMMON_HTTP_HEADERS[i];
+  size_t headerCount = COMMON_HTTP_HEADERS_COUNT + PLATFORM_HTTP_HEADERS_COUNT;
+  for (size_t i = 0; i < headerCount; i++) {
+    const char *headerName =
+        i < COMMON_HTTP_HEADERS_COUNT
+            ? COMMON_HTTP_HEADERS[i]
+            : PLATFORM_HTTP_HEADERS[i - COMMON_HTTP_HEADERS_COUNT];
     size_t headerLen = httpd_req_get_hdr_value_len(req, headerName);
     if (headerLen > 0) {
       char *headerValue = new char[headerLen + 1];
@@ -1,3 +1,5 @@
+#include "platform/http_negotiation.h"
+#include "platform/response_body.h"
 #include "storage/storage_manager.h"
 #include "utilities/debug_macros.h"
 #include "web_platform.h"
@@ -9,6 +11,120 @@
 // Forward declare WebServerClass - the actual implementation is in
 // web_platform.h
 
+namespace {
+bool acceptsGzip(const String &acceptEncoding) {
+  return HttpNegotiation::acceptsGzip(acceptEncoding.c_str());
+}
+
+// A handler sets Content-Length on PROGMEM content that isn't a C string
+// (e.g. a gzip asset), which strlen_P can't measure
+size_t progmemLength(const char *data, const std::string &contentLength) {
+  if (!contentLength.empty()) {
+    return strtoul(contentLength.c_str(), nullptr, 10);
+  }
+  return strlen_P(data);
+}
+
+String getRequestHeader(httpd_req *req, const char *name) {
+  char value[128];
+  size_t length = httpd_req_get_hdr_value_len(req, name);
+  if (length == 0 || length >= sizeof(value) ||
+      httpd_req_get_hdr_value_str(req, name, value, sizeof(value)) != ESP_OK) {
+    return String();
+  }
+  return String(value);
+}
+
+String getAcceptEncoding(httpd_req *req) {
+  return getRequestHeader(req, "Accept-Encoding");
+}
+
+// The bytes of a totalLength-byte body a request's Range header asks for.
+// Only a 200 response is cut down - errors and redirects go out whole.
+struct ByteRange {
+  HttpNegotiation::RangeResult result;
+  size_t first;
+  size_t last;
+
+  size_t length() const { return last - first + 1; }
+};
+
+ByteRange requestedRange(int status, const String &range,
+                         const String &ifRange, const std::string &etag,
+                         size_t totalLength) {
+  ByteRange requested = {HttpNegotiation::RangeResult::Full, 0,
+                         totalLength > 0 ? totalLength - 1 : 0};
+  if (status != 200 || range.isEmpty() ||
+      !HttpNegotiation::ifRangeMatches(ifRange.c_str(), etag)) {
+    return requested;
+  }
+  requested.result = HttpNegotiation::parseRange(
+      range.c_str(), totalLength, requested.first, requested.last);
+  if (requested.result == HttpNegotiation::RangeResult::Full) {
+    requested.first = 0;
+    requested.last = totalLength > 0 ? totalLength - 1 : 0;
+  }
+  return requested;
+}
+
+// Content-Range value for a 206 ("bytes 0-99/1000") or 416 ("bytes */1000")
+String contentRange(const ByteRange &range, size_t totalLength) {
+  char value[64];
+  if (range.result == HttpNegotiation::RangeResult::Partial) {
+    snprintf(value, sizeof(value), "bytes %u-%u/%u", (unsigned)range.first,
+             (unsigned)range.last, (unsigned)totalLength);
+  } else {
+    snprintf(value, sizeof(value), "bytes */%u", (unsigned)totalLength);
+  }
+  return String(value);
+}
+
+// Fixed chunk buffer for produced bodies - the only memory a templated
+// page costs while it is sent
+const size_t PRODUCED_CHUNK_SIZE = 512;
+
+// Fixed buffer JSON bodies are serialized through
+const size_t JSON_CHUNK_SIZE = 512;
+
+void sendProduced(const ResponseBody::Producer &producer,
+                  WebServerClass *server, int status, const String &mimeType) {
+  server->setContentLength(CONTENT_LENGTH_UNKNOWN); // Enable chunked encoding
+  server->send(status, mimeType, "");
+
+  char buffer[PRODUCED_CHUNK_SIZE];
+  ResponseBody::ChunkWriter writer(
+      buffer, sizeof(buffer), [server](const char *data, size_t length) {
+        server->sendContent(data, length);
+        return true;
+      });
+  producer([&writer](const char *data, size_t length) {
+    writer.write(data, length);
+  });
+  writer.flush();
+}
+
+esp_err_t sendProduced(const ResponseBody::Producer &producer,
+                       httpd_req *req) {
+  esp_err_t ret = ESP_OK;
+  char buffer[PRODUCED_CHUNK_SIZE];
+  ResponseBody::ChunkWriter writer(
+      buffer, sizeof(buffer), [req, &ret](const char *data, size_t length) {
+        ret = httpd_resp_send_chunk(req, data, length);
+        return ret == ESP_OK;
+      });
+  producer([&writer](const char *data, size_t length) {
+    writer.write(data, length);
+  });
+
+  if (!writer.flush()) {
+    ERROR_PRINTLN("WebResponse: Produced body streaming failed");
+    return ret;
+  }
+  // End chunked transfer
+  return httpd_resp_send_chunk(req, NULL, 0);
+}
+} // namespace
+
 WebResponse::WebResponse() : core(), jsonDoc(nullptr), isJsonContent(false) {}
 
 void WebResponse::setStatus(int code) {
@@ -85,16 +201,24 @@ void WebResponse::sendTo(WebServerClass *server) {
   if (!server || core.isResponseSent())
     return;
 
-  // Send all custom headers from core
+  // Send all custom headers from core. Content-Length is left to the body
+  // writers below, which always set it themselves.
   for (const auto &header : core.getHeaders()) {
+    if (header.first == "Content-Length")
+      continue;
     server->sendHeader(String(header.first.c_str()),
                        String(header.second.c_str()));
   }
 
   markHeadersSent();
 
-  // Send response - use streaming for PROGMEM, JSON, or storage content
-  if (core.hasProgmemContent()) {
+  // Send response - use streaming for produced, PROGMEM, JSON, or storage
+  // content
+  ResponseBody::Producer producer = ResponseBody::find(*this);
+  if (producer) {
+    sendProduced(producer, server, core.getStatus(),
+                 String(core.getMimeType().c_str()));
+  } else if (core.hasProgmemContent()) {
     sendProgmemChunked(core.getProgmemData(), server);
   } else if (isJsonContent && jsonDoc != nullptr) {
     streamJsonContent(*jsonDoc, server);
@@ -123,17 +247,24 @@ esp_err_t WebResponse::sendTo(httpd_req *req) {
   // Set content type
   httpd_resp_set_type(req, core.getMimeType().c_str());
 
-  // Set custom headers from core
+  // Set custom headers from core. Content-Length is left to the body
+  // writers below - a chunked response must not carry one.
   for (const auto &header : core.getHeaders()) {
+    if (header.first == "Content-Length")
+      continue;
     httpd_resp_set_hdr(req, header.first.c_str(), header.second.c_str());
   }
 
   // Mark headers as sent
   markHeadersSent();
 
-  // Send response body - use streaming for PROGMEM, JSON, or storage content
+  // Send response body - use streaming for produced, PROGMEM, JSON, or
+  // storage content
   esp_err_t ret;
-  if (core.hasProgmemContent()) {
+  ResponseBody::Producer producer = ResponseBody::find(*this);
+  if (producer) {
+    ret = sendProduced(producer, req);
+  } else if (core.hasProgmemContent()) {
     ret = sendProgmemChunked(core.getProgmemData(), req);
   } else if (isJsonContent && jsonDoc != nullptr) {
     ret = streamJsonContent(*jsonDoc, req);
@@ -155,77 +286,51 @@ esp_err_t WebResponse::sendTo(httpd_req *req) {
 
 void WebResponse::streamJsonContent(const JsonDocument &doc,
                                     WebServerClass *server) {
-  // Create a wrapper that implements Print interface
-  class ServerPrint : public Print {
-    WebServerClass *server;
-    String buffer;
-
-  public:
-    ServerPrint(WebServerClass *s) : server(s) {
-      buffer.reserve(512); // Small buffer for chunking
-    }
-
-    size_t write(uint8_t c) override {
-      buffer += (char)c;
-      if (buffer.length() >= 500) { // Flush when buffer gets full
-        flush();
-      }
-      return 1;
-    }
-
-    void flush() {
-      if (buffer.length() > 0) {
-        // Send chunk (you'd need chunked transfer encoding)
-        server->sendContent(buffer);
-        buffer = "";
-      }
-    }
-  };
-
-  ServerPrint printer(server);
-  server->setContentLength(CONTENT_LENGTH_UNKNOWN); // Enable chunked encoding
+  // Measured up front so the body goes out with a Content-Length instead of
+  // chunk framing
+  server->setContentLength(measureJson(doc));
   server->send(core.getStatus(), String(core.getMimeType().c_str()), "");
 
-  serializeJson(doc, printer); // Streams directly!
-  printer.flush();
+  char buffer[JSON_CHUNK_SIZE];
+  ResponseBody::ChunkWriter writer(
+      buffer, sizeof(buffer), [server](const char *data, size_t length) {
+        server->sendContent(data, length);
+        return true;
+      });
+  ResponseBody::ChunkPrint printer(writer);
+  serializeJson(doc, printer);
+  writer.flush();
 }
 
 esp_err_t WebResponse::streamJsonContent(const JsonDocument &doc,
                                          httpd_req *req) {
-  class HttpdPrint : public Print {
-    httpd_req *req;
-    char buffer[512];
-    size_t pos = 0;
-
-  public:
-    HttpdPrint(httpd_req *r) : req(r) {}
-
-    size_t write(uint8_t c) override {
-      buffer[pos++] = c;
-      if (pos >= sizeof(buffer) - 1) {
-        flush();
-      }
-      return 1;
-    }
-
-    void flush() {
-      if (pos > 0) {
-        httpd_resp_send_chunk(req, buffer, pos);
-        pos = 0;
-      }
-    }
-  };
-
-  // Set chunked encoding
-  httpd_resp_set_type(req, core.getMimeType().c_str());
-  httpd_resp_set_status(req, std::to_string(core.getStatus()).c_str());
-
-  HttpdPrint printer(req);
-  serializeJson(doc, printer); // Streams directly!
-  printer.flush();
+  // Status and content type were set by sendTo
+  char buffer[JSON_CHUNK_SIZE];
+  size_t length = measureJson(doc);
+
+  // A document that fits the buffer goes out in one send with a
+  // Content-Length. httpd only streams a body of unknown size as chunks, so
+  // larger ones still do, written through the buffer in full-size pieces.
+  if (length < sizeof(buffer)) {
+    serializeJson(doc, buffer, sizeof(buffer));
+    return httpd_resp_send(req, buffer, length);
+  }
 
-  // End chunked response
-  return httpd_resp_send_chunk(req, nullptr, 0);
+  esp_err_t ret = ESP_OK;
+  ResponseBody::ChunkWriter writer(
+      buffer, sizeof(buffer), [req, &ret](const char *data, size_t size) {
+        ret = httpd_resp_send_chunk(req, data, size);
+        return ret == ESP_OK;
+      });
+  ResponseBody::ChunkPrint printer(writer);
+  serializeJson(doc, printer);
+
+  if (!writer.flush()) {
+    ERROR_PRINTLN("WebResponse: JSON streaming failed");
+    return ret;
+  }
+  // End chunked transfer
+  return httpd_resp_send_chunk(req, NULL, 0);
 }
 
 // PROGMEM streaming implementation for Arduino WebServer
@@ -233,7 +338,7 @@ void WebResponse::sendProgmemChunked(const char *data, WebServerClass *server) {
   if (!data || !server)
     return;
 
-  size_t len = strlen_P(data);
+  size_t len = progmemLength(data, core.getHeader("Content-Length"));
   const size_t CHUNK_SIZE = 512;
 
   DEBUG_PRINTLN("PROGMEM content length: " + String(len));
@@ -243,9 +348,24 @@ void WebResponse::sendProgmemChunked(const char *data, WebServerClass *server) {
     return;
   }
 
+  ByteRange range =
+      requestedRange(core.getStatus(), server->header("Range"),
+                     server->header("If-Range"), core.getHeader("ETag"), len);
+  server->sendHeader("Accept-Ranges", "bytes");
+  if (range.result == HttpNegotiation::RangeResult::Unsatisfiable) {
+    server->sendHeader("Content-Range", contentRange(range, len));
+    server->send(416, String(core.getMimeType().c_str()), "");
+    return;
+  }
+  int status = core.getStatus();
+  if (range.result == HttpNegotiation::RangeResult::Partial) {
+    server->sendHeader("Content-Range", contentRange(range, len));
+    status = 206;
+  }
+
   // Pre-calculate content length and send it directly instead of chunked
-  server->setContentLength(len);
-  server->send(core.getStatus(), String(core.getMimeType().c_str()), "");
+  server->setContentLength(range.length());
+  server->send(status, String(core.getMimeType().c_str()), "");
 
   // Allocate buffer once and reuse
   char *buffer = (char *)malloc(CHUNK_SIZE + 1);
@@ -255,14 +375,14 @@ void WebResponse::sendProgmemChunked(const char *data, WebServerClass *server) {
   }
 
   // Send data in chunks with explicit buffer management
-  for (size_t i = 0; i < len; i += CHUNK_SIZE) {
-    size_t chunk_len = min(CHUNK_SIZE, len - i);
+  size_t end = range.last + 1;
+  for (size_t i = range.first; i < end; i += CHUNK_SIZE) {
+    size_t chunk_len = min(CHUNK_SIZE, end - i);
     memcpy_P(buffer, data + i, chunk_len);
-    buffer[chunk_len] = 0;
-    server->sendContent(buffer);
+    server->sendContent(buffer, chunk_len);
 
     // Yield to prevent watchdog timeout on large files
-    if (i % (CHUNK_SIZE * 10) == 0) {
+    if ((i - range.first) % (CHUNK_SIZE * 10) == 0) {
       yield();
     }
   }
@@ -278,9 +398,25 @@ esp_err_t WebResponse::sendProgmemChunked(const char *data, httpd_req *req) {
   if (!data || !req)
     return ESP_FAIL;
 
-  size_t len = strlen_P(data);
+  size_t len = progmemLength(data, core.getHeader("Content-Length"));
   const size_t CHUNK_SIZE = 512;
 
+  // httpd keeps header pointers until the response goes out
+  ByteRange range = requestedRange(
+      core.getStatus(), getRequestHeader(req, "Range"),
+      getRequestHeader(req, "If-Range"), core.getHeader("ETag"), len);
+  String contentRangeValue = contentRange(range, len);
+  httpd_resp_set_hdr(req, "Accept-Ranges", "bytes");
+  if (range.result == HttpNegotiation::RangeResult::Unsatisfiable) {
+    httpd_resp_set_status(req, "416 Range Not Satisfiable");
+    httpd_resp_set_hdr(req, "Content-Range", contentRangeValue.c_str());
+    return httpd_resp_send(req, nullptr, 0);
+  }
+  if (range.result == HttpNegotiation::RangeResult::Partial) {
+    httpd_resp_set_status(req, "206 Partial Content");
+    httpd_resp_set_hdr(req, "Content-Range", contentRangeValue.c_str());
+  }
+
   // Allocate buffer once and reuse
   char *buffer = (char *)malloc(CHUNK_SIZE + 1);
   if (!buffer) {
@@ -291,15 +427,16 @@ esp_err_t WebResponse::sendProgmemChunked(const char *data, httpd_req *req) {
 
   // Send data in chunks with explicit buffer management
   esp_err_t ret = ESP_OK;
-  for (size_t i = 0; i < len && ret == ESP_OK; i += CHUNK_SIZE) {
-    size_t chunk_len = min(CHUNK_SIZE, len - i);
+  size_t end = len > 0 ? range.last + 1 : 0;
+  for (size_t i = range.first; i < end && ret == ESP_OK; i += CHUNK_SIZE) {
+    size_t chunk_len = min(CHUNK_SIZE, end - i);
     memcpy_P(buffer, data + i, chunk_len);
     buffer[chunk_len] = 0;
 
     ret = httpd_resp_send_chunk(req, buffer, chunk_len);
 
     // Yield periodically to prevent watchdog timeout
-    if (i % (CHUNK_SIZE * 10) == 0) {
+    if ((i - range.first) % (CHUNK_SIZE * 10) == 0) {
       yield();
     }
   }
@@ -344,6 +481,57 @@ void WebResponse::streamFromStorage(const String &collection, const String &key,
     return;
   }
 
+  // Records stored gzip-compressed go out exactly as stored - never
+  // inflated on the device - to any client that accepts gzip
+  // A Range request is answered from the record as retrieve() returns it,
+  // so a download can resume part-way whatever the encoding on flash
+  String rangeHeader = server->header("Range");
+  size_t gzipSize = driver->compressedSize(collection, key);
+  if (gzipSize > 0) {
+    server->sendHeader("Vary", "Accept-Encoding");
+  }
+  if (gzipSize > 0 && rangeHeader.isEmpty() &&
+      acceptsGzip(server->header("Accept-Encoding"))) {
+    server->sendHeader("Content-Encoding", "gzip");
+    server->setContentLength(gzipSize);
+    server->send(core.getStatus(), String(core.getMimeType().c_str()), "");
+    driver->streamCompressed(
+        collection, key, [server](const uint8_t *data, size_t length) {
+          server->sendContent(reinterpret_cast<const char *>(data), length);
+          return true;
+        });
+    DEBUG_PRINTLN("Compressed storage streaming completed for WebServer");
+    return;
+  }
+
+  server->sendHeader("Accept-Ranges", "bytes");
+  if (!rangeHeader.isEmpty()) {
+    size_t total = driver->recordLength(collection, key);
+    ByteRange range =
+        requestedRange(core.getStatus(), rangeHeader,
+                       server->header("If-Range"), core.getHeader("ETag"),
+                       total);
+    if (range.result == HttpNegotiation::RangeResult::Unsatisfiable) {
+      server->sendHeader("Content-Range", contentRange(range, total));
+      server->send(416, String(core.getMimeType().c_str()), "");
+      return;
+    }
+    if (range.result == HttpNegotiation::RangeResult::Partial) {
+      // Only the requested bytes are read from storage
+      server->sendHeader("Content-Range", contentRange(range, total));
+      server->setContentLength(range.length());
+      server->send(206, String(core.getMimeType().c_str()), "");
+      driver->readRange(collection, key, range.first, range.length(),
+                        [server](const uint8_t *data, size_t length) {
+                          server->sendContent(
+                              reinterpret_cast<const char *>(data), length);
+                          return true;
+                        });
+      DEBUG_PRINTLN("Storage range streaming completed for WebServer");
+      return;
+    }
+  }
+
   // For large files, we'll still need to load due to WebServer limitations
   // but with improved memory management
   server->setContentLength(CONTENT_LENGTH_UNKNOWN);
@@ -401,6 +589,65 @@ esp_err_t WebResponse::streamFromStorage(const String &collection,
     return httpd_resp_send(req, error, HTTPD_RESP_USE_STRLEN);
   }
 
+  // Records stored gzip-compressed go out exactly as stored - never
+  // inflated on the device - to any client that accepts gzip
+  // A Range request is answered from the record as retrieve() returns it,
+  // so a download can resume part-way whatever the encoding on flash
+  String rangeHeader = getRequestHeader(req, "Range");
+  size_t gzipSize = driver->compressedSize(collection, key);
+  if (gzipSize > 0) {
+    httpd_resp_set_hdr(req, "Vary", "Accept-Encoding");
+  }
+  if (gzipSize > 0 && rangeHeader.isEmpty() &&
+      acceptsGzip(getAcceptEncoding(req))) {
+    httpd_resp_set_hdr(req, "Content-Encoding", "gzip");
+    esp_err_t ret = ESP_OK;
+    bool streamed = driver->streamCompressed(
+        collection, key, [req, &ret](const uint8_t *data, size_t length) {
+          ret = httpd_resp_send_chunk(
+              req, reinterpret_cast<const char *>(data), length);
+          return ret == ESP_OK;
+        });
+    if (!streamed || ret != ESP_OK) {
+      ERROR_PRINTLN("WebResponse: Compressed storage streaming failed");
+      return ret != ESP_OK ? ret : ESP_FAIL;
+    }
+    return httpd_resp_send_chunk(req, NULL, 0);
+  }
+
+  httpd_resp_set_hdr(req, "Accept-Ranges", "bytes");
+  String contentRangeValue; // httpd keeps the pointer until the send
+  if (!rangeHeader.isEmpty()) {
+    size_t total = driver->recordLength(collection, key);
+    ByteRange range = requestedRange(
+        core.getStatus(), rangeHeader, getRequestHeader(req, "If-Range"),
+        core.getHeader("ETag"), total);
+    contentRangeValue = contentRange(range, total);
+    if (range.result == HttpNegotiation::RangeResult::Unsatisfiable) {
+      httpd_resp_set_status(req, "416 Range Not Satisfiable");
+      httpd_resp_set_hdr(req, "Content-Range", contentRangeValue.c_str());
+      return httpd_resp_send(req, nullptr, 0);
+    }
+    if (range.result == HttpNegotiation::RangeResult::Partial) {
+      // Only the requested bytes are read from storage
+      httpd_resp_set_status(req, "206 Partial Content");
+      httpd_resp_set_hdr(req, "Content-Range", contentRangeValue.c_str());
+      esp_err_t ret = ESP_OK;
+      bool streamed = driver->readRange(
+          collection, key, range.first, range.length(),
+          [req, &ret](const uint8_t *data, size_t length) {
+            ret = httpd_resp_send_chunk(
+                req, reinterpret_cast<const char *>(data), length);
+            return ret == ESP_OK;
+          });
+      if (!streamed || ret != ESP_OK) {
+        ERROR_PRINTLN("WebResponse: Storage range streaming failed");
+        return ret != ESP_OK ? ret : ESP_FAIL;
+      }
+      return httpd_resp_send_chunk(req, NULL, 0);
+    }
+  }
+
   const size_t STORAGE_CHUNK_SIZE = 1024;
   char *buffer = (char *)malloc(STORAGE_CHUNK_SIZE + 1);
   if (!buffer) {
@@ -0,0 +1,35 @@
+#include "platform/asset_bundle.h"
+#include <cstring>
+
+namespace AssetBundles {
+
+const AssetBundleEntry *find(const AssetBundle &bundle, const char *path) {
+  size_t low = 0;
+  size_t high = bundle.count;
+  while (low < high) {
+    size_t mid = low + (high - low) / 2;
+    int order = strcmp(bundle.index[mid].path, path);
+    if (order == 0) {
+      return &bundle.index[mid];
+    }
+    if (order < 0) {
+      low = mid + 1;
+    } else {
+      high = mid;
+    }
+  }
+  return nullptr;
+}
+
+EmbeddedAsset embeddedAsset(const AssetBundle &bundle,
+                            const AssetBundleEntry &entry) {
+  const uint8_t *gzip =
+      entry.gzipLength > 0
+          ? reinterpret_cast<const uint8_t *>(bundle.data + entry.gzipOffset)
+          : nullptr;
+  EmbeddedAsset asset = {bundle.data + entry.offset, gzip, entry.gzipLength,
+                         entry.hash};
+  return asset;
+}
+
+} // namespace AssetBundles
@@ -0,0 +1,63 @@
+#include "platform/asset_fingerprint.h"
+#include <cctype>
+
+namespace AssetFingerprint {
+
+namespace {
+// Offset of the file name's extension dot, or npos if it has none
+size_t extensionDot(const std::string &path) {
+  size_t slash = path.rfind('/');
+  size_t nameStart = slash == std::string::npos ? 0 : slash + 1;
+  size_t dot = path.rfind('.');
+  // A leading dot (".hidden") marks a name, not an extension
+  if (dot == std::string::npos || dot <= nameStart) {
+    return std::string::npos;
+  }
+  return dot;
+}
+
+bool isHex(const std::string &value) {
+  for (char c : value) {
+    if (!isxdigit(static_cast<unsigned char>(c))) {
+      return false;
+    }
+  }
+  return !value.empty();
+}
+} // namespace
+
+std::string fingerprint(const std::string &path, const std::string &hash) {
+  size_t dot = extensionDot(path);
+  if (dot == std::string::npos) {
+    return path + "." + hash;
+  }
+  return path.substr(0, dot) + "." + hash + path.substr(dot);
+}
+
+bool parse(const std::string &fingerprinted, size_t hashLength,
+           std::string &path, std::string &hash) {
+  // "name.<hash>.ext", then "name.<hash>" for names with no extension
+  size_t dot = extensionDot(fingerprinted);
+  size_t hashEnds[] = {dot, fingerprinted.size()};
+  for (size_t hashEnd : hashEnds) {
+    if (hashEnd == std::string::npos || hashEnd < hashLength + 1) {
+      continue;
+    }
+    size_t hashDot = hashEnd - hashLength - 1;
+    std::string candidate = fingerprinted.substr(hashDot + 1, hashLength);
+    size_t slash = fingerprinted.rfind('/', hashDot);
+    size_t nameStart = slash == std::string::npos ? 0 : slash + 1;
+    // Something has to be left of the name once the hash is removed
+    if (fingerprinted[hashDot] != '.' || hashDot <= nameStart ||
+        !isHex(candidate)) {
+      continue;
+    }
+
+    path = fingerprinted.substr(0, hashDot) + fingerprinted.substr(hashEnd);
+    hash = candidate;
+    return true;
+  }
+  return false;
+}
+
+} // namespace AssetFingerprint
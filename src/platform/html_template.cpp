@@ -0,0 +1,136 @@
+#include "platform/html_template.h"
+#include <cstring>
+
+namespace HtmlTemplate {
+
+namespace {
+struct MarkerName {
+  const char *name;
+  size_t length;
+  Marker marker;
+};
+
+const MarkerName MARKER_NAMES[] = {
+    {"NAV_MENU", 8, Marker::NavMenu},
+    {"username", 8, Marker::Username},
+    {"csrfToken", 9, Marker::CsrfToken},
+    {"DEVICE_NAME", 11, Marker::DeviceName},
+    {"redirectUrl", 11, Marker::RedirectUrl},
+    {"MODULE_PREFIX", 13, Marker::ModulePrefix},
+    {"SECURITY_NOTICE", 15, Marker::SecurityNotice},
+};
+
+const char ASSET_PREFIX[] = "ASSET:";
+const size_t ASSET_PREFIX_LENGTH = sizeof(ASSET_PREFIX) - 1;
+
+bool startsWith(const char *text, size_t length, const char *prefix,
+                size_t prefixLength) {
+  return length >= prefixLength && memcmp(text, prefix, prefixLength) == 0;
+}
+
+// Offset of the first "}}" at or after from, or length if there is none
+size_t findClose(const char *source, size_t length, size_t from) {
+  for (size_t i = from; i + 1 < length; i++) {
+    if (source[i] == '}' && source[i + 1] == '}') {
+      return i;
+    }
+  }
+  return length;
+}
+
+// The marker called name (the text between the braces), or Literal
+Marker identify(const char *name, size_t length) {
+  for (const MarkerName &known : MARKER_NAMES) {
+    if (length == known.length && memcmp(name, known.name, length) == 0) {
+      return known.marker;
+    }
+  }
+  if (length > ASSET_PREFIX_LENGTH &&
+      startsWith(name, length, ASSET_PREFIX, ASSET_PREFIX_LENGTH)) {
+    return Marker::Asset;
+  }
+  return Marker::Literal;
+}
+
+bool isTagEnd(char c) {
+  return c == '>' || c == ' ' || c == '\t' || c == '\n' || c == '\r';
+}
+} // namespace
+
+Segments compile(const char *source, size_t length) {
+  Segments segments;
+  size_t literalStart = 0;
+  auto push = [&](size_t start, Marker marker, size_t offset,
+                  size_t argumentLength, size_t end) {
+    if (start > literalStart) {
+      segments.push_back({Marker::Literal, static_cast<uint32_t>(literalStart),
+                          static_cast<uint32_t>(start - literalStart)});
+    }
+    segments.push_back({marker, static_cast<uint32_t>(offset),
+                        static_cast<uint32_t>(argumentLength)});
+    literalStart = end;
+  };
+
+  size_t pos = 0;
+  while (pos < length) {
+    if (source[pos] != '{' && source[pos] != '<') {
+      pos++;
+      continue;
+    }
+    const char *at = source + pos;
+    size_t remaining = length - pos;
+
+    if (startsWith(at, remaining, "{{", 2)) {
+      size_t close = findClose(source, length, pos + 2);
+      if (close == length) {
+        pos++; // Unclosed - the braces are just text
+        continue;
+      }
+      size_t nameStart = pos + 2;
+      Marker marker = identify(source + nameStart, close - nameStart);
+      if (marker == Marker::Asset) {
+        size_t pathStart = nameStart + ASSET_PREFIX_LENGTH;
+        push(pos, marker, pathStart, close - pathStart, close + 2);
+      } else if (marker != Marker::Literal) {
+        push(pos, marker, nameStart, 0, close + 2);
+      }
+      pos = close + 2;
+    } else if (startsWith(at, remaining, "<head>", 6)) {
+      push(pos, Marker::HeadOpen, pos, 0, pos + 6);
+      pos += 6;
+    } else if (startsWith(at, remaining, "<body", 5) && remaining > 5 &&
+               isTagEnd(at[5])) {
+      const char *tagEnd =
+          static_cast<const char *>(memchr(at, '>', remaining));
+      if (!tagEnd) {
+        pos += 5; // Unterminated tag - leave it alone
+        continue;
+      }
+      size_t end = tagEnd - source;
+      push(pos, Marker::BodyOpen, pos + 5, end - (pos + 5), end + 1);
+      pos = end + 1;
+    } else {
+      pos++;
+    }
+  }
+
+  if (length > literalStart) {
+    segments.push_back({Marker::Literal, static_cast<uint32_t>(literalStart),
+                        static_cast<uint32_t>(length - literalStart)});
+  }
+  return segments;
+}
+
+void render(const char *source, const Segments &segments,
+            const MarkerWriter &writeMarker, const Writer &write) {
+  for (const Segment &segment : segments) {
+    if (segment.marker == Marker::Literal) {
+      write(source + segment.offset, segment.length);
+    } else {
+      writeMarker(segment.marker, source + segment.offset, segment.length,
+                  write);
+    }
+  }
+}
+
+} // namespace HtmlTemplate
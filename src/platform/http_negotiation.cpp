@@ -0,0 +1,157 @@
+#include "platform/http_negotiation.h"
+#include <algorithm>
+#include <cctype>
+#include <cstdlib>
+
+namespace HttpNegotiation {
+
+namespace {
+std::string trim(const std::string &value) {
+  size_t start = value.find_first_not_of(" \t");
+  if (start == std::string::npos) {
+    return std::string();
+  }
+  size_t end = value.find_last_not_of(" \t");
+  return value.substr(start, end - start + 1);
+}
+
+std::string withoutWeakPrefix(const std::string &tag) {
+  return tag.compare(0, 2, "W/") == 0 ? tag.substr(2) : tag;
+}
+
+std::string toLower(std::string value) {
+  std::transform(value.begin(), value.end(), value.begin(),
+                 [](unsigned char c) { return std::tolower(c); });
+  return value;
+}
+
+// Calls visit(name, accepted) for each "name;q=..." list entry, with
+// accepted false only for q=0
+template <typename Visitor>
+void forEachCoding(const std::string &header, Visitor visit) {
+  size_t start = 0;
+  while (start < header.size()) {
+    size_t end = header.find(',', start);
+    if (end == std::string::npos) {
+      end = header.size();
+    }
+    std::string entry = header.substr(start, end - start);
+    start = end + 1;
+
+    size_t semicolon = entry.find(';');
+    std::string name = toLower(trim(entry.substr(0, semicolon)));
+    if (name.empty()) {
+      continue;
+    }
+    bool accepted = true;
+    if (semicolon != std::string::npos) {
+      size_t q = entry.find("q=", semicolon);
+      if (q != std::string::npos) {
+        accepted = atof(entry.c_str() + q + 2) > 0;
+      }
+    }
+    visit(name, accepted);
+  }
+}
+} // namespace
+
+bool acceptsGzip(const std::string &acceptEncoding) {
+  int gzip = -1; // -1 = not listed, else 0/1
+  int any = -1;
+  forEachCoding(acceptEncoding,
+                [&gzip, &any](const std::string &name, bool accepted) {
+                  if (name == "gzip" || name == "x-gzip") {
+                    gzip = accepted;
+                  } else if (name == "*") {
+                    any = accepted;
+                  }
+                });
+  return gzip >= 0 ? gzip == 1 : any == 1;
+}
+
+bool etagMatches(const std::string &ifNoneMatch, const std::string &etag) {
+  if (etag.empty()) {
+    return false;
+  }
+  std::string wanted = withoutWeakPrefix(etag);
+  // Entity tags can't contain commas, so a plain split is enough
+  size_t start = 0;
+  while (start < ifNoneMatch.size()) {
+    size_t end = ifNoneMatch.find(',', start);
+    if (end == std::string::npos) {
+      end = ifNoneMatch.size();
+    }
+    std::string tag = trim(ifNoneMatch.substr(start, end - start));
+    start = end + 1;
+    if (tag == "*" || withoutWeakPrefix(tag) == wanted) {
+      return true;
+    }
+  }
+  return false;
+}
+
+RangeResult parseRange(const std::string &range, size_t totalLength,
+                       size_t &first, size_t &last) {
+  std::string spec = trim(range);
+  if (toLower(spec.substr(0, 6)) != "bytes=") {
+    return RangeResult::Full;
+  }
+  spec = trim(spec.substr(6));
+  size_t dash = spec.find('-');
+  if (dash == std::string::npos ||
+      spec.find_first_not_of("0123456789-") != std::string::npos ||
+      spec.find('-', dash + 1) != std::string::npos) {
+    return RangeResult::Full; // Malformed, or more than one range
+  }
+
+  std::string from = spec.substr(0, dash);
+  std::string to = spec.substr(dash + 1);
+  if (from.empty()) {
+    // Suffix range: the last <to> bytes
+    size_t count = to.empty() ? 0 : strtoul(to.c_str(), nullptr, 10);
+    if (count == 0 || totalLength == 0) {
+      return to.empty() ? RangeResult::Full : RangeResult::Unsatisfiable;
+    }
+    first = count < totalLength ? totalLength - count : 0;
+    last = totalLength - 1;
+    return RangeResult::Partial;
+  }
+
+  first = strtoul(from.c_str(), nullptr, 10);
+  if (to.empty()) {
+    last = totalLength - 1;
+  } else {
+    last = strtoul(to.c_str(), nullptr, 10);
+    if (last < first) {
+      return RangeResult::Full; // Invalid, so the header is ignored
+    }
+  }
+  if (first >= totalLength) {
+    return RangeResult::Unsatisfiable;
+  }
+  if (last >= totalLength) {
+    last = totalLength - 1;
+  }
+  return RangeResult::Partial;
+}
+
+bool ifRangeMatches(const std::string &ifRange, const std::string &etag) {
+  std::string tag = trim(ifRange);
+  if (tag.empty()) {
+    return true;
+  }
+  // Strong comparison: weak tags never match, and an HTTP date isn't a tag
+  return !etag.empty() && tag.compare(0, 2, "W/") != 0 &&
+         etag.compare(0, 2, "W/") != 0 && tag == etag;
+}
+
+bool isTemplatable(const std::string &mimeType,
+                   const std::string &contentEncoding) {
+  std::string coding = toLower(trim(contentEncoding));
+  if (!coding.empty() && coding != "identity") {
+    return false;
+  }
+  return mimeType == "text/html" || mimeType == "text/plain";
+}
+
+} // namespace HttpNegotiation
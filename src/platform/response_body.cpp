@@ -0,0 +1,77 @@
+#include "platform/response_body.h"
+#include <cstring>
+#include <map>
+#include <mutex>
+
+namespace ResponseBody {
+
+namespace {
+// HTTP and HTTPS requests are served from different tasks
+std::mutex producersMutex;
+std::map<const WebResponse *, Producer> &producers() {
+  static std::map<const WebResponse *, Producer> attached;
+  return attached;
+}
+} // namespace
+
+Scope::Scope(const WebResponse &response, Producer producer)
+    : response(nullptr) {
+  if (!producer) {
+    return;
+  }
+  std::lock_guard<std::mutex> lock(producersMutex);
+  producers()[&response] = std::move(producer);
+  this->response = &response;
+}
+
+Scope::~Scope() {
+  if (!response) {
+    return;
+  }
+  std::lock_guard<std::mutex> lock(producersMutex);
+  producers().erase(response);
+}
+
+Producer find(const WebResponse &response) {
+  std::lock_guard<std::mutex> lock(producersMutex);
+  auto it = producers().find(&response);
+  return it != producers().end() ? it->second : Producer();
+}
+
+ChunkWriter::ChunkWriter(char *buffer, size_t capacity, SendChunk sendChunk)
+    : buffer(buffer), capacity(capacity), used(0),
+      sendChunk(std::move(sendChunk)), sendFailed(false) {}
+
+void ChunkWriter::write(const char *data, size_t length) {
+  while (length > 0 && !sendFailed) {
+    size_t room = capacity - used;
+    size_t count = length < room ? length : room;
+    memcpy(buffer + used, data, count);
+    used += count;
+    data += count;
+    length -= count;
+    if (used == capacity) {
+      flush();
+    }
+  }
+}
+
+bool ChunkWriter::flush() {
+  if (used > 0 && !sendFailed) {
+    sendFailed = !sendChunk(buffer, used);
+  }
+  used = 0;
+  return !sendFailed;
+}
+
+size_t ChunkPrint::write(uint8_t c) {
+  writer.write(reinterpret_cast<const char *>(&c), 1);
+  return writer.failed() ? 0 : 1;
+}
+
+size_t ChunkPrint::write(const uint8_t *data, size_t length) {
+  writer.write(reinterpret_cast<const char *>(data), length);
+  return writer.failed() ? 0 : length;
+}
+
+} // namespace ResponseBody
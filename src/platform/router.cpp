@@ -241,13 +241,25 @@ void Router::executeRouteWithAuth(const RouteEntry &route, WebRequest &request,
           serverType.c_str(), request.getPath().c_str(),
           response.getContent().length());
 
-      if (callbacks.processResponseTemplates) {
+      if (streamsTemplate(response)) {
+        DEBUG_PRINTLN("Template expansion deferred to sendResponse");
+      } else if (callbacks.processResponseTemplates) {
         callbacks.processResponseTemplates(request, response);
       }
     }
   }
 }
 
+bool Router::streamsTemplate(WebResponse &response) const {
+  // Only a handler sets PROGMEM content (auth failures set JSON or a
+  // redirect), so an unsent PROGMEM page here is one a route produced
+  return callbacks.templateBody && !response.isResponseSent() &&
+         response.hasProgmemContent() &&
+         response.getProgmemData() != nullptr &&
+         (!callbacks.shouldProcessResponse ||
+          callbacks.shouldProcessResponse(response));
+}
+
 bool Router::dispatchRoute(const String &path, WebModule::Method wmMethod,
                            WebRequest &request, WebResponse &response,
                            const char *protocol) {
@@ -359,6 +371,24 @@ void Router::printUnifiedRoutes() const {
 
 #ifdef ESP_PLATFORM
 
+void Router::sendResponse(WebRequest &request, WebResponse &response,
+                          WebServerClass *server) {
+  ResponseBody::Scope body(response,
+                           streamsTemplate(response)
+                               ? callbacks.templateBody(request, response)
+                               : ResponseBody::Producer());
+  response.sendTo(server);
+}
+
+esp_err_t Router::sendResponse(WebRequest &request, WebResponse &response,
+                               httpd_req_t *req) {
+  ResponseBody::Scope body(response,
+                           streamsTemplate(response)
+                               ? callbacks.templateBody(request, response)
+                               : ResponseBody::Producer());
+  return response.sendTo(req);
+}
+
 void Router::bindHttp(WebServerClass *server, bool isHttpRedirectServer,
                       std::function<void()> notFoundFallback) {
   if (!server) {
@@ -393,7 +423,7 @@ void Router::bindHttp(WebServerClass *server, bool isHttpRedirectServer,
         WebResponse response;
 
         executeRouteWithAuth(route, request, response, "HTTP");
-        response.sendTo(server);
+        sendResponse(request, response, server);
       });
       continue;
     }
@@ -419,7 +449,7 @@ void Router::bindHttp(WebServerClass *server, bool isHttpRedirectServer,
       WebResponse response;
 
       executeRouteWithAuth(route, request, response, "HTTP");
-      response.sendTo(server);
+      sendResponse(request, response, server);
     };
     server->on(routeWithSlash.c_str(), httpMethod, wrapperHandler);
 
@@ -440,7 +470,7 @@ void Router::bindHttp(WebServerClass *server, bool isHttpRedirectServer,
     WebResponse response;
     if (dispatchWildcardOnly(requestPath, wmMethod, request, response,
                              "HTTP")) {
-      response.sendTo(server);
+      sendResponse(request, response, server);
       return;
     }
 
@@ -496,7 +526,8 @@ void Router::bindHttpsRoutes(httpd_handle_t handle) {
           httpd_resp_send_404(req);
           return ESP_FAIL;
         }
-        return response.sendTo(req);
+        return Router::activeHttpsInstance->sendResponse(request, response,
+                                                         req);
       };
       httpd_register_uri_handler(handle, &uri_config);
       continue;
@@ -537,7 +568,8 @@ void Router::bindHttpsRoutes(httpd_handle_t handle) {
         return ESP_FAIL;
       }
 
-      return response.sendTo(req);
+      return Router::activeHttpsInstance->sendResponse(request, response,
+                                                       req);
     };
     httpd_register_uri_handler(handle, &uri_config);
 
@@ -578,7 +610,8 @@ void Router::registerHttpsNotFoundHandler(httpd_handle_t handle) {
         WebResponse response;
         if (Router::activeHttpsInstance->dispatchWildcardOnly(
                 requestPath, wmMethod, request, response, "HTTPS")) {
-          return response.sendTo(req);
+          return Router::activeHttpsInstance->sendResponse(request, response,
+                                                           req);
         }
 
         String errorPage =
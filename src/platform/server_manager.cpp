@@ -1,12 +1,30 @@
 #include "platform/certificate_loader.h"
+#include "platform/request_headers.h"
 #include "platform/server_manager.h"
 #include "utilities/debug_macros.h"
 #include <interface/web_request.h>
+#include <vector>
 
 ServerManager::ServerManager(Router &router) : router(router) {}
 
 ServerManager::~ServerManager() { stop(); }
 
+void ServerManager::collectRequestHeaders() {
+  std::vector<const char *> names(COMMON_HTTP_HEADERS,
+                                  COMMON_HTTP_HEADERS +
+                                      COMMON_HTTP_HEADERS_COUNT);
+  for (size_t i = 0; i < PLATFORM_HTTP_HEADERS_COUNT; i++) {
+    bool listed = false;
+    for (const char *name : names) {
+      listed = listed || strcasecmp(name, PLATFORM_HTTP_HEADERS[i]) == 0;
+    }
+    if (!listed) {
+      names.push_back(PLATFORM_HTTP_HEADERS[i]);
+    }
+  }
+  server->collectHeaders(names.data(), names.size());
+}
+
 void ServerManager::start(bool wantHttps, const Config &config) {
   if (wantHttps) {
     httpsEnabled = true;
@@ -29,7 +47,7 @@ void ServerManager::start(bool wantHttps, const Config &config) {
         return;
       }
 
-      server->collectHeaders(COMMON_HTTP_HEADERS, COMMON_HTTP_HEADERS_COUNT);
+      collectRequestHeaders();
 
       server->begin();
       running = true;
@@ -54,7 +72,7 @@ void ServerManager::start(bool wantHttps, const Config &config) {
         return;
       }
 
-      server->collectHeaders(COMMON_HTTP_HEADERS, COMMON_HTTP_HEADERS_COUNT);
+      collectRequestHeaders();
 
       server->onNotFound([this]() {
         String host = server->hostHeader();
@@ -104,7 +122,7 @@ void ServerManager::start(bool wantHttps, const Config &config) {
       return;
     }
 
-    server->collectHeaders(COMMON_HTTP_HEADERS, COMMON_HTTP_HEADERS_COUNT);
+    collectRequestHeaders();
 
     server->begin();
     running = true;
@@ -51,8 +51,13 @@ WebPlatform::WebPlatform()
                                                        auth);
       },
       [this](int statusCode) { return getErrorPage(statusCode); },
-      [this](String html, WebRequest req) { return prepareHtml(html, req); },
+      [this](const String &html, WebRequest &req) {
+        return prepareHtml(html, req);
+      },
       [this](const String &path) { return getRedirectTarget(path); },
+      [this](WebRequest &req, WebResponse &res) {
+        return templateBody(req, res);
+      },
   });
 }
 
@@ -164,6 +169,7 @@ void WebPlatform::handle() {
   if (restartScheduled && now >= restartScheduledTime) {
     DEBUG_PRINTLN(
         "WebPlatform: Scheduled restart time reached - restarting now");
+    StorageManager::flush(); // Don't lose queued writes
     ESP.restart();
   }
 
@@ -171,6 +177,12 @@ void WebPlatform::handle() {
     updateConnectionState();
     lastConnectionCheck = now;
   }
+
+  // Deferred storage housekeeping (e.g. log compaction), one slice at a time
+  if (now - lastStorageMaintenance > STORAGE_MAINTENANCE_INTERVAL) {
+    StorageManager::maintain();
+    lastStorageMaintenance = now;
+  }
 }
 
 void WebPlatform::finalizeRoutes() {
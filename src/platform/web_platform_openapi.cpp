@@ -261,8 +261,9 @@ bool WebPlatform::generateAndStoreSpec(
 
   if (storeResult) {
     // Immediately verify the storage worked by trying to retrieve
-    // But only do verification if we have sufficient heap
-    if (ESP.getFreeHeap() > openAPIJson.length() + 8192) {
+    // But only do verification if we have sufficient heap - retrieving a
+    // gzip record inflates into a scratch buffer before copying it out
+    if (ESP.getFreeHeap() > openAPIJson.length() * 2 + 8192) {
       String verifyRetrieve = driver->retrieve(OPENAPI_COLLECTION, storageKey);
       bool verifyExists = driver->exists(OPENAPI_COLLECTION, storageKey);
 
@@ -346,6 +347,11 @@ void WebPlatform::generateOpenAPISpec() {
     return;
   }
 
+  // Specs are large, repetitive JSON - keep them gzipped on flash and let
+  // WebResponse send them as stored with Content-Encoding: gzip
+  StorageManager::declareFormat(OPENAPI_COLLECTION, RecordFormat::Gzip,
+                                "littlefs");
+
   size_t freeHeap = ESP.getFreeHeap();
   size_t maxBlock = ESP.getMaxAllocHeap();
   size_t maxAllowable = (size_t)(maxBlock * 0.7);
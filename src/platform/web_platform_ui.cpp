@@ -5,6 +5,12 @@
 // Navigation Menu System
 void WebPlatform::setNavigationMenu(const std::vector<NavigationItem> &items) {
   navigationMenu = items;
+
+  // The menu only changes here, so both visibility variants are built
+  // once and {{NAV_MENU}} writes the cached one
+  authenticatedNavigationHtml = buildNavigationHtml(true);
+  anonymousNavigationHtml = buildNavigationHtml(false);
+  DEBUG_PRINTF("Navigation menu set: %d items\n", (int)navigationMenu.size());
 }
 
 std::vector<NavigationItem> WebPlatform::getNavigationMenu() const {
@@ -12,12 +18,16 @@ std::vector<NavigationItem> WebPlatform::getNavigationMenu() const {
 }
 
 String WebPlatform::generateNavigationHtml(bool isAuthenticated) const {
-  DEBUG_PRINTLN("generateNavigationHtml called, isAuthenticated: " +
-                String(isAuthenticated ? "true" : "false"));
-  DEBUG_PRINTLN("Navigation menu size: " + String(navigationMenu.size()));
+  return navigationHtml(isAuthenticated);
+}
+
+const String &WebPlatform::navigationHtml(bool isAuthenticated) const {
+  return isAuthenticated ? authenticatedNavigationHtml
+                         : anonymousNavigationHtml;
+}
 
+String WebPlatform::buildNavigationHtml(bool isAuthenticated) const {
   if (navigationMenu.empty()) {
-    DEBUG_PRINTLN("Navigation menu is empty, returning empty string");
     return "";
   }
 
@@ -148,7 +158,8 @@ String WebPlatform::generateDefaultErrorPage(int statusCode, const String &messa
     // For unknown status codes, we need to create dynamic title
     html += String(statusCode);
     html += F(" Error</title>\n"
-              "  <link rel=\"stylesheet\" href=\"/assets/style.css\">\n"
+              "  <link rel=\"stylesheet\" "
+              "href=\"{{ASSET:/assets/style.css}}\">\n"
               "</head>\n<body>\n  <div class=\"container\">\n    {{NAV_MENU}}\n"
               "    <div class=\"error-page\">\n      <h1 class=\"error\">");
     html += String(statusCode);
@@ -175,7 +186,8 @@ String WebPlatform::generateDefaultErrorPage(int statusCode, const String &messa
 
   // For standard status codes, use PROGMEM strings
   html += FPSTR(title);
-  html += F("</title>\n  <link rel=\"stylesheet\" href=\"/assets/style.css\">\n"
+  html += F("</title>\n"
+            "  <link rel=\"stylesheet\" href=\"{{ASSET:/assets/style.css}}\">\n"
             "</head>\n<body>\n  <div class=\"container\">\n    {{NAV_MENU}}\n"
             "    <div class=\"error-page\">\n      <h1 class=\"");
   html += FPSTR(statusClass);
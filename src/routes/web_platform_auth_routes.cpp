@@ -16,11 +16,6 @@
 
 // Register authentication-related routes
 void WebPlatform::registerAuthRoutes() {
-  registerWebRoute("/assets/account-page.js",
-                   std::bind(&WebPlatform::accountPageJSAssetHandler, this,
-                             std::placeholders::_1, std::placeholders::_2),
-                   {AuthType::NONE}, WebModule::WM_GET);
-
   registerWebRoute("/login",
                    std::bind(&WebPlatform::loginPageHandler, this,
                              std::placeholders::_1, std::placeholders::_2),
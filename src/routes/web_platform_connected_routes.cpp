@@ -4,43 +4,11 @@
 #include <interface/web_module_interface.h>
 
 void WebPlatform::registerConnectedModeRoutes() {
-  registerWebRoute("/assets/favicon.svg",
-                   std::bind(&WebPlatform::webPlatformFaviconHandler, this,
-                             std::placeholders::_1, std::placeholders::_2),
-                   {AuthType::NONE}, WebModule::WM_GET);
-
-  registerWebRoute("/assets/favicon.ico",
-                   std::bind(&WebPlatform::webPlatformFaviconHandler, this,
-                             std::placeholders::_1, std::placeholders::_2),
-                   {AuthType::NONE}, WebModule::WM_GET);
-
-  registerWebRoute("/assets/style.css",
-                   std::bind(&WebPlatform::styleCSSAssetHandler, this,
-                             std::placeholders::_1, std::placeholders::_2),
-                   {AuthType::NONE}, WebModule::WM_GET);
-
-  registerWebRoute("/assets/web-platform-style.css",
-                   std::bind(&WebPlatform::webPlatformCSSAssetHandler, this,
-                             std::placeholders::_1, std::placeholders::_2),
-                   {AuthType::NONE}, WebModule::WM_GET);
-
-  registerWebRoute("/assets/web-platform-utils.js",
-                   std::bind(&WebPlatform::webPlatformJSAssetHandler, this,
-                             std::placeholders::_1, std::placeholders::_2),
-                   {AuthType::NONE}, WebModule::WM_GET);
-
-  registerWebRoute("/assets/wifi.js",
-                   std::bind(&WebPlatform::wifiJSAssetHandler, this,
-                             std::placeholders::_1, std::placeholders::_2),
-                   {AuthType::NONE}, WebModule::WM_GET);
-
-  registerWebRoute("/assets/system-status.js",
-                   std::bind(&WebPlatform::systemStatusJSAssetHandler, this,
-                             std::placeholders::_1, std::placeholders::_2),
-                   {AuthType::NONE}, WebModule::WM_GET);
-
-  registerWebRoute("/assets/home-page.js",
-                   std::bind(&WebPlatform::homePageJSAssetHandler, this,
+  // Every bundled asset (assets/asset_bundle_data.h and module bundles),
+  // by plain or fingerprinted name. A wildcard route, so it takes no URI
+  // handler slot however many assets there are.
+  registerWebRoute("/assets/*",
+                   std::bind(&WebPlatform::embeddedAssetHandler, this,
                              std::placeholders::_1, std::placeholders::_2),
                    {AuthType::NONE}, WebModule::WM_GET);
 
@@ -8,33 +8,8 @@
 
 void WebPlatform::registerConfigPortalRoutes() {
   // Static assets - no authentication required for captive portal
-  registerWebRoute("/assets/favicon.svg",
-                   std::bind(&WebPlatform::webPlatformFaviconHandler, this,
-                             std::placeholders::_1, std::placeholders::_2),
-                   {AuthType::NONE}, WebModule::WM_GET);
-
-  registerWebRoute("/assets/favicon.ico",
-                   std::bind(&WebPlatform::webPlatformFaviconHandler, this,
-                             std::placeholders::_1, std::placeholders::_2),
-                   {AuthType::NONE}, WebModule::WM_GET);
-
-  registerWebRoute("/assets/style.css",
-                   std::bind(&WebPlatform::styleCSSAssetHandler, this,
-                             std::placeholders::_1, std::placeholders::_2),
-                   {AuthType::NONE}, WebModule::WM_GET);
-
-  registerWebRoute("/assets/web-platform-style.css",
-                   std::bind(&WebPlatform::webPlatformCSSAssetHandler, this,
-                             std::placeholders::_1, std::placeholders::_2),
-                   {AuthType::NONE}, WebModule::WM_GET);
-
-  registerWebRoute("/assets/web-platform-utils.js",
-                   std::bind(&WebPlatform::webPlatformJSAssetHandler, this,
-                             std::placeholders::_1, std::placeholders::_2),
-                   {AuthType::NONE}, WebModule::WM_GET);
-
-  registerWebRoute("/assets/wifi.js",
-                   std::bind(&WebPlatform::wifiJSAssetHandler, this,
+  registerWebRoute("/assets/*",
+                   std::bind(&WebPlatform::embeddedAssetHandler, this,
                              std::placeholders::_1, std::placeholders::_2),
                    {AuthType::NONE}, WebModule::WM_GET);
 
@@ -0,0 +1,582 @@
+#include "storage/async_database_driver.h"
+#include "storage/write_batch.h"
+#include "utilities/debug_macros.h"
+#include <chrono>
+
+#ifdef NATIVE_PLATFORM
+#include <testing/native_debug_macros_compat.h>
+#endif
+
+const unsigned long AsyncDatabaseDriver::RETRY_DELAY_MS;
+
+AsyncDatabaseDriver::AsyncDatabaseDriver(
+    std::unique_ptr<IDatabaseDriver> driver, size_t maxPending,
+    unsigned long coalesceDelayMs)
+    : innerDriver(std::move(driver)),
+      maxPending(maxPending > 0 ? maxPending : 1),
+      coalesceDelayMs(coalesceDelayMs), pendingCount(0), nextSequence(0),
+      stopping(false), workerRunning(false), failedDrains(0), scanDepth(0) {
+#ifndef NATIVE_PLATFORM
+  workerHandle = nullptr;
+#endif
+  startWorker();
+}
+
+AsyncDatabaseDriver::~AsyncDatabaseDriver() { shutdown(); }
+
+void AsyncDatabaseDriver::startWorker() {
+  workerRunning = true;
+#ifdef NATIVE_PLATFORM
+  worker = std::thread(&AsyncDatabaseDriver::workerLoop, this);
+#else
+  if (xTaskCreate(&AsyncDatabaseDriver::workerTask, "storage_async",
+                  WORKER_STACK_SIZE, this, WORKER_PRIORITY,
+                  &workerHandle) != pdPASS) {
+    // Without a worker every write goes straight through
+    workerRunning = false;
+    WARN_PRINTF("AsyncDatabaseDriver: Failed to start worker task, "
+                "writing synchronously\n");
+  }
+#endif
+}
+
+#ifndef NATIVE_PLATFORM
+void AsyncDatabaseDriver::workerTask(void *self) {
+  AsyncDatabaseDriver *driver = static_cast<AsyncDatabaseDriver *>(self);
+  driver->workerLoop();
+  {
+    std::lock_guard<std::mutex> lock(driver->queueMutex);
+    driver->workerRunning = false;
+  }
+  driver->queueChanged.notify_all();
+  vTaskDelete(nullptr);
+}
+#endif
+
+void AsyncDatabaseDriver::workerLoop() {
+  std::unique_lock<std::mutex> lock(queueMutex);
+  while (!stopping) {
+    queueChanged.wait(lock, [this]() { return stopping || pendingCount > 0; });
+    if (stopping) {
+      break; // shutdown() does the final drain
+    }
+
+    // Let the rest of a burst arrive so it lands in the same batch
+    queueChanged.wait_for(lock, std::chrono::milliseconds(coalesceDelayMs),
+                          [this]() {
+                            return stopping || pendingCount >= maxPending;
+                          });
+
+    lock.unlock();
+    bool applied = drain();
+    lock.lock();
+    if (!applied && !stopping) {
+      // The failed writes are still pending - retry them later rather than
+      // spin on a driver that is refusing writes
+      queueChanged.wait_for(lock, std::chrono::milliseconds(RETRY_DELAY_MS),
+                            [this]() { return stopping; });
+    }
+  }
+}
+
+bool AsyncDatabaseDriver::enqueue(const String &collection, const String &key,
+                                  bool isRemove, const String &data) {
+  std::unique_lock<std::mutex> lock(queueMutex);
+  if (!workerRunning) {
+    return false;
+  }
+
+  auto collectionIt = pending.find(collection);
+  bool queued = collectionIt != pending.end() &&
+                collectionIt->second.find(key) != collectionIt->second.end();
+  // Full: write the backlog out on this task rather than grow. Not while a
+  // forEach() holds the wrapped driver - its scan would be changed under it.
+  if (!queued && pendingCount >= maxPending && scanDepth == 0) {
+    lock.unlock();
+    drain();
+    lock.lock();
+    // Still full: the backlog is writes the wrapped driver refused. Hand
+    // this one back so the caller writes it (and learns if it fails).
+    if (pendingCount >= maxPending) {
+      return false;
+    }
+  }
+
+  auto inserted = pending[collection].emplace(key, PendingWrite());
+  if (inserted.second) {
+    pendingCount++;
+  }
+  PendingWrite &write = inserted.first->second;
+  write.isRemove = isRemove;
+  write.data = isRemove ? String() : data;
+  write.sequence = ++nextSequence;
+
+  lock.unlock();
+  queueChanged.notify_all();
+  return true;
+}
+
+bool AsyncDatabaseDriver::drain() {
+  // Held until the applied entries are dropped from the pending map, so a
+  // reader that misses the map is guaranteed to find the write applied
+  std::lock_guard<std::recursive_mutex> driverLock(driverMutex);
+
+  struct Drained {
+    String collection;
+    String key;
+    uint32_t sequence;
+    bool isRemove;
+    String data;
+    bool applied;
+  };
+  std::vector<Drained> drained;
+  WriteBatch batch(innerDriver.get());
+  {
+    std::lock_guard<std::mutex> lock(queueMutex);
+    for (const auto &collection : pending) {
+      for (const auto &entry : collection.second) {
+        if (entry.second.isRemove) {
+          batch.remove(collection.first, entry.first);
+        } else {
+          batch.put(collection.first, entry.first, entry.second.data);
+        }
+        Drained item;
+        item.collection = collection.first;
+        item.key = entry.first;
+        item.sequence = entry.second.sequence;
+        item.isRemove = entry.second.isRemove;
+        item.data = entry.second.data;
+        item.applied = true;
+        drained.push_back(item);
+      }
+    }
+  }
+  if (drained.empty()) {
+    return true;
+  }
+
+  // One bad write mustn't cost the rest of the batch: if the wrapped driver
+  // rejects it, apply the writes one at a time and keep the ones it refuses
+  size_t failed = 0;
+  if (!batch.commit()) {
+    for (Drained &item : drained) {
+      if (item.isRemove) {
+        item.applied = innerDriver->remove(item.collection, item.key) ||
+                       !innerDriver->exists(item.collection, item.key);
+      } else {
+        item.applied = innerDriver->store(item.collection, item.key, item.data);
+      }
+      if (!item.applied) {
+        failed++;
+      }
+    }
+  }
+
+  {
+    std::lock_guard<std::mutex> lock(queueMutex);
+    if (failed > 0) {
+      failedDrains++;
+    }
+    for (const Drained &item : drained) {
+      if (!item.applied) {
+        continue; // Stays pending for the next drain
+      }
+      auto collectionIt = pending.find(item.collection);
+      if (collectionIt == pending.end()) {
+        continue;
+      }
+      auto entryIt = collectionIt->second.find(item.key);
+      // Rewritten while the batch was applied - keep the newer write
+      if (entryIt == collectionIt->second.end() ||
+          entryIt->second.sequence != item.sequence) {
+        continue;
+      }
+      collectionIt->second.erase(entryIt);
+      pendingCount--;
+      if (collectionIt->second.empty()) {
+        pending.erase(collectionIt);
+      }
+    }
+  }
+  queueChanged.notify_all();
+
+  if (failed > 0) {
+    WARN_PRINTF("AsyncDatabaseDriver: %s driver refused %u write(s), kept "
+                "pending\n",
+                innerDriver->getDriverName().c_str(),
+                static_cast<unsigned>(failed));
+  }
+  return failed == 0;
+}
+
+bool AsyncDatabaseDriver::findPending(const String &collection,
+                                      const String &key, PendingWrite &found) {
+  std::lock_guard<std::mutex> lock(queueMutex);
+  auto collectionIt = pending.find(collection);
+  if (collectionIt == pending.end()) {
+    return false;
+  }
+  auto entryIt = collectionIt->second.find(key);
+  if (entryIt == collectionIt->second.end()) {
+    return false;
+  }
+  found = entryIt->second;
+  return true;
+}
+
+std::map<String, AsyncDatabaseDriver::PendingWrite>
+AsyncDatabaseDriver::pendingFor(const String &collection) {
+  std::lock_guard<std::mutex> lock(queueMutex);
+  auto collectionIt = pending.find(collection);
+  if (collectionIt == pending.end()) {
+    return std::map<String, PendingWrite>();
+  }
+  return collectionIt->second;
+}
+
+bool AsyncDatabaseDriver::store(const String &collection, const String &key,
+                                const String &data) {
+  // Reject now what the wrapped driver would reject at drain time, when
+  // there's no caller left to tell
+  if (!innerDriver->acceptsName(collection, key)) {
+    return false;
+  }
+
+  if (enqueue(collection, key, false, data)) {
+    return true;
+  }
+  std::lock_guard<std::recursive_mutex> driverLock(driverMutex);
+  return innerDriver->store(collection, key, data);
+}
+
+String AsyncDatabaseDriver::retrieve(const String &collection,
+                                     const String &key) {
+  PendingWrite write;
+  if (findPending(collection, key, write)) {
+    return write.isRemove ? String() : write.data;
+  }
+
+  std::lock_guard<std::recursive_mutex> driverLock(driverMutex);
+  return innerDriver->retrieve(collection, key);
+}
+
+bool AsyncDatabaseDriver::remove(const String &collection, const String &key) {
+  if (!exists(collection, key)) {
+    return false;
+  }
+
+  if (enqueue(collection, key, true, String())) {
+    return true;
+  }
+  std::lock_guard<std::recursive_mutex> driverLock(driverMutex);
+  return innerDriver->remove(collection, key);
+}
+
+std::vector<String> AsyncDatabaseDriver::listKeys(const String &collection) {
+  std::lock_guard<std::recursive_mutex> driverLock(driverMutex);
+  std::map<String, PendingWrite> overrides = pendingFor(collection);
+
+  std::vector<String> keys;
+  for (const String &key : innerDriver->listKeys(collection)) {
+    if (overrides.find(key) == overrides.end()) {
+      keys.push_back(key);
+    }
+  }
+  for (const auto &entry : overrides) {
+    if (!entry.second.isRemove) {
+      keys.push_back(entry.first);
+    }
+  }
+  return keys;
+}
+
+bool AsyncDatabaseDriver::exists(const String &collection, const String &key) {
+  PendingWrite write;
+  if (findPending(collection, key, write)) {
+    return !write.isRemove;
+  }
+
+  std::lock_guard<std::recursive_mutex> driverLock(driverMutex);
+  return innerDriver->exists(collection, key);
+}
+
+size_t AsyncDatabaseDriver::forEach(const String &collection,
+                                    RecordCallback callback) {
+  size_t visited = 0;
+  if (!callback) {
+    return visited;
+  }
+
+  std::lock_guard<std::recursive_mutex> driverLock(driverMutex);
+  std::map<String, PendingWrite> overrides = pendingFor(collection);
+
+  // Stored records first, minus the ones with a pending write, then the
+  // pending values
+  scanDepth++;
+  bool stopped = false;
+  innerDriver->forEach(collection,
+                       [&](const String &key, const String &data) {
+                         if (overrides.find(key) != overrides.end()) {
+                           return true;
+                         }
+                         visited++;
+                         stopped = !callback(key, data);
+                         return !stopped;
+                       });
+  scanDepth--;
+
+  for (auto it = overrides.begin(); !stopped && it != overrides.end(); ++it) {
+    if (!it->second.isRemove) {
+      visited++;
+      stopped = !callback(it->first, it->second.data);
+    }
+  }
+  return visited;
+}
+
+size_t AsyncDatabaseDriver::scanPrefix(const String &collection,
+                                       const String &prefix,
+                                       RecordCallback callback) {
+  return mergeScan(
+      collection,
+      [&](RecordCallback inner) {
+        return innerDriver->scanPrefix(collection, prefix, inner);
+      },
+      [&prefix](const String &key) { return key.startsWith(prefix); },
+      callback);
+}
+
+size_t AsyncDatabaseDriver::scanRange(const String &collection,
+                                      const String &from, const String &to,
+                                      RecordCallback callback) {
+  return mergeScan(
+      collection,
+      [&](RecordCallback inner) {
+        return innerDriver->scanRange(collection, from, to, inner);
+      },
+      [&](const String &key) {
+        return key >= from && (to.length() == 0 || key < to);
+      },
+      callback);
+}
+
+size_t AsyncDatabaseDriver::mergeScan(
+    const String &collection,
+    const std::function<size_t(RecordCallback)> &innerScan,
+    const std::function<bool(const String &)> &inRange,
+    RecordCallback callback) {
+  size_t visited = 0;
+  if (!callback) {
+    return visited;
+  }
+
+  std::lock_guard<std::recursive_mutex> driverLock(driverMutex);
+  std::map<String, PendingWrite> overrides;
+  for (const auto &entry : pendingFor(collection)) {
+    if (inRange(entry.first)) {
+      overrides.insert(entry);
+    }
+  }
+
+  // Both sides are in key order: before each stored record, emit the
+  // pending puts that sort ahead of it
+  auto next = overrides.begin();
+  bool stopped = false;
+  auto emitPendingBefore = [&](const String *limit) {
+    for (; !stopped && next != overrides.end() &&
+           (limit == nullptr || next->first < *limit);
+         ++next) {
+      if (!next->second.isRemove) {
+        visited++;
+        stopped = !callback(next->first, next->second.data);
+      }
+    }
+  };
+
+  scanDepth++;
+  innerScan([&](const String &key, const String &data) {
+    emitPendingBefore(&key);
+    if (stopped) {
+      return false;
+    }
+    if (overrides.find(key) != overrides.end()) {
+      return true; // Emitted (or hidden) from the pending side
+    }
+    visited++;
+    stopped = !callback(key, data);
+    return !stopped;
+  });
+  scanDepth--;
+
+  emitPendingBefore(nullptr);
+  return visited;
+}
+
+size_t AsyncDatabaseDriver::count(const String &collection) {
+  std::lock_guard<std::recursive_mutex> driverLock(driverMutex);
+  std::map<String, PendingWrite> overrides = pendingFor(collection);
+
+  size_t total = innerDriver->count(collection);
+  for (const auto &entry : overrides) {
+    bool stored = innerDriver->exists(collection, entry.first);
+    if (!entry.second.isRemove && !stored) {
+      total++;
+    } else if (entry.second.isRemove && stored && total > 0) {
+      total--;
+    }
+  }
+  return total;
+}
+
+bool AsyncDatabaseDriver::applyBatch(const WriteBatch &batch) {
+  bool running;
+  {
+    std::lock_guard<std::mutex> lock(queueMutex);
+    running = workerRunning;
+  }
+  // driverMutex is always taken before queueMutex, never while holding it
+  if (!running) {
+    std::lock_guard<std::recursive_mutex> driverLock(driverMutex);
+    return innerDriver->applyBatch(batch);
+  }
+
+  for (const WriteBatch::Operation &op : batch.operations()) {
+    if (!innerDriver->acceptsName(op.collection, op.key)) {
+      return false;
+    }
+  }
+  for (const WriteBatch::Operation &op : batch.operations()) {
+    if (!enqueue(op.collection, op.key, op.isRemove, op.data)) {
+      // Shut down, or backed up with refused writes - write it through
+      std::lock_guard<std::recursive_mutex> driverLock(driverMutex);
+      if (op.isRemove) {
+        innerDriver->remove(op.collection, op.key);
+      } else if (!innerDriver->store(op.collection, op.key, op.data)) {
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+bool AsyncDatabaseDriver::setRecordFormat(const String &collection,
+                                          RecordFormat format) {
+  std::lock_guard<std::recursive_mutex> driverLock(driverMutex);
+  return innerDriver->setRecordFormat(collection, format);
+}
+
+size_t AsyncDatabaseDriver::compressedSize(const String &collection,
+                                           const String &key) {
+  PendingWrite write;
+  if (findPending(collection, key, write)) {
+    return 0; // Not stored yet - callers fall back to retrieve()
+  }
+
+  std::lock_guard<std::recursive_mutex> driverLock(driverMutex);
+  return innerDriver->compressedSize(collection, key);
+}
+
+bool AsyncDatabaseDriver::streamCompressed(const String &collection,
+                                           const String &key,
+                                           ChunkCallback callback) {
+  PendingWrite write;
+  if (findPending(collection, key, write)) {
+    return false;
+  }
+
+  std::lock_guard<std::recursive_mutex> driverLock(driverMutex);
+  return innerDriver->streamCompressed(collection, key, callback);
+}
+
+size_t AsyncDatabaseDriver::recordLength(const String &collection,
+                                         const String &key) {
+  PendingWrite write;
+  if (findPending(collection, key, write)) {
+    return write.isRemove ? 0 : write.data.length();
+  }
+
+  std::lock_guard<std::recursive_mutex> driverLock(driverMutex);
+  return innerDriver->recordLength(collection, key);
+}
+
+bool AsyncDatabaseDriver::readRange(const String &collection,
+                                    const String &key, size_t offset,
+                                    size_t length, ChunkCallback callback) {
+  // A queued write isn't on the inner driver yet - read it via retrieve()
+  PendingWrite write;
+  if (findPending(collection, key, write)) {
+    return IDatabaseDriver::readRange(collection, key, offset, length,
+                                      callback);
+  }
+
+  std::lock_guard<std::recursive_mutex> driverLock(driverMutex);
+  return innerDriver->readRange(collection, key, offset, length, callback);
+}
+
+bool AsyncDatabaseDriver::setCollectionTtl(const String &collection,
+                                           unsigned long ttlSeconds) {
+  std::lock_guard<std::recursive_mutex> driverLock(driverMutex);
+  return innerDriver->setCollectionTtl(collection, ttlSeconds);
+}
+
+void AsyncDatabaseDriver::maintain() {
+  // Skip this slice rather than stall the main loop behind a drain
+  std::unique_lock<std::recursive_mutex> driverLock(driverMutex,
+                                                    std::try_to_lock);
+  if (driverLock.owns_lock()) {
+    innerDriver->maintain();
+  }
+}
+
+bool AsyncDatabaseDriver::flush() {
+  bool drained = drain();
+  std::lock_guard<std::recursive_mutex> driverLock(driverMutex);
+  return innerDriver->flush() && drained;
+}
+
+bool AsyncDatabaseDriver::acceptsName(const String &collection,
+                                      const String &key) {
+  return innerDriver->acceptsName(collection, key);
+}
+
+String AsyncDatabaseDriver::getDriverName() const {
+  return innerDriver->getDriverName();
+}
+
+void AsyncDatabaseDriver::shutdown() {
+  {
+    std::lock_guard<std::mutex> lock(queueMutex);
+    stopping = true;
+  }
+  queueChanged.notify_all();
+
+#ifdef NATIVE_PLATFORM
+  if (worker.joinable()) {
+    worker.join();
+  }
+  {
+    std::lock_guard<std::mutex> lock(queueMutex);
+    workerRunning = false;
+  }
+#else
+  {
+    std::unique_lock<std::mutex> lock(queueMutex);
+    queueChanged.wait(lock, [this]() { return !workerRunning; });
+  }
+#endif
+
+  // Nothing is queued once workerRunning is false, so this is the last
+  drain();
+}
+
+size_t AsyncDatabaseDriver::getPendingCount() {
+  std::lock_guard<std::mutex> lock(queueMutex);
+  return pendingCount;
+}
+
+size_t AsyncDatabaseDriver::getFailedDrainCount() {
+  std::lock_guard<std::mutex> lock(queueMutex);
+  return failedDrains;
+}
+
+IDatabaseDriver &AsyncDatabaseDriver::getInnerDriver() { return *innerDriver; }
@@ -27,11 +27,11 @@ bool AuthStorage::hasUsers() {
   ensureInitialized();
 
   IDatabaseDriver *driver = &StorageManager::driver(driverName);
-  std::vector<String> userKeys = driver->listKeys(USERS_COLLECTION);
+  size_t userCount = driver->count(USERS_COLLECTION);
 
-  DEBUG_PRINTF("AuthStorage: Found %d existing users\n", userKeys.size());
+  DEBUG_PRINTF("AuthStorage: Found %d existing users\n", userCount);
 
-  return !userKeys.empty();
+  return userCount > 0;
 }
 
 void AuthStorage::cleanExpiredData() {
@@ -61,8 +61,37 @@ void AuthStorage::initialize(const String &driver) {
   // Note: No longer creating default admin user
   // First user will be created via setup process
 
+  // Page tokens are written on every rendered page and only live for
+  // PAGE_TOKEN_DURATION_MS, so keep them in RAM instead of wearing flash.
+  // A reboot just invalidates forms that were open at the time. They get
+  // their own driver, sized by AuthConstants::MAX_PAGE_TOKENS.
+  StorageManager::routeCollection(PAGE_TOKENS_COLLECTION,
+                                  "memory:page_tokens");
+  StorageManager::declareTtl(PAGE_TOKENS_COLLECTION,
+                             AuthConstants::PAGE_TOKEN_DURATION_MS / 1000);
+
+  // Index the fields the lookups below filter on. Page tokens are left
+  // unindexed: one is written per rendered page, so keeping an index
+  // current would cost more writes than the scans it saves.
+  StorageManager::declareIndex(USERS_COLLECTION, "username", driverName);
+  StorageManager::declareIndex(SESSIONS_COLLECTION, "userId", driverName);
+  StorageManager::declareIndex(API_TOKENS_COLLECTION, "userId", driverName);
+  StorageManager::declareIndex(API_TOKENS_COLLECTION, "token", driverName);
+
+  // Store the auth collections as MessagePack: each record becomes a map in
+  // the collection blob instead of an escaped JSON string. Data written in
+  // JSON by older firmware is converted on the collection's next write.
+  StorageManager::declareFormat(USERS_COLLECTION, RecordFormat::MessagePack,
+                                driverName);
+  StorageManager::declareFormat(SESSIONS_COLLECTION, RecordFormat::MessagePack,
+                                driverName);
+  StorageManager::declareFormat(API_TOKENS_COLLECTION,
+                                RecordFormat::MessagePack, driverName);
+
   initialized = true;
 
+  purgePersistedPageTokens();
+
   // Clean expired data
   cleanExpiredData();
 
@@ -195,26 +224,28 @@ bool AuthStorage::deleteUser(const String &userId) {
   }
 
   IDatabaseDriver *driver = &StorageManager::driver(driverName);
-  bool success = driver->remove(USERS_COLLECTION, userId);
+  if (!driver->exists(USERS_COLLECTION, userId)) {
+    return false;
+  }
 
-  if (success) {
-    DEBUG_PRINTF("AuthStorage: Deleted user ID %s\n", userId.c_str());
+  // Remove the user together with their sessions and tokens - batched so
+  // each collection is written once instead of once per record
+  WriteBatch batch = StorageManager::batch(driverName);
+  batch.remove(USERS_COLLECTION, userId);
 
-    // Clean up user's sessions and tokens
-    // Use QueryBuilder to remove by userId
-    QueryBuilder sessionsQuery = StorageManager::query(SESSIONS_COLLECTION);
-    if (driverName.length() > 0) {
-      sessionsQuery = QueryBuilder(&StorageManager::driver(driverName),
-                                   SESSIONS_COLLECTION);
-    }
-    sessionsQuery.where("userId", userId).remove();
+  auto removeAll = [&](const String &collection) {
+    QueryBuilder query(driver, collection);
+    query.where("userId", userId).each([&](const String &key, const String &) {
+      batch.remove(collection, key);
+      return true;
+    });
+  };
+  removeAll(SESSIONS_COLLECTION);
+  removeAll(API_TOKENS_COLLECTION);
 
-    QueryBuilder tokensQuery = StorageManager::query(API_TOKENS_COLLECTION);
-    if (driverName.length() > 0) {
-      tokensQuery = QueryBuilder(&StorageManager::driver(driverName),
-                                 API_TOKENS_COLLECTION);
-    }
-    tokensQuery.where("userId", userId).remove();
+  bool success = batch.commit();
+  if (success) {
+    DEBUG_PRINTF("AuthStorage: Deleted user ID %s\n", userId.c_str());
   }
 
   return success;
@@ -241,26 +272,34 @@ String AuthStorage::validateCredentials(const String &username,
 }
 
 std::vector<AuthUser> AuthStorage::getAllUsers() {
-  ensureInitialized();
-
   std::vector<AuthUser> users;
+  forEachUser([&](AuthUser &user) {
+    users.push_back(std::move(user));
+    return true;
+  });
+  return users;
+}
+
+String AuthStorage::forEachUser(std::function<bool(AuthUser &)> callback,
+                                size_t limit, const String &cursor) {
+  ensureInitialized();
 
-  // Use QueryBuilder to get all users
   QueryBuilder query = StorageManager::query(USERS_COLLECTION);
   if (driverName.length() > 0) {
     query = QueryBuilder(&StorageManager::driver(driverName), USERS_COLLECTION);
   }
 
-  std::vector<String> userDataList = query.getAll();
+  query.orderBy("username").after(cursor);
+  if (limit > 0) {
+    query.limit((int)limit);
+  }
 
-  for (const String &userData : userDataList) {
+  query.each([&](const String &, const String &userData) {
     AuthUser user = AuthUser::fromJson(userData);
-    if (user.isValid()) {
-      users.push_back(std::move(user));
-    }
-  }
+    return !user.isValid() || callback(user);
+  });
 
-  return users;
+  return query.nextCursor();
 }
 
 // Session management
@@ -350,19 +389,20 @@ int AuthStorage::cleanExpiredSessions() {
   ensureInitialized();
 
   IDatabaseDriver *driver = &StorageManager::driver(driverName);
-  std::vector<String> sessionKeys = driver->listKeys(SESSIONS_COLLECTION);
-  int cleaned = 0;
-
-  for (const String &key : sessionKeys) {
-    String sessionData = driver->retrieve(SESSIONS_COLLECTION, key);
-    if (sessionData.length() > 0) {
-      AuthSession session = AuthSession::fromJson(sessionData);
-      if (!session.isValid()) {
-        if (driver->remove(SESSIONS_COLLECTION, key)) {
-          cleaned++;
-        }
-      }
-    }
+  WriteBatch expired = StorageManager::batch(driverName);
+
+  driver->forEach(SESSIONS_COLLECTION,
+                  [&](const String &key, const String &sessionData) {
+                    if (!AuthSession::fromJson(sessionData).isValid()) {
+                      expired.remove(SESSIONS_COLLECTION, key);
+                    }
+                    return true;
+                  });
+
+  // One write for the whole collection rather than one per record
+  int cleaned = (int)expired.size();
+  if (cleaned > 0 && !expired.commit()) {
+    cleaned = 0;
   }
 
   if (cleaned > 0) {
@@ -453,12 +493,21 @@ bool AuthStorage::deleteApiToken(const String &token) {
 }
 
 std::vector<AuthApiToken> AuthStorage::getUserApiTokens(const String &userId) {
-  ensureInitialized();
-
   std::vector<AuthApiToken> tokens;
+  forEachUserApiToken(userId, [&](AuthApiToken &token) {
+    tokens.push_back(std::move(token));
+    return true;
+  });
+  return tokens;
+}
+
+String AuthStorage::forEachUserApiToken(
+    const String &userId, std::function<bool(AuthApiToken &)> callback,
+    size_t limit, const String &cursor) {
+  ensureInitialized();
 
   if (userId.length() == 0) {
-    return tokens;
+    return "";
   }
 
   // Use QueryBuilder to find by userId
@@ -468,35 +517,37 @@ std::vector<AuthApiToken> AuthStorage::getUserApiTokens(const String &userId) {
                          API_TOKENS_COLLECTION);
   }
 
-  std::vector<String> tokenDataList = query.where("userId", userId).getAll();
+  query.where("userId", userId).orderBy("createdAt").after(cursor);
+  if (limit > 0) {
+    query.limit((int)limit);
+  }
 
-  for (const String &tokenData : tokenDataList) {
+  query.each([&](const String &, const String &tokenData) {
     AuthApiToken token = AuthApiToken::fromJson(tokenData);
-    if (token.isValid()) {
-      tokens.push_back(std::move(token));
-    }
-  }
+    return !token.isValid() || callback(token);
+  });
 
-  return tokens;
+  return query.nextCursor();
 }
 
 int AuthStorage::cleanExpiredApiTokens() {
   ensureInitialized();
 
   IDatabaseDriver *driver = &StorageManager::driver(driverName);
-  std::vector<String> tokenKeys = driver->listKeys(API_TOKENS_COLLECTION);
-  int cleaned = 0;
-
-  for (const String &key : tokenKeys) {
-    String tokenData = driver->retrieve(API_TOKENS_COLLECTION, key);
-    if (tokenData.length() > 0) {
-      AuthApiToken token = AuthApiToken::fromJson(tokenData);
-      if (!token.isValid()) {
-        if (driver->remove(API_TOKENS_COLLECTION, key)) {
-          cleaned++;
-        }
-      }
-    }
+  WriteBatch expired = StorageManager::batch(driverName);
+
+  driver->forEach(API_TOKENS_COLLECTION,
+                  [&](const String &key, const String &tokenData) {
+                    if (!AuthApiToken::fromJson(tokenData).isValid()) {
+                      expired.remove(API_TOKENS_COLLECTION, key);
+                    }
+                    return true;
+                  });
+
+  // One write for the whole collection rather than one per record
+  int cleaned = (int)expired.size();
+  if (cleaned > 0 && !expired.commit()) {
+    cleaned = 0;
   }
 
   if (cleaned > 0) {
@@ -517,7 +568,8 @@ String AuthStorage::createPageToken(const String &clientIp) {
   String token = AuthUtils::generatePageToken();
   AuthPageToken pageToken(token, clientIp);
 
-  IDatabaseDriver *driver = &StorageManager::driver(driverName);
+  IDatabaseDriver *driver =
+      &StorageManager::driverFor(PAGE_TOKENS_COLLECTION, driverName);
 
   if (driver->store(PAGE_TOKENS_COLLECTION, pageToken.id, pageToken.toJson())) {
     return token;
@@ -535,11 +587,9 @@ bool AuthStorage::validatePageToken(const String &token,
   }
 
   // Use QueryBuilder to find by token value
-  QueryBuilder query = StorageManager::query(PAGE_TOKENS_COLLECTION);
-  if (driverName.length() > 0) {
-    query = QueryBuilder(&StorageManager::driver(driverName),
-                         PAGE_TOKENS_COLLECTION);
-  }
+  QueryBuilder query(
+      &StorageManager::driverFor(PAGE_TOKENS_COLLECTION, driverName),
+      PAGE_TOKENS_COLLECTION);
 
   String tokenData = query.where("token", token).get();
 
@@ -553,7 +603,8 @@ bool AuthStorage::validatePageToken(const String &token,
   if (!pageToken.isValid()) {
     DEBUG_PRINTF("PageToken validation failed: token '%s...' expired\n",
                  token.substring(0, 6).c_str());
-    IDatabaseDriver *driver = &StorageManager::driver(driverName);
+    IDatabaseDriver *driver =
+        &StorageManager::driverFor(PAGE_TOKENS_COLLECTION, driverName);
     driver->remove(PAGE_TOKENS_COLLECTION, pageToken.id);
     return false;
   }
@@ -570,20 +621,22 @@ bool AuthStorage::validatePageToken(const String &token,
 int AuthStorage::cleanExpiredPageTokens() {
   ensureInitialized();
 
-  IDatabaseDriver *driver = &StorageManager::driver(driverName);
-  std::vector<String> tokenKeys = driver->listKeys(PAGE_TOKENS_COLLECTION);
-  int cleaned = 0;
-
-  for (const String &key : tokenKeys) {
-    String tokenData = driver->retrieve(PAGE_TOKENS_COLLECTION, key);
-    if (tokenData.length() > 0) {
-      AuthPageToken token = AuthPageToken::fromJson(tokenData);
-      if (!token.isValid()) {
-        if (driver->remove(PAGE_TOKENS_COLLECTION, key)) {
-          cleaned++;
-        }
-      }
-    }
+  IDatabaseDriver *driver =
+      &StorageManager::driverFor(PAGE_TOKENS_COLLECTION, driverName);
+  WriteBatch expired(driver);
+
+  driver->forEach(PAGE_TOKENS_COLLECTION,
+                  [&](const String &key, const String &tokenData) {
+                    if (!AuthPageToken::fromJson(tokenData).isValid()) {
+                      expired.remove(PAGE_TOKENS_COLLECTION, key);
+                    }
+                    return true;
+                  });
+
+  // One write for the whole collection rather than one per record
+  int cleaned = (int)expired.size();
+  if (cleaned > 0 && !expired.commit()) {
+    cleaned = 0;
   }
 
   if (cleaned > 0) {
@@ -593,6 +646,28 @@ int AuthStorage::cleanExpiredPageTokens() {
   return cleaned;
 }
 
+void AuthStorage::purgePersistedPageTokens() {
+  IDatabaseDriver *flash = &StorageManager::driver(driverName);
+  if (flash == &StorageManager::driverFor(PAGE_TOKENS_COLLECTION,
+                                          driverName)) {
+    return;
+  }
+
+  // Older firmware kept page tokens in the auth driver; they're unreachable
+  // now, so drop them in one write
+  WriteBatch stale(flash);
+  flash->forEach(PAGE_TOKENS_COLLECTION,
+                 [&](const String &key, const String &tokenData) {
+                   stale.remove(PAGE_TOKENS_COLLECTION, key);
+                   return true;
+                 });
+
+  size_t dropped = stale.size();
+  if (dropped > 0 && stale.commit()) {
+    DEBUG_PRINTF("AuthStorage: Dropped %u persisted page tokens\n", dropped);
+  }
+}
+
 // Utility methods
 
 String AuthStorage::getDriverName() {
@@ -623,10 +698,12 @@ String AuthStorage::getStorageStats() {
   IDatabaseDriver *driver = &StorageManager::driver(driverName);
 
   doc["driver"] = getDriverName();
-  doc["users"] = driver->listKeys(USERS_COLLECTION).size();
-  doc["sessions"] = driver->listKeys(SESSIONS_COLLECTION).size();
-  doc["api_tokens"] = driver->listKeys(API_TOKENS_COLLECTION).size();
-  doc["page_tokens"] = driver->listKeys(PAGE_TOKENS_COLLECTION).size();
+  doc["users"] = driver->count(USERS_COLLECTION);
+  doc["sessions"] = driver->count(SESSIONS_COLLECTION);
+  doc["api_tokens"] = driver->count(API_TOKENS_COLLECTION);
+  doc["page_tokens"] =
+      StorageManager::driverFor(PAGE_TOKENS_COLLECTION, driverName)
+          .count(PAGE_TOKENS_COLLECTION);
 
   std::string stats;
   serializeJson(doc, stats);
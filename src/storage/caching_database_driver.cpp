@@ -0,0 +1,299 @@
+#include "storage/caching_database_driver.h"
+#include "storage/write_batch.h"
+#include "utilities/debug_macros.h"
+#include <cstdlib>
+#include <cstring>
+
+#ifdef NATIVE_PLATFORM
+#include <testing/native_debug_macros_compat.h>
+#else
+#include <esp_heap_caps.h>
+#endif
+
+namespace {
+void *heapAllocate(size_t size) { return malloc(size); }
+void heapRelease(void *ptr) { free(ptr); }
+
+#ifndef NATIVE_PLATFORM
+void *psramAllocate(size_t size) {
+  return heap_caps_malloc(size, MALLOC_CAP_SPIRAM);
+}
+void psramRelease(void *ptr) { heap_caps_free(ptr); }
+#endif
+} // namespace
+
+CachingDatabaseDriver::Allocator CachingDatabaseDriver::heapAllocator() {
+  Allocator heap = {heapAllocate, heapRelease, false};
+  return heap;
+}
+
+CachingDatabaseDriver::Allocator CachingDatabaseDriver::defaultAllocator() {
+#ifndef NATIVE_PLATFORM
+  if (psramFound()) {
+    Allocator psram = {psramAllocate, psramRelease, true};
+    return psram;
+  }
+#endif
+  return heapAllocator();
+}
+
+CachingDatabaseDriver::CachingDatabaseDriver(
+    std::unique_ptr<IDatabaseDriver> driver, size_t maxBytes,
+    Allocator allocator, size_t maxRecordBytes)
+    : innerDriver(std::move(driver)), allocator(allocator),
+      maxBytes(maxBytes), maxRecordBytes(maxRecordBytes), usedBytes(0),
+      hitCount(0), missCount(0) {
+  if (this->maxBytes == 0) {
+    this->maxBytes = allocator.external ? DEFAULT_PSRAM_MAX_BYTES
+                                        : DEFAULT_HEAP_MAX_BYTES;
+  }
+  if (this->maxRecordBytes == 0) {
+    this->maxRecordBytes = this->maxBytes / 8;
+  }
+}
+
+CachingDatabaseDriver::~CachingDatabaseDriver() { clear(); }
+
+size_t CachingDatabaseDriver::entrySize(const String &key, size_t length) {
+  return key.length() + length;
+}
+
+CachingDatabaseDriver::Entry *
+CachingDatabaseDriver::find(const String &collection, const String &key) {
+  auto collectionIt = entries.find(collection);
+  if (collectionIt == entries.end()) {
+    return nullptr;
+  }
+  auto entryIt = collectionIt->second.find(key);
+  if (entryIt == collectionIt->second.end()) {
+    return nullptr;
+  }
+
+  Entry &entry = entryIt->second;
+  lru.splice(lru.end(), lru, entry.lruPosition);
+  return &entry;
+}
+
+void CachingDatabaseDriver::insert(const String &collection,
+                                   const String &key, const String &data) {
+  size_t length = data.length();
+  size_t size = entrySize(key, length);
+  if (length == 0 || length > maxRecordBytes || size > maxBytes) {
+    return;
+  }
+
+  invalidate(collection, key);
+  while (usedBytes + size > maxBytes && !lru.empty()) {
+    evictOldest();
+  }
+
+  char *buffer = static_cast<char *>(allocator.allocate(length + 1));
+  if (!buffer) {
+    return; // Out of cache memory - serve uncached
+  }
+  memcpy(buffer, data.c_str(), length + 1);
+
+  auto collectionIt =
+      entries.emplace(collection, std::map<String, Entry>()).first;
+  auto entryIt = collectionIt->second.emplace(key, Entry()).first;
+  Entry &entry = entryIt->second;
+  entry.data = buffer;
+  entry.length = length;
+  EntryRef ref = {&collectionIt->first, &entryIt->first};
+  entry.lruPosition = lru.insert(lru.end(), ref);
+  usedBytes += size;
+}
+
+void CachingDatabaseDriver::invalidate(const String &collection,
+                                       const String &key) {
+  auto collectionIt = entries.find(collection);
+  if (collectionIt == entries.end()) {
+    return;
+  }
+  auto entryIt = collectionIt->second.find(key);
+  if (entryIt == collectionIt->second.end()) {
+    return;
+  }
+
+  usedBytes -= entrySize(entryIt->first, entryIt->second.length);
+  allocator.release(entryIt->second.data);
+  lru.erase(entryIt->second.lruPosition);
+  collectionIt->second.erase(entryIt);
+  if (collectionIt->second.empty()) {
+    entries.erase(collectionIt);
+  }
+}
+
+void CachingDatabaseDriver::evictOldest() {
+  // Copy the names - invalidate() frees the strings the ref points at
+  EntryRef oldest = lru.front();
+  String collection = *oldest.collection;
+  String key = *oldest.key;
+  invalidate(collection, key);
+}
+
+bool CachingDatabaseDriver::store(const String &collection, const String &key,
+                                  const String &data) {
+  invalidate(collection, key);
+  return innerDriver->store(collection, key, data);
+}
+
+String CachingDatabaseDriver::retrieve(const String &collection,
+                                       const String &key) {
+  Entry *entry = find(collection, key);
+  if (entry) {
+    hitCount++;
+    return String(entry->data);
+  }
+
+  missCount++;
+  String data = innerDriver->retrieve(collection, key);
+  if (uncachedCollections.find(collection) == uncachedCollections.end()) {
+    insert(collection, key, data);
+  }
+  return data;
+}
+
+bool CachingDatabaseDriver::remove(const String &collection,
+                                   const String &key) {
+  invalidate(collection, key);
+  return innerDriver->remove(collection, key);
+}
+
+std::vector<String> CachingDatabaseDriver::listKeys(const String &collection) {
+  return innerDriver->listKeys(collection);
+}
+
+bool CachingDatabaseDriver::exists(const String &collection,
+                                   const String &key) {
+  auto collectionIt = entries.find(collection);
+  if (collectionIt != entries.end() &&
+      collectionIt->second.find(key) != collectionIt->second.end()) {
+    return true;
+  }
+  return innerDriver->exists(collection, key);
+}
+
+size_t CachingDatabaseDriver::forEach(const String &collection,
+                                      RecordCallback callback) {
+  return innerDriver->forEach(collection, callback);
+}
+
+size_t CachingDatabaseDriver::scanPrefix(const String &collection,
+                                         const String &prefix,
+                                         RecordCallback callback) {
+  return innerDriver->scanPrefix(collection, prefix, callback);
+}
+
+size_t CachingDatabaseDriver::scanRange(const String &collection,
+                                        const String &from, const String &to,
+                                        RecordCallback callback) {
+  return innerDriver->scanRange(collection, from, to, callback);
+}
+
+size_t CachingDatabaseDriver::count(const String &collection) {
+  return innerDriver->count(collection);
+}
+
+bool CachingDatabaseDriver::applyBatch(const WriteBatch &batch) {
+  for (const WriteBatch::Operation &op : batch.operations()) {
+    invalidate(op.collection, op.key);
+  }
+  return innerDriver->applyBatch(batch);
+}
+
+bool CachingDatabaseDriver::hasIndex(const String &collection,
+                                     const String &field) {
+  return innerDriver->hasIndex(collection, field);
+}
+
+bool CachingDatabaseDriver::lookupIndex(const String &collection,
+                                        const String &field,
+                                        const String &value,
+                                        std::vector<String> &keys) {
+  return innerDriver->lookupIndex(collection, field, value, keys);
+}
+
+bool CachingDatabaseDriver::setRecordFormat(const String &collection,
+                                            RecordFormat format) {
+  return innerDriver->setRecordFormat(collection, format);
+}
+
+size_t CachingDatabaseDriver::compressedSize(const String &collection,
+                                             const String &key) {
+  return innerDriver->compressedSize(collection, key);
+}
+
+bool CachingDatabaseDriver::streamCompressed(const String &collection,
+                                             const String &key,
+                                             ChunkCallback callback) {
+  return innerDriver->streamCompressed(collection, key, callback);
+}
+
+size_t CachingDatabaseDriver::recordLength(const String &collection,
+                                           const String &key) {
+  return innerDriver->recordLength(collection, key);
+}
+
+bool CachingDatabaseDriver::readRange(const String &collection,
+                                      const String &key, size_t offset,
+                                      size_t length, ChunkCallback callback) {
+  return innerDriver->readRange(collection, key, offset, length, callback);
+}
+
+bool CachingDatabaseDriver::setCollectionTtl(const String &collection,
+                                             unsigned long ttlSeconds) {
+  // Expiry is the wrapped driver's call - a cached copy would outlive it
+  if (ttlSeconds > 0) {
+    uncachedCollections.insert(collection);
+    auto collectionIt = entries.find(collection);
+    if (collectionIt != entries.end()) {
+      std::vector<String> keys;
+      for (const auto &entry : collectionIt->second) {
+        keys.push_back(entry.first);
+      }
+      for (const String &key : keys) {
+        invalidate(collection, key);
+      }
+    }
+  } else {
+    uncachedCollections.erase(collection);
+  }
+  return innerDriver->setCollectionTtl(collection, ttlSeconds);
+}
+
+void CachingDatabaseDriver::maintain() { innerDriver->maintain(); }
+
+bool CachingDatabaseDriver::flush() { return innerDriver->flush(); }
+
+bool CachingDatabaseDriver::acceptsName(const String &collection,
+                                        const String &key) {
+  return innerDriver->acceptsName(collection, key);
+}
+
+String CachingDatabaseDriver::getDriverName() const {
+  return String("cached:") + innerDriver->getDriverName();
+}
+
+void CachingDatabaseDriver::clear() {
+  for (auto &collection : entries) {
+    for (auto &entry : collection.second) {
+      allocator.release(entry.second.data);
+    }
+  }
+  entries.clear();
+  lru.clear();
+  usedBytes = 0;
+}
+
+size_t CachingDatabaseDriver::getUsedBytes() const { return usedBytes; }
+
+size_t CachingDatabaseDriver::getMaxBytes() const { return maxBytes; }
+
+size_t CachingDatabaseDriver::getHitCount() const { return hitCount; }
+
+size_t CachingDatabaseDriver::getMissCount() const { return missCount; }
+
+IDatabaseDriver &CachingDatabaseDriver::getInnerDriver() {
+  return *innerDriver;
+}
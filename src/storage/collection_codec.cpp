@@ -0,0 +1,103 @@
+#include "storage/collection_codec.h"
+#include <ArduinoJson.h>
+
+bool CollectionCodec::encodeJson(const Records &records, std::string &out) {
+  JsonDocument doc;
+  JsonArray array = doc.to<JsonArray>();
+  if (array.isNull()) {
+    return false; // Failed to create array
+  }
+
+  for (const auto &pair : records) {
+    JsonObject item = array.add<JsonObject>();
+    if (!item.isNull()) {
+      item["key"] = pair.first.c_str();
+      item["data"] = pair.second.c_str();
+    }
+  }
+
+  // Check if the document overflowed while being populated
+  if (doc.overflowed()) {
+    return false; // Failed to allocate memory
+  }
+
+  return serializeJson(doc, out) > 0;
+}
+
+bool CollectionCodec::decodeJson(const char *text, Records &records) {
+  JsonDocument doc;
+  DeserializationError error = deserializeJson(doc, text);
+  if (error || !doc.is<JsonArray>()) {
+    return false;
+  }
+
+  JsonArray array = doc.as<JsonArray>();
+  for (JsonObject item : array) {
+    if (!item.isNull()) {
+      const char *keyStr = item["key"];
+      const char *dataStr = item["data"];
+      if (keyStr && dataStr &&
+          keyStr[0] != '\0') { // NOSONAR: Safer than strlen for null-check
+        records[String(keyStr)] = String(dataStr);
+      }
+    }
+  }
+  return true;
+}
+
+bool CollectionCodec::encodeMsgPack(const Records &records, std::string &out) {
+  JsonDocument doc;
+  JsonObject root = doc.to<JsonObject>();
+  if (root.isNull()) {
+    return false;
+  }
+
+  for (const auto &pair : records) {
+    // Parse each record straight into the collection document so it is
+    // stored as a typed map instead of a string holding JSON
+    JsonDocument record;
+    DeserializationError error = deserializeJson(record, pair.second.c_str());
+    if (!error && (record.is<JsonObject>() || record.is<JsonArray>())) {
+      root[pair.first.c_str()] = record;
+    } else {
+      root[pair.first.c_str()] = pair.second.c_str();
+    }
+  }
+
+  if (doc.overflowed()) {
+    return false;
+  }
+
+  out.push_back(static_cast<char>(MSGPACK_VERSION));
+  return serializeMsgPack(doc, out) > 0;
+}
+
+bool CollectionCodec::decodeMsgPack(const uint8_t *data, size_t length,
+                                    Records &records) {
+  if (length < 2 || data[0] != MSGPACK_VERSION) {
+    return false;
+  }
+
+  JsonDocument doc;
+  DeserializationError error = deserializeMsgPack(doc, data + 1, length - 1);
+  if (error || !doc.is<JsonObject>()) {
+    return false;
+  }
+
+  std::string text;
+  for (JsonPair pair : doc.as<JsonObject>()) {
+    JsonString key = pair.key();
+    if (key.size() == 0) {
+      continue;
+    }
+    JsonVariant value = pair.value();
+    if (value.is<const char *>()) {
+      records[String(key.c_str())] = String(value.as<const char *>());
+    } else {
+      text.clear();
+      serializeJson(value, text);
+      records[String(key.c_str())] = String(text.c_str());
+    }
+  }
+  return true;
+}
@@ -0,0 +1,569 @@
+#include "storage/indexed_database_driver.h"
+#include "utilities/debug_macros.h"
+#include <algorithm>
+#include <ArduinoJson.h>
+#include <string>
+
+const char *const IndexedDatabaseDriver::INDEX_COLLECTION = "_indexes";
+
+namespace {
+String indexRecordKey(const String &collection, const String &field) {
+  return collection + "." + field;
+}
+
+// Same text form QueryBuilder compares against: strings as-is, booleans as
+// "true"/"false", anything else serialized. Missing fields aren't indexed.
+String indexText(JsonVariantConst field) {
+  if (field.isNull()) {
+    return "";
+  }
+  if (field.is<const char *>()) {
+    return String(field.as<const char *>());
+  }
+  if (field.is<bool>()) {
+    return field.as<bool>() ? "true" : "false";
+  }
+  std::string text;
+  serializeJson(field, text);
+  return String(text.c_str());
+}
+} // namespace
+
+IndexedDatabaseDriver::IndexedDatabaseDriver(
+    std::unique_ptr<IDatabaseDriver> inner)
+    : innerDriver(std::move(inner)) {}
+
+void IndexedDatabaseDriver::addIndex(const String &collection,
+                                     const String &field) {
+  if (collection.length() == 0 || field.length() == 0 ||
+      collection == INDEX_COLLECTION) {
+    return;
+  }
+  if (findIndex(collection, field)) {
+    return;
+  }
+
+  FieldIndex index;
+  index.field = field;
+  indexes[collection].push_back(index);
+  DEBUG_PRINTF("IndexedDatabaseDriver: Indexing %s.%s\n", collection.c_str(),
+               field.c_str());
+}
+
+std::vector<String>
+IndexedDatabaseDriver::getIndexedFields(const String &collection) const {
+  std::vector<String> fields;
+  auto it = indexes.find(collection);
+  if (it != indexes.end()) {
+    for (const FieldIndex &index : it->second) {
+      fields.push_back(index.field);
+    }
+  }
+  return fields;
+}
+
+void IndexedDatabaseDriver::rebuildIndexes(const String &collection) {
+  auto it = indexes.find(collection);
+  if (it == indexes.end()) {
+    return;
+  }
+  for (FieldIndex &index : it->second) {
+    rebuild(collection, index);
+  }
+}
+
+IDatabaseDriver &IndexedDatabaseDriver::inner() { return *innerDriver; }
+
+IndexedDatabaseDriver::FieldIndex *
+IndexedDatabaseDriver::findIndex(const String &collection,
+                                 const String &field) {
+  auto it = indexes.find(collection);
+  if (it == indexes.end()) {
+    return nullptr;
+  }
+  for (FieldIndex &index : it->second) {
+    if (index.field == field) {
+      return &index;
+    }
+  }
+  return nullptr;
+}
+
+void IndexedDatabaseDriver::ensureLoaded(const String &collection,
+                                         FieldIndex &index) {
+  if (index.loaded) {
+    return;
+  }
+
+  String record = innerDriver->retrieve(INDEX_COLLECTION,
+                                        indexRecordKey(collection, index.field));
+  JsonDocument doc;
+  if (record.length() == 0 || deserializeJson(doc, record.c_str()) ||
+      doc["n"].as<size_t>() != innerDriver->count(collection)) {
+    rebuild(collection, index);
+    return;
+  }
+
+  index.entries.clear();
+  index.recordCount = doc["n"].as<size_t>();
+  JsonObject values = doc["v"].as<JsonObject>();
+  for (JsonPair pair : values) {
+    std::vector<String> &keys = index.entries[String(pair.key().c_str())];
+    for (JsonVariant key : pair.value().as<JsonArray>()) {
+      keys.push_back(String(key.as<const char *>()));
+    }
+  }
+
+  std::vector<String> pending;
+  for (JsonVariant key : doc["p"].as<JsonArray>()) {
+    pending.push_back(String(key.as<const char *>()));
+  }
+  settlePending(collection, index, pending);
+  index.loaded = true;
+}
+
+void IndexedDatabaseDriver::settlePending(const String &collection,
+                                          FieldIndex &index,
+                                          const std::vector<String> &keys) {
+  if (keys.empty()) {
+    return;
+  }
+
+  JsonDocument filter;
+  filter[index.field] = true;
+  JsonDocument doc;
+  for (const String &key : keys) {
+    // Held under its old and new values - keep whichever the record has
+    for (auto it = index.entries.begin(); it != index.entries.end();) {
+      std::vector<String> &entryKeys = it->second;
+      entryKeys.erase(std::remove(entryKeys.begin(), entryKeys.end(), key),
+                      entryKeys.end());
+      it = entryKeys.empty() ? index.entries.erase(it) : std::next(it);
+    }
+    String data = innerDriver->retrieve(collection, key);
+    if (data.length() > 0 &&
+        !deserializeJson(doc, data.c_str(),
+                         DeserializationOption::Filter(filter))) {
+      addKey(index, indexText(doc[index.field]), key);
+    }
+  }
+}
+
+void IndexedDatabaseDriver::rebuild(const String &collection,
+                                    FieldIndex &index) {
+  index.entries.clear();
+  index.recordCount = 0;
+
+  JsonDocument filter;
+  filter[index.field] = true;
+  JsonDocument doc;
+
+  innerDriver->forEach(collection, [&](const String &key, const String &data) {
+    index.recordCount++;
+    if (!deserializeJson(doc, data.c_str(),
+                         DeserializationOption::Filter(filter))) {
+      String value = indexText(doc[index.field]);
+      if (value.length() > 0) {
+        index.entries[value].push_back(key);
+      }
+    }
+    return true;
+  });
+
+  index.loaded = true;
+  persist(collection, index);
+  DEBUG_PRINTF("IndexedDatabaseDriver: Rebuilt %s.%s (%d records)\n",
+               collection.c_str(), index.field.c_str(),
+               (int)index.recordCount);
+}
+
+String IndexedDatabaseDriver::serialize(const FieldIndex &index,
+                                        const std::vector<String> &pending) {
+  JsonDocument doc;
+  doc["n"] = index.recordCount;
+  JsonObject values = doc["v"].to<JsonObject>();
+  for (const auto &entry : index.entries) {
+    JsonArray keys = values[entry.first.c_str()].to<JsonArray>();
+    for (const String &key : entry.second) {
+      keys.add(key.c_str());
+    }
+  }
+  if (!pending.empty()) {
+    JsonArray keys = doc["p"].to<JsonArray>();
+    for (const String &key : pending) {
+      keys.add(key.c_str());
+    }
+  }
+
+  std::string record;
+  serializeJson(doc, record);
+  return String(record.c_str());
+}
+
+void IndexedDatabaseDriver::persist(const String &collection,
+                                    const FieldIndex &index) {
+  if (!innerDriver->store(INDEX_COLLECTION,
+                          indexRecordKey(collection, index.field),
+                          serialize(index))) {
+    DEBUG_PRINTF("IndexedDatabaseDriver: Failed to persist index %s.%s\n",
+                 collection.c_str(), index.field.c_str());
+  }
+}
+
+void IndexedDatabaseDriver::extractValues(const String &collection,
+                                          const String &data,
+                                          std::vector<String> &values) {
+  const std::vector<FieldIndex> &fields = indexes[collection];
+  values.assign(fields.size(), String());
+  if (data.length() == 0) {
+    return;
+  }
+
+  JsonDocument filter;
+  for (const FieldIndex &index : fields) {
+    filter[index.field] = true;
+  }
+  JsonDocument doc;
+  if (deserializeJson(doc, data.c_str(),
+                      DeserializationOption::Filter(filter))) {
+    return;
+  }
+  for (size_t i = 0; i < fields.size(); i++) {
+    values[i] = indexText(doc[fields[i].field]);
+  }
+}
+
+void IndexedDatabaseDriver::addKey(FieldIndex &index, const String &value,
+                                   const String &key) {
+  if (value.length() == 0) {
+    return;
+  }
+  std::vector<String> &keys = index.entries[value];
+  if (std::find(keys.begin(), keys.end(), key) == keys.end()) {
+    keys.push_back(key);
+  }
+}
+
+void IndexedDatabaseDriver::removeKey(FieldIndex &index, const String &value,
+                                      const String &key) {
+  auto it = index.entries.find(value);
+  if (it == index.entries.end()) {
+    return;
+  }
+  std::vector<String> &keys = it->second;
+  keys.erase(std::remove(keys.begin(), keys.end(), key), keys.end());
+  if (keys.empty()) {
+    index.entries.erase(it);
+  }
+}
+
+bool IndexedDatabaseDriver::store(const String &collection, const String &key,
+                                  const String &data) {
+  auto it = indexes.find(collection);
+  if (it == indexes.end()) {
+    return innerDriver->store(collection, key, data);
+  }
+  std::vector<FieldIndex> &fields = it->second;
+  for (FieldIndex &index : fields) {
+    ensureLoaded(collection, index);
+  }
+
+  // The previous record tells us which index entries to drop
+  String previous = innerDriver->retrieve(collection, key);
+  bool inserted = previous.length() == 0;
+  std::vector<String> oldValues;
+  std::vector<String> newValues;
+  extractValues(collection, previous, oldValues);
+  extractValues(collection, data, newValues);
+
+  // Indexes first, holding the key under its old and new values, so they
+  // stay right whether or not the data write lands
+  std::vector<bool> changed(fields.size());
+  std::vector<String> pending(1, key);
+  WriteBatch indexWrites(innerDriver.get());
+  for (size_t i = 0; i < fields.size(); i++) {
+    changed[i] = inserted || oldValues[i] != newValues[i];
+    if (!changed[i]) {
+      continue; // Unchanged - no index write
+    }
+    FieldIndex &index = fields[i];
+    if (inserted) {
+      index.recordCount++;
+    }
+    addKey(index, newValues[i], key);
+    indexWrites.put(INDEX_COLLECTION, indexRecordKey(collection, index.field),
+                    serialize(index, pending));
+  }
+  if (!indexWrites.empty() && !indexWrites.commit()) {
+    DEBUG_PRINTF("IndexedDatabaseDriver: Failed to persist %s indexes\n",
+                 collection.c_str());
+  }
+
+  if (!innerDriver->store(collection, key, data)) {
+    // Reload from the persisted records, which settle the key
+    for (size_t i = 0; i < fields.size(); i++) {
+      if (changed[i]) {
+        fields[i].loaded = false;
+      }
+    }
+    return false;
+  }
+
+  for (size_t i = 0; i < fields.size(); i++) {
+    if (changed[i] && oldValues[i] != newValues[i]) {
+      removeKey(fields[i], oldValues[i], key);
+    }
+  }
+  return true;
+}
+
+bool IndexedDatabaseDriver::applyBatch(const WriteBatch &batch) {
+  struct Change {
+    String collection;
+    String key;
+    bool inserted;
+    bool removed;
+    std::vector<String> oldValues;
+    std::vector<String> newValues;
+  };
+
+  // Work out index changes against the records as they stand, before the
+  // wrapped driver applies the batch
+  std::vector<Change> changes;
+  for (const WriteBatch::Operation &op : batch.collapsed()) {
+    auto it = indexes.find(op.collection);
+    if (it == indexes.end()) {
+      continue;
+    }
+    for (FieldIndex &index : it->second) {
+      ensureLoaded(op.collection, index);
+    }
+
+    String previous = innerDriver->retrieve(op.collection, op.key);
+    if (op.isRemove && previous.length() == 0) {
+      continue;
+    }
+    Change change;
+    change.collection = op.collection;
+    change.key = op.key;
+    change.inserted = previous.length() == 0;
+    change.removed = op.isRemove;
+    extractValues(op.collection, previous, change.oldValues);
+    extractValues(op.collection, op.isRemove ? String() : op.data,
+                  change.newValues);
+    changes.push_back(change);
+  }
+
+  // As in store(): every changed index goes out ahead of the records, with
+  // the batch's keys pending under both values
+  struct Touched {
+    String collection;
+    FieldIndex *index;
+    std::vector<String> pending;
+  };
+  std::vector<Touched> touched;
+  for (const Change &change : changes) {
+    std::vector<FieldIndex> &fields = indexes[change.collection];
+    for (size_t i = 0; i < fields.size(); i++) {
+      FieldIndex &index = fields[i];
+      if (change.removed) {
+        if (index.recordCount > 0) {
+          index.recordCount--;
+        }
+      } else if (change.inserted) {
+        index.recordCount++;
+      } else if (change.oldValues[i] == change.newValues[i]) {
+        continue;
+      }
+      addKey(index, change.newValues[i], change.key);
+
+      auto entry = std::find_if(
+          touched.begin(), touched.end(),
+          [&index](const Touched &t) { return t.index == &index; });
+      if (entry == touched.end()) {
+        Touched t;
+        t.collection = change.collection;
+        t.index = &index;
+        entry = touched.insert(touched.end(), t);
+      }
+      entry->pending.push_back(change.key);
+    }
+  }
+
+  // Index records share one collection, so they go out as one batch too
+  WriteBatch indexWrites(innerDriver.get());
+  for (const Touched &entry : touched) {
+    indexWrites.put(INDEX_COLLECTION,
+                    indexRecordKey(entry.collection, entry.index->field),
+                    serialize(*entry.index, entry.pending));
+  }
+  if (!indexWrites.empty() && !indexWrites.commit()) {
+    DEBUG_PRINTLN("IndexedDatabaseDriver: Failed to persist batch indexes");
+  }
+
+  if (!innerDriver->applyBatch(batch)) {
+    // Some operations may have landed - reload, settling the pending keys
+    for (Touched &entry : touched) {
+      entry.index->loaded = false;
+    }
+    return false;
+  }
+
+  for (const Change &change : changes) {
+    std::vector<FieldIndex> &fields = indexes[change.collection];
+    for (size_t i = 0; i < fields.size(); i++) {
+      if (change.oldValues[i] != change.newValues[i]) {
+        removeKey(fields[i], change.oldValues[i], change.key);
+      }
+    }
+  }
+  return true;
+}
+
+String IndexedDatabaseDriver::retrieve(const String &collection,
+                                       const String &key) {
+  return innerDriver->retrieve(collection, key);
+}
+
+bool IndexedDatabaseDriver::remove(const String &collection,
+                                   const String &key) {
+  auto it = indexes.find(collection);
+  if (it == indexes.end()) {
+    return innerDriver->remove(collection, key);
+  }
+  std::vector<FieldIndex> &fields = it->second;
+  for (FieldIndex &index : fields) {
+    ensureLoaded(collection, index);
+  }
+
+  String previous = innerDriver->retrieve(collection, key);
+  if (previous.length() == 0) {
+    return innerDriver->remove(collection, key);
+  }
+
+  // The entries keep the key until the record is gone; it's pending
+  std::vector<String> pending(1, key);
+  WriteBatch indexWrites(innerDriver.get());
+  for (FieldIndex &index : fields) {
+    if (index.recordCount > 0) {
+      index.recordCount--;
+    }
+    indexWrites.put(INDEX_COLLECTION, indexRecordKey(collection, index.field),
+                    serialize(index, pending));
+  }
+  if (!indexWrites.commit()) {
+    DEBUG_PRINTF("IndexedDatabaseDriver: Failed to persist %s indexes\n",
+                 collection.c_str());
+  }
+
+  if (!innerDriver->remove(collection, key)) {
+    for (FieldIndex &index : fields) {
+      index.loaded = false; // Count is off now, so the reload rebuilds
+    }
+    return false;
+  }
+
+  std::vector<String> oldValues;
+  extractValues(collection, previous, oldValues);
+  for (size_t i = 0; i < fields.size(); i++) {
+    removeKey(fields[i], oldValues[i], key);
+  }
+  return true;
+}
+
+std::vector<String> IndexedDatabaseDriver::listKeys(const String &collection) {
+  return innerDriver->listKeys(collection);
+}
+
+bool IndexedDatabaseDriver::exists(const String &collection,
+                                   const String &key) {
+  return innerDriver->exists(collection, key);
+}
+
+size_t IndexedDatabaseDriver::forEach(const String &collection,
+                                      RecordCallback callback) {
+  return innerDriver->forEach(collection, callback);
+}
+
+size_t IndexedDatabaseDriver::scanPrefix(const String &collection,
+                                         const String &prefix,
+                                         RecordCallback callback) {
+  return innerDriver->scanPrefix(collection, prefix, callback);
+}
+
+size_t IndexedDatabaseDriver::scanRange(const String &collection,
+                                        const String &from, const String &to,
+                                        RecordCallback callback) {
+  return innerDriver->scanRange(collection, from, to, callback);
+}
+
+size_t IndexedDatabaseDriver::count(const String &collection) {
+  return innerDriver->count(collection);
+}
+
+bool IndexedDatabaseDriver::setRecordFormat(const String &collection,
+                                            RecordFormat format) {
+  return innerDriver->setRecordFormat(collection, format);
+}
+
+size_t IndexedDatabaseDriver::compressedSize(const String &collection,
+                                             const String &key) {
+  return innerDriver->compressedSize(collection, key);
+}
+
+bool IndexedDatabaseDriver::streamCompressed(const String &collection,
+                                             const String &key,
+                                             ChunkCallback callback) {
+  return innerDriver->streamCompressed(collection, key, callback);
+}
+
+size_t IndexedDatabaseDriver::recordLength(const String &collection,
+                                           const String &key) {
+  return innerDriver->recordLength(collection, key);
+}
+
+bool IndexedDatabaseDriver::readRange(const String &collection,
+                                      const String &key, size_t offset,
+                                      size_t length, ChunkCallback callback) {
+  return innerDriver->readRange(collection, key, offset, length, callback);
+}
+
+bool IndexedDatabaseDriver::setCollectionTtl(const String &collection,
+                                             unsigned long ttlSeconds) {
+  return innerDriver->setCollectionTtl(collection, ttlSeconds);
+}
+
+void IndexedDatabaseDriver::maintain() { innerDriver->maintain(); }
+
+bool IndexedDatabaseDriver::flush() { return innerDriver->flush(); }
+
+bool IndexedDatabaseDriver::acceptsName(const String &collection,
+                                        const String &key) {
+  return innerDriver->acceptsName(collection, key);
+}
+
+bool IndexedDatabaseDriver::hasIndex(const String &collection,
+                                     const String &field) {
+  return findIndex(collection, field) != nullptr;
+}
+
+bool IndexedDatabaseDriver::lookupIndex(const String &collection,
+                                        const String &field,
+                                        const String &value,
+                                        std::vector<String> &keys) {
+  FieldIndex *index = findIndex(collection, field);
+  if (!index) {
+    return false;
+  }
+  ensureLoaded(collection, *index);
+
+  auto it = index->entries.find(value);
+  if (it != index->entries.end()) {
+    keys.insert(keys.end(), it->second.begin(), it->second.end());
+  }
+  return true;
+}
+
+String IndexedDatabaseDriver::getDriverName() const {
+  return innerDriver->getDriverName();
+}
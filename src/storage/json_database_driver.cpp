@@ -1,11 +1,11 @@
 #include "storage/json_database_driver.h"
-#include <ArduinoJson.h>
 #include <string>
+#include <vector>
 
 #include <Preferences.h>
 
 JsonDatabaseDriver::JsonDatabaseDriver()
-    : driverName("json"), initialized(false) {}
+    : driverName("json"), initialized(false), iterationDepth(0) {}
 
 JsonDatabaseDriver::~JsonDatabaseDriver() {
   // Cleanup if needed
@@ -31,31 +31,34 @@ void JsonDatabaseDriver::loadCollection(const String &collection) {
   }
 
   // Initialize collection map
-  cache[collection] = std::map<String, String>();
+  std::map<String, String> &records = cache[collection];
 
   Preferences prefs;
   prefs.begin("storage", false);
 
-  String jsonData = prefs.getString(collection.c_str(), "[]");
-  prefs.end();
-
-  // Parse JSON and populate cache
-  JsonDocument doc;
-  DeserializationError error = deserializeJson(doc, jsonData.c_str());
-
-  if (!error && doc.is<JsonArray>()) {
-    JsonArray array = doc.as<JsonArray>();
-    for (JsonObject item : array) {
-      if (!item.isNull()) {
-        const char *keyStr = item["key"];
-        const char *dataStr = item["data"];
-        if (keyStr && dataStr &&
-            keyStr[0] != '\0') { // NOSONAR: Safer than strlen for null-check
-          cache[collection][String(keyStr)] = String(dataStr ? dataStr : "");
-        }
-      }
+  String blobKey = getBlobKey(collection);
+  auto loadBlob = [&]() {
+    size_t length = prefs.getBytesLength(blobKey.c_str());
+    if (length == 0) {
+      return false;
     }
+    std::vector<uint8_t> blob(length);
+    return prefs.getBytes(blobKey.c_str(), blob.data(), length) == length &&
+           CollectionCodec::decodeMsgPack(blob.data(), length, records);
+  };
+  auto loadText = [&]() {
+    String jsonData = prefs.getString(collection.c_str(), "");
+    return jsonData.length() > 0 &&
+           CollectionCodec::decodeJson(jsonData.c_str(), records);
+  };
+
+  // A format switch writes the new key before removing the old one, so if
+  // both exist the configured format's copy is the newer
+  bool preferBlob = getRecordFormat(collection) == RecordFormat::MessagePack;
+  if (!(preferBlob ? loadBlob() : loadText())) {
+    preferBlob ? loadText() : loadBlob();
   }
+  prefs.end();
 }
 
 void JsonDatabaseDriver::saveCollection(const String &collection) {
@@ -66,42 +69,42 @@ void JsonDatabaseDriver::saveCollection(const String &collection) {
     return; // Nothing to save
   }
 
-  // Calculate dynamic buffer size based on collection data
-  size_t jsonSize = calculateJsonSize(collectionIt->second);
+  String blobKey = getBlobKey(collection);
+  Preferences prefs;
 
-  // Build JSON array from cache
-  JsonDocument doc;
-  JsonArray array = doc.to<JsonArray>();
-  if (array.isNull()) {
-    return; // Failed to create array
-  }
+  if (getRecordFormat(collection) == RecordFormat::MessagePack) {
+    std::string blob;
+    if (!CollectionCodec::encodeMsgPack(collectionIt->second, blob)) {
+      return; // Failed to allocate memory
+    }
 
-  for (const auto &pair : collectionIt->second) {
-    JsonObject item = array.add<JsonObject>();
-    if (!item.isNull()) {
-      item["key"] = pair.first.c_str();
-      item["data"] = pair.second.c_str();
+    prefs.begin("storage", false);
+    if (prefs.putBytes(blobKey.c_str(), blob.data(), blob.size()) ==
+            blob.size() &&
+        prefs.isKey(collection.c_str())) {
+      prefs.remove(collection.c_str()); // Migrated from JSON text
     }
+    prefs.end();
+    return;
   }
 
-  // Check if the document overflowed while being populated
-  if (doc.overflowed()) {
-    return; // Failed to allocate memory
-  }
+  // Calculate dynamic buffer size based on collection data
+  size_t jsonSize = calculateJsonSize(collectionIt->second);
 
   std::string serialized;
   size_t reserveSize = jsonSize > 256 ? jsonSize - 256 : 256;
   serialized.reserve(reserveSize);
 
-  size_t serializedSize = serializeJson(doc, serialized);
-  if (serializedSize == 0) {
+  if (!CollectionCodec::encodeJson(collectionIt->second, serialized)) {
     return; // Serialization failed
   }
   String jsonData(serialized.c_str());
 
-  Preferences prefs;
   prefs.begin("storage", false);
-  prefs.putString(collection.c_str(), jsonData);
+  if (prefs.putString(collection.c_str(), jsonData) == jsonData.length() &&
+      blobKey.length() <= MAX_NVS_KEY_LENGTH && prefs.isKey(blobKey.c_str())) {
+    prefs.remove(blobKey.c_str()); // Switched back from MessagePack
+  }
   prefs.end();
 }
 
@@ -191,6 +194,150 @@ bool JsonDatabaseDriver::exists(const String &collection, const String &key) {
   return false;
 }
 
+size_t JsonDatabaseDriver::forEach(const String &collection,
+                                   RecordCallback callback) {
+  return scanFrom(collection, "", [](const String &key) { return true; },
+                  callback);
+}
+
+size_t JsonDatabaseDriver::scanPrefix(const String &collection,
+                                      const String &prefix,
+                                      RecordCallback callback) {
+  return scanFrom(
+      collection, prefix,
+      [&prefix](const String &key) { return key.startsWith(prefix); },
+      callback);
+}
+
+size_t JsonDatabaseDriver::scanRange(const String &collection,
+                                     const String &from, const String &to,
+                                     RecordCallback callback) {
+  return scanFrom(
+      collection, from,
+      [&to](const String &key) { return to.length() == 0 || key < to; },
+      callback);
+}
+
+size_t JsonDatabaseDriver::scanFrom(
+    const String &collection, const String &from,
+    const std::function<bool(const String &)> &inRange,
+    RecordCallback callback) {
+  size_t visited = 0;
+
+  if (collection.length() == 0 || !callback) {
+    return visited;
+  }
+
+  loadCollection(collection);
+
+  auto collectionIt = cache.find(collection);
+  if (collectionIt == cache.end()) {
+    return visited;
+  }
+
+  // Records are already in RAM - hand them out directly instead of copying
+  // every key into a vector and looking each one up again. The cache is
+  // sorted by key, so a range is a seek plus a walk to its first miss.
+  iterationDepth++;
+  const std::map<String, String> &records = collectionIt->second;
+  for (auto it = records.lower_bound(from);
+       it != records.end() && inRange(it->first); ++it) {
+    if (it->second.length() == 0) {
+      continue; // Reads as missing via retrieve() too
+    }
+    visited++;
+    if (!callback(it->first, it->second)) {
+      break;
+    }
+  }
+  iterationDepth--;
+
+  return visited;
+}
+
+size_t JsonDatabaseDriver::count(const String &collection) {
+  if (collection.length() == 0) {
+    return 0;
+  }
+
+  loadCollection(collection);
+
+  auto collectionIt = cache.find(collection);
+  if (collectionIt == cache.end()) {
+    return 0;
+  }
+
+  // Empty values read as missing, and forEach() skips them - count agrees
+  size_t records = 0;
+  for (const auto &record : collectionIt->second) {
+    if (record.second.length() > 0) {
+      records++;
+    }
+  }
+  return records;
+}
+
+bool JsonDatabaseDriver::applyBatch(const WriteBatch &batch) {
+  bool ok = true;
+
+  // One collection at a time - loading the next one may evict the cache,
+  // so each collection is saved before moving on
+  for (const String &collection : batch.collections()) {
+    if (collection.length() == 0) {
+      ok = false;
+      continue;
+    }
+
+    loadCollection(collection);
+    std::map<String, String> &records = cache[collection];
+    bool changed = false;
+    for (const WriteBatch::Operation &op : batch.operations()) {
+      if (op.collection != collection) {
+        continue;
+      }
+      if (op.key.length() == 0) {
+        ok = false;
+      } else if (op.isRemove) {
+        changed |= records.erase(op.key) > 0;
+      } else {
+        records[op.key] = op.data;
+        changed = true;
+      }
+    }
+
+    if (changed) {
+      saveCollection(collection);
+    }
+  }
+
+  return ok;
+}
+
+bool JsonDatabaseDriver::setRecordFormat(const String &collection,
+                                         RecordFormat format) {
+  if (collection.length() == 0 || format == RecordFormat::Gzip) {
+    return false; // Whole-collection blobs; records aren't stored singly
+  }
+  if (format == RecordFormat::MessagePack &&
+      getBlobKey(collection).length() > MAX_NVS_KEY_LENGTH) {
+    return false; // No room for the blob key
+  }
+
+  // Takes effect on the next write; the cached records are format-neutral
+  formats[collection] = format;
+  return true;
+}
+
+RecordFormat JsonDatabaseDriver::getRecordFormat(
+    const String &collection) const {
+  auto it = formats.find(collection);
+  return it != formats.end() ? it->second : RecordFormat::Json;
+}
+
+String JsonDatabaseDriver::getBlobKey(const String &collection) {
+  return "~" + collection;
+}
+
 String JsonDatabaseDriver::getDriverName() const { return driverName; }
 
 void JsonDatabaseDriver::clearCache() { cache.clear(); }
@@ -206,6 +353,9 @@ void JsonDatabaseDriver::clearCollection(const String &collection) {
 void JsonDatabaseDriver::evictOldCollections() {
   // Simple eviction: clear all collections if we're at the limit
   // In a more sophisticated implementation, we could use LRU eviction
+  if (iterationDepth > 0) {
+    return; // forEach() is iterating a cached collection
+  }
   if (cache.size() >= MAX_CACHED_COLLECTIONS) {
     cache.clear();
   }
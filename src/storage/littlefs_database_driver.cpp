@@ -1,16 +1,43 @@
 #include "storage/littlefs_database_driver.h"
 #include "FS.h"
+#include "core/checksum.h"
+#include "core/gzip.h"
 #include "utilities/debug_macros.h"
 #include <algorithm>
 #include <ArduinoJson.h>
+#include <cstdio>
+#include <cstring>
 #include <string>
 
 #ifdef NATIVE_PLATFORM
 #include <testing/native_debug_macros_compat.h>
 #endif
 
+using WebPlatform::Core::Checksum;
+using WebPlatform::Core::Gzip;
+
+namespace {
+const char TEMP_SUFFIX[] = ".tmp";
+// Batch values are staged under their own suffix: recovery may promote a
+// lone .tmp, but a staged value only lands through the batch manifest
+const char STAGED_SUFFIX[] = ".staged";
+// Written (via rename) once every value of a batch is staged; while it
+// exists the batch is committed and recovery replays it. A leading '.'
+// can't clash with a collection directory (see isValidName).
+const char BATCH_MANIFEST[] = "/.batch";
+const char RECORD_SUFFIX[] = ".json";
+const size_t RECORD_SUFFIX_LENGTH = sizeof(RECORD_SUFFIX) - 1;
+
+// Trailer appended after the JSON body: "\n#crc32:" + 8 hex digits. A JSON
+// document can never end this way, so its presence is unambiguous.
+const char CHECKSUM_MARKER[] = "\n#crc32:";
+const size_t CHECKSUM_MARKER_LENGTH = sizeof(CHECKSUM_MARKER) - 1;
+const size_t CHECKSUM_TRAILER_LENGTH = CHECKSUM_MARKER_LENGTH + 8;
+} // namespace
+
 LittleFSDatabaseDriver::LittleFSDatabaseDriver(const String &baseStoragePath)
-    : driverName("littlefs"), initialized(false), basePath(baseStoragePath) {
+    : driverName("littlefs"), initialized(false), basePath(baseStoragePath),
+      checksumEnabled(false), shardingEnabled(false) {
   // Ensure base path starts and ends correctly
   if (!basePath.startsWith("/")) {
     basePath = "/" + basePath;
@@ -48,12 +75,38 @@ void LittleFSDatabaseDriver::ensureInitialized() {
     initialized = true;
     DEBUG_PRINTF("LittleFSDatabaseDriver: Initialized with base path: %s\n",
                  basePath.c_str());
+
+    recoverInterruptedWrites();
   }
 }
 
 String LittleFSDatabaseDriver::getFilePath(const String &collection,
                                            const String &key) {
-  return basePath + "/" + collection + "/" + key + ".json";
+  return getRecordDirectory(collection, key) + "/" + key + RECORD_SUFFIX;
+}
+
+String LittleFSDatabaseDriver::getShardName(const String &key) {
+  uint32_t hash = Checksum::crc32(
+      reinterpret_cast<const uint8_t *>(key.c_str()), key.length());
+  char shard[3];
+  snprintf(shard, sizeof(shard), "%02x", (unsigned)(hash % SHARD_COUNT));
+  return String(shard);
+}
+
+String LittleFSDatabaseDriver::getRecordDirectory(const String &collection,
+                                                  const String &key) {
+  if (!shardingEnabled) {
+    return getCollectionPath(collection);
+  }
+  return getCollectionPath(collection) + "/" + getShardName(key);
+}
+
+String LittleFSDatabaseDriver::getTempFilePath(const String &filePath) {
+  return filePath + TEMP_SUFFIX;
+}
+
+String LittleFSDatabaseDriver::getStagedFilePath(const String &filePath) {
+  return filePath + STAGED_SUFFIX;
 }
 
 String LittleFSDatabaseDriver::getCollectionPath(const String &collection) {
@@ -82,6 +135,157 @@ bool LittleFSDatabaseDriver::ensureCollectionDirectory(
   return true;
 }
 
+bool LittleFSDatabaseDriver::ensureRecordDirectory(const String &collection,
+                                                   const String &key) {
+  if (!ensureCollectionDirectory(collection)) {
+    return false;
+  }
+  if (!shardingEnabled) {
+    return true;
+  }
+
+  String shardPath = getRecordDirectory(collection, key);
+  if (!LittleFS.exists(shardPath) && !LittleFS.mkdir(shardPath)) {
+    DEBUG_PRINTF("LittleFSDatabaseDriver: Failed to create shard directory: "
+                 "%s\n",
+                 shardPath.c_str());
+    return false;
+  }
+  return true;
+}
+
+bool LittleFSDatabaseDriver::isShardName(const String &name) {
+  if (name.length() != 2) {
+    return false;
+  }
+  for (size_t i = 0; i < 2; i++) {
+    char c = name.charAt(i);
+    if (!((c >= '0' && c <= '9') || (c >= 'a' && c <= 'f'))) {
+      return false;
+    }
+  }
+  return true;
+}
+
+String LittleFSDatabaseDriver::entryName(File &file) {
+  String name = file.name();
+  int slash = name.lastIndexOf('/');
+  return slash >= 0 ? name.substring(slash + 1) : name;
+}
+
+std::set<String> &
+LittleFSDatabaseDriver::loadKeyDirectory(const String &collection) {
+  auto it = keyDirectory.find(collection);
+  if (it != keyDirectory.end()) {
+    return it->second;
+  }
+
+  ensureInitialized();
+  std::set<String> &keys = keyDirectory[collection];
+
+  String collectionPath = getCollectionPath(collection);
+  if (!LittleFS.exists(collectionPath)) {
+    return keys;
+  }
+  File dir = LittleFS.open(collectionPath);
+  if (!dir || !dir.isDirectory()) {
+    return keys;
+  }
+
+  // Records sitting where the other layout puts them: key -> current path
+  std::vector<std::pair<String, String>> misplaced;
+  std::vector<String> shards;
+
+  File entry = dir.openNextFile();
+  while (entry) {
+    String name = entryName(entry);
+    if (entry.isDirectory()) {
+      if (isShardName(name)) {
+        shards.push_back(collectionPath + "/" + name);
+      }
+    } else if (name.endsWith(RECORD_SUFFIX)) {
+      String key = name.substring(0, name.length() - RECORD_SUFFIX_LENGTH);
+      if (shardingEnabled) {
+        misplaced.push_back(std::make_pair(key, collectionPath + "/" + name));
+      } else {
+        keys.insert(key);
+      }
+    }
+    entry = dir.openNextFile();
+  }
+  dir.close();
+
+  for (const String &shardPath : shards) {
+    File shard = LittleFS.open(shardPath);
+    if (!shard || !shard.isDirectory()) {
+      continue;
+    }
+    File file = shard.openNextFile();
+    while (file) {
+      String name = entryName(file);
+      if (!file.isDirectory() && name.endsWith(RECORD_SUFFIX)) {
+        String key = name.substring(0, name.length() - RECORD_SUFFIX_LENGTH);
+        String path = shardPath + "/" + name;
+        if (shardingEnabled && path == getFilePath(collection, key)) {
+          keys.insert(key);
+        } else {
+          misplaced.push_back(std::make_pair(key, path));
+        }
+      }
+      file = shard.openNextFile();
+    }
+    shard.close();
+  }
+
+  // Sharding was switched since these were written - move them over once
+  // rather than looking in both places on every access
+  bool movedAll = true;
+  for (const auto &record : misplaced) {
+    const String &key = record.first;
+    if (keys.count(key) > 0) {
+      // Rewritten under the current layout since - that copy is newer
+      LittleFS.remove(record.second);
+      continue;
+    }
+    if (ensureRecordDirectory(collection, key) &&
+        LittleFS.rename(record.second, getFilePath(collection, key))) {
+      keys.insert(key);
+    } else {
+      DEBUG_PRINTF("LittleFSDatabaseDriver: Failed to move %s\n",
+                   record.second.c_str());
+      movedAll = false;
+    }
+  }
+  if (!shardingEnabled && movedAll) {
+    for (const String &shardPath : shards) {
+      LittleFS.rmdir(shardPath);
+    }
+  }
+
+  DEBUG_PRINTF("LittleFSDatabaseDriver: Loaded %u key(s) of %s (%u moved)\n",
+               keys.size(), collection.c_str(), misplaced.size());
+  return keys;
+}
+
+void LittleFSDatabaseDriver::updateKeyDirectory(const String &collection,
+                                                const String &key,
+                                                bool present) {
+  auto it = keyDirectory.find(collection);
+  if (it == keyDirectory.end()) {
+    return; // Not loaded yet - the scan will pick the change up
+  }
+  if (present) {
+    it->second.insert(key);
+  } else {
+    it->second.erase(key);
+  }
+}
+
+bool LittleFSDatabaseDriver::hasKey(const String &collection,
+                                    const String &key) {
+  return loadKeyDirectory(collection).count(key) > 0;
+}
+
 bool LittleFSDatabaseDriver::isValidName(const String &name) {
   if (name.length() == 0 || name.length() > 64) {
     return false;
@@ -226,69 +430,10 @@ String LittleFSDatabaseDriver::retrieveLargeFile(File &file, size_t fileSize,
   return content;
 }
 
-bool LittleFSDatabaseDriver::store(const String &collection, const String &key,
-                                   const String &data) {
-  if (!isValidName(collection) || !isValidName(key)) {
-    DEBUG_PRINTLN("LittleFSDatabaseDriver: Invalid collection or key name");
-    return false;
-  }
-
-  if (!ensureCollectionDirectory(collection)) {
-    return false;
-  }
-
-  String filePath = getFilePath(collection, key);
-
-  File file = LittleFS.open(filePath, FILE_WRITE);
-  if (!file) {
-    DEBUG_PRINTF(
-        "LittleFSDatabaseDriver: Failed to open file for writing: %s\n",
-        filePath.c_str());
-    return false;
-  }
-
-  size_t written = file.print(data);
-  file.close();
-
-  if (written == data.length()) {
-    // Add to cache if small enough
-    addToCache(filePath, data);
-    DEBUG_PRINTF("LittleFSDatabaseDriver: Stored %s/%s (%u bytes)\n",
-                 collection.c_str(), key.c_str(), data.length());
-    return true;
-  } else {
-    DEBUG_PRINTF("LittleFSDatabaseDriver: Write failed for %s/%s\n",
-                 collection.c_str(), key.c_str());
-    return false;
-  }
-}
-
-String LittleFSDatabaseDriver::retrieve(const String &collection,
-                                        const String &key) {
-  if (!isValidName(collection) || !isValidName(key)) {
-    return String();
-  }
-
-  ensureInitialized();
-
-  String filePath = getFilePath(collection, key);
-
-  // Check cache first
-  String cached = getFromCache(filePath);
-  if (cached.length() > 0) {
-    return cached;
-  }
-
-  if (!LittleFS.exists(filePath)) {
-    return String();
-  }
-
-  File file = LittleFS.open(filePath, FILE_READ);
-  if (!file) {
-    DEBUG_PRINTF(
-        "LittleFSDatabaseDriver: Failed to open file for reading: %s\n",
-        filePath.c_str());
-    return String();
+String LittleFSDatabaseDriver::readRecord(File &file,
+                                          const String &filePath) {
+  if (isCompressedFile(file)) {
+    return readCompressedRecord(file, filePath);
   }
 
   size_t fileSize = file.size();
@@ -298,7 +443,6 @@ String LittleFSDatabaseDriver::retrieve(const String &collection,
 
   if (fileSize <= 16384) { // 16KB - use simple read
     content = file.readString();
-    file.close();
 
     if (content.length() != fileSize) {
       DEBUG_PRINTF("LittleFSDatabaseDriver: Simple read size mismatch for %s: "
@@ -308,7 +452,6 @@ String LittleFSDatabaseDriver::retrieve(const String &collection,
     }
   } else { // Large file - use improved chunked reading
     content = retrieveLargeFile(file, fileSize, filePath);
-    file.close();
 
     if (content.length() == 0) {
       DEBUG_PRINTF(
@@ -342,6 +485,320 @@ String LittleFSDatabaseDriver::retrieve(const String &collection,
                "%d bytes - SUCCESS\n",
                filePath.c_str(), fileSize, content.length());
 
+  if (!verifyAndStripChecksum(content, filePath)) {
+    return String(); // Corrupt record reads as missing
+  }
+
+  return content;
+}
+
+bool LittleFSDatabaseDriver::isCompressedFile(File &file) {
+  uint8_t magic[2];
+  size_t bytesRead =
+      file.readBytes(reinterpret_cast<char *>(magic), sizeof(magic));
+  file.seek(0);
+  return Gzip::isGzip(magic, bytesRead);
+}
+
+String LittleFSDatabaseDriver::readCompressedRecord(File &file,
+                                                    const String &filePath) {
+  size_t fileSize = file.size();
+  if (fileSize < Gzip::HEADER_SIZE + Gzip::TRAILER_SIZE) {
+    return String();
+  }
+
+  // The trailer records the inflated size, so the output is allocated once.
+  // Capped at deflate's best-case ratio in case the trailer is corrupt.
+  uint8_t trailer[Gzip::TRAILER_SIZE];
+  file.seek(fileSize - Gzip::TRAILER_SIZE);
+  file.readBytes(reinterpret_cast<char *>(trailer), sizeof(trailer));
+  file.seek(0);
+
+  std::string inflated;
+  inflated.reserve(
+      std::min<size_t>(Gzip::storedSize(trailer), fileSize * 1032));
+
+  // Pull the compressed bytes in small reads - the gzip stream itself is
+  // never held in RAM
+  Gzip::Source source = [&file](uint8_t *buffer, size_t capacity) {
+    return file.readBytes(reinterpret_cast<char *>(buffer), capacity);
+  };
+  if (!Gzip::decompress(source, inflated)) {
+    DEBUG_PRINTF("LittleFSDatabaseDriver: Corrupt gzip record %s\n",
+                 filePath.c_str());
+    return String(); // Corrupt record reads as missing
+  }
+  if (inflated.find('\0') != std::string::npos) {
+    DEBUG_PRINTF("LittleFSDatabaseDriver: gzip record %s is not text\n",
+                 filePath.c_str());
+    return String();
+  }
+
+  String content;
+  content.reserve(inflated.size());
+  content += inflated.c_str();
+  DEBUG_PRINTF("LittleFSDatabaseDriver: Inflated %s: %d -> %d bytes\n",
+               filePath.c_str(), fileSize, content.length());
+  return content;
+}
+
+size_t LittleFSDatabaseDriver::plainRecordLength(File &file) {
+  size_t fileSize = file.size();
+  if (fileSize < CHECKSUM_TRAILER_LENGTH) {
+    return fileSize;
+  }
+
+  char marker[CHECKSUM_MARKER_LENGTH];
+  file.seek(fileSize - CHECKSUM_TRAILER_LENGTH);
+  size_t bytesRead = file.readBytes(marker, sizeof(marker));
+  file.seek(0);
+  bool hasTrailer = bytesRead == sizeof(marker) &&
+                    strncmp(marker, CHECKSUM_MARKER, sizeof(marker)) == 0;
+  return hasTrailer ? fileSize - CHECKSUM_TRAILER_LENGTH : fileSize;
+}
+
+bool LittleFSDatabaseDriver::verifyAndStripChecksum(String &content,
+                                                    const String &filePath) {
+  size_t length = content.length();
+  if (length < CHECKSUM_TRAILER_LENGTH) {
+    return true; // Too short to carry a trailer
+  }
+
+  size_t markerPos = length - CHECKSUM_TRAILER_LENGTH;
+  const char *raw = content.c_str();
+  if (strncmp(raw + markerPos, CHECKSUM_MARKER, CHECKSUM_MARKER_LENGTH) != 0) {
+    return true; // Written without a checksum
+  }
+
+  uint32_t expected = 0;
+  if (!Checksum::fromHex(raw + markerPos + CHECKSUM_MARKER_LENGTH, expected)) {
+    DEBUG_PRINTF("LittleFSDatabaseDriver: Malformed checksum trailer in %s\n",
+                 filePath.c_str());
+    return false;
+  }
+
+  uint32_t actual =
+      Checksum::crc32(reinterpret_cast<const uint8_t *>(raw), markerPos);
+  if (actual != expected) {
+    DEBUG_PRINTF("LittleFSDatabaseDriver: Checksum mismatch for %s "
+                 "(stored %08x, computed %08x)\n",
+                 filePath.c_str(), expected, actual);
+    return false;
+  }
+
+  content = content.substring(0, markerPos);
+  return true;
+}
+
+bool LittleFSDatabaseDriver::shouldCompress(const String &collection,
+                                            const String &data) const {
+  return data.length() >= MIN_COMPRESSED_SIZE &&
+         getRecordFormat(collection) == RecordFormat::Gzip;
+}
+
+bool LittleFSDatabaseDriver::writeTempFile(const String &tempPath,
+                                           const String &data, bool compress) {
+  std::string packed;
+  if (compress &&
+      (!Gzip::compress(reinterpret_cast<const uint8_t *>(data.c_str()),
+                       data.length(), packed) ||
+       packed.size() >= data.length())) {
+    packed.clear(); // Incompressible - store it plain
+  }
+
+  File file = LittleFS.open(tempPath, FILE_WRITE);
+  if (!file) {
+    DEBUG_PRINTF(
+        "LittleFSDatabaseDriver: Failed to open file for writing: %s\n",
+        tempPath.c_str());
+    return false;
+  }
+
+  size_t expected = 0;
+  size_t written = 0;
+  if (!packed.empty()) {
+    // gzip carries its own CRC32, checked on every inflate
+    expected = packed.size();
+    written = file.write(reinterpret_cast<const uint8_t *>(packed.data()),
+                         packed.size());
+  } else {
+    expected = data.length();
+    written = file.print(data);
+  }
+  if (packed.empty() && checksumEnabled) {
+    uint32_t crc = Checksum::crc32(
+        reinterpret_cast<const uint8_t *>(data.c_str()), data.length());
+    String trailer = CHECKSUM_MARKER;
+    trailer += Checksum::toHex(crc).c_str();
+    expected += trailer.length();
+    written += file.print(trailer);
+  }
+  file.close();
+
+  if (written != expected) {
+    DEBUG_PRINTF("LittleFSDatabaseDriver: Write failed for %s\n",
+                 tempPath.c_str());
+    LittleFS.remove(tempPath);
+    return false;
+  }
+  return true;
+}
+
+bool LittleFSDatabaseDriver::commitTempFile(const String &tempPath,
+                                            const String &filePath) {
+  if (!LittleFS.rename(tempPath, filePath)) {
+    // Older VFS layers refuse to rename onto an existing file - fall back
+    // to remove + rename. Not atomic, but a crash in between leaves the
+    // complete temp file, which recovery promotes (see
+    // resolveInterruptedWrite).
+    LittleFS.remove(filePath);
+    if (!LittleFS.rename(tempPath, filePath)) {
+      DEBUG_PRINTF("LittleFSDatabaseDriver: Failed to commit %s\n",
+                   filePath.c_str());
+      LittleFS.remove(tempPath);
+      removeFromCache(filePath);
+      return false;
+    }
+  }
+  return true;
+}
+
+bool LittleFSDatabaseDriver::store(const String &collection, const String &key,
+                                   const String &data) {
+  if (!isValidName(collection) || !isValidName(key)) {
+    DEBUG_PRINTLN("LittleFSDatabaseDriver: Invalid collection or key name");
+    return false;
+  }
+
+  if (!ensureRecordDirectory(collection, key)) {
+    return false;
+  }
+
+  String filePath = getFilePath(collection, key);
+  String tempPath = getTempFilePath(filePath);
+
+  // Write the new value beside the old one, then rename it into place.
+  // LittleFS renames are atomic, so readers (and a reboot mid-write) see
+  // either the complete old record or the complete new one.
+  if (!writeTempFile(tempPath, data, shouldCompress(collection, data)) ||
+      !commitTempFile(tempPath, filePath)) {
+    return false;
+  }
+
+  // Add to cache if small enough
+  addToCache(filePath, data);
+  updateKeyDirectory(collection, key, true);
+  DEBUG_PRINTF("LittleFSDatabaseDriver: Stored %s/%s (%u bytes)\n",
+               collection.c_str(), key.c_str(), data.length());
+  return true;
+}
+
+bool LittleFSDatabaseDriver::applyBatch(const WriteBatch &batch) {
+  std::vector<WriteBatch::Operation> ops = batch.collapsed();
+  for (const WriteBatch::Operation &op : ops) {
+    if (!isValidName(op.collection) || !isValidName(op.key)) {
+      DEBUG_PRINTLN("LittleFSDatabaseDriver: Invalid name in batch");
+      return false;
+    }
+  }
+
+  ensureInitialized();
+
+  // Stage every new value first. If any write fails (e.g. flash full) the
+  // staged files are dropped and nothing in the batch is applied.
+  std::vector<String> staged;
+  auto dropStaged = [&staged]() {
+    for (const String &path : staged) {
+      LittleFS.remove(path);
+    }
+  };
+  JsonDocument manifest;
+  JsonArray entries = manifest.to<JsonArray>();
+  for (const WriteBatch::Operation &op : ops) {
+    JsonObject entry = entries.add<JsonObject>();
+    entry["c"] = op.collection.c_str();
+    entry["k"] = op.key.c_str();
+    if (op.isRemove) {
+      entry["r"] = 1;
+      continue;
+    }
+    String stagedPath = getStagedFilePath(getFilePath(op.collection, op.key));
+    if (!ensureRecordDirectory(op.collection, op.key) ||
+        !writeTempFile(stagedPath, op.data,
+                       shouldCompress(op.collection, op.data))) {
+      dropStaged();
+      return false;
+    }
+    staged.push_back(stagedPath);
+  }
+
+  // Commit point: once the manifest is renamed into place, a reboot
+  // part-way through the swaps below finishes them (replayBatchManifest)
+  std::string manifestText;
+  serializeJson(manifest, manifestText);
+  String manifestPath = basePath + BATCH_MANIFEST;
+  String manifestTemp = getTempFilePath(manifestPath);
+  if (!writeTempFile(manifestTemp, String(manifestText.c_str()), false) ||
+      !commitTempFile(manifestTemp, manifestPath)) {
+    dropStaged();
+    return false;
+  }
+
+  bool ok = true;
+  for (const WriteBatch::Operation &op : ops) {
+    String filePath = getFilePath(op.collection, op.key);
+    if (op.isRemove) {
+      if (hasKey(op.collection, op.key) && LittleFS.remove(filePath)) {
+        removeFromCache(filePath);
+        updateKeyDirectory(op.collection, op.key, false);
+      }
+    } else if (commitTempFile(getStagedFilePath(filePath), filePath)) {
+      addToCache(filePath, op.data);
+      updateKeyDirectory(op.collection, op.key, true);
+    } else {
+      ok = false;
+    }
+  }
+  LittleFS.remove(manifestPath);
+  return ok;
+}
+
+String LittleFSDatabaseDriver::retrieve(const String &collection,
+                                        const String &key) {
+  if (!isValidName(collection) || !isValidName(key)) {
+    return String();
+  }
+
+  ensureInitialized();
+
+  String filePath = getFilePath(collection, key);
+
+  // Check cache first
+  String cached = getFromCache(filePath);
+  if (cached.length() > 0) {
+    return cached;
+  }
+
+  // Misses are answered from the key directory without touching flash
+  if (!hasKey(collection, key)) {
+    return String();
+  }
+
+  File file = LittleFS.open(filePath, FILE_READ);
+  if (!file) {
+    DEBUG_PRINTF(
+        "LittleFSDatabaseDriver: Failed to open file for reading: %s\n",
+        filePath.c_str());
+    return String();
+  }
+
+  String content = readRecord(file, filePath);
+  file.close();
+
+  if (content.length() == 0) {
+    return String();
+  }
+
   // Add to cache only if small enough
   addToCache(filePath, content);
 
@@ -356,15 +813,15 @@ bool LittleFSDatabaseDriver::remove(const String &collection,
 
   ensureInitialized();
 
-  String filePath = getFilePath(collection, key);
-
-  if (!LittleFS.exists(filePath)) {
+  if (!hasKey(collection, key)) {
     return false;
   }
 
+  String filePath = getFilePath(collection, key);
   bool removed = LittleFS.remove(filePath);
   if (removed) {
     removeFromCache(filePath);
+    updateKeyDirectory(collection, key, false);
     DEBUG_PRINTF("LittleFSDatabaseDriver: Removed %s/%s\n", collection.c_str(),
                  key.c_str());
   }
@@ -373,58 +830,468 @@ bool LittleFSDatabaseDriver::remove(const String &collection,
 }
 
 std::vector<String> LittleFSDatabaseDriver::listKeys(const String &collection) {
-  std::vector<String> keys;
-
   if (!isValidName(collection)) {
-    return keys;
+    return std::vector<String>();
   }
 
-  ensureInitialized();
-
-  String collectionPath = getCollectionPath(collection);
+  const std::set<String> &keys = loadKeyDirectory(collection);
+  return std::vector<String>(keys.begin(), keys.end());
+}
 
-  if (!LittleFS.exists(collectionPath)) {
-    return keys;
+bool LittleFSDatabaseDriver::exists(const String &collection,
+                                    const String &key) {
+  if (!isValidName(collection) || !isValidName(key)) {
+    return false;
   }
 
-  File dir = LittleFS.open(collectionPath);
-  if (!dir || !dir.isDirectory()) {
-    return keys;
+  return hasKey(collection, key);
+}
+
+size_t LittleFSDatabaseDriver::forEach(const String &collection,
+                                       RecordCallback callback) {
+  return scanFrom(collection, "", [](const String &key) { return true; },
+                  callback);
+}
+
+size_t LittleFSDatabaseDriver::scanPrefix(const String &collection,
+                                          const String &prefix,
+                                          RecordCallback callback) {
+  return scanFrom(
+      collection, prefix,
+      [&prefix](const String &key) { return key.startsWith(prefix); },
+      callback);
+}
+
+size_t LittleFSDatabaseDriver::scanRange(const String &collection,
+                                         const String &from, const String &to,
+                                         RecordCallback callback) {
+  return scanFrom(
+      collection, from,
+      [&to](const String &key) { return to.length() == 0 || key < to; },
+      callback);
+}
+
+size_t LittleFSDatabaseDriver::scanFrom(
+    const String &collection, const String &from,
+    const std::function<bool(const String &)> &inRange,
+    RecordCallback callback) {
+  size_t visited = 0;
+
+  if (!isValidName(collection) || !callback) {
+    return visited;
   }
 
-  File file = dir.openNextFile();
-  while (file) {
-    if (!file.isDirectory()) {
-      String filename = file.name();
-      // Remove .json extension
-      if (filename.endsWith(".json")) {
-        String key = filename.substring(0, filename.length() - 5);
-        keys.push_back(key);
+  // Walk the key directory (sorted) instead of the collection's
+  // directories, opening each record by path - a range only opens the
+  // files inside it. The next key is looked up after each callback, so the
+  // callback may store or remove records. Scanned records are not added to
+  // the LRU cache so a full scan doesn't flush out the hot entries.
+  std::set<String> &keys = loadKeyDirectory(collection);
+  auto it = keys.lower_bound(from);
+  while (it != keys.end() && inRange(*it)) {
+    String key = *it;
+    String filePath = getFilePath(collection, key);
+    File file = LittleFS.open(filePath, FILE_READ);
+    if (file) {
+      String data = readRecord(file, filePath);
+      file.close();
+
+      if (data.length() > 0) {
+        visited++;
+        if (!callback(key, data)) {
+          break;
+        }
       }
     }
-    file = dir.openNextFile();
+    it = keys.upper_bound(key);
   }
 
-  return keys;
+  return visited;
 }
 
-bool LittleFSDatabaseDriver::exists(const String &collection,
-                                    const String &key) {
+size_t LittleFSDatabaseDriver::count(const String &collection) {
+  if (!isValidName(collection)) {
+    return 0;
+  }
+
+  return loadKeyDirectory(collection).size();
+}
+
+bool LittleFSDatabaseDriver::setRecordFormat(const String &collection,
+                                             RecordFormat format) {
+  if (!isValidName(collection) || format == RecordFormat::MessagePack) {
+    return false; // Records are files; there's no collection blob to pack
+  }
+
+  // Takes effect per record on its next write; retrieve() detects gzip
+  // files by their magic bytes, so both kinds can share a collection
+  formats[collection] = format;
+  return true;
+}
+
+RecordFormat
+LittleFSDatabaseDriver::getRecordFormat(const String &collection) const {
+  auto it = formats.find(collection);
+  return it != formats.end() ? it->second : RecordFormat::Json;
+}
+
+size_t LittleFSDatabaseDriver::compressedSize(const String &collection,
+                                              const String &key) {
   if (!isValidName(collection) || !isValidName(key)) {
+    return 0;
+  }
+
+  if (!hasKey(collection, key)) {
+    return 0;
+  }
+
+  File file = LittleFS.open(getFilePath(collection, key), FILE_READ);
+  if (!file) {
+    return 0;
+  }
+  size_t size = isCompressedFile(file) ? file.size() : 0;
+  file.close();
+  return size;
+}
+
+bool LittleFSDatabaseDriver::streamCompressed(const String &collection,
+                                              const String &key,
+                                              ChunkCallback callback) {
+  if (!isValidName(collection) || !isValidName(key) || !callback) {
+    return false;
+  }
+
+  if (!hasKey(collection, key)) {
+    return false;
+  }
+
+  String filePath = getFilePath(collection, key);
+  File file = LittleFS.open(filePath, FILE_READ);
+  if (!file) {
+    return false;
+  }
+  if (!isCompressedFile(file)) {
+    file.close();
     return false;
   }
 
+  const size_t CHUNK_SIZE = 512;
+  uint8_t buffer[CHUNK_SIZE];
+  size_t remaining = file.size();
+  bool ok = true;
+  while (remaining > 0) {
+    size_t bytesRead = file.readBytes(reinterpret_cast<char *>(buffer),
+                                      std::min(CHUNK_SIZE, remaining));
+    if (bytesRead == 0) {
+      DEBUG_PRINTF("LittleFSDatabaseDriver: Short read streaming %s\n",
+                   filePath.c_str());
+      ok = false;
+      break;
+    }
+    remaining -= bytesRead;
+    if (!callback(buffer, bytesRead)) {
+      ok = false;
+      break;
+    }
+  }
+  file.close();
+  return ok;
+}
+
+size_t LittleFSDatabaseDriver::recordLength(const String &collection,
+                                            const String &key) {
+  if (!isValidName(collection) || !isValidName(key)) {
+    return 0;
+  }
+
   ensureInitialized();
 
   String filePath = getFilePath(collection, key);
-  return LittleFS.exists(filePath);
+  String cached = getFromCache(filePath);
+  if (cached.length() > 0) {
+    return cached.length();
+  }
+  if (!hasKey(collection, key)) {
+    return 0;
+  }
+
+  File file = LittleFS.open(filePath, FILE_READ);
+  if (!file) {
+    return 0;
+  }
+  size_t size;
+  if (isCompressedFile(file)) {
+    // The gzip trailer records the inflated size
+    size_t fileSize = file.size();
+    uint8_t trailer[Gzip::TRAILER_SIZE];
+    size = 0;
+    if (fileSize >= Gzip::HEADER_SIZE + Gzip::TRAILER_SIZE) {
+      file.seek(fileSize - Gzip::TRAILER_SIZE);
+      file.readBytes(reinterpret_cast<char *>(trailer), sizeof(trailer));
+      size = Gzip::storedSize(trailer);
+    }
+  } else {
+    size = plainRecordLength(file);
+  }
+  file.close();
+  return size;
+}
+
+bool LittleFSDatabaseDriver::readRange(const String &collection,
+                                       const String &key, size_t offset,
+                                       size_t length, ChunkCallback callback) {
+  if (!isValidName(collection) || !isValidName(key) || !callback) {
+    return false;
+  }
+
+  ensureInitialized();
+
+  if (!hasKey(collection, key)) {
+    return false;
+  }
+
+  String filePath = getFilePath(collection, key);
+  File file = LittleFS.open(filePath, FILE_READ);
+  if (!file) {
+    return false;
+  }
+  if (isCompressedFile(file)) {
+    // Deflate streams can't be entered mid-way
+    file.close();
+    return IDatabaseDriver::readRange(collection, key, offset, length,
+                                      callback);
+  }
+
+  size_t dataLength = plainRecordLength(file);
+  if (offset >= dataLength || !file.seek(offset)) {
+    file.close();
+    return false;
+  }
+
+  const size_t CHUNK_SIZE = 512;
+  uint8_t buffer[CHUNK_SIZE];
+  size_t remaining = std::min(length, dataLength - offset);
+  bool ok = true;
+  while (remaining > 0) {
+    size_t bytesRead = file.readBytes(reinterpret_cast<char *>(buffer),
+                                      std::min(CHUNK_SIZE, remaining));
+    if (bytesRead == 0) {
+      DEBUG_PRINTF("LittleFSDatabaseDriver: Short read in range of %s\n",
+                   filePath.c_str());
+      ok = false;
+      break;
+    }
+    remaining -= bytesRead;
+    if (!callback(buffer, bytesRead)) {
+      ok = false;
+      break;
+    }
+  }
+  file.close();
+  return ok;
+}
+
+bool LittleFSDatabaseDriver::acceptsName(const String &collection,
+                                         const String &key) {
+  return isValidName(collection) && isValidName(key);
 }
 
 String LittleFSDatabaseDriver::getDriverName() const { return driverName; }
 
+void LittleFSDatabaseDriver::setChecksumEnabled(bool enabled) {
+  checksumEnabled = enabled;
+}
+
+bool LittleFSDatabaseDriver::isChecksumEnabled() const {
+  return checksumEnabled;
+}
+
+void LittleFSDatabaseDriver::setShardingEnabled(bool enabled) {
+  if (shardingEnabled == enabled) {
+    return;
+  }
+
+  // Every path changes - records move as each collection is next loaded
+  shardingEnabled = enabled;
+  keyDirectory.clear();
+  cache.clear();
+  cacheOrder.clear();
+}
+
+bool LittleFSDatabaseDriver::isShardingEnabled() const {
+  return shardingEnabled;
+}
+
+size_t LittleFSDatabaseDriver::recoverInterruptedWrites() {
+  ensureInitialized();
+  if (!initialized) {
+    return 0;
+  }
+
+  // A committed batch is finished before anything else is looked at
+  size_t resolved = replayBatchManifest();
+
+  // A leftover .tmp means power was lost before its rename. Where key.json
+  // is still there it holds the previous value and the temp file is
+  // dropped; where it is gone, commitTempFile's remove + rename fallback
+  // was cut off between its two steps and the temp file is the record.
+  // Staged batch values still here belong to a batch that never
+  // committed, and are dropped.
+  std::vector<String> collections = listCollections();
+  for (const String &collection : collections) {
+    String collectionPath = getCollectionPath(collection);
+    File dir = LittleFS.open(collectionPath);
+    if (!dir || !dir.isDirectory()) {
+      continue;
+    }
+
+    // Collect first - removing entries while iterating a directory is not
+    // safe on every filesystem.
+    std::vector<String> orphans;
+    std::vector<String> uncommitted;
+    std::vector<String> shards;
+    File file = dir.openNextFile();
+    while (file) {
+      String filename = entryName(file);
+      if (file.isDirectory()) {
+        if (isShardName(filename)) {
+          shards.push_back(collectionPath + "/" + filename);
+        }
+      } else if (filename.endsWith(TEMP_SUFFIX)) {
+        orphans.push_back(collectionPath + "/" + filename);
+      } else if (filename.endsWith(STAGED_SUFFIX)) {
+        uncommitted.push_back(collectionPath + "/" + filename);
+      }
+      file = dir.openNextFile();
+    }
+    dir.close();
+
+    for (const String &shardPath : shards) {
+      File shard = LittleFS.open(shardPath);
+      if (!shard || !shard.isDirectory()) {
+        continue;
+      }
+      file = shard.openNextFile();
+      while (file) {
+        String filename = entryName(file);
+        if (!file.isDirectory() && filename.endsWith(TEMP_SUFFIX)) {
+          orphans.push_back(shardPath + "/" + filename);
+        } else if (!file.isDirectory() && filename.endsWith(STAGED_SUFFIX)) {
+          uncommitted.push_back(shardPath + "/" + filename);
+        }
+        file = shard.openNextFile();
+      }
+      shard.close();
+    }
+
+    for (const String &orphan : orphans) {
+      if (resolveInterruptedWrite(collection, orphan)) {
+        resolved++;
+      }
+    }
+    for (const String &path : uncommitted) {
+      if (LittleFS.remove(path)) {
+        resolved++;
+      }
+    }
+  }
+
+  if (resolved > 0) {
+    DEBUG_PRINTF("LittleFSDatabaseDriver: Resolved %u interrupted write(s)\n",
+                 resolved);
+  }
+  return resolved;
+}
+
+size_t LittleFSDatabaseDriver::replayBatchManifest() {
+  String manifestPath = basePath + BATCH_MANIFEST;
+  // A manifest that never reached its rename is an uncommitted batch
+  LittleFS.remove(getTempFilePath(manifestPath));
+  if (!LittleFS.exists(manifestPath)) {
+    return 0;
+  }
+
+  JsonDocument manifest;
+  File file = LittleFS.open(manifestPath, FILE_READ);
+  if (file) {
+    String text = readRecord(file, manifestPath);
+    file.close();
+    deserializeJson(manifest, text);
+  }
+
+  // Idempotent - a reboot during the replay just runs it again
+  size_t replayed = 0;
+  for (JsonObjectConst entry : manifest.as<JsonArrayConst>()) {
+    String collection = entry["c"].as<const char *>();
+    String key = entry["k"].as<const char *>();
+    if (!isValidName(collection) || !isValidName(key)) {
+      continue;
+    }
+    String filePath = getFilePath(collection, key);
+    String stagedPath = getStagedFilePath(filePath);
+    if (entry["r"].as<bool>()) {
+      if (LittleFS.exists(filePath) && LittleFS.remove(filePath)) {
+        replayed++;
+      }
+    } else if (LittleFS.exists(stagedPath) &&
+               commitTempFile(stagedPath, filePath)) {
+      replayed++;
+    }
+    removeFromCache(filePath);
+    keyDirectory.erase(collection);
+  }
+  LittleFS.remove(manifestPath);
+
+  DEBUG_PRINTF("LittleFSDatabaseDriver: Finished %u interrupted batch "
+               "operation(s)\n",
+               replayed);
+  return replayed;
+}
+
+bool LittleFSDatabaseDriver::resolveInterruptedWrite(const String &collection,
+                                                     const String &tempPath) {
+  String filePath =
+      tempPath.substring(0, tempPath.length() - (sizeof(TEMP_SUFFIX) - 1));
+  if (LittleFS.exists(filePath)) {
+    return LittleFS.remove(tempPath);
+  }
+
+  // Only a temp file that reads back whole is promoted - one cut off
+  // mid-write was never acknowledged and there is nothing to keep
+  bool complete = false;
+  File file = LittleFS.open(tempPath, FILE_READ);
+  if (file) {
+    String content = readRecord(file, tempPath);
+    file.close();
+    JsonDocument filter;
+    filter.set(false);
+    JsonDocument doc;
+    complete = content.length() > 0 &&
+               deserializeJson(doc, content,
+                               DeserializationOption::Filter(filter)) ==
+                   DeserializationError::Ok;
+  }
+  if (!complete) {
+    return LittleFS.remove(tempPath);
+  }
+  if (!LittleFS.rename(tempPath, filePath)) {
+    return false;
+  }
+
+  String name = filePath.substring(filePath.lastIndexOf('/') + 1);
+  removeFromCache(filePath);
+  updateKeyDirectory(
+      collection, name.substring(0, name.length() - RECORD_SUFFIX_LENGTH),
+      true);
+  DEBUG_PRINTF("LittleFSDatabaseDriver: Restored %s from its temp file\n",
+               filePath.c_str());
+  return true;
+}
+
 void LittleFSDatabaseDriver::clearCache() {
   cache.clear();
   cacheOrder.clear();
+  keyDirectory.clear();
   DEBUG_PRINTLN("LittleFSDatabaseDriver: Cache cleared");
 }
 
@@ -460,6 +1327,25 @@ bool LittleFSDatabaseDriver::removeCollection(const String &collection) {
   for (const String &key : keys) {
     remove(collection, key);
   }
+  keyDirectory.erase(collection);
+
+  // Then the (now empty) shard directories
+  std::vector<String> shards;
+  File dir = LittleFS.open(collectionPath);
+  if (dir && dir.isDirectory()) {
+    File entry = dir.openNextFile();
+    while (entry) {
+      String name = entryName(entry);
+      if (entry.isDirectory() && isShardName(name)) {
+        shards.push_back(collectionPath + "/" + name);
+      }
+      entry = dir.openNextFile();
+    }
+    dir.close();
+  }
+  for (const String &shardPath : shards) {
+    LittleFS.rmdir(shardPath);
+  }
 
   // Remove the directory
   bool removed = LittleFS.rmdir(collectionPath);
@@ -479,13 +1365,11 @@ size_t LittleFSDatabaseDriver::getKeySize(const String &collection,
 
   ensureInitialized();
 
-  String filePath = getFilePath(collection, key);
-
-  if (!LittleFS.exists(filePath)) {
+  if (!hasKey(collection, key)) {
     return 0;
   }
 
-  File file = LittleFS.open(filePath, FILE_READ);
+  File file = LittleFS.open(getFilePath(collection, key), FILE_READ);
   if (!file) {
     return 0;
   }
@@ -0,0 +1,824 @@
+#include "storage/log_database_driver.h"
+#include "FS.h"
+#include "core/checksum.h"
+#include "utilities/debug_macros.h"
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+#ifdef NATIVE_PLATFORM
+#include <testing/native_debug_macros_compat.h>
+#endif
+
+using WebPlatform::Core::Checksum;
+
+namespace {
+const char SEGMENT_SUFFIX[] = ".log";
+
+// "P 64 64 4294967295 xxxxxxxx" plus slack - anything longer is garbage
+const size_t MAX_HEADER_LENGTH = 48;
+
+// Names are length-prefixed in the log, so any byte is safe; the limit just
+// keeps headers bounded and matches LittleFSDatabaseDriver
+const size_t MAX_NAME_LENGTH = 64;
+
+const size_t READ_CHUNK_SIZE = 256;
+
+String formatHeader(char op, size_t collectionLength, size_t keyLength,
+                    size_t dataLength, uint32_t crc) {
+  char header[MAX_HEADER_LENGTH];
+  snprintf(header, sizeof(header), "%c %u %u %u %s\n", op,
+           (unsigned)collectionLength, (unsigned)keyLength,
+           (unsigned)dataLength, Checksum::toHex(crc).c_str());
+  return String(header);
+}
+} // namespace
+
+LogDatabaseDriver::LogDatabaseDriver(const String &baseStoragePath,
+                                     size_t maxSegmentBytes)
+    : driverName("log"), initialized(false), basePath(baseStoragePath),
+      maxSegmentBytes(maxSegmentBytes), compactionThreshold(0.5f) {
+  // Ensure base path starts and ends correctly
+  if (!basePath.startsWith("/")) {
+    basePath = "/" + basePath;
+  }
+  if (basePath.endsWith("/")) {
+    basePath = basePath.substring(0, basePath.length() - 1);
+  }
+}
+
+void LogDatabaseDriver::ensureInitialized() {
+  if (initialized) {
+    return;
+  }
+
+  if (!LittleFS.begin(true)) { // true = format if mount fails
+    DEBUG_PRINTLN("LogDatabaseDriver: Failed to initialize LittleFS");
+    return;
+  }
+
+  if (!LittleFS.exists(basePath) && !LittleFS.mkdir(basePath)) {
+    DEBUG_PRINTF("LogDatabaseDriver: Failed to create base directory: %s\n",
+                 basePath.c_str());
+    return;
+  }
+
+  std::vector<uint32_t> ids;
+  File dir = LittleFS.open(basePath);
+  if (dir && dir.isDirectory()) {
+    File file = dir.openNextFile();
+    while (file) {
+      String filename = file.name();
+      if (!file.isDirectory() && filename.endsWith(SEGMENT_SUFFIX)) {
+        uint32_t id = strtoul(filename.c_str(), nullptr, 10);
+        if (id > 0) {
+          ids.push_back(id);
+        }
+      }
+      file = dir.openNextFile();
+    }
+    dir.close();
+  }
+  std::sort(ids.begin(), ids.end());
+
+  // Replay oldest first so later records win
+  index.clear();
+  segments.clear();
+  bool lastIntact = true;
+  for (uint32_t id : ids) {
+    Segment segment = {id, 0, 0};
+    segments.push_back(segment);
+    lastIntact = replaySegment(segments.back());
+  }
+
+  // Never append after a torn record - replay would stop in front of it
+  if (segments.empty() || !lastIntact) {
+    Segment fresh = {segments.empty() ? 1 : segments.back().id + 1, 0, 0};
+    segments.push_back(fresh);
+  }
+
+  initialized = true;
+  DEBUG_PRINTF("LogDatabaseDriver: Mounted %s (%u segments, %u bytes, %u "
+               "dead)\n",
+               basePath.c_str(), (unsigned)segments.size(),
+               (unsigned)getTotalBytes(), (unsigned)getDeadBytes());
+}
+
+bool LogDatabaseDriver::replaySegment(Segment &segment) {
+  String path = getSegmentPath(segment.id);
+  File file = LittleFS.open(path, FILE_READ);
+  if (!file) {
+    return false;
+  }
+
+  segment.bytes = file.size();
+  String content = file.readString();
+  file.close();
+
+  std::vector<ParsedRecord> records;
+  size_t parsed =
+      parseRecords(content, 0, content.length(), segment.id, records, true);
+  for (const ParsedRecord &record : records) {
+    applyToIndex(record.op, record.collection, record.key, record.location);
+  }
+
+  if (parsed != segment.bytes) {
+    DEBUG_PRINTF("LogDatabaseDriver: %s is damaged at byte %u of %u - "
+                 "ignoring the rest\n",
+                 path.c_str(), (unsigned)parsed, (unsigned)segment.bytes);
+    return false;
+  }
+  return true;
+}
+
+size_t LogDatabaseDriver::parseRecords(const String &buffer, size_t start,
+                                       size_t end, uint32_t segmentId,
+                                       std::vector<ParsedRecord> &records,
+                                       bool allowBatch) {
+  const char *raw = buffer.c_str();
+  size_t pos = start;
+
+  while (pos < end) {
+    size_t lineEnd = pos;
+    while (lineEnd < end && lineEnd - pos < MAX_HEADER_LENGTH &&
+           raw[lineEnd] != '\n') {
+      lineEnd++;
+    }
+    if (lineEnd >= end || raw[lineEnd] != '\n') {
+      break; // Torn header
+    }
+
+    char line[MAX_HEADER_LENGTH + 1];
+    memcpy(line, raw + pos, lineEnd - pos);
+    line[lineEnd - pos] = '\0';
+
+    char op = 0;
+    unsigned long collectionLength = 0, keyLength = 0, dataLength = 0;
+    char crcHex[9] = {0};
+    uint32_t crc = 0;
+    if (sscanf(line, "%c %lu %lu %lu %8s", &op, &collectionLength, &keyLength,
+               &dataLength, crcHex) != 5 ||
+        strlen(crcHex) != 8 || !Checksum::fromHex(crcHex, crc)) {
+      break;
+    }
+
+    size_t body = lineEnd + 1;
+    size_t recordEnd = body + collectionLength + keyLength + dataLength + 1;
+    if (recordEnd > end || raw[recordEnd - 1] != '\n') {
+      break; // Torn body
+    }
+
+    if (op == 'B') {
+      if (!allowBatch || collectionLength != 0 || keyLength != 0 ||
+          Checksum::crc32(reinterpret_cast<const uint8_t *>(raw + body),
+                          dataLength) != crc) {
+        break;
+      }
+      std::vector<ParsedRecord> batchRecords;
+      size_t payloadEnd = body + dataLength;
+      if (parseRecords(buffer, body, payloadEnd, segmentId, batchRecords,
+                       false) != payloadEnd) {
+        break;
+      }
+      for (ParsedRecord &record : batchRecords) {
+        records.push_back(std::move(record));
+      }
+    } else if (op == 'P' || op == 'D') {
+      if (collectionLength == 0 || keyLength == 0 ||
+          (op == 'D' && dataLength != 0)) {
+        break;
+      }
+      ParsedRecord record;
+      record.op = op;
+      record.collection = buffer.substring(body, body + collectionLength);
+      record.key = buffer.substring(body + collectionLength,
+                                    body + collectionLength + keyLength);
+      size_t dataStart = body + collectionLength + keyLength;
+      if (recordCrc(op, record.collection, record.key, raw + dataStart,
+                    dataLength) != crc) {
+        break;
+      }
+      record.location.segment = segmentId;
+      record.location.offset = dataStart;
+      record.location.length = dataLength;
+      record.location.recordBytes = recordEnd - pos;
+      record.location.crc = crc;
+      records.push_back(std::move(record));
+    } else {
+      break;
+    }
+
+    pos = recordEnd;
+  }
+
+  return pos;
+}
+
+void LogDatabaseDriver::applyToIndex(char op, const String &collection,
+                                     const String &key,
+                                     const Location &location) {
+  std::map<String, Location> &records = index[collection];
+  auto it = records.find(key);
+  if (it != records.end()) {
+    Segment *previous = findSegment(it->second.segment);
+    if (previous) {
+      previous->liveBytes -= it->second.recordBytes;
+    }
+  }
+
+  if (op == 'P') {
+    Segment *segment = findSegment(location.segment);
+    if (segment) {
+      segment->liveBytes += location.recordBytes;
+    }
+    records[key] = location;
+  } else if (it != records.end()) {
+    records.erase(it);
+  }
+
+  if (records.empty()) {
+    index.erase(collection);
+  }
+}
+
+uint32_t LogDatabaseDriver::recordCrc(char op, const String &collection,
+                                      const String &key, const char *data,
+                                      size_t dataLength) {
+  uint32_t crc = Checksum::crc32(reinterpret_cast<const uint8_t *>(&op), 1);
+  crc = Checksum::crc32(
+      reinterpret_cast<const uint8_t *>(collection.c_str()),
+      collection.length(), crc);
+  crc = Checksum::crc32(reinterpret_cast<const uint8_t *>(key.c_str()),
+                        key.length(), crc);
+  return Checksum::crc32(reinterpret_cast<const uint8_t *>(data), dataLength,
+                         crc);
+}
+
+uint32_t LogDatabaseDriver::encodeRecord(String &out, char op,
+                                         const String &collection,
+                                         const String &key, const String &data,
+                                         size_t &dataOffset) {
+  size_t dataLength = op == 'P' ? data.length() : 0;
+  uint32_t crc =
+      recordCrc(op, collection, key, op == 'P' ? data.c_str() : "", dataLength);
+
+  out += formatHeader(op, collection.length(), key.length(), dataLength, crc)
+             .c_str();
+  out += collection.c_str();
+  out += key.c_str();
+  dataOffset = out.length();
+  if (dataLength > 0) {
+    out += data.c_str();
+  }
+  out += "\n";
+  return crc;
+}
+
+bool LogDatabaseDriver::append(const String &bytes, uint32_t &segmentId,
+                               size_t &offset) {
+  if (segments.back().bytes > 0 &&
+      segments.back().bytes + bytes.length() > maxSegmentBytes) {
+    Segment next = {segments.back().id + 1, 0, 0};
+    segments.push_back(next);
+  }
+
+  Segment &active = segments.back();
+  String path = getSegmentPath(active.id);
+  File file = LittleFS.open(path, FILE_APPEND);
+  if (!file) {
+    DEBUG_PRINTF("LogDatabaseDriver: Failed to open %s for append\n",
+                 path.c_str());
+    return false;
+  }
+
+  size_t written = file.print(bytes);
+  file.close();
+
+  segmentId = active.id;
+  offset = active.bytes;
+  active.bytes += written;
+
+  if (written != bytes.length()) {
+    // Part of a record is on flash; start over in a new segment so the next
+    // append isn't hidden behind it at replay
+    DEBUG_PRINTF("LogDatabaseDriver: Short write to %s (%u of %u bytes)\n",
+                 path.c_str(), (unsigned)written, (unsigned)bytes.length());
+    Segment next = {active.id + 1, 0, 0};
+    segments.push_back(next);
+    return false;
+  }
+  return true;
+}
+
+String LogDatabaseDriver::readData(File &file, const String &collection,
+                                   const String &key,
+                                   const Location &location) {
+  if (!file.seek(location.offset)) {
+    return String();
+  }
+
+  String data;
+  data.reserve(location.length + 1);
+  char buffer[READ_CHUNK_SIZE + 1];
+  size_t remaining = location.length;
+  while (remaining > 0) {
+    size_t toRead = std::min(remaining, READ_CHUNK_SIZE);
+    size_t bytesRead = file.readBytes(buffer, toRead);
+    if (bytesRead == 0) {
+      break;
+    }
+    buffer[bytesRead] = '\0';
+    data += buffer;
+    remaining -= bytesRead;
+  }
+
+  if (data.length() != location.length ||
+      recordCrc('P', collection, key, data.c_str(), data.length()) !=
+          location.crc) {
+    DEBUG_PRINTF("LogDatabaseDriver: Unreadable record %s/%s in segment %u\n",
+                 collection.c_str(), key.c_str(), (unsigned)location.segment);
+    return String();
+  }
+  return data;
+}
+
+String LogDatabaseDriver::getSegmentPath(uint32_t id) const {
+  char filename[16];
+  snprintf(filename, sizeof(filename), "%08u", (unsigned)id);
+  return basePath + "/" + filename + SEGMENT_SUFFIX;
+}
+
+LogDatabaseDriver::Segment *LogDatabaseDriver::findSegment(uint32_t id) {
+  for (Segment &segment : segments) {
+    if (segment.id == id) {
+      return &segment;
+    }
+  }
+  return nullptr;
+}
+
+bool LogDatabaseDriver::isValidName(const String &name) const {
+  return name.length() > 0 && name.length() <= MAX_NAME_LENGTH;
+}
+
+bool LogDatabaseDriver::store(const String &collection, const String &key,
+                              const String &data) {
+  if (!isValidName(collection) || !isValidName(key)) {
+    DEBUG_PRINTLN("LogDatabaseDriver: Invalid collection or key name");
+    return false;
+  }
+
+  ensureInitialized();
+  if (!initialized) {
+    return false;
+  }
+
+  String record;
+  size_t dataOffset = 0;
+  uint32_t crc = encodeRecord(record, 'P', collection, key, data, dataOffset);
+
+  uint32_t segmentId = 0;
+  size_t offset = 0;
+  if (!append(record, segmentId, offset)) {
+    return false;
+  }
+
+  Location location = {segmentId, (uint32_t)(offset + dataOffset),
+                       (uint32_t)data.length(), (uint32_t)record.length(),
+                       crc};
+  applyToIndex('P', collection, key, location);
+  return true;
+}
+
+String LogDatabaseDriver::retrieve(const String &collection,
+                                   const String &key) {
+  ensureInitialized();
+
+  auto collectionIt = index.find(collection);
+  if (collectionIt == index.end()) {
+    return String();
+  }
+  auto it = collectionIt->second.find(key);
+  if (it == collectionIt->second.end()) {
+    return String();
+  }
+
+  File file = LittleFS.open(getSegmentPath(it->second.segment), FILE_READ);
+  if (!file) {
+    return String();
+  }
+  String data = readData(file, collection, key, it->second);
+  file.close();
+  return data;
+}
+
+bool LogDatabaseDriver::remove(const String &collection, const String &key) {
+  if (!exists(collection, key)) {
+    return false;
+  }
+
+  String record;
+  size_t dataOffset = 0;
+  uint32_t crc = encodeRecord(record, 'D', collection, key, "", dataOffset);
+
+  uint32_t segmentId = 0;
+  size_t offset = 0;
+  if (!append(record, segmentId, offset)) {
+    return false;
+  }
+
+  Location tombstone = {segmentId, (uint32_t)offset, 0,
+                        (uint32_t)record.length(), crc};
+  applyToIndex('D', collection, key, tombstone);
+  return true;
+}
+
+std::vector<String> LogDatabaseDriver::listKeys(const String &collection) {
+  std::vector<String> keys;
+  ensureInitialized();
+
+  auto collectionIt = index.find(collection);
+  if (collectionIt != index.end()) {
+    keys.reserve(collectionIt->second.size());
+    for (const auto &entry : collectionIt->second) {
+      keys.push_back(entry.first);
+    }
+  }
+  return keys;
+}
+
+bool LogDatabaseDriver::exists(const String &collection, const String &key) {
+  ensureInitialized();
+
+  auto collectionIt = index.find(collection);
+  return collectionIt != index.end() &&
+         collectionIt->second.find(key) != collectionIt->second.end();
+}
+
+size_t LogDatabaseDriver::forEach(const String &collection,
+                                  RecordCallback callback) {
+  size_t visited = 0;
+  if (!callback) {
+    return visited;
+  }
+
+  ensureInitialized();
+
+  auto collectionIt = index.find(collection);
+  if (collectionIt == index.end()) {
+    return visited;
+  }
+
+  // Read in log order so each segment is opened once and read forwards
+  std::vector<const std::pair<const String, Location> *> entries;
+  entries.reserve(collectionIt->second.size());
+  for (const auto &entry : collectionIt->second) {
+    entries.push_back(&entry);
+  }
+  std::sort(entries.begin(), entries.end(),
+            [](const std::pair<const String, Location> *a,
+               const std::pair<const String, Location> *b) {
+              if (a->second.segment != b->second.segment) {
+                return a->second.segment < b->second.segment;
+              }
+              return a->second.offset < b->second.offset;
+            });
+
+  File file;
+  uint32_t openSegment = 0;
+  for (const auto *entry : entries) {
+    if (entry->second.segment != openSegment) {
+      if (file) {
+        file.close();
+      }
+      openSegment = entry->second.segment;
+      file = LittleFS.open(getSegmentPath(openSegment), FILE_READ);
+    }
+    if (!file) {
+      continue;
+    }
+
+    String data = readData(file, collection, entry->first, entry->second);
+    if (data.length() == 0) {
+      continue;
+    }
+    visited++;
+    if (!callback(entry->first, data)) {
+      break;
+    }
+  }
+  if (file) {
+    file.close();
+  }
+
+  return visited;
+}
+
+size_t LogDatabaseDriver::scanPrefix(const String &collection,
+                                     const String &prefix,
+                                     RecordCallback callback) {
+  return scanFrom(
+      collection, prefix,
+      [&prefix](const String &key) { return key.startsWith(prefix); },
+      callback);
+}
+
+size_t LogDatabaseDriver::scanRange(const String &collection,
+                                    const String &from, const String &to,
+                                    RecordCallback callback) {
+  return scanFrom(
+      collection, from,
+      [&to](const String &key) { return to.length() == 0 || key < to; },
+      callback);
+}
+
+size_t LogDatabaseDriver::scanFrom(
+    const String &collection, const String &from,
+    const std::function<bool(const String &)> &inRange,
+    RecordCallback callback) {
+  size_t visited = 0;
+  if (!callback) {
+    return visited;
+  }
+
+  ensureInitialized();
+
+  auto collectionIt = index.find(collection);
+  if (collectionIt == index.end()) {
+    return visited;
+  }
+
+  // Key order, unlike forEach(); a segment stays open while consecutive
+  // keys live in it
+  const std::map<String, Location> &locations = collectionIt->second;
+  File file;
+  uint32_t openSegment = 0;
+  for (auto it = locations.lower_bound(from);
+       it != locations.end() && inRange(it->first); ++it) {
+    if (it->second.segment != openSegment) {
+      if (file) {
+        file.close();
+      }
+      openSegment = it->second.segment;
+      file = LittleFS.open(getSegmentPath(openSegment), FILE_READ);
+    }
+    if (!file) {
+      continue;
+    }
+
+    String data = readData(file, collection, it->first, it->second);
+    if (data.length() == 0) {
+      continue;
+    }
+    visited++;
+    if (!callback(it->first, data)) {
+      break;
+    }
+  }
+  if (file) {
+    file.close();
+  }
+
+  return visited;
+}
+
+size_t LogDatabaseDriver::count(const String &collection) {
+  ensureInitialized();
+
+  auto collectionIt = index.find(collection);
+  return collectionIt == index.end() ? 0 : collectionIt->second.size();
+}
+
+bool LogDatabaseDriver::applyBatch(const WriteBatch &batch) {
+  std::vector<WriteBatch::Operation> ops = batch.collapsed();
+  for (const WriteBatch::Operation &op : ops) {
+    if (!isValidName(op.collection) || !isValidName(op.key)) {
+      DEBUG_PRINTLN("LogDatabaseDriver: Invalid name in batch");
+      return false;
+    }
+  }
+
+  ensureInitialized();
+  if (!initialized) {
+    return false;
+  }
+
+  struct Staged {
+    const WriteBatch::Operation *op;
+    size_t dataOffset; // Relative to the payload start
+    size_t recordBytes;
+    uint32_t crc;
+  };
+  std::vector<Staged> staged;
+  String payload;
+  for (const WriteBatch::Operation &op : ops) {
+    if (op.isRemove && !exists(op.collection, op.key)) {
+      continue; // Nothing to shadow
+    }
+    size_t start = payload.length();
+    Staged entry;
+    entry.op = &op;
+    entry.crc = encodeRecord(payload, op.isRemove ? 'D' : 'P', op.collection,
+                             op.key, op.data, entry.dataOffset);
+    entry.recordBytes = payload.length() - start;
+    staged.push_back(entry);
+  }
+
+  if (staged.empty()) {
+    return true;
+  }
+
+  // One frame, one append: replay applies all of it or none of it
+  uint32_t payloadCrc = Checksum::crc32(
+      reinterpret_cast<const uint8_t *>(payload.c_str()), payload.length());
+  String frame = formatHeader('B', 0, 0, payload.length(), payloadCrc);
+  size_t headerLength = frame.length();
+  frame += payload.c_str();
+  frame += "\n";
+
+  uint32_t segmentId = 0;
+  size_t offset = 0;
+  if (!append(frame, segmentId, offset)) {
+    return false;
+  }
+
+  for (const Staged &entry : staged) {
+    const WriteBatch::Operation &op = *entry.op;
+    Location location = {
+        segmentId, (uint32_t)(offset + headerLength + entry.dataOffset),
+        op.isRemove ? 0u : (uint32_t)op.data.length(),
+        (uint32_t)entry.recordBytes, entry.crc};
+    applyToIndex(op.isRemove ? 'D' : 'P', op.collection, op.key, location);
+  }
+  return true;
+}
+
+void LogDatabaseDriver::maintain() {
+  if (initialized && needsCompaction()) {
+    compactOldestSegment();
+  }
+}
+
+bool LogDatabaseDriver::acceptsName(const String &collection,
+                                    const String &key) {
+  return isValidName(collection) && isValidName(key);
+}
+
+String LogDatabaseDriver::getDriverName() const { return driverName; }
+
+void LogDatabaseDriver::setCompactionThreshold(float ratio) {
+  compactionThreshold = ratio < 0 ? 0 : (ratio > 1 ? 1 : ratio);
+}
+
+bool LogDatabaseDriver::needsCompaction() {
+  ensureInitialized();
+  if (segments.size() < 2) {
+    return false;
+  }
+
+  size_t dead = getDeadBytes();
+  return dead >= maxSegmentBytes &&
+         dead >= (size_t)(getTotalBytes() * compactionThreshold);
+}
+
+bool LogDatabaseDriver::compactOldestSegment() {
+  if (segments.size() < 2) {
+    return false;
+  }
+
+  // Oldest first: any record a tombstone in this segment shadows is in this
+  // segment too, so tombstones can be dropped rather than carried forward
+  uint32_t oldest = segments.front().id;
+
+  struct LiveRecord {
+    String collection;
+    String key;
+    Location location;
+  };
+  std::vector<LiveRecord> live;
+  for (const auto &collectionEntry : index) {
+    for (const auto &entry : collectionEntry.second) {
+      if (entry.second.segment == oldest) {
+        live.push_back({collectionEntry.first, entry.first, entry.second});
+      }
+    }
+  }
+  std::sort(live.begin(), live.end(),
+            [](const LiveRecord &a, const LiveRecord &b) {
+              return a.location.offset < b.location.offset;
+            });
+
+  struct Moved {
+    const LiveRecord *record;
+    size_t dataOffset;
+    size_t recordBytes;
+    uint32_t crc;
+  };
+  std::vector<Moved> moved;
+  String chunk;
+
+  // Copy forward in chunks of up to a quarter segment per append
+  auto flush = [&]() {
+    if (chunk.length() == 0) {
+      return true;
+    }
+    uint32_t segmentId = 0;
+    size_t offset = 0;
+    if (!append(chunk, segmentId, offset)) {
+      return false;
+    }
+    for (const Moved &entry : moved) {
+      Location location = {segmentId, (uint32_t)(offset + entry.dataOffset),
+                           entry.record->location.length,
+                           (uint32_t)entry.recordBytes, entry.crc};
+      applyToIndex('P', entry.record->collection, entry.record->key, location);
+    }
+    moved.clear();
+    chunk = String();
+    return true;
+  };
+
+  String path = getSegmentPath(oldest);
+  File file = LittleFS.open(path, FILE_READ);
+  if (!file && !live.empty()) {
+    return false;
+  }
+
+  for (const LiveRecord &record : live) {
+    String data = readData(file, record.collection, record.key,
+                           record.location);
+    if (data.length() != record.location.length) {
+      // Already unreadable through retrieve(); don't keep the segment alive
+      WARN_PRINTF("LogDatabaseDriver: Dropping unreadable %s/%s\n",
+                  record.collection.c_str(), record.key.c_str());
+      applyToIndex('D', record.collection, record.key, record.location);
+      continue;
+    }
+
+    size_t start = chunk.length();
+    Moved entry;
+    entry.record = &record;
+    entry.crc = encodeRecord(chunk, 'P', record.collection, record.key, data,
+                             entry.dataOffset);
+    entry.recordBytes = chunk.length() - start;
+    moved.push_back(entry);
+
+    if (chunk.length() >= maxSegmentBytes / 4 && !flush()) {
+      file.close();
+      return false;
+    }
+  }
+  if (file) {
+    file.close();
+  }
+  if (!flush()) {
+    return false;
+  }
+
+  // Every live record now has a newer copy - the segment is garbage
+  size_t reclaimed = segments.front().bytes;
+  if (LittleFS.exists(path) && !LittleFS.remove(path)) {
+    DEBUG_PRINTF("LogDatabaseDriver: Failed to remove %s\n", path.c_str());
+    return false;
+  }
+  segments.erase(segments.begin());
+
+  DEBUG_PRINTF("LogDatabaseDriver: Compacted segment %u (%u records moved, "
+               "%u bytes freed)\n",
+               (unsigned)oldest, (unsigned)live.size(), (unsigned)reclaimed);
+  return true;
+}
+
+size_t LogDatabaseDriver::compact() {
+  size_t compacted = 0;
+  // Bounded: compacting re-appends live data, which may seal new segments
+  size_t limit = getSegmentCount();
+  while (compacted < limit && needsCompaction() && compactOldestSegment()) {
+    compacted++;
+  }
+  return compacted;
+}
+
+size_t LogDatabaseDriver::getSegmentCount() {
+  ensureInitialized();
+  return segments.size();
+}
+
+size_t LogDatabaseDriver::getTotalBytes() {
+  ensureInitialized();
+  size_t total = 0;
+  for (const Segment &segment : segments) {
+    total += segment.bytes;
+  }
+  return total;
+}
+
+size_t LogDatabaseDriver::getDeadBytes() {
+  ensureInitialized();
+  size_t dead = 0;
+  for (const Segment &segment : segments) {
+    dead += segment.bytes - segment.liveBytes;
+  }
+  return dead;
+}
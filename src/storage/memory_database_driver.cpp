@@ -0,0 +1,291 @@
+#include "storage/memory_database_driver.h"
+#include "utilities/debug_macros.h"
+
+#ifdef NATIVE_PLATFORM
+#include <testing/native_debug_macros_compat.h>
+#endif
+
+MemoryDatabaseDriver::MemoryDatabaseDriver(size_t maxRecords, size_t maxBytes,
+                                           EvictionPolicy policy)
+    : driverName("memory"), maxRecords(maxRecords), maxBytes(maxBytes),
+      policy(policy), clock([]() { return time(nullptr); }), recordCount(0),
+      usedBytes(0), evictionCount(0) {}
+
+time_t MemoryDatabaseDriver::now() const {
+  return ttls.empty() ? 0 : clock();
+}
+
+bool MemoryDatabaseDriver::isExpired(const Entry &entry, time_t currentTime) {
+  return entry.expiresAt != 0 && currentTime >= entry.expiresAt;
+}
+
+size_t MemoryDatabaseDriver::recordSize(const String &key,
+                                        const String &data) {
+  return key.length() + data.length();
+}
+
+MemoryDatabaseDriver::Entry *
+MemoryDatabaseDriver::findEntry(const String &collection, const String &key) {
+  auto collectionIt = collections.find(collection);
+  if (collectionIt == collections.end()) {
+    return nullptr;
+  }
+  auto entryIt = collectionIt->second.find(key);
+  return entryIt != collectionIt->second.end() ? &entryIt->second : nullptr;
+}
+
+MemoryDatabaseDriver::Entry *
+MemoryDatabaseDriver::findLive(const String &collection, const String &key) {
+  Entry *entry = findEntry(collection, key);
+  if (entry && isExpired(*entry, now())) {
+    erase(collection, key);
+    return nullptr;
+  }
+  return entry;
+}
+
+bool MemoryDatabaseDriver::erase(const String &collection, const String &key) {
+  auto collectionIt = collections.find(collection);
+  if (collectionIt == collections.end()) {
+    return false;
+  }
+  auto entryIt = collectionIt->second.find(key);
+  if (entryIt == collectionIt->second.end()) {
+    return false;
+  }
+
+  usedBytes -= recordSize(key, entryIt->second.data);
+  recordCount--;
+  lru.erase(entryIt->second.lruPosition);
+  collectionIt->second.erase(entryIt);
+  if (collectionIt->second.empty()) {
+    collections.erase(collectionIt);
+  }
+  return true;
+}
+
+size_t MemoryDatabaseDriver::removeExpired() {
+  time_t currentTime = now();
+  if (currentTime == 0) {
+    return 0; // No TTLs, nothing can expire
+  }
+
+  size_t removed = 0;
+  for (auto collectionIt = collections.begin();
+       collectionIt != collections.end();) {
+    auto &entries = collectionIt->second;
+    for (auto entryIt = entries.begin(); entryIt != entries.end();) {
+      if (isExpired(entryIt->second, currentTime)) {
+        usedBytes -= recordSize(entryIt->first, entryIt->second.data);
+        recordCount--;
+        lru.erase(entryIt->second.lruPosition);
+        entryIt = entries.erase(entryIt);
+        removed++;
+      } else {
+        ++entryIt;
+      }
+    }
+    collectionIt = entries.empty() ? collections.erase(collectionIt)
+                                   : std::next(collectionIt);
+  }
+  return removed;
+}
+
+bool MemoryDatabaseDriver::fits(size_t size, size_t freedRecords,
+                                size_t freedBytes) const {
+  return recordCount - freedRecords + 1 <= maxRecords &&
+         usedBytes - freedBytes + size <= maxBytes;
+}
+
+bool MemoryDatabaseDriver::store(const String &collection, const String &key,
+                                 const String &data) {
+  if (collection.length() == 0 || key.length() == 0) {
+    return false;
+  }
+
+  size_t size = recordSize(key, data);
+  if (maxRecords == 0 || size > maxBytes) {
+    DEBUG_PRINTF("MemoryDatabaseDriver: %s/%s (%u bytes) exceeds capacity\n",
+                 collection.c_str(), key.c_str(), size);
+    return false;
+  }
+
+  // A replaced record frees its own slot first
+  Entry *existing = findEntry(collection, key);
+  size_t freedRecords = existing ? 1 : 0;
+  size_t freedBytes = existing ? recordSize(key, existing->data) : 0;
+  if (!fits(size, freedRecords, freedBytes) && removeExpired() > 0) {
+    existing = findEntry(collection, key);
+    freedRecords = existing ? 1 : 0;
+    freedBytes = existing ? recordSize(key, existing->data) : 0;
+  }
+  if (!fits(size, freedRecords, freedBytes) &&
+      policy == EvictionPolicy::RejectWhenFull) {
+    DEBUG_PRINTF("MemoryDatabaseDriver: Full, rejected %s/%s\n",
+                 collection.c_str(), key.c_str());
+    return false;
+  }
+
+  erase(collection, key);
+  while (!fits(size, 0, 0) && !lru.empty()) {
+    RecordRef oldest = lru.front();
+    // Copy the names - erase() frees the map nodes they point into
+    String oldestCollection = *oldest.collection;
+    String oldestKey = *oldest.key;
+    erase(oldestCollection, oldestKey);
+    evictionCount++;
+  }
+
+  unsigned long ttl = 0;
+  auto ttlIt = ttls.find(collection);
+  if (ttlIt != ttls.end()) {
+    ttl = ttlIt->second;
+  }
+
+  auto &entries = collections[collection];
+  auto inserted = entries.emplace(key, Entry());
+  Entry &entry = inserted.first->second;
+  entry.data = data;
+  entry.expiresAt = ttl > 0 ? now() + ttl : 0;
+
+  RecordRef ref;
+  ref.collection = &collections.find(collection)->first;
+  ref.key = &inserted.first->first;
+  entry.lruPosition = lru.insert(lru.end(), ref);
+
+  recordCount++;
+  usedBytes += size;
+  return true;
+}
+
+String MemoryDatabaseDriver::retrieve(const String &collection,
+                                      const String &key) {
+  Entry *entry = findLive(collection, key);
+  if (!entry) {
+    return String();
+  }
+
+  // Most recently used moves to the back of the eviction order
+  lru.splice(lru.end(), lru, entry->lruPosition);
+  return entry->data;
+}
+
+bool MemoryDatabaseDriver::remove(const String &collection,
+                                  const String &key) {
+  bool live = findLive(collection, key) != nullptr;
+  return live && erase(collection, key);
+}
+
+std::vector<String> MemoryDatabaseDriver::listKeys(const String &collection) {
+  std::vector<String> keys;
+  forEach(collection, [&keys](const String &key, const String &data) {
+    keys.push_back(key);
+    return true;
+  });
+  return keys;
+}
+
+bool MemoryDatabaseDriver::exists(const String &collection,
+                                  const String &key) {
+  return findLive(collection, key) != nullptr;
+}
+
+size_t MemoryDatabaseDriver::forEach(const String &collection,
+                                     RecordCallback callback) {
+  return scanFrom(collection, "", [](const String &key) { return true; },
+                  callback);
+}
+
+size_t MemoryDatabaseDriver::scanPrefix(const String &collection,
+                                        const String &prefix,
+                                        RecordCallback callback) {
+  return scanFrom(
+      collection, prefix,
+      [&prefix](const String &key) { return key.startsWith(prefix); },
+      callback);
+}
+
+size_t MemoryDatabaseDriver::scanRange(const String &collection,
+                                       const String &from, const String &to,
+                                       RecordCallback callback) {
+  return scanFrom(
+      collection, from,
+      [&to](const String &key) { return to.length() == 0 || key < to; },
+      callback);
+}
+
+size_t MemoryDatabaseDriver::scanFrom(
+    const String &collection, const String &from,
+    const std::function<bool(const String &)> &inRange,
+    RecordCallback callback) {
+  size_t visited = 0;
+
+  auto collectionIt = collections.find(collection);
+  if (collectionIt == collections.end() || !callback) {
+    return visited;
+  }
+
+  // Scans don't count as use - a full pass shouldn't reorder eviction
+  time_t currentTime = now();
+  const std::map<String, Entry> &records = collectionIt->second;
+  for (auto it = records.lower_bound(from);
+       it != records.end() && inRange(it->first); ++it) {
+    if (isExpired(it->second, currentTime)) {
+      continue; // Freed by maintain(); can't erase mid-iteration
+    }
+    visited++;
+    if (!callback(it->first, it->second.data)) {
+      break;
+    }
+  }
+  return visited;
+}
+
+size_t MemoryDatabaseDriver::count(const String &collection) {
+  return forEach(collection,
+                 [](const String &key, const String &data) { return true; });
+}
+
+bool MemoryDatabaseDriver::setCollectionTtl(const String &collection,
+                                            unsigned long ttlSeconds) {
+  if (collection.length() == 0) {
+    return false;
+  }
+
+  // Applies to records stored from now on
+  if (ttlSeconds == 0) {
+    ttls.erase(collection);
+  } else {
+    ttls[collection] = ttlSeconds;
+  }
+  return true;
+}
+
+void MemoryDatabaseDriver::maintain() {
+  size_t removed = removeExpired();
+  if (removed > 0) {
+    DEBUG_PRINTF("MemoryDatabaseDriver: Freed %u expired record(s)\n",
+                 removed);
+  }
+}
+
+String MemoryDatabaseDriver::getDriverName() const { return driverName; }
+
+void MemoryDatabaseDriver::setClock(Clock source) {
+  if (source) {
+    clock = source;
+  }
+}
+
+void MemoryDatabaseDriver::clear() {
+  collections.clear();
+  lru.clear();
+  recordCount = 0;
+  usedBytes = 0;
+}
+
+size_t MemoryDatabaseDriver::getRecordCount() const { return recordCount; }
+
+size_t MemoryDatabaseDriver::getUsedBytes() const { return usedBytes; }
+
+size_t MemoryDatabaseDriver::getEvictionCount() const { return evictionCount; }
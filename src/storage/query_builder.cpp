@@ -1,121 +1,435 @@
 #include "storage/query_builder.h"
-#include <ArduinoJson.h>
+#include "utilities/debug_macros.h"
+#include <algorithm>
+#include <cctype>
+#include <cstdlib>
+#include <cstring>
+#include <string>
 
 QueryBuilder::QueryBuilder(IDatabaseDriver* driver, const String& collectionName)
-    : targetDriver(driver), collection(collectionName), limitCount(-1) {
+    : targetDriver(driver), collection(collectionName), limitCount(-1),
+      orderDescending(false), filterDirty(true) {
 }
 
-// TODO: optional third arg for =/<> etc
-QueryBuilder& QueryBuilder::where(const String& key, const String& value) {
-    conditions[key] = value;
+QueryBuilder::Operator QueryBuilder::parseOperator(const String& op) {
+    if (op == "=" || op == "==") return Operator::Equal;
+    if (op == "!=" || op == "<>") return Operator::NotEqual;
+    if (op == "<") return Operator::Less;
+    if (op == "<=") return Operator::LessOrEqual;
+    if (op == ">") return Operator::Greater;
+    if (op == ">=") return Operator::GreaterOrEqual;
+    if (op == "prefix" || op == "startsWith") return Operator::StartsWith;
+    if (op == "contains") return Operator::Contains;
+    return Operator::Invalid;
+}
+
+QueryBuilder& QueryBuilder::addCondition(const String& key, Operator op,
+                                         const String& value) {
+    Condition condition;
+    condition.field = key;
+    condition.op = op;
+    condition.value = value;
+
+    // Parse the comparison value once here rather than per record
+    const char* text = value.c_str();
+    char* end = nullptr;
+    condition.number = strtod(text, &end);
+    condition.numeric = value.length() > 0 &&
+                        (isdigit((unsigned char)text[0]) || text[0] == '-' ||
+                         text[0] == '+' || text[0] == '.') &&
+                        end && *end == '\0';
+
+    conditions.push_back(condition);
+    filterDirty = true;
     return *this;
 }
 
+QueryBuilder& QueryBuilder::where(const String& key, const String& value) {
+    return addCondition(key, Operator::Equal, value);
+}
+
+QueryBuilder& QueryBuilder::where(const String& key, const String& op,
+                                  const String& value) {
+    Operator parsed = parseOperator(op);
+    if (parsed == Operator::Invalid) {
+        DEBUG_PRINTF("QueryBuilder: Unknown operator '%s' - condition will "
+                     "match nothing\n", op.c_str());
+    }
+    return addCondition(key, parsed, value);
+}
+
+QueryBuilder& QueryBuilder::where(const String& key, const String& op,
+                                  double value) {
+    // Integral values print without a fraction so a string field compared
+    // against where("n", "=", 5) still sees "5"
+    char text[32];
+    if (value == (double)(long long)value) {
+        snprintf(text, sizeof(text), "%lld", (long long)value);
+    } else {
+        snprintf(text, sizeof(text), "%.17g", value);
+    }
+    return where(key, op, String(text));
+}
+
 QueryBuilder& QueryBuilder::limit(int count) {
     limitCount = count;
     return *this;
 }
 
-String QueryBuilder::get() {
-    if (!targetDriver) {
-        return "";
+QueryBuilder& QueryBuilder::orderBy(const String& field, bool descending) {
+    orderField = field;
+    orderDescending = descending;
+    filterDirty = true;
+    return *this;
+}
+
+QueryBuilder& QueryBuilder::after(const String& cursor) {
+    afterCursor = cursor;
+    return *this;
+}
+
+void QueryBuilder::readSortValue(JsonVariantConst field, SortValue& value) {
+    value.numeric = false;
+    value.number = 0;
+    value.text = "";
+    if (field.isNull()) {
+        return;
+    }
+    if (field.is<double>()) {
+        value.numeric = true;
+        value.number = field.as<double>();
+    } else if (field.is<const char*>()) {
+        value.text = field.as<const char*>();
+    } else {
+        std::string scratch;
+        serializeJson(field, scratch);
+        value.text = scratch.c_str();
+    }
+}
+
+bool QueryBuilder::rowBefore(const Row& a, const Row& b) const {
+    int order = 0;
+    if (a.value.numeric != b.value.numeric) {
+        order = a.value.numeric ? -1 : 1; // Numbers sort before text
+    } else if (a.value.numeric) {
+        order = a.value.number < b.value.number
+                    ? -1
+                    : (a.value.number > b.value.number ? 1 : 0);
+    } else {
+        order = strcmp(a.value.text.c_str(), b.value.text.c_str());
+    }
+    if (order == 0) {
+        order = strcmp(a.key.c_str(), b.key.c_str());
+    }
+    return orderDescending ? order > 0 : order < 0;
+}
+
+// Cursor = hex of "<n|s><sort value>\n<key>" - opaque and URL-safe
+String QueryBuilder::encodeCursor(const Row& row) {
+    String plain = row.value.numeric ? "n" : "s";
+    if (row.value.numeric) {
+        char number[32];
+        snprintf(number, sizeof(number), "%.17g", row.value.number);
+        plain += number;
+    } else {
+        plain += row.value.text;
+    }
+    plain += "\n";
+    plain += row.key;
+
+    static const char digits[] = "0123456789abcdef";
+    String cursor;
+    cursor.reserve(plain.length() * 2);
+    for (size_t i = 0; i < plain.length(); i++) {
+        unsigned char c = (unsigned char)plain[i];
+        char hex[3] = {digits[c >> 4], digits[c & 0x0F], '\0'};
+        cursor += hex;
+    }
+    return cursor;
+}
+
+bool QueryBuilder::decodeCursor(const String& cursor, Row& row) {
+    if (cursor.length() < 4 || cursor.length() % 2 != 0) {
+        return false;
+    }
+    std::string plain;
+    for (size_t i = 0; i < cursor.length(); i += 2) {
+        char pair[3] = {cursor[i], cursor[i + 1], '\0'};
+        char* end = nullptr;
+        long byte = strtol(pair, &end, 16);
+        if (!end || *end != '\0' || !isxdigit((unsigned char)pair[0])) {
+            return false;
+        }
+        plain += (char)byte;
+    }
+
+    size_t separator = plain.rfind('\n');
+    if (separator == std::string::npos || (plain[0] != 'n' && plain[0] != 's')) {
+        return false;
+    }
+    std::string value = plain.substr(1, separator - 1);
+    row.key = plain.substr(separator + 1).c_str();
+    row.value.numeric = plain[0] == 'n';
+    row.value.number = row.value.numeric ? strtod(value.c_str(), nullptr) : 0;
+    row.value.text = row.value.numeric ? "" : value.c_str();
+    return true;
+}
+
+bool QueryBuilder::evaluate(const Condition& condition,
+                            JsonVariantConst field) {
+    if (condition.op == Operator::Invalid) {
+        return false;
+    }
+    if (field.isNull()) {
+        return condition.op == Operator::NotEqual;
+    }
+
+    // Typed comparison when both sides are numbers
+    if (condition.numeric && field.is<double>() &&
+        condition.op != Operator::StartsWith &&
+        condition.op != Operator::Contains) {
+        double actual = field.as<double>();
+        switch (condition.op) {
+        case Operator::Equal: return actual == condition.number;
+        case Operator::NotEqual: return actual != condition.number;
+        case Operator::Less: return actual < condition.number;
+        case Operator::LessOrEqual: return actual <= condition.number;
+        case Operator::Greater: return actual > condition.number;
+        case Operator::GreaterOrEqual: return actual >= condition.number;
+        default: return false;
+        }
+    }
+
+    // Compare strings in place; only non-string fields need serializing
+    const char* text;
+    std::string scratch;
+    if (field.is<const char*>()) {
+        text = field.as<const char*>();
+    } else if (field.is<bool>()) {
+        text = field.as<bool>() ? "true" : "false";
+    } else {
+        serializeJson(field, scratch);
+        text = scratch.c_str();
+    }
+
+    const char* expected = condition.value.c_str();
+    switch (condition.op) {
+    case Operator::Equal: return strcmp(text, expected) == 0;
+    case Operator::NotEqual: return strcmp(text, expected) != 0;
+    case Operator::Less: return strcmp(text, expected) < 0;
+    case Operator::LessOrEqual: return strcmp(text, expected) <= 0;
+    case Operator::Greater: return strcmp(text, expected) > 0;
+    case Operator::GreaterOrEqual: return strcmp(text, expected) >= 0;
+    case Operator::StartsWith:
+        return strncmp(text, expected, condition.value.length()) == 0;
+    case Operator::Contains: return strstr(text, expected) != nullptr;
+    default: return false;
+    }
+}
+
+bool QueryBuilder::matchesConditions(const String& data, JsonDocument& doc) {
+    if (conditions.empty() && orderField.length() == 0) {
+        return true;
     }
     
-    // If no conditions, just get first key
-    if (conditions.empty()) {
-        std::vector<String> keys = targetDriver->listKeys(collection);
-        if (!keys.empty()) {
-            return targetDriver->retrieve(collection, keys[0]);
+    if (filterDirty) {
+        fieldFilter.clear();
+        for (const Condition& condition : conditions) {
+            fieldFilter[condition.field] = true;
         }
-        return "";
+        if (orderField.length() > 0) {
+            fieldFilter[orderField] = true;
+        }
+        filterDirty = false;
     }
     
-    // Find first match based on conditions
-    std::vector<String> keys = targetDriver->listKeys(collection);
-    int count = 0;
+    // Only the WHERE/ORDER BY fields are materialized - everything else in
+    // the record is skipped by the parser
+    DeserializationError error = deserializeJson(
+        doc, data.c_str(), DeserializationOption::Filter(fieldFilter));
+    if (error) {
+        return false;
+    }
     
+    for (const Condition& condition : conditions) {
+        if (!evaluate(condition, doc[condition.field])) {
+            return false;
+        }
+    }
+    return true;
+}
+
+const QueryBuilder::Condition* QueryBuilder::indexedCondition() const {
+    if (!targetDriver) {
+        return nullptr;
+    }
+    for (const Condition& condition : conditions) {
+        if (condition.op == Operator::Equal &&
+            targetDriver->hasIndex(collection, condition.field)) {
+            return &condition;
+        }
+    }
+    return nullptr;
+}
+
+void QueryBuilder::forEachCandidate(bool keyOrder, const String& afterKey,
+                                    IDatabaseDriver::RecordCallback callback) {
+    const Condition* condition = indexedCondition();
+    std::vector<String> keys;
+    if (!condition || !targetDriver->lookupIndex(collection, condition->field,
+                                                 condition->value, keys)) {
+        if (!keyOrder) {
+            targetDriver->forEach(collection, callback);
+            return;
+        }
+        // forEach() may run in storage order (the log driver reads in log
+        // order); scanRange() is always by key and seeks past the cursor
+        targetDriver->scanRange(collection, afterKey, "",
+                                [&](const String& key, const String& data) {
+            return key == afterKey || callback(key, data);
+        });
+        return;
+    }
+
+    // Index entries are in insertion order
+    if (keyOrder) {
+        std::sort(keys.begin(), keys.end());
+    }
     for (const String& key : keys) {
-        if (limitCount > 0 && count >= limitCount) {
-            break;
+        if (keyOrder && afterKey.length() > 0 &&
+            strcmp(key.c_str(), afterKey.c_str()) <= 0) {
+            continue;
         }
-        
         String data = targetDriver->retrieve(collection, key);
         if (data.length() == 0) continue;
-        
-        // Check if data matches all conditions
-        bool matches = true;
-        JsonDocument doc;
-        DeserializationError error = deserializeJson(doc, data.c_str());
-        
-        if (!error) {
-            for (const auto& condition : conditions) {
-                String fieldValue = String(doc[condition.first].as<std::string>().c_str());
-                if (fieldValue != condition.second) {
-                    matches = false;
-                    break;
-                }
-            }
-        } else {
-            matches = false;
-        }
-        
-        if (matches) {
-            return data;
-        }
-        count++;
+        if (!callback(key, data)) break;
     }
-    
-    return "";
 }
 
-std::vector<String> QueryBuilder::getAll() {
-    std::vector<String> results;
-    
+String QueryBuilder::explain() const {
+    const Condition* condition = indexedCondition();
+    if (condition) {
+        return "INDEX " + condition->field;
+    }
+    return "SCAN";
+}
+
+String QueryBuilder::get() {
     if (!targetDriver) {
-        return results;
+        return "";
     }
+
+    String found;
+    if (orderField.length() > 0) {
+        int savedLimit = limitCount;
+        limitCount = 1;
+        each([&](const String&, const String& data) {
+            found = data;
+            return false;
+        });
+        limitCount = savedLimit;
+        return found;
+    }
+
+    // Unordered: the first match in key order wins, so stop reading as soon
+    // as it's found
+    Row cursorRow;
+    if (afterCursor.length() == 0 || !decodeCursor(afterCursor, cursorRow)) {
+        cursorRow.key = "";
+    }
+    JsonDocument doc;
+    forEachCandidate(true, cursorRow.key, [&](const String&, const String& data) {
+        if (matchesConditions(data, doc)) {
+            found = data;
+            return false;
+        }
+        return true;
+    });
     
-    std::vector<String> keys = targetDriver->listKeys(collection);
-    int count = 0;
-    
-    for (const String& key : keys) {
-        if (limitCount > 0 && count >= limitCount) {
-            break;
+    return found;
+}
+
+size_t QueryBuilder::each(IDatabaseDriver::RecordCallback callback) {
+    nextCursorValue = "";
+    if (!targetDriver) {
+        return 0;
+    }
+
+    Row cursorRow;
+    bool hasCursor = afterCursor.length() > 0 && decodeCursor(afterCursor, cursorRow);
+    JsonDocument doc;
+    size_t delivered = 0;
+
+    // Nothing to sort or page - stream matches straight through, read in
+    // key order
+    if (orderField.length() == 0 && limitCount <= 0) {
+        String afterKey = hasCursor ? cursorRow.key : String();
+        forEachCandidate(true, afterKey, [&](const String& key, const String& data) {
+            if (!matchesConditions(data, doc)) {
+                return true;
+            }
+            delivered++;
+            return callback(key, data);
+        });
+        return delivered;
+    }
+
+    // Keep the first `limit` matches in result order; anything past them
+    // only needs to be noticed so a cursor is handed out. Rows are placed by
+    // rowBefore(), so candidates may arrive in any order.
+    std::vector<Row> rows;
+    bool truncated = false;
+    auto before = [this](const Row& a, const Row& b) { return rowBefore(a, b); };
+    forEachCandidate(false, String(), [&](const String& key, const String& data) {
+        if (!matchesConditions(data, doc)) {
+            return true;
         }
-        
-        String data = targetDriver->retrieve(collection, key);
-        if (data.length() == 0) continue;
-        
-        // If no conditions, include all
-        if (conditions.empty()) {
-            results.push_back(data);
-            count++;
-            continue;
+        Row row;
+        row.key = key;
+        if (orderField.length() > 0) {
+            readSortValue(doc[orderField], row.value);
         }
-        
-        // Check if data matches all conditions
-        bool matches = true;
-        JsonDocument doc;
-        DeserializationError error = deserializeJson(doc, data.c_str());
-        
-        if (!error) {
-            for (const auto& condition : conditions) {
-                String fieldValue = String(doc[condition.first].as<std::string>().c_str());
-                if (fieldValue != condition.second) {
-                    matches = false;
-                    break;
-                }
+        if (hasCursor && !rowBefore(cursorRow, row)) {
+            return true;
+        }
+        if (limitCount > 0 && rows.size() >= (size_t)limitCount) {
+            truncated = true;
+            if (!rowBefore(row, rows.back())) {
+                return true;
             }
-        } else {
-            matches = false;
+            rows.pop_back();
         }
-        
-        if (matches) {
-            results.push_back(data);
+        row.data = data;
+        rows.insert(std::upper_bound(rows.begin(), rows.end(), row, before),
+                    std::move(row));
+        return true;
+    });
+
+    for (size_t i = 0; i < rows.size(); i++) {
+        delivered++;
+        if (!callback(rows[i].key, rows[i].data)) {
+            if (i + 1 < rows.size() || truncated) {
+                nextCursorValue = encodeCursor(rows[i]);
+            }
+            return delivered;
         }
-        count++;
     }
-    
+    if (truncated && !rows.empty()) {
+        nextCursorValue = encodeCursor(rows.back());
+    }
+    return delivered;
+}
+
+String QueryBuilder::nextCursor() const {
+    return nextCursorValue;
+}
+
+std::vector<String> QueryBuilder::getAll() {
+    std::vector<String> results;
+    each([&](const String&, const String& data) {
+        results.push_back(data);
+        return true;
+    });
     return results;
 }
 
@@ -141,46 +455,22 @@ bool QueryBuilder::remove() {
         return false;
     }
     
-    bool anyRemoved = false;
-    std::vector<String> keys = targetDriver->listKeys(collection);
-    
-    for (const String& key : keys) {
-        String data = targetDriver->retrieve(collection, key);
-        if (data.length() == 0) continue;
-        
-        // If no conditions, remove all
-        if (conditions.empty()) {
-            if (targetDriver->remove(collection, key)) {
-                anyRemoved = true;
-            }
-            continue;
-        }
-        
-        // Check if data matches all conditions
-        bool matches = true;
-        JsonDocument doc;
-        DeserializationError error = deserializeJson(doc, data.c_str());
-        
-        if (!error) {
-            for (const auto& condition : conditions) {
-                String fieldValue = String(doc[condition.first].as<std::string>().c_str());
-                if (fieldValue != condition.second) {
-                    matches = false;
-                    break;
-                }
-            }
-        } else {
-            matches = false;
-        }
-        
-        if (matches) {
-            if (targetDriver->remove(collection, key)) {
-                anyRemoved = true;
-            }
+    // Drivers don't allow removing while iterating - collect first, then
+    // remove as one batch (one write per collection on drivers that
+    // rewrite the whole collection)
+    WriteBatch batch(targetDriver);
+    JsonDocument doc;
+    forEachCandidate(false, String(), [&](const String& key, const String& data) {
+        if (matchesConditions(data, doc)) {
+            batch.remove(collection, key);
         }
-    }
+        return true;
+    });
     
-    return anyRemoved;
+    if (batch.empty()) {
+        return false;
+    }
+    return batch.commit();
 }
 
 IDatabaseDriver* QueryBuilder::getDriver() const {
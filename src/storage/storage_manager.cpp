@@ -1,6 +1,10 @@
 #include "storage/storage_manager.h"
+#include "auth/auth_constants.h"
+#include "storage/caching_database_driver.h"
+#include "storage/indexed_database_driver.h"
 #include "storage/json_database_driver.h"
 #include "storage/littlefs_database_driver.h"
+#include "storage/memory_database_driver.h"
 #include "storage/query_builder.h"
 #include "utilities/debug_macros.h"
 #include <ArduinoJson.h>
@@ -13,6 +17,13 @@
 std::map<String, std::unique_ptr<IDatabaseDriver>> StorageManager::drivers;
 String StorageManager::defaultDriverName = "json";
 bool StorageManager::initialized = false;
+std::vector<StorageManager::IndexDeclaration>
+    StorageManager::indexDeclarations;
+std::map<String, IndexedDatabaseDriver *> StorageManager::indexedDrivers;
+std::vector<StorageManager::FormatDeclaration>
+    StorageManager::formatDeclarations;
+std::vector<StorageManager::TtlDeclaration> StorageManager::ttlDeclarations;
+std::map<String, String> StorageManager::collectionRoutes;
 
 void StorageManager::ensureInitialized() {
   if (!initialized) {
@@ -28,10 +39,105 @@ void StorageManager::ensureInitialized() {
           new LittleFSDatabaseDriver("/openapi_storage"));
     }
 
+    // Create RAM-only driver for ephemeral collections if it doesn't exist
+    if (drivers.find("memory") == drivers.end()) {
+      drivers["memory"] =
+          std::unique_ptr<IDatabaseDriver>(new MemoryDatabaseDriver());
+    }
+
+    // Page tokens get a RAM driver of their own, so other ephemeral
+    // collections on "memory" can't evict the tokens of open forms
+    if (drivers.find("memory:page_tokens") == drivers.end()) {
+      drivers["memory:page_tokens"] =
+          std::unique_ptr<IDatabaseDriver>(new MemoryDatabaseDriver(
+              AuthConstants::MAX_PAGE_TOKENS,
+              AuthConstants::PAGE_TOKEN_MAX_BYTES));
+    }
+
+    // LittleFS behind a read cache (PSRAM when the board has it). The
+    // cache is only allocated as records are read through it. It keeps its
+    // own directory: writes made through "littlefs" would bypass the cache
+    // and leave it serving stale records.
+    if (drivers.find("cached:littlefs") == drivers.end()) {
+      drivers["cached:littlefs"] =
+          std::unique_ptr<IDatabaseDriver>(new CachingDatabaseDriver(
+              std::unique_ptr<IDatabaseDriver>(
+                  new LittleFSDatabaseDriver("/openapi_cached_storage"))));
+    }
+
     initialized = true;
+    for (const char *name : {"json", "littlefs", "memory", "memory:page_tokens",
+                             "cached:littlefs"}) {
+      applyIndexDeclarations(name);
+      applyFormatDeclarations(name);
+      applyTtlDeclarations(name);
+    }
+  }
+}
+
+void StorageManager::applyIndexDeclarations(const String &name) {
+  auto driverIt = drivers.find(name);
+  if (driverIt == drivers.end()) {
+    return;
+  }
+
+  for (const IndexDeclaration &declaration : indexDeclarations) {
+    if (declaration.driverName != name) {
+      continue;
+    }
+
+    auto wrapperIt = indexedDrivers.find(name);
+    IndexedDatabaseDriver *wrapper;
+    if (wrapperIt != indexedDrivers.end()) {
+      wrapper = wrapperIt->second;
+    } else {
+      wrapper = new IndexedDatabaseDriver(std::move(driverIt->second));
+      driverIt->second = std::unique_ptr<IDatabaseDriver>(wrapper);
+      indexedDrivers[name] = wrapper;
+    }
+    wrapper->addIndex(declaration.collection, declaration.field);
   }
 }
 
+void StorageManager::applyFormatDeclarations(const String &name) {
+  auto driverIt = drivers.find(name);
+  if (driverIt == drivers.end()) {
+    return;
+  }
+
+  for (const FormatDeclaration &declaration : formatDeclarations) {
+    if (declaration.driverName == name) {
+      driverIt->second->setRecordFormat(declaration.collection,
+                                        declaration.format);
+    }
+  }
+}
+
+void StorageManager::applyTtlDeclarations(const String &name) {
+  auto driverIt = drivers.find(name);
+  if (driverIt == drivers.end()) {
+    return;
+  }
+
+  for (const TtlDeclaration &declaration : ttlDeclarations) {
+    if (declaration.driverName == name) {
+      driverIt->second->setCollectionTtl(declaration.collection,
+                                         declaration.ttlSeconds);
+    }
+  }
+}
+
+String StorageManager::resolveDriverName(const String &collection,
+                                         const String &driverName) {
+  if (driverName.length() > 0) {
+    return driverName;
+  }
+
+  auto routeIt = collectionRoutes.find(collection);
+  return routeIt != collectionRoutes.end() ? routeIt->second
+                                           : defaultDriverName;
+}
+
 void StorageManager::configureDriver(const String &name,
                                      std::unique_ptr<IDatabaseDriver> driver) {
   if (name.length() == 0 || !driver) {
@@ -40,6 +146,10 @@ void StorageManager::configureDriver(const String &name,
 
   ensureInitialized();
   drivers[name] = std::move(driver);
+  indexedDrivers.erase(name);
+  applyIndexDeclarations(name);
+  applyFormatDeclarations(name);
+  applyTtlDeclarations(name);
 
   DEBUG_PRINTF("StorageManager: Configured driver '%s'\n", name.c_str());
 }
@@ -78,6 +188,40 @@ IDatabaseDriver &StorageManager::driver(const String &name) {
   return *(defaultIt->second.get());
 }
 
+IDatabaseDriver &StorageManager::driverFor(const String &collection,
+                                           const String &fallbackName) {
+  ensureInitialized();
+
+  auto routeIt = collectionRoutes.find(collection);
+  if (routeIt != collectionRoutes.end()) {
+    auto it = drivers.find(routeIt->second);
+    if (it != drivers.end()) {
+      return *(it->second.get());
+    }
+
+    WARN_PRINTF("StorageManager: Warning - driver '%s' for '%s' not found\n",
+                routeIt->second.c_str(), collection.c_str());
+  }
+
+  return driver(fallbackName);
+}
+
+void StorageManager::routeCollection(const String &collection,
+                                     const String &driverName) {
+  if (collection.length() == 0) {
+    return;
+  }
+
+  if (driverName.length() == 0) {
+    collectionRoutes.erase(collection);
+    return;
+  }
+
+  collectionRoutes[collection] = driverName;
+  DEBUG_PRINTF("StorageManager: Routed '%s' to driver '%s'\n",
+               collection.c_str(), driverName.c_str());
+}
+
 std::vector<String> StorageManager::getDriverNames() {
   ensureInitialized();
 
@@ -104,6 +248,7 @@ bool StorageManager::removeDriver(const String &name) {
   auto it = drivers.find(name);
   if (it != drivers.end()) {
     drivers.erase(it);
+    indexedDrivers.erase(name);
 
     // If we removed the default driver, fall back to JSON
     if (defaultDriverName == name) {
@@ -118,8 +263,107 @@ bool StorageManager::removeDriver(const String &name) {
   return false;
 }
 
+void StorageManager::declareIndex(const String &collection,
+                                  const String &field,
+                                  const String &driverName) {
+  if (collection.length() == 0 || field.length() == 0) {
+    return;
+  }
+
+  ensureInitialized();
+  String targetName = resolveDriverName(collection, driverName);
+  for (const IndexDeclaration &declaration : indexDeclarations) {
+    if (declaration.driverName == targetName &&
+        declaration.collection == collection && declaration.field == field) {
+      return;
+    }
+  }
+
+  IndexDeclaration declaration;
+  declaration.driverName = targetName;
+  declaration.collection = collection;
+  declaration.field = field;
+  indexDeclarations.push_back(declaration);
+  applyIndexDeclarations(targetName);
+}
+
+void StorageManager::maintain() {
+  for (auto &pair : drivers) {
+    pair.second->maintain();
+  }
+}
+
+bool StorageManager::flush() {
+  bool ok = true;
+  for (auto &pair : drivers) {
+    if (!pair.second->flush()) {
+      WARN_PRINTF("StorageManager: Warning - driver '%s' failed to flush\n",
+                  pair.first.c_str());
+      ok = false;
+    }
+  }
+  return ok;
+}
+
+void StorageManager::declareFormat(const String &collection,
+                                   RecordFormat format,
+                                   const String &driverName) {
+  if (collection.length() == 0) {
+    return;
+  }
+
+  ensureInitialized();
+  String targetName = resolveDriverName(collection, driverName);
+  bool found = false;
+  for (FormatDeclaration &declaration : formatDeclarations) {
+    if (declaration.driverName == targetName &&
+        declaration.collection == collection) {
+      declaration.format = format;
+      found = true;
+    }
+  }
+
+  if (!found) {
+    FormatDeclaration declaration;
+    declaration.driverName = targetName;
+    declaration.collection = collection;
+    declaration.format = format;
+    formatDeclarations.push_back(declaration);
+  }
+  applyFormatDeclarations(targetName);
+}
+
+void StorageManager::declareTtl(const String &collection,
+                                unsigned long ttlSeconds,
+                                const String &driverName) {
+  if (collection.length() == 0) {
+    return;
+  }
+
+  ensureInitialized();
+  String targetName = resolveDriverName(collection, driverName);
+  bool found = false;
+  for (TtlDeclaration &declaration : ttlDeclarations) {
+    if (declaration.driverName == targetName &&
+        declaration.collection == collection) {
+      declaration.ttlSeconds = ttlSeconds;
+      found = true;
+    }
+  }
+
+  if (!found) {
+    TtlDeclaration declaration;
+    declaration.driverName = targetName;
+    declaration.collection = collection;
+    declaration.ttlSeconds = ttlSeconds;
+    ttlDeclarations.push_back(declaration);
+  }
+  applyTtlDeclarations(targetName);
+}
+
 void StorageManager::clearAllDrivers() {
   drivers.clear();
+  indexedDrivers.clear();
   defaultDriverName = "json";
   initialized = false;
 
@@ -0,0 +1,82 @@
+#include "storage/write_batch.h"
+#include "storage/database_driver_interface.h"
+
+WriteBatch::WriteBatch(IDatabaseDriver *driver) : targetDriver(driver) {}
+
+WriteBatch &WriteBatch::put(const String &collection, const String &key,
+                            const String &data) {
+  Operation op;
+  op.isRemove = false;
+  op.collection = collection;
+  op.key = key;
+  op.data = data;
+  ops.push_back(op);
+  return *this;
+}
+
+WriteBatch &WriteBatch::remove(const String &collection, const String &key) {
+  Operation op;
+  op.isRemove = true;
+  op.collection = collection;
+  op.key = key;
+  ops.push_back(op);
+  return *this;
+}
+
+bool WriteBatch::commit() {
+  if (!targetDriver) {
+    return false;
+  }
+  if (ops.empty()) {
+    return true;
+  }
+
+  bool applied = targetDriver->applyBatch(*this);
+  ops.clear();
+  return applied;
+}
+
+void WriteBatch::clear() { ops.clear(); }
+
+bool WriteBatch::empty() const { return ops.empty(); }
+
+size_t WriteBatch::size() const { return ops.size(); }
+
+const std::vector<WriteBatch::Operation> &WriteBatch::operations() const {
+  return ops;
+}
+
+std::vector<String> WriteBatch::collections() const {
+  std::vector<String> names;
+  for (const Operation &op : ops) {
+    bool seen = false;
+    for (const String &name : names) {
+      if (name == op.collection) {
+        seen = true;
+        break;
+      }
+    }
+    if (!seen) {
+      names.push_back(op.collection);
+    }
+  }
+  return names;
+}
+
+std::vector<WriteBatch::Operation> WriteBatch::collapsed() const {
+  std::vector<Operation> result;
+  for (const Operation &op : ops) {
+    bool replaced = false;
+    for (Operation &existing : result) {
+      if (existing.collection == op.collection && existing.key == op.key) {
+        existing = op;
+        replaced = true;
+        break;
+      }
+    }
+    if (!replaced) {
+      result.push_back(op);
+    }
+  }
+  return result;
+}
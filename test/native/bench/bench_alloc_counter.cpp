@@ -0,0 +1,68 @@
+#include "bench_utils.h"
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+// Counts heap allocations for Bench::allocationStats(). Arduino's String
+// and ArduinoJson allocate with malloc()/realloc(), so on glibc the C
+// allocator itself is interposed (operator new goes through malloc there
+// too). Elsewhere only operator new is counted.
+
+namespace {
+std::atomic<size_t> allocationCount(0);
+std::atomic<size_t> allocatedBytes(0);
+
+inline void recordAllocation(size_t size) {
+  allocationCount.fetch_add(1, std::memory_order_relaxed);
+  allocatedBytes.fetch_add(size, std::memory_order_relaxed);
+}
+} // namespace
+
+Bench::AllocationStats Bench::allocationStats() {
+  AllocationStats stats;
+  stats.count = allocationCount.load(std::memory_order_relaxed);
+  stats.bytes = allocatedBytes.load(std::memory_order_relaxed);
+  return stats;
+}
+
+#if defined(__GLIBC__)
+
+extern "C" {
+void *__libc_malloc(size_t size);
+void *__libc_calloc(size_t count, size_t size);
+void *__libc_realloc(void *ptr, size_t size);
+
+void *malloc(size_t size) {
+  recordAllocation(size);
+  return __libc_malloc(size);
+}
+
+void *calloc(size_t count, size_t size) {
+  recordAllocation(count * size);
+  return __libc_calloc(count, size);
+}
+
+void *realloc(void *ptr, size_t size) {
+  recordAllocation(size);
+  return __libc_realloc(ptr, size);
+}
+}
+
+#else
+
+void *operator new(size_t size) {
+  recordAllocation(size);
+  void *ptr = std::malloc(size > 0 ? size : 1);
+  if (!ptr) {
+    throw std::bad_alloc();
+  }
+  return ptr;
+}
+
+void *operator new[](size_t size) { return operator new(size); }
+
+void operator delete(void *ptr) noexcept { std::free(ptr); }
+
+void operator delete[](void *ptr) noexcept { std::free(ptr); }
+
+#endif
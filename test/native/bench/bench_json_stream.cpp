@@ -0,0 +1,95 @@
+#include "bench_utils.h"
+#include "platform/response_body.h"
+#include <ArduinoJson.h>
+
+namespace {
+
+const int DOCUMENT_ROUNDS = 200;
+const size_t CHUNK_SIZE = 512;
+
+// A large API response: a listing shaped like the users endpoint
+void buildListing(JsonDocument &doc) {
+  JsonArray users = doc["users"].to<JsonArray>();
+  for (int i = 0; i < 300; i++) {
+    JsonObject user = users.add<JsonObject>();
+    user["id"] = "user" + String(i);
+    user["username"] = "operator" + String(i);
+    user["isAdmin"] = i % 10 == 0;
+    user["createdAt"] = 1700000000 + i;
+    JsonArray roles = user["roles"].to<JsonArray>();
+    roles.add("viewer");
+    roles.add("editor");
+  }
+}
+
+// The old JSON response path: a String grown one byte at a time, flushed
+// as a chunk every 500 bytes
+class StringPrint : public Print {
+public:
+  size_t sent = 0;
+
+  StringPrint() { buffer.reserve(CHUNK_SIZE); }
+
+  size_t write(uint8_t c) override {
+    buffer += (char)c;
+    if (buffer.length() >= 500) {
+      flush();
+    }
+    return 1;
+  }
+
+  void flush() {
+    sent += buffer.length();
+    buffer = "";
+  }
+
+private:
+  String buffer;
+};
+
+} // namespace
+
+void bench_json_stream_large_document(void) {
+  JsonDocument doc;
+  buildListing(doc);
+  size_t length = measureJson(doc);
+
+  Bench::Timer stringTimer;
+  size_t stringSent = 0;
+  for (int round = 0; round < DOCUMENT_ROUNDS; round++) {
+    StringPrint printer;
+    serializeJson(doc, printer);
+    printer.flush();
+    stringSent += printer.sent;
+  }
+  Bench::report("json per-byte String print", DOCUMENT_ROUNDS,
+                stringTimer.elapsedMicros());
+
+  Bench::Timer chunkTimer;
+  size_t chunkSent = 0;
+  size_t chunks = 0;
+  for (int round = 0; round < DOCUMENT_ROUNDS; round++) {
+    char buffer[CHUNK_SIZE];
+    ResponseBody::ChunkWriter writer(buffer, sizeof(buffer),
+                                     [&](const char *, size_t size) {
+                                       chunkSent += size;
+                                       chunks++;
+                                       return true;
+                                     });
+    ResponseBody::ChunkPrint printer(writer);
+    serializeJson(doc, printer);
+    writer.flush();
+  }
+  Bench::report("json ChunkPrint", DOCUMENT_ROUNDS, chunkTimer.elapsedMicros());
+
+  char line[96];
+  snprintf(line, sizeof(line), "json document: %zu bytes, %zu chunks", length,
+           chunks / DOCUMENT_ROUNDS);
+  TEST_MESSAGE(line);
+  TEST_ASSERT_EQUAL(length * DOCUMENT_ROUNDS, stringSent);
+  TEST_ASSERT_EQUAL(length * DOCUMENT_ROUNDS, chunkSent);
+}
+
+void register_json_stream_benchmarks(void) {
+  RUN_TEST(bench_json_stream_large_document);
+}
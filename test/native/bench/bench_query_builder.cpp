@@ -0,0 +1,183 @@
+#include "bench_utils.h"
+#include "storage/indexed_database_driver.h"
+#include "storage/query_builder.h"
+#include <ArduinoJson.h>
+#include <map>
+#include <string>
+
+namespace {
+
+const size_t RECORD_COUNT = 1000;
+const int QUERY_ROUNDS = 20;
+
+// In-memory driver so the numbers measure QueryBuilder's matching, not a
+// storage backend
+class MemoryDriver : public IDatabaseDriver {
+private:
+  std::map<String, std::map<String, String>> data;
+
+public:
+  bool store(const String &collection, const String &key,
+             const String &value) override {
+    data[collection][key] = value;
+    return true;
+  }
+  String retrieve(const String &collection, const String &key) override {
+    auto &col = data[collection];
+    auto it = col.find(key);
+    return it == col.end() ? String() : it->second;
+  }
+  bool remove(const String &collection, const String &key) override {
+    return data[collection].erase(key) > 0;
+  }
+  std::vector<String> listKeys(const String &collection) override {
+    std::vector<String> keys;
+    for (const auto &entry : data[collection]) {
+      keys.push_back(entry.first);
+    }
+    return keys;
+  }
+  bool exists(const String &collection, const String &key) override {
+    return data[collection].count(key) > 0;
+  }
+  size_t forEach(const String &collection, RecordCallback callback) override {
+    size_t visited = 0;
+    for (const auto &entry : data[collection]) {
+      visited++;
+      if (!callback(entry.first, entry.second)) {
+        break;
+      }
+    }
+    return visited;
+  }
+  String getDriverName() const override { return "bench-memory"; }
+};
+
+// Records shaped like AuthApiToken - a handful of short strings and
+// numbers, ~230 bytes each
+void populate(IDatabaseDriver &driver) {
+  char key[16];
+  char json[320];
+  for (size_t i = 0; i < RECORD_COUNT; i++) {
+    snprintf(key, sizeof(key), "tok%04zu", i);
+    snprintf(json, sizeof(json),
+             "{\"id\":\"%s\",\"token\":\"tok_%032zu\",\"userId\":\"user%02zu\","
+             "\"username\":\"user%02zu\",\"name\":\"Token %zu\","
+             "\"createdAt\":%zu,\"expiresAt\":%zu}",
+             key, i, i % 50, i % 50, i, 1700000000 + i, 1800000000 + i);
+    driver.store("tokens", key, json);
+  }
+}
+
+// The pre-pushdown matching loop: parse the whole record, then convert
+// the field to a std::string and a String before comparing
+size_t legacyFullParseScan(MemoryDriver &driver, const char *field,
+                           const char *value) {
+  size_t matches = 0;
+  driver.forEach("tokens", [&](const String &, const String &data) {
+    JsonDocument doc;
+    if (!deserializeJson(doc, data.c_str())) {
+      String fieldValue = String(doc[field].as<std::string>().c_str());
+      if (fieldValue == value) {
+        matches++;
+      }
+    }
+    return true;
+  });
+  return matches;
+}
+
+} // namespace
+
+void bench_query_builder_legacy_full_parse_equality(void) {
+  MemoryDriver driver;
+  populate(driver);
+
+  size_t matches = 0;
+  Bench::Timer timer;
+  for (int round = 0; round < QUERY_ROUNDS; round++) {
+    matches = legacyFullParseScan(driver, "userId", "user07");
+  }
+  Bench::report("legacy full-parse where(userId) x1000", QUERY_ROUNDS,
+                timer.elapsedMicros());
+  TEST_ASSERT_EQUAL(RECORD_COUNT / 50, matches);
+}
+
+void bench_query_builder_filtered_equality(void) {
+  MemoryDriver driver;
+  populate(driver);
+
+  size_t matches = 0;
+  Bench::Timer timer;
+  for (int round = 0; round < QUERY_ROUNDS; round++) {
+    matches = QueryBuilder(&driver, "tokens")
+                  .where("userId", "user07")
+                  .getAll()
+                  .size();
+  }
+  Bench::report("filtered where(userId) x1000", QUERY_ROUNDS,
+                timer.elapsedMicros());
+  TEST_ASSERT_EQUAL(RECORD_COUNT / 50, matches);
+}
+
+void bench_query_builder_numeric_range(void) {
+  MemoryDriver driver;
+  populate(driver);
+
+  size_t matches = 0;
+  Bench::Timer timer;
+  for (int round = 0; round < QUERY_ROUNDS; round++) {
+    matches = QueryBuilder(&driver, "tokens")
+                  .where("createdAt", ">=", 1700000100)
+                  .where("createdAt", "<", 1700000200)
+                  .getAll()
+                  .size();
+  }
+  Bench::report("where(createdAt range) x1000", QUERY_ROUNDS,
+                timer.elapsedMicros());
+  TEST_ASSERT_EQUAL(100, matches);
+}
+
+void bench_query_builder_prefix(void) {
+  MemoryDriver driver;
+  populate(driver);
+
+  size_t matches = 0;
+  Bench::Timer timer;
+  for (int round = 0; round < QUERY_ROUNDS; round++) {
+    matches = QueryBuilder(&driver, "tokens")
+                  .where("name", "prefix", "Token 99")
+                  .getAll()
+                  .size();
+  }
+  Bench::report("where(name prefix) x1000", QUERY_ROUNDS,
+                timer.elapsedMicros());
+  TEST_ASSERT_EQUAL(11, matches); // "Token 99" and "Token 990".."Token 999"
+}
+
+void bench_query_builder_indexed_equality(void) {
+  IndexedDatabaseDriver driver(
+      std::unique_ptr<IDatabaseDriver>(new MemoryDriver()));
+  driver.addIndex("tokens", "userId");
+  populate(driver);
+
+  size_t matches = 0;
+  Bench::Timer timer;
+  for (int round = 0; round < QUERY_ROUNDS; round++) {
+    matches = QueryBuilder(&driver, "tokens")
+                  .where("userId", "user07")
+                  .getAll()
+                  .size();
+  }
+  Bench::report("indexed where(userId) x1000", QUERY_ROUNDS,
+                timer.elapsedMicros());
+  TEST_ASSERT_EQUAL(RECORD_COUNT / 50, matches);
+}
+
+void register_query_builder_benchmarks(void) {
+  RUN_TEST(bench_query_builder_legacy_full_parse_equality);
+  RUN_TEST(bench_query_builder_filtered_equality);
+  RUN_TEST(bench_query_builder_indexed_equality);
+  RUN_TEST(bench_query_builder_numeric_range);
+  RUN_TEST(bench_query_builder_prefix);
+}
@@ -0,0 +1,142 @@
+#include "bench_utils.h"
+#include "core/gzip.h"
+#include "storage/collection_codec.h"
+
+using WebPlatform::Core::Gzip;
+
+namespace {
+
+const size_t RECORD_COUNT = 50;
+const int CODEC_ROUNDS = 50;
+
+// An api_tokens collection: records shaped like AuthApiToken::toJson()
+CollectionCodec::Records tokenCollection() {
+  CollectionCodec::Records records;
+  char key[16];
+  char json[320];
+  for (size_t i = 0; i < RECORD_COUNT; i++) {
+    snprintf(key, sizeof(key), "tok%04zu", i);
+    snprintf(json, sizeof(json),
+             "{\"id\":\"%s\",\"token\":\"tok_%032zu\",\"userId\":\"user%02zu\","
+             "\"username\":\"user%02zu\",\"name\":\"Token %zu\","
+             "\"createdAt\":%zu,\"expiresAt\":%zu}",
+             key, i, i % 5, i % 5, i, 1700000000 + i, 1800000000 + i);
+    records[key] = json;
+  }
+  return records;
+}
+
+// An OpenAPI document: many paths with near-identical operation objects
+std::string openApiSpec() {
+  std::string spec = "{\"openapi\":\"3.0.0\",\"info\":{\"title\":\"Bench\"},"
+                     "\"paths\":{";
+  char path[512];
+  for (size_t i = 0; i < 60; i++) {
+    snprintf(path, sizeof(path),
+             "%s\"/api/module%zu/item%zu\":{\"get\":{\"summary\":\"Get item "
+             "%zu\",\"tags\":[\"Module %zu\"],\"security\":[{\"bearerAuth\":"
+             "[]}],\"responses\":{\"200\":{\"description\":\"Success\","
+             "\"content\":{\"application/json\":{\"schema\":{\"type\":"
+             "\"object\"}}}},\"401\":{\"description\":\"Unauthorized\"}}}}",
+             i ? "," : "", i % 6, i, i, i % 6);
+    spec += path;
+  }
+  return spec + "}}";
+}
+
+} // namespace
+
+void bench_record_encoding_json(void) {
+  CollectionCodec::Records records = tokenCollection();
+  std::string blob;
+
+  Bench::Timer encodeTimer;
+  for (int round = 0; round < CODEC_ROUNDS; round++) {
+    blob.clear();
+    CollectionCodec::encodeJson(records, blob);
+  }
+  Bench::report("json encode collection x50", CODEC_ROUNDS,
+                encodeTimer.elapsedMicros());
+
+  CollectionCodec::Records decoded;
+  Bench::Timer decodeTimer;
+  for (int round = 0; round < CODEC_ROUNDS; round++) {
+    decoded.clear();
+    CollectionCodec::decodeJson(blob.c_str(), decoded);
+  }
+  Bench::report("json decode collection x50", CODEC_ROUNDS,
+                decodeTimer.elapsedMicros());
+
+  char line[96];
+  snprintf(line, sizeof(line), "json collection: %zu bytes in NVS",
+           blob.size());
+  TEST_MESSAGE(line);
+  TEST_ASSERT_EQUAL(RECORD_COUNT, decoded.size());
+}
+
+void bench_record_encoding_msgpack(void) {
+  CollectionCodec::Records records = tokenCollection();
+  std::string blob;
+
+  Bench::Timer encodeTimer;
+  for (int round = 0; round < CODEC_ROUNDS; round++) {
+    blob.clear();
+    CollectionCodec::encodeMsgPack(records, blob);
+  }
+  Bench::report("msgpack encode collection x50", CODEC_ROUNDS,
+                encodeTimer.elapsedMicros());
+
+  CollectionCodec::Records decoded;
+  const uint8_t *data = reinterpret_cast<const uint8_t *>(blob.data());
+  Bench::Timer decodeTimer;
+  for (int round = 0; round < CODEC_ROUNDS; round++) {
+    decoded.clear();
+    CollectionCodec::decodeMsgPack(data, blob.size(), decoded);
+  }
+  Bench::report("msgpack decode collection x50", CODEC_ROUNDS,
+                decodeTimer.elapsedMicros());
+
+  char line[96];
+  snprintf(line, sizeof(line), "msgpack collection: %zu bytes in NVS",
+           blob.size());
+  TEST_MESSAGE(line);
+  TEST_ASSERT_EQUAL(RECORD_COUNT, decoded.size());
+  TEST_ASSERT_EQUAL_STRING(records["tok0007"].c_str(),
+                           decoded["tok0007"].c_str());
+}
+
+void bench_record_encoding_gzip_spec(void) {
+  std::string spec = openApiSpec();
+  const uint8_t *data = reinterpret_cast<const uint8_t *>(spec.data());
+  std::string packed;
+
+  Bench::Timer compressTimer;
+  for (int round = 0; round < CODEC_ROUNDS; round++) {
+    packed.clear();
+    Gzip::compress(data, spec.size(), packed);
+  }
+  Bench::report("gzip compress spec x50", CODEC_ROUNDS,
+                compressTimer.elapsedMicros());
+
+  std::string inflated;
+  const uint8_t *stored = reinterpret_cast<const uint8_t *>(packed.data());
+  Bench::Timer inflateTimer;
+  for (int round = 0; round < CODEC_ROUNDS; round++) {
+    inflated.clear();
+    Gzip::decompress(stored, packed.size(), inflated);
+  }
+  Bench::report("gzip inflate spec x50", CODEC_ROUNDS,
+                inflateTimer.elapsedMicros());
+
+  char line[96];
+  snprintf(line, sizeof(line), "openapi spec: %zu bytes plain, %zu gzip",
+           spec.size(), packed.size());
+  TEST_MESSAGE(line);
+  TEST_ASSERT_TRUE(inflated == spec);
+}
+
+void register_record_encoding_benchmarks(void) {
+  RUN_TEST(bench_record_encoding_json);
+  RUN_TEST(bench_record_encoding_msgpack);
+  RUN_TEST(bench_record_encoding_gzip_spec);
+}
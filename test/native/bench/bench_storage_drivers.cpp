@@ -0,0 +1,128 @@
+#include "bench_utils.h"
+#include "storage/json_database_driver.h"
+#include "storage/littlefs_database_driver.h"
+#include "storage/log_database_driver.h"
+#include <LittleFS.h>
+#include <Preferences.h>
+
+namespace {
+
+// High-churn workload: a small set of session-like records, each rewritten
+// many times. Runs over the Preferences/LittleFS fakes, which have no flash
+// cost model (an append even copies the whole file), so read the timings
+// alongside the write/rename counts - on flash, each LittleFS rename and
+// file create is a metadata commit that an append to an open segment avoids.
+const size_t WRITE_COUNT = 2000;
+const size_t KEY_COUNT = 32;
+
+void churn(IDatabaseDriver &driver) {
+  char key[16];
+  char json[160];
+  for (size_t i = 0; i < WRITE_COUNT; i++) {
+    snprintf(key, sizeof(key), "sess%02zu", i % KEY_COUNT);
+    snprintf(json, sizeof(json),
+             "{\"id\":\"%s\",\"userId\":\"user%02zu\",\"lastSeen\":%zu,"
+             "\"ip\":\"192.168.1.%zu\",\"agent\":\"bench\"}",
+             key, i % 7, 1700000000 + i, i % 250);
+    TEST_ASSERT_TRUE(driver.store("sessions", key, json));
+  }
+}
+
+void reportWrites(const char *name, IDatabaseDriver &driver) {
+  size_t fsWritesBefore = NativeFsFake::writeCount();
+  size_t renamesBefore = NativeFsFake::renameCount();
+  size_t nvsWritesBefore = NativePreferencesFake::writeCount();
+
+  Bench::Timer timer;
+  churn(driver);
+  Bench::report(name, WRITE_COUNT, timer.elapsedMicros());
+
+  char line[160];
+  snprintf(line, sizeof(line),
+           "%s: %zu file writes, %zu renames, %zu NVS writes", name, NativeFsFake::writeCount() - fsWritesBefore,
+           NativeFsFake::renameCount() - renamesBefore,
+           NativePreferencesFake::writeCount() - nvsWritesBefore);
+  TEST_MESSAGE(line);
+  TEST_ASSERT_EQUAL(KEY_COUNT, driver.count("sessions"));
+}
+
+// Lookup workload: exists()/listKeys() over a few hundred records in one
+// collection. On flash each LittleFS lookup walks the directory, so the
+// number of filesystem calls matters more than the fake's timings.
+const size_t LOOKUP_KEY_COUNT = 300;
+const size_t LOOKUP_COUNT = 3000;
+
+void reportLookups(const char *name, LittleFSDatabaseDriver &driver) {
+  char key[16];
+  for (size_t i = 0; i < LOOKUP_KEY_COUNT; i++) {
+    snprintf(key, sizeof(key), "dev%03zu", i);
+    TEST_ASSERT_TRUE(driver.store("devices", key, "{}"));
+  }
+
+  // The first lookup loads the collection's key directory
+  size_t lookupsBefore = NativeFsFake::lookupCount();
+  driver.exists("devices", "dev000");
+  size_t warmupLookups = NativeFsFake::lookupCount() - lookupsBefore;
+
+  lookupsBefore = NativeFsFake::lookupCount();
+  Bench::Timer timer;
+  for (size_t i = 0; i < LOOKUP_COUNT; i++) {
+    // Every other key is missing
+    snprintf(key, sizeof(key), "dev%03zu", (i * 7) % (LOOKUP_KEY_COUNT * 2));
+    driver.exists("devices", key);
+  }
+  TEST_ASSERT_EQUAL(LOOKUP_KEY_COUNT, driver.listKeys("devices").size());
+  Bench::report(name, LOOKUP_COUNT + 1, timer.elapsedMicros());
+
+  char line[160];
+  snprintf(line, sizeof(line),
+           "%s: %zu filesystem lookups to warm up, %zu after, %zu entries "
+           "in the collection directory",
+           name, warmupLookups, NativeFsFake::lookupCount() - lookupsBefore,
+           NativeFsFake::immediateChildren("/bench_fs/devices").size());
+  TEST_MESSAGE(line);
+}
+
+} // namespace
+
+void bench_storage_json_driver_writes(void) {
+  JsonDatabaseDriver driver;
+  reportWrites("json driver churn writes", driver);
+}
+
+void bench_storage_littlefs_driver_writes(void) {
+  LittleFSDatabaseDriver driver("/bench_fs");
+  reportWrites("littlefs driver churn writes", driver);
+}
+
+void bench_storage_littlefs_driver_lookups(void) {
+  LittleFSDatabaseDriver driver("/bench_fs");
+  reportLookups("littlefs flat exists/listKeys", driver);
+}
+
+void bench_storage_littlefs_sharded_driver_lookups(void) {
+  LittleFSDatabaseDriver driver("/bench_fs");
+  driver.setShardingEnabled(true);
+  reportLookups("littlefs sharded exists/listKeys", driver);
+}
+
+void bench_storage_log_driver_writes(void) {
+  LogDatabaseDriver driver("/bench_log");
+  reportWrites("log driver churn writes", driver);
+
+  // Compaction cost is paid in maintain(), off the write path
+  Bench::Timer timer;
+  size_t compacted = driver.compact();
+  Bench::report("log driver compaction (segments)", compacted,
+                timer.elapsedMicros());
+  TEST_ASSERT_FALSE(driver.needsCompaction());
+  TEST_ASSERT_EQUAL(KEY_COUNT, driver.count("sessions"));
+}
+
+void register_storage_driver_benchmarks(void) {
+  RUN_TEST(bench_storage_json_driver_writes);
+  RUN_TEST(bench_storage_littlefs_driver_writes);
+  RUN_TEST(bench_storage_littlefs_driver_lookups);
+  RUN_TEST(bench_storage_littlefs_sharded_driver_lookups);
+  RUN_TEST(bench_storage_log_driver_writes);
+}
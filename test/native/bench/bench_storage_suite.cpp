@@ -0,0 +1,321 @@
+#include "bench_utils.h"
+#include "storage/async_database_driver.h"
+#include "storage/auth_storage.h"
+#include "storage/json_database_driver.h"
+#include "storage/log_database_driver.h"
+#include "storage/memory_database_driver.h"
+#include "storage/storage_manager.h"
+#include <ArduinoJson.h>
+#include <LittleFS.h>
+#include <Preferences.h>
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+// Parameterized storage suite: every workload below runs against every
+// driver StorageManager has registered (plus "log" and an async-wrapped
+// JSON driver) at 10, 100 and 1,000 records. Besides timing, each run
+// records heap allocations and the flash traffic seen by the FS and
+// Preferences fakes, which is the number that matters on device.
+//
+// Results are printed and also written as JSON to
+// $WEB_PLATFORM_BENCH_JSON (default bench_storage_suite.json in the
+// working directory) so two runs can be diffed.
+
+namespace {
+
+const size_t RECORD_COUNTS[] = {10, 100, 1000};
+const char COLLECTION[] = "bench";
+const size_t GROUP_COUNT = 10;
+const int SCAN_ROUNDS = 10;
+
+struct Result {
+  String driver;
+  String workload;
+  size_t records;
+  size_t ops;
+  double micros;
+  Bench::AllocationStats allocations;
+  size_t fileWrites;
+  size_t fileBytes;
+  size_t renames;
+  size_t nvsWrites;
+  size_t nvsBytes;
+};
+
+std::vector<Result> &results() {
+  static std::vector<Result> all;
+  return all;
+}
+
+// Drivers under test, registered fresh before each driver/size pair
+void registerDrivers() {
+  StorageManager::clearAllDrivers();
+  NativeFsFake::reset();
+  NativePreferencesFake::reset();
+
+  // Large enough that 1,000 records measure the driver, not eviction
+  StorageManager::configureDriver(
+      "memory",
+      std::unique_ptr<IDatabaseDriver>(new MemoryDatabaseDriver(4096, 1 << 20)));
+  StorageManager::configureDriver(
+      "log", std::unique_ptr<IDatabaseDriver>(new LogDatabaseDriver()));
+  StorageManager::configureDriver(
+      "async-json",
+      std::unique_ptr<IDatabaseDriver>(new AsyncDatabaseDriver(
+          std::unique_ptr<IDatabaseDriver>(new JsonDatabaseDriver()))));
+}
+
+String keyFor(size_t i) {
+  char key[16];
+  snprintf(key, sizeof(key), "k%05zu", i);
+  return String(key);
+}
+
+String recordFor(size_t i, size_t version) {
+  char json[96];
+  snprintf(json, sizeof(json), "{\"id\":%zu,\"group\":\"g%zu\",\"v\":%zu}", i,
+           i % GROUP_COUNT, version);
+  return String(json);
+}
+
+// Fixed-seed permutation so random runs are comparable between builds
+std::vector<size_t> shuffled(size_t count) {
+  std::vector<size_t> order(count);
+  for (size_t i = 0; i < count; i++) {
+    order[i] = i;
+  }
+  uint32_t state = 0x2545F491;
+  for (size_t i = count; i > 1; i--) {
+    state = state * 1664525 + 1013904223;
+    std::swap(order[i - 1], order[state % i]);
+  }
+  return order;
+}
+
+void populate(IDatabaseDriver &driver, size_t count) {
+  for (size_t i = 0; i < count; i++) {
+    driver.store(COLLECTION, keyFor(i), recordFor(i, 0));
+  }
+  driver.flush();
+}
+
+// Runs one workload and records its cost. setup runs unmeasured first.
+void measure(const String &driverName, const char *workload, size_t records,
+             const std::function<void(IDatabaseDriver &)> &setup,
+             const std::function<size_t(IDatabaseDriver &)> &work) {
+  IDatabaseDriver &driver = StorageManager::driver(driverName);
+  setup(driver);
+
+  Result result;
+  result.driver = driverName;
+  result.workload = workload;
+  result.records = records;
+
+  size_t fileWrites = NativeFsFake::writeCount();
+  size_t fileBytes = NativeFsFake::bytesWritten();
+  size_t renames = NativeFsFake::renameCount();
+  size_t nvsWrites = NativePreferencesFake::writeCount();
+  size_t nvsBytes = NativePreferencesFake::bytesWritten();
+  Bench::AllocationStats allocations = Bench::allocationStats();
+
+  Bench::Timer timer;
+  result.ops = work(driver);
+  driver.flush(); // Writes count once they reach storage
+  result.micros = timer.elapsedMicros();
+
+  Bench::AllocationStats after = Bench::allocationStats();
+  result.allocations.count = after.count - allocations.count;
+  result.allocations.bytes = after.bytes - allocations.bytes;
+  result.fileWrites = NativeFsFake::writeCount() - fileWrites;
+  result.fileBytes = NativeFsFake::bytesWritten() - fileBytes;
+  result.renames = NativeFsFake::renameCount() - renames;
+  result.nvsWrites = NativePreferencesFake::writeCount() - nvsWrites;
+  result.nvsBytes = NativePreferencesFake::bytesWritten() - nvsBytes;
+
+  char name[96];
+  snprintf(name, sizeof(name), "%s %s x%zu", driverName.c_str(), workload,
+           records);
+  Bench::report(name, result.ops, result.micros);
+  char line[192];
+  snprintf(line, sizeof(line),
+           "%s: %zu allocs (%zu bytes), %zu file writes (%zu bytes), "
+           "%zu renames, %zu NVS writes (%zu bytes)",
+           name, result.allocations.count, result.allocations.bytes,
+           result.fileWrites, result.fileBytes, result.renames,
+           result.nvsWrites, result.nvsBytes);
+  TEST_MESSAGE(line);
+
+  results().push_back(result);
+}
+
+void noSetup(IDatabaseDriver &) {}
+
+void runStorageWorkloads(const String &name, size_t count) {
+  auto populated = [count](IDatabaseDriver &driver) {
+    populate(driver, count);
+  };
+
+  measure(name, "put_sequential", count, noSetup,
+          [count](IDatabaseDriver &driver) {
+            for (size_t i = 0; i < count; i++) {
+              TEST_ASSERT_TRUE(
+                  driver.store(COLLECTION, keyFor(i), recordFor(i, 0)));
+            }
+            return count;
+          });
+
+  measure(name, "put_random", count, noSetup,
+          [count](IDatabaseDriver &driver) {
+            for (size_t i : shuffled(count)) {
+              TEST_ASSERT_TRUE(
+                  driver.store(COLLECTION, keyFor(i), recordFor(i, 1)));
+            }
+            return count;
+          });
+
+  measure(name, "get_sequential", count, populated,
+          [count](IDatabaseDriver &driver) {
+            for (size_t i = 0; i < count; i++) {
+              TEST_ASSERT_TRUE(driver.retrieve(COLLECTION, keyFor(i)).length() >
+                               0);
+            }
+            return count;
+          });
+
+  measure(name, "get_random", count, populated,
+          [count](IDatabaseDriver &driver) {
+            for (size_t i : shuffled(count)) {
+              TEST_ASSERT_TRUE(driver.retrieve(COLLECTION, keyFor(i)).length() >
+                               0);
+            }
+            return count;
+          });
+
+  measure(name, "list_keys", count, populated,
+          [count](IDatabaseDriver &driver) {
+            for (int round = 0; round < SCAN_ROUNDS; round++) {
+              TEST_ASSERT_EQUAL(count, driver.listKeys(COLLECTION).size());
+            }
+            return static_cast<size_t>(SCAN_ROUNDS);
+          });
+
+  measure(name, "query_scan", count, populated,
+          [count](IDatabaseDriver &driver) {
+            for (int round = 0; round < SCAN_ROUNDS; round++) {
+              size_t matches = QueryBuilder(&driver, COLLECTION)
+                                   .where("group", "g3")
+                                   .getAll()
+                                   .size();
+              TEST_ASSERT_EQUAL((count + GROUP_COUNT - 4) / GROUP_COUNT,
+                                matches);
+            }
+            return static_cast<size_t>(SCAN_ROUNDS);
+          });
+
+  // A tenth of the key space, like "the last hour" of time-keyed readings
+  measure(name, "range_scan", count, populated,
+          [count](IDatabaseDriver &driver) {
+            size_t from = count / 2;
+            size_t to = from + (count + 9) / 10;
+            for (int round = 0; round < SCAN_ROUNDS; round++) {
+              size_t visited = driver.scanRange(
+                  COLLECTION, keyFor(from), keyFor(to),
+                  [](const String &, const String &) { return true; });
+              TEST_ASSERT_EQUAL(to - from, visited);
+            }
+            return static_cast<size_t>(SCAN_ROUNDS);
+          });
+}
+
+// Sign-up, login and session checks through AuthStorage on the driver
+void runAuthWorkload(const String &name, size_t count) {
+  StorageManager::setDefaultDriver(name);
+  // AuthStorage declares these once, against the default driver at the
+  // time - repeat them so every driver gets the same indexes
+  StorageManager::declareIndex("users", "username", name);
+  StorageManager::declareIndex("sessions", "userId", name);
+  AuthStorage::initialize();
+
+  measure(name, "auth_flow", count, noSetup,
+          [count](IDatabaseDriver &) {
+            char username[16];
+            for (size_t i = 0; i < count; i++) {
+              snprintf(username, sizeof(username), "user%04zu", i);
+              String userId = AuthStorage::createUser(username, "secret");
+              TEST_ASSERT_TRUE(userId.length() > 0);
+              TEST_ASSERT_EQUAL_STRING(
+                  userId.c_str(),
+                  AuthStorage::validateCredentials(username, "secret").c_str());
+              String sessionId = AuthStorage::createSession(userId);
+              TEST_ASSERT_EQUAL_STRING(
+                  userId.c_str(),
+                  AuthStorage::validateSession(sessionId).c_str());
+            }
+            return count * 4;
+          });
+}
+
+void writeJsonReport() {
+  JsonDocument doc;
+  doc["suite"] = "storage";
+  JsonArray entries = doc["results"].to<JsonArray>();
+  for (const Result &result : results()) {
+    JsonObject entry = entries.add<JsonObject>();
+    entry["driver"] = result.driver;
+    entry["workload"] = result.workload;
+    entry["records"] = result.records;
+    entry["ops"] = result.ops;
+    entry["micros"] = result.micros;
+    entry["opsPerSecond"] =
+        result.micros > 0 ? result.ops * 1e6 / result.micros : 0;
+    entry["allocations"] = result.allocations.count;
+    entry["allocatedBytes"] = result.allocations.bytes;
+    entry["fileWrites"] = result.fileWrites;
+    entry["fileBytesWritten"] = result.fileBytes;
+    entry["renames"] = result.renames;
+    entry["nvsWrites"] = result.nvsWrites;
+    entry["nvsBytesWritten"] = result.nvsBytes;
+  }
+
+  std::string json;
+  serializeJsonPretty(doc, json);
+
+  const char *path = getenv("WEB_PLATFORM_BENCH_JSON");
+  if (!path || !*path) {
+    path = "bench_storage_suite.json";
+  }
+  FILE *out = fopen(path, "w");
+  TEST_ASSERT_NOT_NULL(out);
+  fwrite(json.data(), 1, json.size(), out);
+  fclose(out);
+
+  char line[160];
+  snprintf(line, sizeof(line), "storage suite: %zu results written to %s",
+           results().size(), path);
+  TEST_MESSAGE(line);
+}
+
+} // namespace
+
+void bench_storage_suite_all_drivers(void) {
+  results().clear();
+
+  registerDrivers();
+  std::vector<String> names = StorageManager::getDriverNames();
+  for (const String &name : names) {
+    for (size_t count : RECORD_COUNTS) {
+      registerDrivers();
+      runStorageWorkloads(name, count);
+      registerDrivers();
+      runAuthWorkload(name, count);
+    }
+  }
+  StorageManager::clearAllDrivers();
+
+  writeJsonReport();
+}
+
+void register_storage_suite_benchmarks(void) {
+  RUN_TEST(bench_storage_suite_all_drivers);
+}
@@ -0,0 +1,52 @@
+#ifndef BENCH_UTILS_H
+#define BENCH_UTILS_H
+
+// Shared helpers for the native benchmarks under test/native/bench/. Only
+// built by the bench_native environment (-DWEB_PLATFORM_BENCHMARKS, -O2,
+// no coverage) - run with `pio test -e bench_native`. Timings are printed
+// through Unity's TEST_MESSAGE so they show up in the normal test log;
+// benchmarks only assert on correctness, never on speed.
+
+#include <chrono>
+#include <cstdio>
+#include <unity.h>
+
+namespace Bench {
+
+class Timer {
+public:
+  Timer() : start_(std::chrono::steady_clock::now()) {}
+
+  double elapsedMicros() const {
+    return std::chrono::duration<double, std::micro>(
+               std::chrono::steady_clock::now() - start_)
+        .count();
+  }
+
+private:
+  std::chrono::steady_clock::time_point start_;
+};
+
+// Prints "<name>: <ops> ops in <ms> ms (<us>/op, <ops/s> ops/s)"
+inline void report(const char *name, size_t ops, double micros) {
+  char line[192];
+  double perOp = ops > 0 ? micros / ops : 0;
+  double perSecond = micros > 0 ? ops * 1e6 / micros : 0;
+  snprintf(line, sizeof(line),
+           "%s: %zu ops in %.2f ms (%.2f us/op, %.0f ops/s)", name, ops,
+           micros / 1000.0, perOp, perSecond);
+  TEST_MESSAGE(line);
+}
+
+// Heap allocations made by the process so far (bench_alloc_counter.cpp).
+// Diff two snapshots to get what a workload allocated. Counts requested
+// bytes, including realloc() growth, not live heap.
+struct AllocationStats {
+  size_t count;
+  size_t bytes;
+};
+AllocationStats allocationStats();
+
+} // namespace Bench
+
+#endif // BENCH_UTILS_H
@@ -2,7 +2,8 @@
 #define NATIVE_FAKE_FS_H
 
 // Minimal native-only fake of Arduino's FS.h File class, scoped to exactly
-// what src/storage/littlefs_database_driver.cpp uses. Backed by
+// what src/storage/littlefs_database_driver.cpp and
+// src/storage/log_database_driver.cpp use. Backed by
 // LittleFS.h's in-memory filesystem (see native_fs_fake.cpp) - not a
 // general-purpose File reimplementation.
 
@@ -12,6 +13,7 @@
 
 #define FILE_READ "r"
 #define FILE_WRITE "w"
+#define FILE_APPEND "a"
 
 class File {
 public:
@@ -23,8 +25,20 @@ public:
     if (!valid_ || isDir_) {
       return 0;
     }
-    content_ = std::string(data.c_str());
-    return content_.size();
+    // Appends like the real File - a write handle starts empty, so
+    // successive print() calls build up the file body.
+    std::string chunk(data.c_str());
+    content_ += chunk;
+    return chunk.size();
+  }
+
+  // Binary-safe counterpart of print() - gzip records contain NUL bytes
+  size_t write(const uint8_t *buffer, size_t length) {
+    if (!valid_ || isDir_) {
+      return 0;
+    }
+    content_.append(reinterpret_cast<const char *>(buffer), length);
+    return length;
   }
 
   void close();
@@ -51,6 +65,17 @@ public:
     return toCopy;
   }
 
+  // Read position, like the real File - only meaningful for reads here
+  bool seek(size_t pos) {
+    if (!valid_ || pos > content_.size()) {
+      return false;
+    }
+    pos_ = pos;
+    return true;
+  }
+
+  size_t position() const { return pos_; }
+
   bool isDirectory() const { return isDir_; }
 
   // Real ESP32 File::name() returns the basename, not the full path -
@@ -76,6 +101,7 @@ private:
   bool forWrite_ = false;
   std::string path_;
   std::string content_;
+  size_t baseSize_ = 0; // Content the handle was opened with
   size_t pos_ = 0;
   std::vector<std::string> children_;
   size_t childIndex_ = 0;
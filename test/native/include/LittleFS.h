@@ -2,8 +2,8 @@
 #define NATIVE_FAKE_LITTLEFS_H
 
 // Minimal native-only fake of ESP32's LittleFS API, scoped to exactly what
-// src/storage/littlefs_database_driver.cpp uses: begin/end, exists/mkdir/
-// rmdir/remove, and open() returning a File (see FS.h). Backed by a
+// the storage drivers use: begin/end, exists/mkdir/
+// rmdir/remove/rename, and open() returning a File (see FS.h). Backed by a
 // process-wide in-memory map of path -> content plus a set of directory
 // paths - not a general-purpose filesystem. Call NativeFsFake::reset()
 // between tests that need a clean slate.
@@ -21,10 +21,20 @@ bool isDirectory(const std::string &path);
 bool makeDirectory(const std::string &path);
 bool removeDirectory(const std::string &path);
 bool removeFile(const std::string &path);
+bool renameFile(const std::string &from, const std::string &to);
 std::string readFile(const std::string &path);
 std::vector<std::string> immediateChildren(const std::string &dirPath);
 size_t totalBytes();
 size_t usedBytes();
+// Files written through File::close() since the last reset()
+size_t writeCount();
+// Bytes those writes added (an append counts only what it appended)
+size_t bytesWritten();
+// Successful renameFile() calls since the last reset()
+size_t renameCount();
+// LittleFS.exists()/open() calls since the last reset()
+size_t lookupCount();
+void recordLookup();
 } // namespace NativeFsFake
 
 class LittleFSClass {
@@ -40,6 +50,7 @@ public:
   size_t usedBytes() { return NativeFsFake::usedBytes(); }
 
   bool exists(const String &path) {
+    NativeFsFake::recordLookup();
     return NativeFsFake::pathExists(path.c_str());
   }
 
@@ -55,6 +66,11 @@ public:
     return NativeFsFake::removeFile(path.c_str());
   }
 
+  // Like real LittleFS, renaming onto an existing file replaces it.
+  bool rename(const String &from, const String &to) {
+    return NativeFsFake::renameFile(from.c_str(), to.c_str());
+  }
+
   File open(const String &path, const char *mode = FILE_READ);
 };
 
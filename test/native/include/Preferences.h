@@ -2,11 +2,12 @@
 #define NATIVE_FAKE_PREFERENCES_H
 
 // Minimal native-only fake of ESP32's Preferences (NVS) API, scoped to
-// exactly what src/storage/json_database_driver.cpp uses: begin/end and
-// get/putString. Backed by a process-wide in-memory map so state persists
+// exactly what src/storage/json_database_driver.cpp uses: begin/end,
+// get/putString, get/putBytes, isKey and remove. Backed by a process-wide in-memory map so state persists
 // across separate `Preferences prefs;` instances within one test run, the
 // same way real NVS persists across separate begin()/end() sessions on
-// device. Call NativePreferencesFake::reset() between tests that need a
+// device. Like NVS, a key holds either a string or a blob - reading it as
+// the other type finds nothing. Call NativePreferencesFake::reset() between tests that need a
 // clean slate - nothing resets it automatically.
 //
 // Only exists so json_database_driver.cpp can compile and run natively;
@@ -14,11 +15,19 @@
 
 #include <Arduino.h>
 #include <map>
+#include <set>
 #include <string>
 
 namespace NativePreferencesFake {
 std::map<std::string, std::map<std::string, std::string>> &store();
+// "namespace/key" of entries written with putBytes()
+std::set<std::string> &blobKeys();
 void reset();
+// putString()/putBytes() calls since the last reset() - each is one NVS
+// write on device
+size_t &writeCount();
+// Bytes passed to those writes
+size_t &bytesWritten();
 } // namespace NativePreferencesFake
 
 class Preferences {
@@ -42,7 +51,8 @@ public:
     }
     auto &ns = NativePreferencesFake::store()[ns_];
     auto it = ns.find(key);
-    return it == ns.end() ? String(defaultValue) : String(it->second.c_str());
+    return it == ns.end() || isBlob(key) ? String(defaultValue)
+                                         : String(it->second.c_str());
   }
 
   size_t putString(const char *key, const String &value) {
@@ -50,8 +60,59 @@ public:
       return 0;
     }
     NativePreferencesFake::store()[ns_][key] = value.c_str();
+    NativePreferencesFake::blobKeys().erase(blobId(key));
+    NativePreferencesFake::writeCount()++;
+    NativePreferencesFake::bytesWritten() += value.length();
     return value.length();
   }
+
+  size_t getBytesLength(const char *key) {
+    if (!open_ || !key || !isBlob(key)) {
+      return 0;
+    }
+    return NativePreferencesFake::store()[ns_][key].size();
+  }
+
+  size_t getBytes(const char *key, void *buffer, size_t maxLength) {
+    size_t length = getBytesLength(key);
+    if (length == 0 || length > maxLength) {
+      return 0;
+    }
+    NativePreferencesFake::store()[ns_][key].copy(static_cast<char *>(buffer),
+                                                  length);
+    return length;
+  }
+
+  size_t putBytes(const char *key, const void *value, size_t length) {
+    if (!open_ || !key) {
+      return 0;
+    }
+    NativePreferencesFake::store()[ns_][key] =
+        std::string(static_cast<const char *>(value), length);
+    NativePreferencesFake::blobKeys().insert(blobId(key));
+    NativePreferencesFake::writeCount()++;
+    NativePreferencesFake::bytesWritten() += length;
+    return length;
+  }
+
+  bool isKey(const char *key) {
+    return open_ && key && NativePreferencesFake::store()[ns_].count(key) > 0;
+  }
+
+  bool remove(const char *key) {
+    if (!open_ || !key) {
+      return false;
+    }
+    NativePreferencesFake::blobKeys().erase(blobId(key));
+    return NativePreferencesFake::store()[ns_].erase(key) > 0;
+  }
+
+private:
+  std::string blobId(const char *key) const { return ns_ + "/" + key; }
+
+  bool isBlob(const char *key) const {
+    return NativePreferencesFake::blobKeys().count(blobId(key)) > 0;
+  }
 };
 
 #endif // NATIVE_FAKE_PREFERENCES_H
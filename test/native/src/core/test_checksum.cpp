@@ -0,0 +1,54 @@
+#include "core/checksum.h"
+#include <unity.h>
+
+using namespace WebPlatform::Core;
+
+void test_crc32_empty_input_is_zero() {
+  TEST_ASSERT_EQUAL_HEX32(0x00000000, Checksum::crc32(""));
+}
+
+void test_crc32_known_check_value() {
+  // Standard CRC-32 check value for the ASCII string "123456789"
+  TEST_ASSERT_EQUAL_HEX32(0xCBF43926, Checksum::crc32("123456789"));
+}
+
+void test_crc32_incremental_matches_one_shot() {
+  const std::string a = "{\"username\":";
+  const std::string b = "\"alice\"}";
+  uint32_t running = Checksum::crc32(
+      reinterpret_cast<const uint8_t *>(a.data()), a.size());
+  running = Checksum::crc32(reinterpret_cast<const uint8_t *>(b.data()),
+                            b.size(), running);
+  TEST_ASSERT_EQUAL_HEX32(Checksum::crc32(a + b), running);
+}
+
+void test_crc32_detects_single_bit_flip() {
+  TEST_ASSERT_TRUE(Checksum::crc32("{\"v\":1}") !=
+                   Checksum::crc32("{\"v\":3}"));
+}
+
+void test_checksum_hex_roundtrip() {
+  std::string hex = Checksum::toHex(0x0A1B2C3D);
+  TEST_ASSERT_EQUAL_STRING("0a1b2c3d", hex.c_str());
+
+  uint32_t parsed = 0;
+  TEST_ASSERT_TRUE(Checksum::fromHex(hex.c_str(), parsed));
+  TEST_ASSERT_EQUAL_HEX32(0x0A1B2C3D, parsed);
+}
+
+void test_checksum_from_hex_rejects_non_hex() {
+  uint32_t parsed = 42;
+  TEST_ASSERT_FALSE(Checksum::fromHex("0a1b2c3z", parsed));
+  TEST_ASSERT_FALSE(Checksum::fromHex("0a1b", parsed));
+  TEST_ASSERT_FALSE(Checksum::fromHex(nullptr, parsed));
+  TEST_ASSERT_EQUAL(42, parsed);
+}
+
+void runChecksumTests() {
+  RUN_TEST(test_crc32_empty_input_is_zero);
+  RUN_TEST(test_crc32_known_check_value);
+  RUN_TEST(test_crc32_incremental_matches_one_shot);
+  RUN_TEST(test_crc32_detects_single_bit_flip);
+  RUN_TEST(test_checksum_hex_roundtrip);
+  RUN_TEST(test_checksum_from_hex_rejects_non_hex);
+}
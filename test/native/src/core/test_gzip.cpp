@@ -0,0 +1,132 @@
+#include "core/checksum.h"
+#include "core/gzip.h"
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <unity.h>
+
+using namespace WebPlatform::Core;
+
+namespace {
+// gzip -9 of makeRecords() - a dynamic-Huffman block, which Gzip::compress
+// never emits itself
+const uint8_t DYNAMIC_GZIP[] = {
+    0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0x6d, 0x92,
+    0x3d, 0x0a, 0xc2, 0x60, 0x10, 0x44, 0xef, 0xf2, 0xd5, 0x16, 0xd9, 0x9d,
+    0xfc, 0x5f, 0x45, 0x2c, 0x04, 0x15, 0x02, 0x21, 0x01, 0x13, 0x2b, 0xf1,
+    0xee, 0x16, 0xc1, 0x42, 0xde, 0xb4, 0xc3, 0x3c, 0x98, 0xd9, 0x9d, 0xf3,
+    0xbb, 0x4c, 0xb7, 0x32, 0x56, 0xa7, 0xb2, 0x2e, 0x65, 0x7c, 0x5c, 0xe7,
+    0xed, 0xfe, 0x39, 0xa4, 0x38, 0xa4, 0xfd, 0xf9, 0xfa, 0x29, 0x09, 0x45,
+    0xc4, 0x6a, 0x98, 0x1a, 0x28, 0x2d, 0xb1, 0x0e, 0xa6, 0x1e, 0xca, 0x60,
+    0x42, 0x56, 0x70, 0x05, 0x83, 0x47, 0x1a, 0x52, 0xb4, 0x31, 0x7b, 0x34,
+    0x86, 0x6c, 0x69, 0x63, 0xfc, 0xe8, 0x0d, 0x39, 0xf0, 0xa6, 0x2c, 0x90,
+    0x41, 0x32, 0x79, 0xfb, 0x64, 0x81, 0xac, 0x0d, 0xc9, 0xf3, 0x27, 0x0b,
+    0x64, 0x67, 0x48, 0x7e, 0x20, 0x59, 0x40, 0x66, 0x3a, 0xe2, 0x0b, 0x64,
+    0xc6, 0x63, 0xd6, 0x23, 0xbe, 0x40, 0x2c, 0x20, 0x33, 0x20, 0xf1, 0x05,
+    0x62, 0x01, 0xfd, 0x6d, 0xe8, 0xf2, 0x05, 0x82, 0x30, 0xd8, 0xa2, 0xfe,
+    0x02, 0x00, 0x00};
+
+std::string makeRecords() {
+  std::string records = "[";
+  char record[32];
+  for (int i = 0; i < 40; i++) {
+    snprintf(record, sizeof(record), "{\"id\":%d,\"on\":%s}", i,
+             i % 3 ? "true" : "false");
+    records += record;
+  }
+  return records + "]";
+}
+
+const uint8_t *bytes(const std::string &data) {
+  return reinterpret_cast<const uint8_t *>(data.data());
+}
+} // namespace
+
+void test_gzip_roundtrip_compresses_json() {
+  std::string json = makeRecords();
+  std::string packed;
+  TEST_ASSERT_TRUE(Gzip::compress(bytes(json), json.size(), packed));
+  TEST_ASSERT_TRUE(Gzip::isGzip(bytes(packed), packed.size()));
+  TEST_ASSERT_TRUE(packed.size() < json.size() / 2);
+
+  std::string unpacked;
+  TEST_ASSERT_TRUE(Gzip::decompress(bytes(packed), packed.size(), unpacked));
+  TEST_ASSERT_EQUAL_STRING(json.c_str(), unpacked.c_str());
+  const uint8_t *trailer =
+      bytes(packed) + packed.size() - Gzip::TRAILER_SIZE;
+  TEST_ASSERT_EQUAL(json.size(), Gzip::storedSize(trailer));
+}
+
+void test_gzip_decodes_dynamic_huffman_from_gzip_tool() {
+  std::string unpacked;
+  TEST_ASSERT_TRUE(
+      Gzip::decompress(DYNAMIC_GZIP, sizeof(DYNAMIC_GZIP), unpacked));
+  TEST_ASSERT_EQUAL_STRING(makeRecords().c_str(), unpacked.c_str());
+}
+
+void test_gzip_incompressible_input_falls_back_to_stored() {
+  std::string noise;
+  uint32_t state = 12345;
+  for (int i = 0; i < 2000; i++) {
+    state = state * 1103515245u + 12345u;
+    noise.push_back(static_cast<char>(state >> 24));
+  }
+
+  std::string packed;
+  TEST_ASSERT_TRUE(Gzip::compress(bytes(noise), noise.size(), packed));
+  TEST_ASSERT_TRUE(packed.size() <= noise.size() + Gzip::HEADER_SIZE +
+                                        Gzip::TRAILER_SIZE + 5);
+
+  std::string unpacked;
+  TEST_ASSERT_TRUE(Gzip::decompress(bytes(packed), packed.size(), unpacked));
+  TEST_ASSERT_TRUE(unpacked == noise);
+}
+
+void test_gzip_pulls_input_in_small_reads() {
+  std::string json = makeRecords();
+  std::string packed;
+  Gzip::compress(bytes(json), json.size(), packed);
+
+  size_t pos = 0;
+  size_t reads = 0;
+  Gzip::Source source = [&](uint8_t *buffer, size_t capacity) {
+    size_t count = std::min<size_t>(7, std::min(capacity, packed.size() - pos));
+    memcpy(buffer, packed.data() + pos, count);
+    pos += count;
+    reads++;
+    return count;
+  };
+
+  std::string unpacked = "prefix:";
+  TEST_ASSERT_TRUE(Gzip::decompress(source, unpacked));
+  TEST_ASSERT_EQUAL_STRING(("prefix:" + json).c_str(), unpacked.c_str());
+  TEST_ASSERT_TRUE(reads > 1);
+}
+
+void test_gzip_rejects_corrupt_or_truncated_streams() {
+  std::string json = makeRecords();
+  std::string packed;
+  Gzip::compress(bytes(json), json.size(), packed);
+
+  std::string out = "kept";
+  std::string truncated = packed.substr(0, packed.size() - 3);
+  TEST_ASSERT_FALSE(
+      Gzip::decompress(bytes(truncated), truncated.size(), out));
+  TEST_ASSERT_EQUAL_STRING("kept", out.c_str());
+
+  std::string flipped = packed;
+  flipped[packed.size() - Gzip::TRAILER_SIZE - 4] ^= 0x10;
+  TEST_ASSERT_FALSE(Gzip::decompress(bytes(flipped), flipped.size(), out));
+
+  TEST_ASSERT_FALSE(Gzip::decompress(bytes(json), json.size(), out));
+  TEST_ASSERT_FALSE(Gzip::isGzip(bytes(json), json.size()));
+  TEST_ASSERT_EQUAL_STRING("kept", out.c_str());
+}
+
+void runGzipTests() {
+  RUN_TEST(test_gzip_roundtrip_compresses_json);
+  RUN_TEST(test_gzip_decodes_dynamic_huffman_from_gzip_tool);
+  RUN_TEST(test_gzip_incompressible_input_falls_back_to_stored);
+  RUN_TEST(test_gzip_pulls_input_in_small_reads);
+  RUN_TEST(test_gzip_rejects_corrupt_or_truncated_streams);
+}
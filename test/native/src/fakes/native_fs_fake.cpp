@@ -17,13 +17,43 @@ std::set<std::string> &dirs() {
   static std::set<std::string> d;
   return d;
 }
+size_t &writes() {
+  static size_t w = 0;
+  return w;
+}
+size_t &writtenBytes() {
+  static size_t b = 0;
+  return b;
+}
+size_t &renames() {
+  static size_t r = 0;
+  return r;
+}
+size_t &lookups() {
+  static size_t l = 0;
+  return l;
+}
 } // namespace
 
 void reset() {
   files().clear();
   dirs().clear();
+  writes() = 0;
+  writtenBytes() = 0;
+  renames() = 0;
+  lookups() = 0;
 }
 
+size_t writeCount() { return writes(); }
+
+size_t bytesWritten() { return writtenBytes(); }
+
+size_t renameCount() { return renames(); }
+
+size_t lookupCount() { return lookups(); }
+
+void recordLookup() { lookups()++; }
+
 void writeFile(const std::string &path, const std::string &content) {
   files()[path] = content;
 }
@@ -45,6 +75,18 @@ bool removeDirectory(const std::string &path) {
 
 bool removeFile(const std::string &path) { return files().erase(path) > 0; }
 
+bool renameFile(const std::string &from, const std::string &to) {
+  auto it = files().find(from);
+  if (it == files().end()) {
+    return false;
+  }
+  std::string content = std::move(it->second);
+  files().erase(it);
+  files()[to] = std::move(content);
+  renames()++;
+  return true;
+}
+
 std::string readFile(const std::string &path) {
   auto it = files().find(path);
   return it == files().end() ? std::string() : it->second;
@@ -85,6 +127,10 @@ size_t usedBytes() {
 void File::close() {
   if (valid_ && forWrite_ && !isDir_) {
     NativeFsFake::writeFile(path_, content_);
+    NativeFsFake::writes()++;
+    if (content_.size() > baseSize_) {
+      NativeFsFake::writtenBytes() += content_.size() - baseSize_;
+    }
   }
   valid_ = false;
 }
@@ -109,6 +155,7 @@ File File::makeFile(const std::string &path, const std::string &content,
   f.forWrite_ = forWrite;
   f.path_ = path;
   f.content_ = content;
+  f.baseSize_ = content.size();
   return f;
 }
 
@@ -124,10 +171,15 @@ File File::makeDirectory(const std::string &path,
 
 File LittleFSClass::open(const String &path, const char *mode) {
   std::string p(path.c_str());
+  NativeFsFake::recordLookup();
 
   if (mode && std::strcmp(mode, FILE_WRITE) == 0) {
     return File::makeFile(p, "", true);
   }
+  if (mode && std::strcmp(mode, FILE_APPEND) == 0) {
+    // print() appends to the existing body; close() writes it all back
+    return File::makeFile(p, NativeFsFake::readFile(p), true);
+  }
 
   if (NativeFsFake::isDirectory(p)) {
     return File::makeDirectory(p, NativeFsFake::immediateChildren(p));
@@ -7,6 +7,26 @@ std::map<std::string, std::map<std::string, std::string>> &store() {
   return s;
 }
 
-void reset() { store().clear(); }
+std::set<std::string> &blobKeys() {
+  static std::set<std::string> keys;
+  return keys;
+}
+
+size_t &writeCount() {
+  static size_t count = 0;
+  return count;
+}
+
+size_t &bytesWritten() {
+  static size_t bytes = 0;
+  return bytes;
+}
+
+void reset() {
+  store().clear();
+  blobKeys().clear();
+  writeCount() = 0;
+  bytesWritten() = 0;
+}
 
 } // namespace NativePreferencesFake
@@ -0,0 +1,88 @@
+#include "../../../../assets/asset_bundle_data.h"
+#include "platform/asset_bundle.h"
+#include "platform/http_negotiation.h"
+#include <cstring>
+#include <unity.h>
+
+namespace {
+const char DATA[] = "a\0bb\0ccc";
+const AssetBundleEntry INDEX[] = {
+    {"/assets/a.css", "text/css", 0, 1, 0, 0, "000000000001"},
+    {"/assets/b.js", "application/javascript", 2, 2, 0, 0, "000000000002"},
+    {"/assets/c.svg", "image/svg+xml", 5, 3, 0, 0, "000000000003"},
+};
+const AssetBundle BUNDLE = {DATA, INDEX, 3};
+} // namespace
+
+void test_asset_bundle_finds_every_entry(void) {
+  for (const AssetBundleEntry &entry : INDEX) {
+    TEST_ASSERT_EQUAL_PTR(&entry, AssetBundles::find(BUNDLE, entry.path));
+  }
+  TEST_ASSERT_EQUAL_STRING(
+      "bb", AssetBundles::embeddedAsset(BUNDLE, INDEX[1]).text);
+  TEST_ASSERT_NULL(AssetBundles::embeddedAsset(BUNDLE, INDEX[1]).gzip);
+}
+
+void test_asset_bundle_misses_unknown_paths(void) {
+  TEST_ASSERT_NULL(AssetBundles::find(BUNDLE, "/assets/"));
+  TEST_ASSERT_NULL(AssetBundles::find(BUNDLE, "/assets/b"));
+  TEST_ASSERT_NULL(AssetBundles::find(BUNDLE, "/assets/bb.js"));
+  TEST_ASSERT_NULL(AssetBundles::find(BUNDLE, "/assets/d.css"));
+  TEST_ASSERT_NULL(AssetBundles::find(BUNDLE, ""));
+
+  AssetBundle empty = {DATA, INDEX, 0};
+  TEST_ASSERT_NULL(AssetBundles::find(empty, "/assets/a.css"));
+}
+
+// The checked-in bundle: sorted, and every slice where the index says
+void test_generated_asset_bundle_is_consistent(void) {
+  TEST_ASSERT_TRUE(ASSET_BUNDLE.count > 0);
+  for (size_t i = 0; i < ASSET_BUNDLE.count; i++) {
+    const AssetBundleEntry &entry = ASSET_BUNDLE.index[i];
+    if (i > 0) {
+      TEST_ASSERT_TRUE(strcmp(ASSET_BUNDLE.index[i - 1].path, entry.path) < 0);
+    }
+    TEST_ASSERT_EQUAL_PTR(&entry, AssetBundles::find(ASSET_BUNDLE, entry.path));
+    TEST_ASSERT_EQUAL(EMBEDDED_ASSET_HASH_LENGTH, strlen(entry.hash));
+
+    TEST_ASSERT_TRUE(entry.offset + entry.length < sizeof(ASSET_BUNDLE_DATA));
+    EmbeddedAsset asset = AssetBundles::embeddedAsset(ASSET_BUNDLE, entry);
+    TEST_ASSERT_EQUAL(entry.length, strlen(asset.text));
+    if (entry.gzipLength > 0) {
+      TEST_ASSERT_TRUE(entry.gzipOffset + entry.gzipLength <=
+                       sizeof(ASSET_BUNDLE_DATA));
+      TEST_ASSERT_EQUAL(0x1f, asset.gzip[0]);
+      TEST_ASSERT_EQUAL(0x8b, asset.gzip[1]);
+    }
+  }
+  TEST_ASSERT_NOT_NULL(AssetBundles::find(ASSET_BUNDLE, "/assets/style.css"));
+}
+
+// A bundled page is served with the same Content-Type whichever encoding
+// goes out, so only the encoding keeps the gzip copy out of the template
+// engine
+void test_bundled_html_asset_is_templated_only_uncompressed(void) {
+  const char data[] = "<p>{{csrfToken}}</p>\0\x1f\x8b\x08\x00";
+  const AssetBundleEntry index[] = {
+      {"/assets/page.html", "text/html", 0, 20, 21, 4, "000000000004"},
+  };
+  const AssetBundle bundle = {data, index, 1};
+
+  const AssetBundleEntry *entry =
+      AssetBundles::find(bundle, "/assets/page.html");
+  TEST_ASSERT_NOT_NULL(entry);
+  EmbeddedAsset asset = AssetBundles::embeddedAsset(bundle, *entry);
+  TEST_ASSERT_EQUAL_STRING("<p>{{csrfToken}}</p>", asset.text);
+  TEST_ASSERT_NOT_NULL(asset.gzip);
+  TEST_ASSERT_EQUAL(0x1f, asset.gzip[0]);
+
+  TEST_ASSERT_TRUE(HttpNegotiation::isTemplatable(entry->mimeType, ""));
+  TEST_ASSERT_FALSE(HttpNegotiation::isTemplatable(entry->mimeType, "gzip"));
+}
+
+void register_asset_bundle_tests(void) {
+  RUN_TEST(test_asset_bundle_finds_every_entry);
+  RUN_TEST(test_asset_bundle_misses_unknown_paths);
+  RUN_TEST(test_generated_asset_bundle_is_consistent);
+  RUN_TEST(test_bundled_html_asset_is_templated_only_uncompressed);
+}
@@ -0,0 +1,52 @@
+#include "platform/asset_fingerprint.h"
+#include <unity.h>
+
+using namespace AssetFingerprint;
+
+void test_fingerprint_inserts_hash_before_extension(void) {
+  TEST_ASSERT_EQUAL_STRING("/assets/style.3f9c2a1b7d4e.css",
+                           fingerprint("/assets/style.css", "3f9c2a1b7d4e")
+                               .c_str());
+  TEST_ASSERT_EQUAL_STRING(
+      "/assets/web-platform-utils.0123456789ab.js",
+      fingerprint("/assets/web-platform-utils.js", "0123456789ab").c_str());
+  TEST_ASSERT_EQUAL_STRING("/assets/LICENSE.0123456789ab",
+                           fingerprint("/assets/LICENSE", "0123456789ab")
+                               .c_str());
+  TEST_ASSERT_EQUAL_STRING("/v1.2/robots.0123456789ab",
+                           fingerprint("/v1.2/robots", "0123456789ab").c_str());
+}
+
+void test_parse_reverses_fingerprint(void) {
+  std::string path;
+  std::string hash;
+  TEST_ASSERT_TRUE(parse("/assets/style.3f9c2a1b7d4e.css", 12, path, hash));
+  TEST_ASSERT_EQUAL_STRING("/assets/style.css", path.c_str());
+  TEST_ASSERT_EQUAL_STRING("3f9c2a1b7d4e", hash.c_str());
+
+  TEST_ASSERT_TRUE(parse(fingerprint("/assets/jquery.min.js", "abcdef012345"),
+                         12, path, hash));
+  TEST_ASSERT_EQUAL_STRING("/assets/jquery.min.js", path.c_str());
+  TEST_ASSERT_EQUAL_STRING("abcdef012345", hash.c_str());
+
+  TEST_ASSERT_TRUE(parse("/assets/LICENSE.0123456789ab", 12, path, hash));
+  TEST_ASSERT_EQUAL_STRING("/assets/LICENSE", path.c_str());
+}
+
+void test_parse_rejects_plain_names(void) {
+  std::string path = "unchanged";
+  std::string hash;
+  TEST_ASSERT_FALSE(parse("/assets/style.css", 12, path, hash));
+  TEST_ASSERT_FALSE(parse("/assets/jquery.min.js", 12, path, hash));
+  TEST_ASSERT_FALSE(parse("/assets/style.3f9c2a1b7d4x.css", 12, path, hash));
+  TEST_ASSERT_FALSE(parse("/assets/style.3f9c2a1b7d.css", 12, path, hash));
+  TEST_ASSERT_FALSE(parse("/assets/.3f9c2a1b7d4e.css", 12, path, hash));
+  TEST_ASSERT_FALSE(parse("", 12, path, hash));
+  TEST_ASSERT_EQUAL_STRING("unchanged", path.c_str());
+}
+
+void register_asset_fingerprint_tests(void) {
+  RUN_TEST(test_fingerprint_inserts_hash_before_extension);
+  RUN_TEST(test_parse_reverses_fingerprint);
+  RUN_TEST(test_parse_rejects_plain_names);
+}
@@ -0,0 +1,74 @@
+#include "platform/html_template.h"
+#include <cstring>
+#include <string>
+#include <unity.h>
+
+using namespace HtmlTemplate;
+
+namespace {
+// Renders markers as "[<id>:<argument>]"
+std::string renderTagged(const char *source) {
+  std::string out;
+  render(source, compile(source, strlen(source)),
+         [](Marker marker, const char *argument, size_t length,
+            const Writer &write) {
+           std::string tag = "[" + std::to_string(static_cast<int>(marker)) +
+                             ":" + std::string(argument, length) + "]";
+           write(tag.data(), tag.size());
+         },
+         [&out](const char *data, size_t length) { out.append(data, length); });
+  return out;
+}
+} // namespace
+
+void test_html_template_splits_literals_and_markers(void) {
+  const char *source = "<p>{{DEVICE_NAME}} / {{username}}</p>";
+  Segments segments = compile(source, strlen(source));
+  TEST_ASSERT_EQUAL(5, segments.size());
+  TEST_ASSERT_TRUE(segments[0].marker == Marker::Literal);
+  TEST_ASSERT_EQUAL(3, segments[0].length);
+  TEST_ASSERT_TRUE(segments[1].marker == Marker::DeviceName);
+  TEST_ASSERT_TRUE(segments[3].marker == Marker::Username);
+  TEST_ASSERT_EQUAL_STRING("</p>",
+                           std::string(source + segments[4].offset,
+                                       segments[4].length)
+                               .c_str());
+
+  TEST_ASSERT_EQUAL_STRING("<p>[4:] / [2:]</p>", renderTagged(source).c_str());
+  TEST_ASSERT_EQUAL_STRING("[1:][3:][5:][6:][7:]",
+                           renderTagged("{{NAV_MENU}}{{csrfToken}}"
+                                        "{{redirectUrl}}{{MODULE_PREFIX}}"
+                                        "{{SECURITY_NOTICE}}")
+                               .c_str());
+}
+
+void test_html_template_keeps_unknown_markers(void) {
+  TEST_ASSERT_EQUAL_STRING("a {{unknown}} b {{ASSET:}} c",
+                           renderTagged("a {{unknown}} b {{ASSET:}} c").c_str());
+  TEST_ASSERT_EQUAL_STRING("{ [4:] {{unclosed }",
+                           renderTagged("{ {{DEVICE_NAME}} {{unclosed }")
+                               .c_str());
+  TEST_ASSERT_EQUAL(1, compile("plain", 5).size());
+  TEST_ASSERT_EQUAL(0, compile("", 0).size());
+}
+
+void test_html_template_passes_marker_arguments(void) {
+  TEST_ASSERT_EQUAL_STRING(
+      "<link href=\"[8:/assets/style.css]\">",
+      renderTagged("<link href=\"{{ASSET:/assets/style.css}}\">").c_str());
+  TEST_ASSERT_EQUAL_STRING(
+      "<html>[9:]<title>t</title></head>[10: class=\"x\"]hi</body>",
+      renderTagged("<html><head><title>t</title></head>"
+                   "<body class=\"x\">hi</body>")
+          .c_str());
+  TEST_ASSERT_EQUAL_STRING("[10:]", renderTagged("<body>").c_str());
+  // Not a body tag, or one that never closes
+  TEST_ASSERT_EQUAL_STRING("<bodyguard>", renderTagged("<bodyguard>").c_str());
+  TEST_ASSERT_EQUAL_STRING("<body class", renderTagged("<body class").c_str());
+}
+
+void register_html_template_tests(void) {
+  RUN_TEST(test_html_template_splits_literals_and_markers);
+  RUN_TEST(test_html_template_keeps_unknown_markers);
+  RUN_TEST(test_html_template_passes_marker_arguments);
+}
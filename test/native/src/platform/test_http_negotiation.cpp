@@ -0,0 +1,117 @@
+#include "platform/http_negotiation.h"
+#include <unity.h>
+
+using namespace HttpNegotiation;
+
+void test_accepts_gzip_when_listed(void) {
+  TEST_ASSERT_TRUE(acceptsGzip("gzip, deflate, br"));
+  TEST_ASSERT_TRUE(acceptsGzip("br;q=1.0, GZip;q=0.5"));
+  TEST_ASSERT_TRUE(acceptsGzip("x-gzip"));
+}
+
+void test_accepts_gzip_through_wildcard(void) {
+  TEST_ASSERT_TRUE(acceptsGzip("*"));
+  TEST_ASSERT_TRUE(acceptsGzip("identity, *;q=0.1"));
+  TEST_ASSERT_FALSE(acceptsGzip("*;q=0"));
+  TEST_ASSERT_FALSE(acceptsGzip("*, gzip;q=0"));
+}
+
+void test_rejects_gzip_when_absent_or_refused(void) {
+  TEST_ASSERT_FALSE(acceptsGzip(""));
+  TEST_ASSERT_FALSE(acceptsGzip("identity"));
+  TEST_ASSERT_FALSE(acceptsGzip("notgzip, gzipped"));
+  TEST_ASSERT_FALSE(acceptsGzip("gzip;q=0, deflate"));
+  TEST_ASSERT_FALSE(acceptsGzip("deflate, gzip ; q=0.0"));
+}
+
+void test_etag_matches_listed_tags(void) {
+  TEST_ASSERT_TRUE(etagMatches("\"abc\"", "\"abc\""));
+  TEST_ASSERT_TRUE(etagMatches("\"x\", \"abc-gz\"", "\"abc-gz\""));
+  TEST_ASSERT_TRUE(etagMatches("W/\"abc\"", "\"abc\""));
+  TEST_ASSERT_TRUE(etagMatches(" * ", "\"abc\""));
+}
+
+void test_etag_mismatch_needs_full_response(void) {
+  TEST_ASSERT_FALSE(etagMatches("", "\"abc\""));
+  TEST_ASSERT_FALSE(etagMatches("\"abc\"", "\"abc-gz\""));
+  TEST_ASSERT_FALSE(etagMatches("\"ab\", \"abcd\"", "\"abc\""));
+  TEST_ASSERT_FALSE(etagMatches("abc", "\"abc\""));
+  TEST_ASSERT_FALSE(etagMatches("*", ""));
+}
+
+void test_parse_range_resolves_single_ranges(void) {
+  size_t first = 0;
+  size_t last = 0;
+  TEST_ASSERT_TRUE(parseRange("bytes=0-99", 1000, first, last) ==
+                   RangeResult::Partial);
+  TEST_ASSERT_EQUAL(0, first);
+  TEST_ASSERT_EQUAL(99, last);
+
+  TEST_ASSERT_TRUE(parseRange("bytes=100-", 1000, first, last) ==
+                   RangeResult::Partial);
+  TEST_ASSERT_EQUAL(100, first);
+  TEST_ASSERT_EQUAL(999, last);
+
+  TEST_ASSERT_TRUE(parseRange("Bytes=-10", 1000, first, last) ==
+                   RangeResult::Partial);
+  TEST_ASSERT_EQUAL(990, first);
+  TEST_ASSERT_EQUAL(999, last);
+
+  // Ends past the body are clamped; a suffix longer than it is all of it
+  TEST_ASSERT_TRUE(parseRange("bytes=900-5000", 1000, first, last) ==
+                   RangeResult::Partial);
+  TEST_ASSERT_EQUAL(999, last);
+  TEST_ASSERT_TRUE(parseRange("bytes=-5000", 1000, first, last) ==
+                   RangeResult::Partial);
+  TEST_ASSERT_EQUAL(0, first);
+}
+
+void test_parse_range_falls_back_or_rejects(void) {
+  size_t first = 0;
+  size_t last = 0;
+  TEST_ASSERT_TRUE(parseRange("", 1000, first, last) == RangeResult::Full);
+  TEST_ASSERT_TRUE(parseRange("items=0-9", 1000, first, last) ==
+                   RangeResult::Full);
+  TEST_ASSERT_TRUE(parseRange("bytes=0-9,20-29", 1000, first, last) ==
+                   RangeResult::Full);
+  TEST_ASSERT_TRUE(parseRange("bytes=9-0", 1000, first, last) ==
+                   RangeResult::Full);
+  TEST_ASSERT_TRUE(parseRange("bytes=abc", 1000, first, last) ==
+                   RangeResult::Full);
+
+  TEST_ASSERT_TRUE(parseRange("bytes=1000-", 1000, first, last) ==
+                   RangeResult::Unsatisfiable);
+  TEST_ASSERT_TRUE(parseRange("bytes=-0", 1000, first, last) ==
+                   RangeResult::Unsatisfiable);
+}
+
+void test_if_range_needs_strong_etag_match(void) {
+  TEST_ASSERT_TRUE(ifRangeMatches("", "\"abc\""));
+  TEST_ASSERT_TRUE(ifRangeMatches("\"abc\"", "\"abc\""));
+  TEST_ASSERT_FALSE(ifRangeMatches("\"abd\"", "\"abc\""));
+  TEST_ASSERT_FALSE(ifRangeMatches("W/\"abc\"", "\"abc\""));
+  TEST_ASSERT_FALSE(ifRangeMatches("\"abc\"", ""));
+  TEST_ASSERT_FALSE(
+      ifRangeMatches("Wed, 21 Oct 2015 07:28:00 GMT", "\"abc\""));
+}
+
+void test_only_unencoded_text_is_templatable(void) {
+  TEST_ASSERT_TRUE(isTemplatable("text/html", ""));
+  TEST_ASSERT_TRUE(isTemplatable("text/plain", "identity"));
+  TEST_ASSERT_FALSE(isTemplatable("text/html", "gzip"));
+  TEST_ASSERT_FALSE(isTemplatable("text/plain", " GZIP "));
+  TEST_ASSERT_FALSE(isTemplatable("text/css", ""));
+  TEST_ASSERT_FALSE(isTemplatable("application/javascript", ""));
+}
+
+void register_http_negotiation_tests(void) {
+  RUN_TEST(test_accepts_gzip_when_listed);
+  RUN_TEST(test_accepts_gzip_through_wildcard);
+  RUN_TEST(test_rejects_gzip_when_absent_or_refused);
+  RUN_TEST(test_etag_matches_listed_tags);
+  RUN_TEST(test_etag_mismatch_needs_full_response);
+  RUN_TEST(test_parse_range_resolves_single_ranges);
+  RUN_TEST(test_parse_range_falls_back_or_rejects);
+  RUN_TEST(test_if_range_needs_strong_etag_match);
+  RUN_TEST(test_only_unencoded_text_is_templatable);
+}
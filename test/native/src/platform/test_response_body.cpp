@@ -0,0 +1,88 @@
+#include "platform/response_body.h"
+#include <ArduinoJson.h>
+#include <string>
+#include <unity.h>
+#include <vector>
+
+using ResponseBody::ChunkPrint;
+using ResponseBody::ChunkWriter;
+
+void test_chunk_writer_coalesces_into_full_chunks(void) {
+  std::vector<std::string> chunks;
+  char buffer[8];
+  ChunkWriter writer(buffer, sizeof(buffer),
+                     [&chunks](const char *data, size_t length) {
+                       chunks.push_back(std::string(data, length));
+                       return true;
+                     });
+
+  writer.write("<p>", 3);
+  writer.write("Device", 6);
+  writer.write("</p>", 4);
+  writer.write("0123456789abcdefXY", 18);
+  TEST_ASSERT_TRUE(writer.flush());
+  TEST_ASSERT_TRUE(writer.flush()); // Nothing buffered - sends nothing
+
+  TEST_ASSERT_EQUAL(4, chunks.size());
+  TEST_ASSERT_EQUAL_STRING("<p>Devic", chunks[0].c_str());
+  TEST_ASSERT_EQUAL_STRING("e</p>012", chunks[1].c_str());
+  TEST_ASSERT_EQUAL_STRING("3456789a", chunks[2].c_str());
+  TEST_ASSERT_EQUAL_STRING("bcdefXY", chunks[3].c_str());
+}
+
+void test_chunk_writer_stops_after_failed_send(void) {
+  size_t sends = 0;
+  char buffer[4];
+  ChunkWriter writer(buffer, sizeof(buffer),
+                     [&sends](const char *, size_t) {
+                       sends++;
+                       return false;
+                     });
+
+  writer.write("abcdefghijkl", 12);
+  TEST_ASSERT_TRUE(writer.failed());
+  writer.write("mnop", 4);
+  TEST_ASSERT_FALSE(writer.flush());
+  TEST_ASSERT_EQUAL(1, sends);
+}
+
+void test_chunk_print_streams_large_json_in_full_chunks(void) {
+  JsonDocument doc;
+  JsonArray users = doc["users"].to<JsonArray>();
+  for (int i = 0; i < 200; i++) {
+    JsonObject user = users.add<JsonObject>();
+    user["id"] = i;
+    user["username"] = "user" + String(i);
+    user["roles"].add("viewer");
+  }
+
+  std::vector<size_t> chunkSizes;
+  std::string body;
+  char buffer[64];
+  ChunkWriter writer(buffer, sizeof(buffer),
+                     [&](const char *data, size_t length) {
+                       chunkSizes.push_back(length);
+                       body.append(data, length);
+                       return true;
+                     });
+  ChunkPrint printer(writer);
+  size_t written = serializeJson(doc, printer);
+  TEST_ASSERT_TRUE(writer.flush());
+
+  String expected;
+  serializeJson(doc, expected);
+  TEST_ASSERT_EQUAL(measureJson(doc), written);
+  TEST_ASSERT_EQUAL(written, body.size());
+  TEST_ASSERT_EQUAL_STRING(expected.c_str(), body.c_str());
+  TEST_ASSERT_EQUAL((written + sizeof(buffer) - 1) / sizeof(buffer),
+                    chunkSizes.size());
+  for (size_t i = 0; i + 1 < chunkSizes.size(); i++) {
+    TEST_ASSERT_EQUAL(sizeof(buffer), chunkSizes[i]);
+  }
+}
+
+void register_response_body_tests(void) {
+  RUN_TEST(test_chunk_writer_coalesces_into_full_chunks);
+  RUN_TEST(test_chunk_writer_stops_after_failed_send);
+  RUN_TEST(test_chunk_print_streams_large_json_in_full_chunks);
+}
@@ -0,0 +1,337 @@
+#include "storage/async_database_driver.h"
+#include "storage/json_database_driver.h"
+#include "storage/littlefs_database_driver.h"
+#include "storage/write_batch.h"
+#include <Preferences.h>
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <thread>
+#include <unity.h>
+
+// Long enough that the worker never drains on its own during a test
+static const unsigned long HOLD_MS = 60000;
+
+static std::unique_ptr<IDatabaseDriver> jsonDriver() {
+  return std::unique_ptr<IDatabaseDriver>(new JsonDatabaseDriver());
+}
+
+namespace {
+
+// In-memory driver that refuses to store the key "bad" while `refusing`,
+// and rejects any batch containing it
+class RefusingDriver : public IDatabaseDriver {
+public:
+  std::map<String, String> records;
+  std::atomic<bool> refusing{true};
+
+  bool store(const String &collection, const String &key,
+             const String &data) override {
+    if (refusing && key == "bad") {
+      return false;
+    }
+    records[collection + "/" + key] = data;
+    return true;
+  }
+  String retrieve(const String &collection, const String &key) override {
+    auto it = records.find(collection + "/" + key);
+    return it == records.end() ? String() : it->second;
+  }
+  bool remove(const String &collection, const String &key) override {
+    return records.erase(collection + "/" + key) > 0;
+  }
+  std::vector<String> listKeys(const String &collection) override {
+    std::vector<String> keys;
+    String prefix = collection + "/";
+    for (const auto &record : records) {
+      if (record.first.startsWith(prefix)) {
+        keys.push_back(record.first.substring(prefix.length()));
+      }
+    }
+    return keys;
+  }
+  bool exists(const String &collection, const String &key) override {
+    return records.count(collection + "/" + key) > 0;
+  }
+  bool applyBatch(const WriteBatch &batch) override {
+    for (const WriteBatch::Operation &op : batch.operations()) {
+      if (refusing && op.key == "bad") {
+        return false; // All-or-nothing
+      }
+    }
+    return IDatabaseDriver::applyBatch(batch);
+  }
+  String getDriverName() const override { return "refusing"; }
+};
+
+} // namespace
+
+void test_async_driver_reads_pending_writes(void) {
+  AsyncDatabaseDriver driver(jsonDriver(), 8, HOLD_MS);
+  TEST_ASSERT_TRUE(driver.store("sessions", "s1", "{\"user\":\"a\"}"));
+
+  TEST_ASSERT_EQUAL_STRING("{\"user\":\"a\"}",
+                           driver.retrieve("sessions", "s1").c_str());
+  TEST_ASSERT_TRUE(driver.exists("sessions", "s1"));
+  TEST_ASSERT_EQUAL(1, driver.getPendingCount());
+  TEST_ASSERT_FALSE(driver.getInnerDriver().exists("sessions", "s1"));
+
+  TEST_ASSERT_TRUE(driver.flush());
+  TEST_ASSERT_EQUAL(0, driver.getPendingCount());
+  TEST_ASSERT_EQUAL_STRING(
+      "{\"user\":\"a\"}",
+      driver.getInnerDriver().retrieve("sessions", "s1").c_str());
+  TEST_ASSERT_FALSE(driver.store("", "s1", "{}"));
+}
+
+void test_async_driver_coalesces_writes_per_key(void) {
+  JsonDatabaseDriver reference;
+  NativePreferencesFake::writeCount() = 0;
+  reference.store("counters", "hits", "{\"n\":0}");
+  size_t singleWrite = NativePreferencesFake::writeCount();
+  NativePreferencesFake::reset();
+
+  AsyncDatabaseDriver driver(jsonDriver(), 8, HOLD_MS);
+  NativePreferencesFake::writeCount() = 0;
+  for (int i = 1; i <= 20; i++) {
+    driver.store("counters", "hits", "{\"n\":" + String(i) + "}");
+  }
+  TEST_ASSERT_EQUAL(0, NativePreferencesFake::writeCount());
+
+  driver.flush();
+  // Twenty stores, one collection write, last value wins
+  TEST_ASSERT_EQUAL(singleWrite, NativePreferencesFake::writeCount());
+  TEST_ASSERT_EQUAL_STRING(
+      "{\"n\":20}",
+      driver.getInnerDriver().retrieve("counters", "hits").c_str());
+}
+
+void test_async_driver_pending_remove_hides_stored_record(void) {
+  AsyncDatabaseDriver driver(jsonDriver(), 8, HOLD_MS);
+  driver.getInnerDriver().store("sessions", "s1", "{}");
+
+  TEST_ASSERT_TRUE(driver.remove("sessions", "s1"));
+  TEST_ASSERT_FALSE(driver.remove("sessions", "s1"));
+  TEST_ASSERT_FALSE(driver.exists("sessions", "s1"));
+  TEST_ASSERT_EQUAL_STRING("", driver.retrieve("sessions", "s1").c_str());
+  TEST_ASSERT_EQUAL(0, driver.count("sessions"));
+  TEST_ASSERT_TRUE(driver.getInnerDriver().exists("sessions", "s1"));
+
+  driver.flush();
+  TEST_ASSERT_FALSE(driver.getInnerDriver().exists("sessions", "s1"));
+}
+
+void test_async_driver_scans_merge_pending_writes(void) {
+  AsyncDatabaseDriver driver(jsonDriver(), 8, HOLD_MS);
+  driver.getInnerDriver().store("users", "a", "{\"v\":1}");
+  driver.getInnerDriver().store("users", "b", "{\"v\":1}");
+
+  driver.store("users", "b", "{\"v\":2}"); // Overrides a stored record
+  driver.store("users", "c", "{\"v\":2}"); // New
+  driver.remove("users", "a");
+
+  TEST_ASSERT_EQUAL(2, driver.count("users"));
+  std::vector<String> keys = driver.listKeys("users");
+  TEST_ASSERT_EQUAL(2, keys.size());
+
+  String seen;
+  size_t visited = driver.forEach("users",
+                                  [&](const String &key, const String &data) {
+                                    seen += key + "=" + data + ";";
+                                    return true;
+                                  });
+  TEST_ASSERT_EQUAL(2, visited);
+  TEST_ASSERT_EQUAL_STRING("b={\"v\":2};c={\"v\":2};", seen.c_str());
+}
+
+void test_async_driver_key_scans_merge_pending_writes_in_order(void) {
+  AsyncDatabaseDriver driver(jsonDriver(), 8, HOLD_MS);
+  driver.getInnerDriver().store("readings", "r10", "{\"v\":1}");
+  driver.getInnerDriver().store("readings", "r12", "{\"v\":1}");
+  driver.getInnerDriver().store("readings", "r14", "{\"v\":1}");
+
+  driver.store("readings", "r11", "{\"v\":2}");
+  driver.store("readings", "r14", "{\"v\":2}");
+  driver.store("readings", "r20", "{\"v\":2}"); // Out of range
+  driver.remove("readings", "r12");
+
+  String seen;
+  size_t visited = driver.scanRange(
+      "readings", "r10", "r15", [&seen](const String &key, const String &data) {
+        seen += key + "=" + data + ";";
+        return true;
+      });
+  TEST_ASSERT_EQUAL(3, visited);
+  TEST_ASSERT_EQUAL_STRING("r10={\"v\":1};r11={\"v\":2};r14={\"v\":2};",
+                           seen.c_str());
+
+  seen = "";
+  TEST_ASSERT_EQUAL(2, driver.scanPrefix("readings", "r1",
+                                         [&seen](const String &key,
+                                                 const String &data) {
+                                           seen += key + ";";
+                                           return key != "r11";
+                                         }));
+  TEST_ASSERT_EQUAL_STRING("r10;r11;", seen.c_str());
+}
+
+void test_async_driver_worker_drains_in_background(void) {
+  AsyncDatabaseDriver driver(jsonDriver(), 8, 5);
+  driver.store("sessions", "s1", "{}");
+  driver.store("sessions", "s2", "{}");
+
+  for (int i = 0; i < 200 && driver.getPendingCount() > 0; i++) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+  }
+  TEST_ASSERT_EQUAL(0, driver.getPendingCount());
+  TEST_ASSERT_EQUAL(2, driver.getInnerDriver().count("sessions"));
+  TEST_ASSERT_EQUAL(0, driver.getFailedDrainCount());
+}
+
+void test_async_driver_full_queue_stays_bounded(void) {
+  AsyncDatabaseDriver driver(jsonDriver(), 2, HOLD_MS);
+  driver.store("sessions", "a", "{}");
+  driver.store("sessions", "b", "{}");
+  driver.store("sessions", "a", "{\"v\":2}");
+  driver.store("sessions", "c", "{}");
+
+  // Three keys never fit: the worker (woken by the full queue) or the
+  // writer itself has drained, whichever got there first
+  TEST_ASSERT_TRUE(driver.getPendingCount() <= 2);
+  TEST_ASSERT_EQUAL_STRING("{\"v\":2}",
+                           driver.retrieve("sessions", "a").c_str());
+  TEST_ASSERT_EQUAL(3, driver.count("sessions"));
+
+  driver.flush();
+  TEST_ASSERT_EQUAL_STRING(
+      "{\"v\":2}", driver.getInnerDriver().retrieve("sessions", "a").c_str());
+}
+
+void test_async_driver_shutdown_drains_then_writes_through(void) {
+  AsyncDatabaseDriver driver(jsonDriver(), 8, HOLD_MS);
+  driver.store("sessions", "s1", "{}");
+
+  driver.shutdown();
+  TEST_ASSERT_TRUE(driver.getInnerDriver().exists("sessions", "s1"));
+
+  driver.store("sessions", "s2", "{}");
+  TEST_ASSERT_EQUAL(0, driver.getPendingCount());
+  TEST_ASSERT_TRUE(driver.getInnerDriver().exists("sessions", "s2"));
+  driver.shutdown(); // Idempotent
+}
+
+void test_async_driver_rejects_names_the_wrapped_driver_refuses(void) {
+  AsyncDatabaseDriver driver(
+      std::unique_ptr<IDatabaseDriver>(
+          new LittleFSDatabaseDriver("/test_storage")),
+      8, HOLD_MS);
+
+  TEST_ASSERT_FALSE(driver.store("sessions", "a:b", "{}"));
+  TEST_ASSERT_FALSE(driver.store(".hidden", "s1", "{}"));
+  String longKey;
+  for (int i = 0; i < 65; i++) {
+    longKey += "k";
+  }
+  TEST_ASSERT_FALSE(driver.store("sessions", longKey, "{}"));
+
+  WriteBatch batch(&driver);
+  batch.put("sessions", "s1", "{}");
+  batch.put("sessions", "a:b", "{}");
+  TEST_ASSERT_FALSE(batch.commit());
+
+  TEST_ASSERT_EQUAL(0, driver.getPendingCount());
+  TEST_ASSERT_TRUE(driver.store("sessions", "s1", "{}"));
+  TEST_ASSERT_TRUE(driver.flush());
+  TEST_ASSERT_EQUAL(0, driver.getFailedDrainCount());
+}
+
+void test_async_driver_keeps_refused_writes_pending(void) {
+  RefusingDriver *inner = new RefusingDriver();
+  AsyncDatabaseDriver driver(std::unique_ptr<IDatabaseDriver>(inner), 8,
+                             HOLD_MS);
+  driver.store("sessions", "good1", "{\"v\":1}");
+  driver.store("sessions", "bad", "{\"v\":2}");
+  driver.store("sessions", "good2", "{\"v\":3}");
+
+  // The batch is rejected, but the rest of it still lands
+  TEST_ASSERT_FALSE(driver.flush());
+  TEST_ASSERT_TRUE(inner->exists("sessions", "good1"));
+  TEST_ASSERT_TRUE(inner->exists("sessions", "good2"));
+  TEST_ASSERT_FALSE(inner->exists("sessions", "bad"));
+  TEST_ASSERT_EQUAL(1, driver.getPendingCount());
+  TEST_ASSERT_EQUAL(1, driver.getFailedDrainCount());
+  TEST_ASSERT_EQUAL_STRING("{\"v\":2}",
+                           driver.retrieve("sessions", "bad").c_str());
+
+  inner->refusing = false;
+  TEST_ASSERT_TRUE(driver.flush());
+  TEST_ASSERT_EQUAL(0, driver.getPendingCount());
+  TEST_ASSERT_EQUAL_STRING("{\"v\":2}",
+                           inner->retrieve("sessions", "bad").c_str());
+}
+
+void test_async_driver_full_of_refused_writes_writes_through(void) {
+  RefusingDriver *inner = new RefusingDriver();
+  AsyncDatabaseDriver driver(std::unique_ptr<IDatabaseDriver>(inner), 1,
+                             HOLD_MS);
+  driver.store("sessions", "bad", "{}");
+
+  // The queue can't drain, so the next write is made (and reported) here
+  TEST_ASSERT_TRUE(driver.store("sessions", "s1", "{}"));
+  TEST_ASSERT_TRUE(inner->exists("sessions", "s1"));
+  TEST_ASSERT_EQUAL(1, driver.getPendingCount());
+
+  inner->refusing = false;
+}
+
+void test_async_driver_apply_batch_and_flush_after_shutdown(void) {
+  // Left behind (not deleted) if the two deadlock, so the test can report it
+  AsyncDatabaseDriver *driver = new AsyncDatabaseDriver(jsonDriver(), 8,
+                                                        HOLD_MS);
+  driver->shutdown();
+  std::shared_ptr<std::atomic<int>> finished(new std::atomic<int>(0));
+
+  std::thread batches([driver, finished]() {
+    for (int i = 0; i < 200; i++) {
+      WriteBatch batch(driver);
+      batch.put("sessions", "s" + String(i), "{}");
+      batch.commit();
+    }
+    (*finished)++;
+  });
+  std::thread flushes([driver, finished]() {
+    while (*finished == 0) { // For as long as the batches run
+      driver->flush();
+    }
+    (*finished)++;
+  });
+
+  for (int i = 0; i < 500 && *finished < 2; i++) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+  }
+  bool deadlocked = *finished < 2;
+  if (deadlocked) {
+    batches.detach();
+    flushes.detach();
+  }
+  TEST_ASSERT_FALSE(deadlocked);
+  batches.join();
+  flushes.join();
+  TEST_ASSERT_EQUAL(200, driver->getInnerDriver().count("sessions"));
+  delete driver;
+}
+
+void register_async_database_driver_tests(void) {
+  RUN_TEST(test_async_driver_reads_pending_writes);
+  RUN_TEST(test_async_driver_coalesces_writes_per_key);
+  RUN_TEST(test_async_driver_pending_remove_hides_stored_record);
+  RUN_TEST(test_async_driver_scans_merge_pending_writes);
+  RUN_TEST(test_async_driver_key_scans_merge_pending_writes_in_order);
+  RUN_TEST(test_async_driver_worker_drains_in_background);
+  RUN_TEST(test_async_driver_full_queue_stays_bounded);
+  RUN_TEST(test_async_driver_shutdown_drains_then_writes_through);
+  RUN_TEST(test_async_driver_rejects_names_the_wrapped_driver_refuses);
+  RUN_TEST(test_async_driver_keeps_refused_writes_pending);
+  RUN_TEST(test_async_driver_full_of_refused_writes_writes_through);
+  RUN_TEST(test_async_driver_apply_batch_and_flush_after_shutdown);
+}
@@ -1,6 +1,7 @@
 #include "models/data_models.h"
 #include "storage/auth_storage.h"
 #include "storage/storage_manager.h"
+#include <Preferences.h>
 #include <unity.h>
 
 namespace {
@@ -22,6 +23,12 @@ const char *kPageTokens = "page_tokens";
 // driverName statics are set once and never touched again.
 IDatabaseDriver &rawDriver() { return StorageManager::driver(""); }
 
+// Page tokens are routed to the RAM-only "memory:page_tokens" driver, which
+// clearAllDrivers() also recreates empty.
+IDatabaseDriver &pageTokenDriver() {
+  return StorageManager::driverFor(kPageTokens);
+}
+
 } // namespace
 
 // --- User management ---
@@ -125,6 +132,27 @@ void test_get_all_users_returns_every_created_user(void) {
   TEST_ASSERT_EQUAL(2, users.size());
 }
 
+void test_for_each_user_pages_in_username_order(void) {
+  AuthStorage::createUser("carol", "pw12345");
+  AuthStorage::createUser("alice", "pw12345");
+  AuthStorage::createUser("bob", "pw12345");
+
+  std::vector<String> names;
+  auto collect = [&](AuthUser &user) {
+    names.push_back(user.username);
+    return true;
+  };
+  String cursor = AuthStorage::forEachUser(collect, 2);
+  TEST_ASSERT_TRUE(cursor.length() > 0);
+  TEST_ASSERT_EQUAL_STRING("",
+                           AuthStorage::forEachUser(collect, 2, cursor).c_str());
+
+  TEST_ASSERT_EQUAL(3, names.size());
+  TEST_ASSERT_EQUAL_STRING("alice", names[0].c_str());
+  TEST_ASSERT_EQUAL_STRING("bob", names[1].c_str());
+  TEST_ASSERT_EQUAL_STRING("carol", names[2].c_str());
+}
+
 // --- Session management ---
 
 void test_create_session_fails_for_unknown_user(void) {
@@ -270,12 +298,12 @@ void test_validate_page_token_rejects_unknown_token(void) {
 void test_validate_page_token_rejects_and_cleans_up_expired(void) {
   AuthPageToken expired("csrf_expired", "10.0.0.5");
   expired.expiresAt = 1;
-  rawDriver().store(kPageTokens, expired.id, expired.toJson());
+  pageTokenDriver().store(kPageTokens, expired.id, expired.toJson());
 
   TEST_ASSERT_FALSE(
       AuthStorage::validatePageToken("csrf_expired", "10.0.0.5"));
   // Confirm it's actually gone, not just reported invalid this one time.
-  TEST_ASSERT_EQUAL_STRING("", rawDriver().retrieve(kPageTokens, expired.id).c_str());
+  TEST_ASSERT_EQUAL_STRING("", pageTokenDriver().retrieve(kPageTokens, expired.id).c_str());
 }
 
 void test_clean_expired_page_tokens_removes_only_expired(void) {
@@ -283,13 +311,37 @@ void test_clean_expired_page_tokens_removes_only_expired(void) {
 
   AuthPageToken expired("csrf_expired2", "10.0.0.5");
   expired.expiresAt = 1;
-  rawDriver().store(kPageTokens, expired.id, expired.toJson());
+  pageTokenDriver().store(kPageTokens, expired.id, expired.toJson());
 
   int cleaned = AuthStorage::cleanExpiredPageTokens();
   TEST_ASSERT_EQUAL(1, cleaned);
   TEST_ASSERT_TRUE(AuthStorage::validatePageToken(valid, "10.0.0.5"));
 }
 
+void test_page_tokens_stay_in_ram(void) {
+  NativePreferencesFake::writeCount() = 0;
+
+  String token = AuthStorage::createPageToken("10.0.0.5");
+  TEST_ASSERT_TRUE(AuthStorage::validatePageToken(token, "10.0.0.5"));
+
+  TEST_ASSERT_EQUAL(0, NativePreferencesFake::writeCount());
+  TEST_ASSERT_EQUAL_STRING("memory",
+                           pageTokenDriver().getDriverName().c_str());
+  TEST_ASSERT_EQUAL(0, rawDriver().count(kPageTokens));
+}
+
+void test_page_tokens_survive_a_full_shared_memory_driver(void) {
+  String token = AuthStorage::createPageToken("10.0.0.5");
+
+  IDatabaseDriver &shared = StorageManager::driver("memory");
+  TEST_ASSERT_TRUE(&shared != &pageTokenDriver());
+  for (int i = 0; i < 200; i++) {
+    shared.store("previews", "p" + String(i), "{\"n\":" + String(i) + "}");
+  }
+
+  TEST_ASSERT_TRUE(AuthStorage::validatePageToken(token, "10.0.0.5"));
+}
+
 // --- Setup state ---
 
 void test_requires_initial_setup_true_when_no_users(void) {
@@ -303,6 +355,22 @@ void test_requires_initial_setup_false_once_user_exists(void) {
   TEST_ASSERT_TRUE(AuthStorage::hasUsers());
 }
 
+void test_delete_user_writes_each_collection_once(void) {
+  String id = AuthStorage::createUser("alice", "pw12345");
+  for (int i = 0; i < 3; i++) {
+    AuthStorage::createSession(id);
+    AuthStorage::createApiToken(id, "cli");
+  }
+  NativePreferencesFake::writeCount() = 0;
+
+  TEST_ASSERT_TRUE(AuthStorage::deleteUser(id));
+
+  // users + sessions + api_tokens + the shared index collection, instead
+  // of one rewrite (plus index update) per removed record
+  TEST_ASSERT_EQUAL(4, NativePreferencesFake::writeCount());
+  TEST_ASSERT_TRUE(AuthStorage::getUserApiTokens(id).empty());
+}
+
 void register_auth_storage_tests(void) {
   RUN_TEST(test_create_user_rejects_empty_fields);
   RUN_TEST(test_create_user_succeeds_and_normalizes_username);
@@ -314,10 +382,12 @@ void register_auth_storage_tests(void) {
   RUN_TEST(test_update_user_password_changes_credentials);
   RUN_TEST(test_update_user_password_fails_for_unknown_user);
   RUN_TEST(test_delete_user_removes_user_and_cascades);
+  RUN_TEST(test_delete_user_writes_each_collection_once);
   RUN_TEST(test_validate_credentials_succeeds_for_correct_password);
   RUN_TEST(test_validate_credentials_fails_for_wrong_password);
   RUN_TEST(test_validate_credentials_fails_for_unknown_user);
   RUN_TEST(test_get_all_users_returns_every_created_user);
+  RUN_TEST(test_for_each_user_pages_in_username_order);
 
   RUN_TEST(test_create_session_fails_for_unknown_user);
   RUN_TEST(test_create_session_succeeds_with_prefix);
@@ -340,6 +410,8 @@ void register_auth_storage_tests(void) {
   RUN_TEST(test_validate_page_token_rejects_unknown_token);
   RUN_TEST(test_validate_page_token_rejects_and_cleans_up_expired);
   RUN_TEST(test_clean_expired_page_tokens_removes_only_expired);
+  RUN_TEST(test_page_tokens_stay_in_ram);
+  RUN_TEST(test_page_tokens_survive_a_full_shared_memory_driver);
 
   RUN_TEST(test_requires_initial_setup_true_when_no_users);
   RUN_TEST(test_requires_initial_setup_false_once_user_exists);
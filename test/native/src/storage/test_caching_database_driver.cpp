@@ -0,0 +1,184 @@
+#include "storage/caching_database_driver.h"
+#include "storage/littlefs_database_driver.h"
+#include "storage/memory_database_driver.h"
+#include "storage/storage_manager.h"
+#include <LittleFS.h>
+#include <cstdlib>
+#include <unity.h>
+
+namespace {
+size_t allocations = 0;
+size_t releases = 0;
+
+void *countingAllocate(size_t size) {
+  allocations++;
+  return malloc(size);
+}
+
+void countingRelease(void *ptr) {
+  releases++;
+  free(ptr);
+}
+
+std::unique_ptr<IDatabaseDriver> littlefsDriver() {
+  return std::unique_ptr<IDatabaseDriver>(
+      new LittleFSDatabaseDriver("/test_storage"));
+}
+} // namespace
+
+void test_caching_driver_serves_repeat_reads_from_cache(void) {
+  CachingDatabaseDriver driver(littlefsDriver(), 4096);
+  TEST_ASSERT_TRUE(driver.store("openapi", "spec", "{\"paths\":{}}"));
+
+  TEST_ASSERT_EQUAL_STRING("{\"paths\":{}}",
+                           driver.retrieve("openapi", "spec").c_str());
+  size_t lookupsBefore = NativeFsFake::lookupCount();
+  for (int i = 0; i < 5; i++) {
+    TEST_ASSERT_EQUAL_STRING("{\"paths\":{}}",
+                             driver.retrieve("openapi", "spec").c_str());
+  }
+  TEST_ASSERT_TRUE(driver.exists("openapi", "spec"));
+  TEST_ASSERT_EQUAL(lookupsBefore, NativeFsFake::lookupCount());
+  TEST_ASSERT_EQUAL(5, driver.getHitCount());
+  TEST_ASSERT_EQUAL(1, driver.getMissCount());
+  TEST_ASSERT_EQUAL_STRING("cached:littlefs", driver.getDriverName().c_str());
+}
+
+void test_caching_driver_writes_through_and_invalidates(void) {
+  CachingDatabaseDriver driver(littlefsDriver(), 4096);
+  driver.store("users", "u1", "{\"v\":1}");
+  driver.retrieve("users", "u1");
+
+  TEST_ASSERT_TRUE(driver.store("users", "u1", "{\"v\":2}"));
+  TEST_ASSERT_EQUAL_STRING(
+      "{\"v\":2}", driver.getInnerDriver().retrieve("users", "u1").c_str());
+  TEST_ASSERT_EQUAL_STRING("{\"v\":2}", driver.retrieve("users", "u1").c_str());
+
+  WriteBatch batch(&driver);
+  batch.put("users", "u1", "{\"v\":3}");
+  TEST_ASSERT_TRUE(batch.commit());
+  TEST_ASSERT_EQUAL_STRING("{\"v\":3}", driver.retrieve("users", "u1").c_str());
+
+  TEST_ASSERT_TRUE(driver.remove("users", "u1"));
+  TEST_ASSERT_FALSE(driver.exists("users", "u1"));
+  TEST_ASSERT_EQUAL_STRING("", driver.retrieve("users", "u1").c_str());
+  TEST_ASSERT_EQUAL(0, driver.getUsedBytes());
+}
+
+void test_caching_driver_evicts_least_recently_used(void) {
+  // 2 bytes of key + 9 of data per record; room for three
+  CachingDatabaseDriver driver(littlefsDriver(), 33,
+                               CachingDatabaseDriver::heapAllocator(), 33);
+  driver.store("c", "r1", "{\"v\":101}");
+  driver.store("c", "r2", "{\"v\":102}");
+  driver.store("c", "r3", "{\"v\":103}");
+  driver.store("c", "r4", "{\"v\":104}");
+  driver.retrieve("c", "r1");
+  driver.retrieve("c", "r2");
+  driver.retrieve("c", "r3");
+  driver.retrieve("c", "r1"); // r2 is now the oldest
+
+  driver.retrieve("c", "r4");
+  TEST_ASSERT_EQUAL(33, driver.getUsedBytes());
+  size_t missesBefore = driver.getMissCount();
+  driver.retrieve("c", "r1");
+  driver.retrieve("c", "r3");
+  TEST_ASSERT_EQUAL(missesBefore, driver.getMissCount());
+  driver.retrieve("c", "r2");
+  TEST_ASSERT_EQUAL(missesBefore + 1, driver.getMissCount());
+}
+
+void test_caching_driver_skips_oversized_records(void) {
+  CachingDatabaseDriver driver(littlefsDriver(), 1024,
+                               CachingDatabaseDriver::heapAllocator(), 16);
+  driver.store("c", "big", "{\"v\":\"0123456789abcdef\"}");
+  TEST_ASSERT_EQUAL_STRING("{\"v\":\"0123456789abcdef\"}",
+                           driver.retrieve("c", "big").c_str());
+  TEST_ASSERT_EQUAL(0, driver.getUsedBytes());
+}
+
+void test_caching_driver_uses_the_given_allocator(void) {
+  allocations = 0;
+  releases = 0;
+  CachingDatabaseDriver::Allocator counting = {countingAllocate,
+                                               countingRelease, true};
+  {
+    CachingDatabaseDriver driver(littlefsDriver(), 0, counting);
+    TEST_ASSERT_EQUAL(CachingDatabaseDriver::DEFAULT_PSRAM_MAX_BYTES,
+                      driver.getMaxBytes());
+    driver.store("c", "a", "{}");
+    driver.store("c", "b", "{}");
+    driver.retrieve("c", "a");
+    driver.retrieve("c", "b");
+    TEST_ASSERT_EQUAL(2, allocations);
+
+    driver.store("c", "a", "{\"v\":2}");
+    TEST_ASSERT_EQUAL(1, releases);
+  }
+  TEST_ASSERT_EQUAL(allocations, releases);
+}
+
+void test_caching_driver_bypasses_collections_with_ttl(void) {
+  MemoryDatabaseDriver *memory = new MemoryDatabaseDriver();
+  time_t now = 1000;
+  memory->setClock([&now]() { return now; });
+  CachingDatabaseDriver driver(std::unique_ptr<IDatabaseDriver>(memory), 4096);
+
+  driver.store("tokens", "t1", "{}");
+  driver.retrieve("tokens", "t1");
+  TEST_ASSERT_TRUE(driver.setCollectionTtl("tokens", 60));
+  TEST_ASSERT_EQUAL(0, driver.getUsedBytes());
+
+  driver.store("tokens", "t1", "{}");
+  driver.retrieve("tokens", "t1");
+  now += 120;
+  TEST_ASSERT_EQUAL_STRING("", driver.retrieve("tokens", "t1").c_str());
+  TEST_ASSERT_FALSE(driver.exists("tokens", "t1"));
+}
+
+void test_storage_manager_registers_cached_littlefs(void) {
+  StorageManager::routeCollection("cached_docs", "cached:littlefs");
+  TEST_ASSERT_TRUE(
+      StorageManager::query("cached_docs").store("d1", "{\"a\":1}"));
+
+  TEST_ASSERT_EQUAL_STRING(
+      "cached:littlefs",
+      StorageManager::driverFor("cached_docs").getDriverName().c_str());
+  TEST_ASSERT_TRUE(
+      NativeFsFake::pathExists("/openapi_cached_storage/cached_docs/d1.json"));
+  TEST_ASSERT_EQUAL_STRING(
+      "{\"a\":1}",
+      StorageManager::driver("cached:littlefs").retrieve("cached_docs", "d1")
+          .c_str());
+
+  StorageManager::routeCollection("cached_docs", "");
+}
+
+void test_storage_manager_cached_littlefs_cannot_go_stale(void) {
+  IDatabaseDriver &cached = StorageManager::driver("cached:littlefs");
+  cached.store("docs", "d1", "{\"v\":1}");
+  cached.retrieve("docs", "d1"); // Now cached
+
+  StorageManager::driver("littlefs").store("docs", "d1", "{\"v\":2}");
+  StorageManager::driver("littlefs").store("docs", "d2", "{\"v\":2}");
+
+  // The cached read and a scan (which skips the cache) still agree
+  String scanned;
+  cached.forEach("docs", [&scanned](const String &key, const String &data) {
+    scanned += key + "=" + data + ";";
+    return true;
+  });
+  TEST_ASSERT_EQUAL_STRING("d1={\"v\":1};", scanned.c_str());
+  TEST_ASSERT_EQUAL_STRING("{\"v\":1}", cached.retrieve("docs", "d1").c_str());
+}
+
+void register_caching_database_driver_tests(void) {
+  RUN_TEST(test_caching_driver_serves_repeat_reads_from_cache);
+  RUN_TEST(test_caching_driver_writes_through_and_invalidates);
+  RUN_TEST(test_caching_driver_evicts_least_recently_used);
+  RUN_TEST(test_caching_driver_skips_oversized_records);
+  RUN_TEST(test_caching_driver_uses_the_given_allocator);
+  RUN_TEST(test_caching_driver_bypasses_collections_with_ttl);
+  RUN_TEST(test_storage_manager_registers_cached_littlefs);
+  RUN_TEST(test_storage_manager_cached_littlefs_cannot_go_stale);
+}
@@ -0,0 +1,56 @@
+#include "storage/collection_codec.h"
+#include <unity.h>
+
+namespace {
+CollectionCodec::Records sampleRecords() {
+  CollectionCodec::Records records;
+  records["u1"] = "{\"username\":\"alice\",\"createdAt\":1700000000,"
+                  "\"active\":true}";
+  records["u2"] = "[1,2,3]";
+  records["u3"] = "not json";
+  records["u4"] = "42";
+  return records;
+}
+} // namespace
+
+void test_collection_codec_msgpack_roundtrip(void) {
+  std::string blob;
+  TEST_ASSERT_TRUE(CollectionCodec::encodeMsgPack(sampleRecords(), blob));
+  TEST_ASSERT_EQUAL(CollectionCodec::MSGPACK_VERSION, (uint8_t)blob[0]);
+
+  CollectionCodec::Records decoded;
+  TEST_ASSERT_TRUE(CollectionCodec::decodeMsgPack(
+      reinterpret_cast<const uint8_t *>(blob.data()), blob.size(), decoded));
+  TEST_ASSERT_EQUAL(4, decoded.size());
+  TEST_ASSERT_EQUAL_STRING(sampleRecords()["u1"].c_str(),
+                           decoded["u1"].c_str());
+  TEST_ASSERT_EQUAL_STRING("[1,2,3]", decoded["u2"].c_str());
+  // Non-document records are tagged as strings and come back verbatim
+  TEST_ASSERT_EQUAL_STRING("not json", decoded["u3"].c_str());
+  TEST_ASSERT_EQUAL_STRING("42", decoded["u4"].c_str());
+}
+
+void test_collection_codec_msgpack_is_smaller_than_json(void) {
+  std::string json;
+  std::string msgpack;
+  TEST_ASSERT_TRUE(CollectionCodec::encodeJson(sampleRecords(), json));
+  TEST_ASSERT_TRUE(CollectionCodec::encodeMsgPack(sampleRecords(), msgpack));
+  TEST_ASSERT_TRUE(msgpack.size() < json.size());
+}
+
+void test_collection_codec_rejects_malformed_blobs(void) {
+  CollectionCodec::Records decoded;
+  const uint8_t unknownVersion[] = {0x7f, 0x80};
+  TEST_ASSERT_FALSE(
+      CollectionCodec::decodeMsgPack(unknownVersion, 2, decoded));
+  const uint8_t truncated[] = {CollectionCodec::MSGPACK_VERSION, 0x81, 0xa2};
+  TEST_ASSERT_FALSE(CollectionCodec::decodeMsgPack(truncated, 3, decoded));
+  TEST_ASSERT_FALSE(CollectionCodec::decodeJson("{\"key\":1}", decoded));
+  TEST_ASSERT_EQUAL(0, decoded.size());
+}
+
+void register_collection_codec_tests(void) {
+  RUN_TEST(test_collection_codec_msgpack_roundtrip);
+  RUN_TEST(test_collection_codec_msgpack_is_smaller_than_json);
+  RUN_TEST(test_collection_codec_rejects_malformed_blobs);
+}
@@ -0,0 +1,363 @@
+#include "storage/indexed_database_driver.h"
+#include "storage/json_database_driver.h"
+#include "storage/query_builder.h"
+#include "storage/storage_manager.h"
+#include <map>
+#include <Preferences.h>
+#include <unity.h>
+
+namespace {
+
+// In-memory driver that counts reads, so tests can tell an index lookup
+// from a full scan
+class CountingDriver : public IDatabaseDriver {
+public:
+  std::map<String, std::map<String, String>> data;
+  int retrieves = 0;
+  int scans = 0;
+  bool powerLossAfterDataWrite = false; // Fail every write after the next
+  bool poweredOff = false;               // one to a data collection
+  bool failDataWrites = false;           // Index writes still succeed
+
+  bool store(const String &collection, const String &key,
+             const String &value) override {
+    if (poweredOff || (failDataWrites &&
+                       collection != IndexedDatabaseDriver::INDEX_COLLECTION)) {
+      return false;
+    }
+    poweredOff = powerLossAfterDataWrite &&
+                 collection != IndexedDatabaseDriver::INDEX_COLLECTION;
+    data[collection][key] = value;
+    return true;
+  }
+  String retrieve(const String &collection, const String &key) override {
+    retrieves++;
+    auto it = data[collection].find(key);
+    return it != data[collection].end() ? it->second : String();
+  }
+  bool remove(const String &collection, const String &key) override {
+    return data[collection].erase(key) > 0;
+  }
+  std::vector<String> listKeys(const String &collection) override {
+    std::vector<String> keys;
+    for (const auto &entry : data[collection]) {
+      keys.push_back(entry.first);
+    }
+    return keys;
+  }
+  bool exists(const String &collection, const String &key) override {
+    return data[collection].count(key) > 0;
+  }
+  size_t forEach(const String &collection, RecordCallback callback) override {
+    scans++;
+    size_t visited = 0;
+    for (const auto &entry : data[collection]) {
+      visited++;
+      if (!callback(entry.first, entry.second)) break;
+    }
+    return visited;
+  }
+  String getDriverName() const override { return "counting"; }
+};
+
+std::vector<String> lookup(IndexedDatabaseDriver &driver,
+                           const String &collection, const String &field,
+                           const String &value) {
+  std::vector<String> keys;
+  driver.lookupIndex(collection, field, value, keys);
+  return keys;
+}
+
+} // namespace
+
+void test_indexed_driver_lookup_finds_stored_keys(void) {
+  IndexedDatabaseDriver driver(
+      std::unique_ptr<IDatabaseDriver>(new CountingDriver()));
+  driver.addIndex("sessions", "userId");
+
+  driver.store("sessions", "s1", "{\"userId\":\"u1\"}");
+  driver.store("sessions", "s2", "{\"userId\":\"u2\"}");
+  driver.store("sessions", "s3", "{\"userId\":\"u1\"}");
+
+  std::vector<String> keys = lookup(driver, "sessions", "userId", "u1");
+  TEST_ASSERT_EQUAL(2, keys.size());
+  TEST_ASSERT_EQUAL_STRING("s1", keys[0].c_str());
+  TEST_ASSERT_EQUAL_STRING("s3", keys[1].c_str());
+  TEST_ASSERT_EQUAL(0, lookup(driver, "sessions", "userId", "u9").size());
+}
+
+void test_indexed_driver_update_and_remove_maintain_index(void) {
+  IndexedDatabaseDriver driver(
+      std::unique_ptr<IDatabaseDriver>(new CountingDriver()));
+  driver.addIndex("sessions", "userId");
+
+  driver.store("sessions", "s1", "{\"userId\":\"u1\"}");
+  driver.store("sessions", "s1", "{\"userId\":\"u2\"}");
+  TEST_ASSERT_EQUAL(0, lookup(driver, "sessions", "userId", "u1").size());
+  TEST_ASSERT_EQUAL(1, lookup(driver, "sessions", "userId", "u2").size());
+
+  TEST_ASSERT_TRUE(driver.remove("sessions", "s1"));
+  TEST_ASSERT_EQUAL(0, lookup(driver, "sessions", "userId", "u2").size());
+}
+
+void test_indexed_driver_indexes_non_string_values_as_text(void) {
+  IndexedDatabaseDriver driver(
+      std::unique_ptr<IDatabaseDriver>(new CountingDriver()));
+  driver.addIndex("items", "qty");
+  driver.addIndex("items", "active");
+
+  driver.store("items", "a", "{\"qty\":5,\"active\":true}");
+  driver.store("items", "b", "{\"name\":\"no fields\"}");
+
+  TEST_ASSERT_EQUAL(1, lookup(driver, "items", "qty", "5").size());
+  TEST_ASSERT_EQUAL(1, lookup(driver, "items", "active", "true").size());
+}
+
+void test_indexed_driver_unindexed_field_reports_no_index(void) {
+  IndexedDatabaseDriver driver(
+      std::unique_ptr<IDatabaseDriver>(new CountingDriver()));
+  driver.addIndex("sessions", "userId");
+
+  std::vector<String> keys;
+  TEST_ASSERT_TRUE(driver.hasIndex("sessions", "userId"));
+  TEST_ASSERT_FALSE(driver.hasIndex("sessions", "token"));
+  TEST_ASSERT_FALSE(driver.lookupIndex("sessions", "token", "x", keys));
+  TEST_ASSERT_FALSE(driver.lookupIndex("users", "userId", "x", keys));
+}
+
+void test_indexed_driver_persists_index_record(void) {
+  {
+    IndexedDatabaseDriver driver(
+        std::unique_ptr<IDatabaseDriver>(new JsonDatabaseDriver()));
+    driver.addIndex("sessions", "userId");
+    driver.store("sessions", "s1", "{\"userId\":\"u1\"}");
+  }
+
+  // A fresh instance (as after a reboot) loads the stored index
+  JsonDatabaseDriver inner;
+  String record = inner.retrieve(IndexedDatabaseDriver::INDEX_COLLECTION,
+                                 "sessions.userId");
+  // Written ahead of the record, so s1 is still listed as pending
+  TEST_ASSERT_EQUAL_STRING("{\"n\":1,\"v\":{\"u1\":[\"s1\"]},\"p\":[\"s1\"]}",
+                           record.c_str());
+
+  IndexedDatabaseDriver driver(
+      std::unique_ptr<IDatabaseDriver>(new JsonDatabaseDriver()));
+  driver.addIndex("sessions", "userId");
+  TEST_ASSERT_EQUAL(1, lookup(driver, "sessions", "userId", "u1").size());
+}
+
+void test_indexed_driver_rebuilds_stale_index(void) {
+  CountingDriver *inner = new CountingDriver();
+  // Written before the index existed
+  inner->store("sessions", "s1", "{\"userId\":\"u1\"}");
+  inner->store("sessions", "s2", "{\"userId\":\"u1\"}");
+
+  IndexedDatabaseDriver driver{std::unique_ptr<IDatabaseDriver>(inner)};
+  driver.addIndex("sessions", "userId");
+
+  TEST_ASSERT_EQUAL(2, lookup(driver, "sessions", "userId", "u1").size());
+  TEST_ASSERT_EQUAL(1, inner->scans);
+
+  // Records written behind the index's back make the count disagree
+  inner->store("sessions", "s3", "{\"userId\":\"u1\"}");
+  IndexedDatabaseDriver reloaded{std::unique_ptr<IDatabaseDriver>(
+      new CountingDriver(*inner))};
+  reloaded.addIndex("sessions", "userId");
+  TEST_ASSERT_EQUAL(3, lookup(reloaded, "sessions", "userId", "u1").size());
+}
+
+void test_indexed_driver_settles_interrupted_update(void) {
+  CountingDriver *inner = new CountingDriver();
+  IndexedDatabaseDriver driver{std::unique_ptr<IDatabaseDriver>(inner)};
+  driver.addIndex("sessions", "userId");
+  driver.store("sessions", "s1", "{\"userId\":\"u1\"}");
+
+  // Power lost right after the data write - the record count is
+  // unchanged, so only the pending key gives the change away
+  inner->powerLossAfterDataWrite = true;
+  driver.store("sessions", "s1", "{\"userId\":\"u2\"}");
+
+  CountingDriver *copy = new CountingDriver(*inner);
+  IndexedDatabaseDriver reloaded{std::unique_ptr<IDatabaseDriver>(copy)};
+  reloaded.addIndex("sessions", "userId");
+  TEST_ASSERT_EQUAL(0, lookup(reloaded, "sessions", "userId", "u1").size());
+  TEST_ASSERT_EQUAL(1, lookup(reloaded, "sessions", "userId", "u2").size());
+  TEST_ASSERT_EQUAL(inner->scans, copy->scans); // Settled, not rebuilt
+}
+
+void test_indexed_driver_keeps_old_value_when_data_write_fails(void) {
+  CountingDriver *inner = new CountingDriver();
+  IndexedDatabaseDriver driver{std::unique_ptr<IDatabaseDriver>(inner)};
+  driver.addIndex("sessions", "userId");
+  driver.store("sessions", "s1", "{\"userId\":\"u1\"}");
+
+  // The index record lands, the data write doesn't
+  inner->failDataWrites = true;
+  TEST_ASSERT_FALSE(driver.store("sessions", "s1", "{\"userId\":\"u2\"}"));
+
+  TEST_ASSERT_EQUAL(1, lookup(driver, "sessions", "userId", "u1").size());
+  TEST_ASSERT_EQUAL(0, lookup(driver, "sessions", "userId", "u2").size());
+
+  IndexedDatabaseDriver reloaded{std::unique_ptr<IDatabaseDriver>(
+      new CountingDriver(*inner))};
+  reloaded.addIndex("sessions", "userId");
+  TEST_ASSERT_EQUAL(1, lookup(reloaded, "sessions", "userId", "u1").size());
+  TEST_ASSERT_EQUAL(0, lookup(reloaded, "sessions", "userId", "u2").size());
+}
+
+void test_indexed_driver_store_writes_indexes_once(void) {
+  IndexedDatabaseDriver driver(
+      std::unique_ptr<IDatabaseDriver>(new JsonDatabaseDriver()));
+  driver.addIndex("api_tokens", "userId");
+  driver.addIndex("api_tokens", "token");
+  driver.store("api_tokens", "t1", "{\"userId\":\"u1\",\"token\":\"a\"}");
+  NativePreferencesFake::writeCount() = 0;
+
+  // One write for the record, one for both index records
+  driver.store("api_tokens", "t2", "{\"userId\":\"u1\",\"token\":\"b\"}");
+  TEST_ASSERT_EQUAL(2, NativePreferencesFake::writeCount());
+  driver.remove("api_tokens", "t1");
+  TEST_ASSERT_EQUAL(4, NativePreferencesFake::writeCount());
+  TEST_ASSERT_EQUAL(1, lookup(driver, "api_tokens", "token", "b").size());
+  TEST_ASSERT_EQUAL(0, lookup(driver, "api_tokens", "token", "a").size());
+}
+
+void test_query_builder_uses_index_for_equality(void) {
+  CountingDriver *inner = new CountingDriver();
+  IndexedDatabaseDriver driver{std::unique_ptr<IDatabaseDriver>(inner)};
+  driver.addIndex("sessions", "userId");
+  for (int i = 0; i < 20; i++) {
+    String userId = String("u") + String(i % 5);
+    driver.store("sessions", String("s") + String(i),
+                 "{\"userId\":\"" + userId + "\",\"n\":" + String(i) + "}");
+  }
+
+  QueryBuilder query(&driver, "sessions");
+  query.where("userId", "u3");
+  TEST_ASSERT_EQUAL_STRING("INDEX userId", query.explain().c_str());
+
+  int scansBefore = inner->scans;
+  inner->retrieves = 0;
+  std::vector<String> results = query.getAll();
+  TEST_ASSERT_EQUAL(4, results.size());
+  TEST_ASSERT_EQUAL(scansBefore, inner->scans);
+  TEST_ASSERT_EQUAL(4, inner->retrieves);
+
+  // Remaining conditions are still applied to index hits
+  QueryBuilder narrowed(&driver, "sessions");
+  narrowed.where("n", ">", 10).where("userId", "u3");
+  TEST_ASSERT_EQUAL_STRING("INDEX userId", narrowed.explain().c_str());
+  TEST_ASSERT_EQUAL(2, narrowed.getAll().size());
+
+  TEST_ASSERT_TRUE(QueryBuilder(&driver, "sessions").where("userId", "u3").remove());
+  TEST_ASSERT_EQUAL(0, QueryBuilder(&driver, "sessions")
+                           .where("userId", "u3")
+                           .getAll()
+                           .size());
+  TEST_ASSERT_EQUAL(16, driver.count("sessions"));
+}
+
+void test_query_builder_index_hits_come_in_key_order(void) {
+  IndexedDatabaseDriver driver(
+      std::unique_ptr<IDatabaseDriver>(new CountingDriver()));
+  driver.addIndex("sessions", "userId");
+  driver.store("sessions", "s3", "{\"userId\":\"u1\"}");
+  driver.store("sessions", "s1", "{\"userId\":\"u1\"}");
+  driver.store("sessions", "s2", "{\"userId\":\"u1\"}");
+
+  std::vector<String> keys;
+  QueryBuilder(&driver, "sessions")
+      .where("userId", "u1")
+      .each([&](const String &key, const String &) {
+        keys.push_back(key);
+        return true;
+      });
+  TEST_ASSERT_EQUAL(3, keys.size());
+  TEST_ASSERT_EQUAL_STRING("s1", keys[0].c_str());
+  TEST_ASSERT_EQUAL_STRING("s3", keys[2].c_str());
+}
+
+void test_query_builder_explain_reports_scan(void) {
+  IndexedDatabaseDriver driver(
+      std::unique_ptr<IDatabaseDriver>(new CountingDriver()));
+  driver.addIndex("sessions", "userId");
+
+  TEST_ASSERT_EQUAL_STRING("SCAN",
+                           QueryBuilder(&driver, "sessions").explain().c_str());
+  TEST_ASSERT_EQUAL_STRING(
+      "SCAN",
+      QueryBuilder(&driver, "sessions").where("token", "t").explain().c_str());
+  TEST_ASSERT_EQUAL_STRING("SCAN", QueryBuilder(&driver, "sessions")
+                                       .where("userId", "!=", "u1")
+                                       .explain()
+                                       .c_str());
+}
+
+void test_storage_manager_declare_index_wraps_driver(void) {
+  CountingDriver *inner = new CountingDriver();
+  StorageManager::configureDriver("indexed",
+                                  std::unique_ptr<IDatabaseDriver>(inner));
+  StorageManager::declareIndex("idx_widgets", "color", "indexed");
+
+  IDatabaseDriver &driver = StorageManager::driver("indexed");
+  TEST_ASSERT_EQUAL_STRING("counting", driver.getDriverName().c_str());
+  TEST_ASSERT_TRUE(driver.hasIndex("idx_widgets", "color"));
+
+  driver.store("idx_widgets", "w1", "{\"color\":\"red\"}");
+  QueryBuilder query(&driver, "idx_widgets");
+  query.where("color", "red");
+  TEST_ASSERT_EQUAL_STRING("INDEX color", query.explain().c_str());
+  TEST_ASSERT_EQUAL(1, query.getAll().size());
+
+  // The declaration carries over to a replacement driver
+  StorageManager::configureDriver(
+      "indexed", std::unique_ptr<IDatabaseDriver>(new CountingDriver()));
+  TEST_ASSERT_TRUE(
+      StorageManager::driver("indexed").hasIndex("idx_widgets", "color"));
+}
+
+void test_indexed_driver_apply_batch_maintains_index(void) {
+  IndexedDatabaseDriver driver(
+      std::unique_ptr<IDatabaseDriver>(new JsonDatabaseDriver()));
+  driver.addIndex("sessions", "userId");
+  driver.store("sessions", "s1", "{\"userId\":\"u1\"}");
+  driver.store("sessions", "s2", "{\"userId\":\"u1\"}");
+  NativePreferencesFake::writeCount() = 0;
+
+  WriteBatch batch(&driver);
+  batch.remove("sessions", "s1")
+      .put("sessions", "s2", "{\"userId\":\"u2\"}")
+      .put("sessions", "s3", "{\"userId\":\"u2\"}");
+  TEST_ASSERT_TRUE(batch.commit());
+
+  // One write for the collection, one for the index records
+  TEST_ASSERT_EQUAL(2, NativePreferencesFake::writeCount());
+  TEST_ASSERT_EQUAL(0, lookup(driver, "sessions", "userId", "u1").size());
+  TEST_ASSERT_EQUAL(2, lookup(driver, "sessions", "userId", "u2").size());
+
+  // Persisted count matches, so a reload uses the record without a rescan
+  IndexedDatabaseDriver reloaded(
+      std::unique_ptr<IDatabaseDriver>(new JsonDatabaseDriver()));
+  reloaded.addIndex("sessions", "userId");
+  TEST_ASSERT_EQUAL(2, lookup(reloaded, "sessions", "userId", "u2").size());
+  TEST_ASSERT_EQUAL(0, lookup(reloaded, "sessions", "userId", "u1").size());
+  TEST_ASSERT_EQUAL(2, NativePreferencesFake::writeCount());
+}
+
+void register_indexed_database_driver_tests(void) {
+  RUN_TEST(test_indexed_driver_lookup_finds_stored_keys);
+  RUN_TEST(test_indexed_driver_update_and_remove_maintain_index);
+  RUN_TEST(test_indexed_driver_indexes_non_string_values_as_text);
+  RUN_TEST(test_indexed_driver_unindexed_field_reports_no_index);
+  RUN_TEST(test_indexed_driver_persists_index_record);
+  RUN_TEST(test_indexed_driver_rebuilds_stale_index);
+  RUN_TEST(test_indexed_driver_settles_interrupted_update);
+  RUN_TEST(test_indexed_driver_keeps_old_value_when_data_write_fails);
+  RUN_TEST(test_indexed_driver_store_writes_indexes_once);
+  RUN_TEST(test_indexed_driver_apply_batch_maintains_index);
+  RUN_TEST(test_query_builder_uses_index_for_equality);
+  RUN_TEST(test_query_builder_index_hits_come_in_key_order);
+  RUN_TEST(test_query_builder_explain_reports_scan);
+  RUN_TEST(test_storage_manager_declare_index_wraps_driver);
+}
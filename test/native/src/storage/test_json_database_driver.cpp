@@ -1,4 +1,6 @@
 #include "storage/json_database_driver.h"
+#include <map>
+#include <Preferences.h>
 #include <unity.h>
 
 void test_json_driver_retrieve_missing_key_returns_empty(void) {
@@ -75,6 +77,175 @@ void test_json_driver_get_driver_name(void) {
   TEST_ASSERT_EQUAL_STRING("json", driver.getDriverName().c_str());
 }
 
+void test_json_driver_for_each_visits_every_record(void) {
+  JsonDatabaseDriver driver;
+  driver.store("users", "u1", "{\"n\":1}");
+  driver.store("users", "u2", "{\"n\":2}");
+
+  std::map<String, String> seen;
+  size_t visited = driver.forEach(
+      "users", [&](const String &key, const String &data) {
+        seen[key] = data;
+        return true;
+      });
+
+  TEST_ASSERT_EQUAL(2, visited);
+  TEST_ASSERT_EQUAL_STRING("{\"n\":1}", seen["u1"].c_str());
+  TEST_ASSERT_EQUAL_STRING("{\"n\":2}", seen["u2"].c_str());
+}
+
+void test_json_driver_for_each_stops_when_callback_returns_false(void) {
+  JsonDatabaseDriver driver;
+  driver.store("users", "u1", "{}");
+  driver.store("users", "u2", "{}");
+  driver.store("users", "u3", "{}");
+
+  size_t visited =
+      driver.forEach("users", [](const String &, const String &) {
+        return false;
+      });
+  TEST_ASSERT_EQUAL(1, visited);
+}
+
+void test_json_driver_count_matches_stored_records(void) {
+  JsonDatabaseDriver driver;
+  TEST_ASSERT_EQUAL(0, driver.count("users"));
+  driver.store("users", "u1", "{}");
+  driver.store("users", "u2", "{}");
+  TEST_ASSERT_EQUAL(2, driver.count("users"));
+  TEST_ASSERT_EQUAL(0, driver.count(""));
+}
+
+void test_json_driver_count_skips_empty_values_like_for_each(void) {
+  JsonDatabaseDriver driver;
+  driver.store("users", "u1", "{}");
+  driver.store("users", "u2", "");
+
+  size_t visited = driver.forEach(
+      "users", [](const String &, const String &) { return true; });
+  TEST_ASSERT_EQUAL(1, visited);
+  TEST_ASSERT_EQUAL(visited, driver.count("users"));
+}
+
+void test_json_driver_apply_batch_writes_each_collection_once(void) {
+  JsonDatabaseDriver driver;
+  driver.store("sessions", "s1", "{}");
+  driver.store("sessions", "s2", "{}");
+  NativePreferencesFake::writeCount() = 0;
+
+  WriteBatch batch(&driver);
+  batch.remove("sessions", "s1")
+      .remove("sessions", "s2")
+      .put("sessions", "s3", "{\"a\":1}")
+      .put("users", "u1", "{}")
+      .put("users", "u2", "{}");
+  TEST_ASSERT_TRUE(batch.commit());
+
+  TEST_ASSERT_EQUAL(2, NativePreferencesFake::writeCount());
+  TEST_ASSERT_EQUAL(1, driver.count("sessions"));
+  TEST_ASSERT_EQUAL(2, driver.count("users"));
+
+  // The single write is what persists - a fresh driver sees the result
+  JsonDatabaseDriver reloaded;
+  TEST_ASSERT_EQUAL_STRING("{\"a\":1}",
+                           reloaded.retrieve("sessions", "s3").c_str());
+  TEST_ASSERT_FALSE(reloaded.exists("sessions", "s1"));
+}
+
+void test_json_driver_apply_batch_skips_write_when_nothing_changes(void) {
+  JsonDatabaseDriver driver;
+  NativePreferencesFake::writeCount() = 0;
+
+  WriteBatch batch(&driver);
+  batch.remove("sessions", "missing");
+  TEST_ASSERT_TRUE(batch.commit());
+  TEST_ASSERT_EQUAL(0, NativePreferencesFake::writeCount());
+}
+
+void test_json_driver_msgpack_collection_roundtrips_through_blob(void) {
+  {
+    JsonDatabaseDriver driver;
+    TEST_ASSERT_TRUE(
+        driver.setRecordFormat("users", RecordFormat::MessagePack));
+    driver.store("users", "u1", "{\"username\":\"alice\"}");
+  }
+
+  auto &nvs = NativePreferencesFake::store()["storage"];
+  TEST_ASSERT_EQUAL(1, nvs.count("~users"));
+  TEST_ASSERT_EQUAL(0, nvs.count("users"));
+
+  // A driver that hasn't been told the format still finds the blob
+  JsonDatabaseDriver reader;
+  TEST_ASSERT_EQUAL_STRING("{\"username\":\"alice\"}",
+                           reader.retrieve("users", "u1").c_str());
+}
+
+void test_json_driver_msgpack_migrates_legacy_text_on_write(void) {
+  NativePreferencesFake::store()["storage"]["sessions"] =
+      "[{\"key\":\"s1\",\"data\":\"{\\\"userId\\\":\\\"u1\\\"}\"}]";
+
+  JsonDatabaseDriver driver;
+  driver.setRecordFormat("sessions", RecordFormat::MessagePack);
+  TEST_ASSERT_EQUAL_STRING("{\"userId\":\"u1\"}",
+                           driver.retrieve("sessions", "s1").c_str());
+  auto &nvs = NativePreferencesFake::store()["storage"];
+  TEST_ASSERT_EQUAL(1, nvs.count("sessions")); // Reads don't migrate
+
+  driver.store("sessions", "s2", "{\"userId\":\"u2\"}");
+  TEST_ASSERT_EQUAL(0, nvs.count("sessions"));
+  TEST_ASSERT_EQUAL(1, nvs.count("~sessions"));
+
+  driver.clearCache();
+  TEST_ASSERT_EQUAL(2, driver.count("sessions"));
+}
+
+void test_json_driver_msgpack_needs_short_collection_name(void) {
+  JsonDatabaseDriver driver;
+  TEST_ASSERT_FALSE(
+      driver.setRecordFormat("fifteen_letters", RecordFormat::MessagePack));
+  TEST_ASSERT_TRUE(driver.getRecordFormat("fifteen_letters") ==
+                   RecordFormat::Json);
+  // Per-record gzip only makes sense for file-backed drivers
+  TEST_ASSERT_FALSE(driver.setRecordFormat("users", RecordFormat::Gzip));
+}
+
+void test_json_driver_scans_key_prefix_and_range(void) {
+  JsonDatabaseDriver driver;
+  driver.store("readings", "reading_20261016_1200", "{\"t\":3}");
+  driver.store("readings", "reading_20261016_1100", "{\"t\":1}");
+  driver.store("readings", "reading_20261016_1130", "{\"t\":2}");
+  driver.store("readings", "reading_20261017_0000", "{\"t\":4}");
+  driver.store("readings", "device:abc:config", "{}");
+
+  String seen;
+  auto collect = [&seen](const String &key, const String &data) {
+    seen += key + ";";
+    return true;
+  };
+
+  // Half-open: the 12:00 reading belongs to the next hour
+  TEST_ASSERT_EQUAL(2, driver.scanRange("readings", "reading_20261016_1100",
+                                        "reading_20261016_1200", collect));
+  TEST_ASSERT_EQUAL_STRING("reading_20261016_1100;reading_20261016_1130;",
+                           seen.c_str());
+
+  seen = "";
+  TEST_ASSERT_EQUAL(3, driver.scanPrefix("readings", "reading_20261016_",
+                                         collect));
+  TEST_ASSERT_EQUAL_STRING(
+      "reading_20261016_1100;reading_20261016_1130;reading_20261016_1200;",
+      seen.c_str());
+
+  // Open-ended range, early stop, no match
+  TEST_ASSERT_EQUAL(2, driver.scanRange("readings", "reading_20261016_1200",
+                                        "", collect));
+  TEST_ASSERT_EQUAL(1, driver.scanPrefix("readings", "",
+                                         [](const String &, const String &) {
+                                           return false;
+                                         }));
+  TEST_ASSERT_EQUAL(0, driver.scanPrefix("readings", "device:xyz:", collect));
+}
+
 void register_json_database_driver_tests(void) {
   RUN_TEST(test_json_driver_retrieve_missing_key_returns_empty);
   RUN_TEST(test_json_driver_store_and_retrieve_roundtrip);
@@ -86,4 +257,14 @@ void register_json_database_driver_tests(void) {
   RUN_TEST(test_json_driver_collections_are_independent);
   RUN_TEST(test_json_driver_persists_across_instances);
   RUN_TEST(test_json_driver_get_driver_name);
+  RUN_TEST(test_json_driver_for_each_visits_every_record);
+  RUN_TEST(test_json_driver_for_each_stops_when_callback_returns_false);
+  RUN_TEST(test_json_driver_count_matches_stored_records);
+  RUN_TEST(test_json_driver_count_skips_empty_values_like_for_each);
+  RUN_TEST(test_json_driver_apply_batch_writes_each_collection_once);
+  RUN_TEST(test_json_driver_apply_batch_skips_write_when_nothing_changes);
+  RUN_TEST(test_json_driver_msgpack_collection_roundtrips_through_blob);
+  RUN_TEST(test_json_driver_msgpack_migrates_legacy_text_on_write);
+  RUN_TEST(test_json_driver_msgpack_needs_short_collection_name);
+  RUN_TEST(test_json_driver_scans_key_prefix_and_range);
 }
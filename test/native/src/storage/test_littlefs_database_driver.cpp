@@ -1,4 +1,7 @@
+#include "core/gzip.h"
 #include "storage/littlefs_database_driver.h"
+#include <LittleFS.h>
+#include <map>
 #include <unity.h>
 
 void test_littlefs_driver_retrieve_missing_key_returns_empty(void) {
@@ -89,10 +92,489 @@ void test_littlefs_driver_remove_collection_removes_all_keys(void) {
   TEST_ASSERT_FALSE(driver.exists("users", "u2"));
 }
 
+void test_littlefs_driver_store_leaves_no_temp_file(void) {
+  LittleFSDatabaseDriver driver("/test_storage");
+  TEST_ASSERT_TRUE(driver.store("users", "u1", "{\"v\":1}"));
+  TEST_ASSERT_TRUE(NativeFsFake::pathExists("/test_storage/users/u1.json"));
+  TEST_ASSERT_FALSE(
+      NativeFsFake::pathExists("/test_storage/users/u1.json.tmp"));
+}
+
+void test_littlefs_driver_startup_discards_interrupted_write(void) {
+  // Simulate a power loss after the temp file was (partially) written but
+  // before it was renamed over the committed record.
+  NativeFsFake::makeDirectory("/test_storage");
+  NativeFsFake::makeDirectory("/test_storage/users");
+  NativeFsFake::writeFile("/test_storage/users/u1.json", "{\"v\":1}");
+  NativeFsFake::writeFile("/test_storage/users/u1.json.tmp", "{\"v\":2");
+
+  LittleFSDatabaseDriver driver("/test_storage");
+  TEST_ASSERT_EQUAL_STRING("{\"v\":1}", driver.retrieve("users", "u1").c_str());
+  TEST_ASSERT_FALSE(
+      NativeFsFake::pathExists("/test_storage/users/u1.json.tmp"));
+}
+
+void test_littlefs_driver_startup_promotes_temp_file_of_removed_record(void) {
+  // Power lost inside commitTempFile's fallback: key.json already removed,
+  // the complete new value still under its temp name
+  NativeFsFake::makeDirectory("/test_storage");
+  NativeFsFake::makeDirectory("/test_storage/users");
+  NativeFsFake::writeFile("/test_storage/users/u1.json.tmp", "{\"v\":2}");
+
+  LittleFSDatabaseDriver driver("/test_storage");
+  TEST_ASSERT_EQUAL_STRING("{\"v\":2}", driver.retrieve("users", "u1").c_str());
+  TEST_ASSERT_TRUE(NativeFsFake::pathExists("/test_storage/users/u1.json"));
+  TEST_ASSERT_FALSE(
+      NativeFsFake::pathExists("/test_storage/users/u1.json.tmp"));
+}
+
+void test_littlefs_driver_recover_reports_removed_temp_files(void) {
+  LittleFSDatabaseDriver driver("/test_storage");
+  driver.store("users", "u1", "{}");
+  NativeFsFake::writeFile("/test_storage/users/u2.json.tmp", "{");
+  NativeFsFake::writeFile("/test_storage/users/u3.json.tmp", "");
+  TEST_ASSERT_EQUAL(2, driver.recoverInterruptedWrites());
+  TEST_ASSERT_EQUAL(1, driver.listKeys("users").size());
+}
+
+void test_littlefs_driver_checksum_roundtrip(void) {
+  LittleFSDatabaseDriver driver("/test_storage");
+  driver.setChecksumEnabled(true);
+  TEST_ASSERT_TRUE(driver.store("users", "u1", "{\"username\":\"alice\"}"));
+
+  std::string raw = NativeFsFake::readFile("/test_storage/users/u1.json");
+  TEST_ASSERT_TRUE(raw.find("\n#crc32:") != std::string::npos);
+
+  driver.clearCache();
+  TEST_ASSERT_EQUAL_STRING("{\"username\":\"alice\"}",
+                           driver.retrieve("users", "u1").c_str());
+}
+
+void test_littlefs_driver_checksum_mismatch_reads_as_missing(void) {
+  LittleFSDatabaseDriver driver("/test_storage");
+  driver.setChecksumEnabled(true);
+  driver.store("users", "u1", "{\"v\":1}");
+
+  // Corrupt the body on "flash" while keeping the original trailer
+  std::string raw = NativeFsFake::readFile("/test_storage/users/u1.json");
+  raw[5] = '9';
+  NativeFsFake::writeFile("/test_storage/users/u1.json", raw);
+
+  driver.clearCache();
+  TEST_ASSERT_EQUAL_STRING("", driver.retrieve("users", "u1").c_str());
+}
+
+void test_littlefs_driver_checksum_accepts_legacy_records(void) {
+  LittleFSDatabaseDriver driver("/test_storage");
+  driver.store("users", "u1", "{\"v\":1}");
+  driver.setChecksumEnabled(true);
+  driver.clearCache();
+  TEST_ASSERT_EQUAL_STRING("{\"v\":1}", driver.retrieve("users", "u1").c_str());
+}
+
+void test_littlefs_driver_for_each_visits_every_record(void) {
+  LittleFSDatabaseDriver driver("/test_storage");
+  driver.store("users", "u1", "{\"n\":1}");
+  driver.store("users", "u2", "{\"n\":2}");
+
+  std::map<String, String> seen;
+  size_t visited = driver.forEach(
+      "users", [&](const String &key, const String &data) {
+        seen[key] = data;
+        return true;
+      });
+
+  TEST_ASSERT_EQUAL(2, visited);
+  TEST_ASSERT_EQUAL_STRING("{\"n\":1}", seen["u1"].c_str());
+  TEST_ASSERT_EQUAL_STRING("{\"n\":2}", seen["u2"].c_str());
+}
+
+void test_littlefs_driver_for_each_stops_when_callback_returns_false(void) {
+  LittleFSDatabaseDriver driver("/test_storage");
+  driver.store("users", "u1", "{}");
+  driver.store("users", "u2", "{}");
+  driver.store("users", "u3", "{}");
+
+  size_t visited =
+      driver.forEach("users", [](const String &, const String &) {
+        return false;
+      });
+  TEST_ASSERT_EQUAL(1, visited);
+}
+
+void test_littlefs_driver_count_ignores_non_record_files(void) {
+  LittleFSDatabaseDriver driver("/test_storage");
+  TEST_ASSERT_EQUAL(0, driver.count("users"));
+  driver.store("users", "u1", "{}");
+  driver.store("users", "u2", "{}");
+  NativeFsFake::writeFile("/test_storage/users/u3.json.tmp", "{");
+  TEST_ASSERT_EQUAL(2, driver.count("users"));
+}
+
+void test_littlefs_driver_apply_batch_applies_final_state(void) {
+  LittleFSDatabaseDriver driver("/test_storage");
+  driver.store("users", "u1", "{\"v\":0}");
+  driver.store("users", "u2", "{}");
+
+  WriteBatch batch(&driver);
+  batch.put("users", "u1", "{\"v\":1}")
+      .put("users", "u1", "{\"v\":2}")
+      .remove("users", "u2")
+      .put("tokens", "t1", "{}");
+  TEST_ASSERT_TRUE(batch.commit());
+
+  TEST_ASSERT_EQUAL_STRING("{\"v\":2}", driver.retrieve("users", "u1").c_str());
+  TEST_ASSERT_FALSE(driver.exists("users", "u2"));
+  TEST_ASSERT_TRUE(driver.exists("tokens", "t1"));
+  TEST_ASSERT_FALSE(
+      NativeFsFake::pathExists("/test_storage/users/u1.json.tmp"));
+  TEST_ASSERT_FALSE(
+      NativeFsFake::pathExists("/test_storage/users/u1.json.staged"));
+  TEST_ASSERT_FALSE(NativeFsFake::pathExists("/test_storage/.batch"));
+}
+
+void test_littlefs_driver_apply_batch_is_all_or_nothing_on_invalid_op(void) {
+  LittleFSDatabaseDriver driver("/test_storage");
+  driver.store("users", "u1", "{\"v\":0}");
+  size_t writesBefore = NativeFsFake::writeCount();
+
+  WriteBatch batch(&driver);
+  batch.put("users", "u1", "{\"v\":1}").put("users", "../escape", "{}");
+  TEST_ASSERT_FALSE(batch.commit());
+
+  TEST_ASSERT_EQUAL(writesBefore, NativeFsFake::writeCount());
+  TEST_ASSERT_EQUAL_STRING("{\"v\":0}", driver.retrieve("users", "u1").c_str());
+}
+
+void test_littlefs_driver_startup_finishes_committed_batch(void) {
+  // Power lost after the batch manifest was committed, with u1 swapped in
+  // but u2's staged value and t1's removal still outstanding
+  {
+    LittleFSDatabaseDriver driver("/test_storage");
+    driver.store("users", "u1", "{\"v\":0}");
+    driver.store("users", "u2", "{\"v\":0}");
+    driver.store("tokens", "t1", "{}");
+  }
+  NativeFsFake::writeFile("/test_storage/users/u1.json", "{\"v\":1}");
+  NativeFsFake::writeFile("/test_storage/users/u2.json.staged", "{\"v\":1}");
+  NativeFsFake::writeFile(
+      "/test_storage/.batch",
+      "[{\"c\":\"users\",\"k\":\"u1\"},{\"c\":\"users\",\"k\":\"u2\"},"
+      "{\"c\":\"tokens\",\"k\":\"t1\",\"r\":1}]");
+
+  LittleFSDatabaseDriver driver("/test_storage");
+  TEST_ASSERT_EQUAL_STRING("{\"v\":1}", driver.retrieve("users", "u1").c_str());
+  TEST_ASSERT_EQUAL_STRING("{\"v\":1}", driver.retrieve("users", "u2").c_str());
+  TEST_ASSERT_FALSE(driver.exists("tokens", "t1"));
+  TEST_ASSERT_FALSE(NativeFsFake::pathExists("/test_storage/.batch"));
+  TEST_ASSERT_FALSE(
+      NativeFsFake::pathExists("/test_storage/users/u2.json.staged"));
+}
+
+void test_littlefs_driver_startup_drops_uncommitted_batch(void) {
+  // Power lost while staging - no manifest, so none of the batch applies,
+  // not even a value for a key that didn't exist yet
+  {
+    LittleFSDatabaseDriver driver("/test_storage");
+    driver.store("users", "u1", "{\"v\":0}");
+  }
+  NativeFsFake::writeFile("/test_storage/users/u1.json.staged", "{\"v\":1}");
+  NativeFsFake::writeFile("/test_storage/users/u9.json.staged", "{\"v\":1}");
+  NativeFsFake::writeFile("/test_storage/.batch.tmp", "[{\"c\":");
+
+  LittleFSDatabaseDriver driver("/test_storage");
+  TEST_ASSERT_EQUAL_STRING("{\"v\":0}", driver.retrieve("users", "u1").c_str());
+  TEST_ASSERT_FALSE(driver.exists("users", "u9"));
+  TEST_ASSERT_FALSE(
+      NativeFsFake::pathExists("/test_storage/users/u9.json.staged"));
+  TEST_ASSERT_FALSE(NativeFsFake::pathExists("/test_storage/.batch.tmp"));
+}
+
+namespace {
+// A spec-shaped document well past the compression threshold
+String makeSpec() {
+  String spec = "{\"openapi\":\"3.0.0\",\"paths\":{";
+  char path[96];
+  for (int i = 0; i < 40; i++) {
+    snprintf(path, sizeof(path),
+             "%s\"/api/item%d\":{\"get\":{\"summary\":\"Get item %d\"}}",
+             i ? "," : "", i, i);
+    spec += path;
+  }
+  spec += "}}";
+  return spec;
+}
+} // namespace
+
+void test_littlefs_driver_gzip_collection_roundtrip(void) {
+  LittleFSDatabaseDriver driver("/test_storage");
+  TEST_ASSERT_TRUE(driver.setRecordFormat("openapi", RecordFormat::Gzip));
+  TEST_ASSERT_FALSE(
+      driver.setRecordFormat("openapi", RecordFormat::MessagePack));
+
+  String spec = makeSpec();
+  TEST_ASSERT_TRUE(driver.store("openapi", "spec", spec));
+  TEST_ASSERT_TRUE(driver.store("openapi", "tiny", "{\"v\":1}"));
+
+  std::string raw = NativeFsFake::readFile("/test_storage/openapi/spec.json");
+  TEST_ASSERT_TRUE(WebPlatform::Core::Gzip::isGzip(
+      reinterpret_cast<const uint8_t *>(raw.data()), raw.size()));
+  TEST_ASSERT_TRUE(raw.size() < spec.length() / 2);
+  TEST_ASSERT_EQUAL(raw.size(), driver.compressedSize("openapi", "spec"));
+
+  // Below the threshold records stay plain
+  TEST_ASSERT_EQUAL(0, driver.compressedSize("openapi", "tiny"));
+  TEST_ASSERT_EQUAL_STRING(
+      "{\"v\":1}",
+      NativeFsFake::readFile("/test_storage/openapi/tiny.json").c_str());
+
+  driver.clearCache();
+  TEST_ASSERT_EQUAL_STRING(spec.c_str(),
+                           driver.retrieve("openapi", "spec").c_str());
+  TEST_ASSERT_EQUAL(2, driver.count("openapi"));
+}
+
+void test_littlefs_driver_stream_compressed_yields_stored_gzip(void) {
+  LittleFSDatabaseDriver driver("/test_storage");
+  driver.setRecordFormat("openapi", RecordFormat::Gzip);
+  String spec = makeSpec();
+  driver.store("openapi", "spec", spec);
+  driver.store("plain", "spec", spec);
+
+  std::string streamed;
+  size_t chunks = 0;
+  TEST_ASSERT_TRUE(driver.streamCompressed(
+      "openapi", "spec", [&](const uint8_t *data, size_t length) {
+        streamed.append(reinterpret_cast<const char *>(data), length);
+        chunks++;
+        return true;
+      }));
+  TEST_ASSERT_TRUE(streamed ==
+                   NativeFsFake::readFile("/test_storage/openapi/spec.json"));
+
+  std::string inflated;
+  TEST_ASSERT_TRUE(WebPlatform::Core::Gzip::decompress(
+      reinterpret_cast<const uint8_t *>(streamed.data()), streamed.size(),
+      inflated));
+  TEST_ASSERT_EQUAL_STRING(spec.c_str(), inflated.c_str());
+
+  // Uncompressed and missing records have nothing to stream
+  auto ignore = [](const uint8_t *, size_t) { return true; };
+  TEST_ASSERT_FALSE(driver.streamCompressed("plain", "spec", ignore));
+  TEST_ASSERT_FALSE(driver.streamCompressed("openapi", "missing", ignore));
+}
+
+void test_littlefs_driver_read_range_seeks_into_records(void) {
+  LittleFSDatabaseDriver driver("/test_storage");
+  driver.setChecksumEnabled(true);
+  driver.setRecordFormat("openapi", RecordFormat::Gzip);
+  String spec = makeSpec();
+  driver.store("logs", "day1", spec);
+  driver.store("openapi", "spec", spec);
+  driver.clearCache();
+
+  auto readPart = [&driver](const char *collection, const char *key,
+                            size_t offset, size_t length, std::string &out) {
+    out.clear();
+    return driver.readRange(collection, key, offset, length,
+                            [&out](const uint8_t *data, size_t size) {
+                              out.append(reinterpret_cast<const char *>(data),
+                                         size);
+                              return true;
+                            });
+  };
+  std::string full(spec.c_str());
+  std::string part;
+
+  // Plain record with a checksum trailer - the trailer isn't record data
+  TEST_ASSERT_EQUAL(spec.length(), driver.recordLength("logs", "day1"));
+  TEST_ASSERT_TRUE(readPart("logs", "day1", 100, 1000, part));
+  TEST_ASSERT_TRUE(part == full.substr(100, 1000));
+  TEST_ASSERT_TRUE(readPart("logs", "day1", full.size() - 5, 100, part));
+  TEST_ASSERT_TRUE(part == full.substr(full.size() - 5));
+  TEST_ASSERT_FALSE(readPart("logs", "day1", full.size(), 10, part));
+
+  // Gzip records report and serve their inflated bytes
+  TEST_ASSERT_EQUAL(spec.length(), driver.recordLength("openapi", "spec"));
+  TEST_ASSERT_TRUE(readPart("openapi", "spec", 10, 20, part));
+  TEST_ASSERT_TRUE(part == full.substr(10, 20));
+
+  TEST_ASSERT_EQUAL(0, driver.recordLength("logs", "missing"));
+  TEST_ASSERT_FALSE(driver.readRange(
+      "logs", "missing", 0, 10, [](const uint8_t *, size_t) { return true; }));
+}
+
+void test_littlefs_driver_gzip_corruption_reads_as_missing(void) {
+  LittleFSDatabaseDriver driver("/test_storage");
+  driver.setRecordFormat("openapi", RecordFormat::Gzip);
+  driver.store("openapi", "spec", makeSpec());
+
+  std::string raw = NativeFsFake::readFile("/test_storage/openapi/spec.json");
+  raw[raw.size() / 2] ^= 0x01;
+  NativeFsFake::writeFile("/test_storage/openapi/spec.json", raw);
+
+  driver.clearCache();
+  TEST_ASSERT_EQUAL_STRING("", driver.retrieve("openapi", "spec").c_str());
+}
+
+void test_littlefs_driver_format_switch_keeps_records_readable(void) {
+  LittleFSDatabaseDriver driver("/test_storage");
+  String spec = makeSpec();
+  driver.store("openapi", "old", spec);
+
+  driver.setRecordFormat("openapi", RecordFormat::Gzip);
+  driver.store("openapi", "new", spec);
+  WriteBatch batch(&driver);
+  batch.put("openapi", "batched", spec);
+  TEST_ASSERT_TRUE(batch.commit());
+
+  TEST_ASSERT_EQUAL(0, driver.compressedSize("openapi", "old"));
+  TEST_ASSERT_TRUE(driver.compressedSize("openapi", "new") > 0);
+  TEST_ASSERT_TRUE(driver.compressedSize("openapi", "batched") > 0);
+
+  driver.setRecordFormat("openapi", RecordFormat::Json);
+  driver.clearCache();
+  size_t visited = driver.forEach(
+      "openapi", [&](const String &key, const String &data) {
+        TEST_ASSERT_EQUAL_STRING(spec.c_str(), data.c_str());
+        return true;
+      });
+  TEST_ASSERT_EQUAL(3, visited);
+}
+
+void test_littlefs_driver_sharding_spreads_records_over_subdirectories(void) {
+  LittleFSDatabaseDriver driver("/test_storage");
+  driver.setShardingEnabled(true);
+  for (int i = 0; i < 20; i++) {
+    TEST_ASSERT_TRUE(driver.store("users", "u" + String(i), "{}"));
+  }
+
+  TEST_ASSERT_FALSE(NativeFsFake::pathExists("/test_storage/users/u1.json"));
+  std::vector<std::string> shards =
+      NativeFsFake::immediateChildren("/test_storage/users");
+  TEST_ASSERT_TRUE(shards.size() > 1);
+  for (const std::string &shard : shards) {
+    TEST_ASSERT_TRUE(NativeFsFake::isDirectory(shard));
+  }
+
+  // A fresh instance finds them all again
+  LittleFSDatabaseDriver reloaded("/test_storage");
+  reloaded.setShardingEnabled(true);
+  TEST_ASSERT_EQUAL(20, reloaded.count("users"));
+  TEST_ASSERT_EQUAL_STRING("{}", reloaded.retrieve("users", "u7").c_str());
+  TEST_ASSERT_TRUE(reloaded.removeCollection("users"));
+  TEST_ASSERT_FALSE(NativeFsFake::pathExists("/test_storage/users"));
+}
+
+void test_littlefs_driver_key_directory_answers_without_filesystem(void) {
+  LittleFSDatabaseDriver driver("/test_storage");
+  driver.store("users", "u1", "{}");
+  driver.store("users", "u2", "{}");
+  driver.exists("users", "u1"); // Warm up
+
+  size_t lookupsBefore = NativeFsFake::lookupCount();
+  TEST_ASSERT_TRUE(driver.exists("users", "u2"));
+  TEST_ASSERT_FALSE(driver.exists("users", "nobody"));
+  TEST_ASSERT_EQUAL(2, driver.listKeys("users").size());
+  TEST_ASSERT_EQUAL(2, driver.count("users"));
+  TEST_ASSERT_EQUAL_STRING("", driver.retrieve("users", "nobody").c_str());
+  TEST_ASSERT_FALSE(driver.remove("users", "nobody"));
+  TEST_ASSERT_EQUAL(lookupsBefore, NativeFsFake::lookupCount());
+
+  // Kept current by store/remove and batches
+  driver.remove("users", "u1");
+  WriteBatch batch(&driver);
+  batch.put("users", "u3", "{}").remove("users", "u2");
+  TEST_ASSERT_TRUE(batch.commit());
+  std::vector<String> keys = driver.listKeys("users");
+  TEST_ASSERT_EQUAL(1, keys.size());
+  TEST_ASSERT_EQUAL_STRING("u3", keys[0].c_str());
+}
+
+void test_littlefs_driver_moves_records_when_sharding_changes(void) {
+  {
+    LittleFSDatabaseDriver flat("/test_storage");
+    flat.store("users", "u1", "{\"v\":1}");
+    flat.store("users", "u2", "{\"v\":2}");
+  }
+
+  LittleFSDatabaseDriver driver("/test_storage");
+  driver.setShardingEnabled(true);
+  // Written under the new layout before the collection was loaded
+  driver.store("users", "u2", "{\"v\":3}");
+
+  TEST_ASSERT_EQUAL(2, driver.count("users"));
+  TEST_ASSERT_FALSE(NativeFsFake::pathExists("/test_storage/users/u1.json"));
+  TEST_ASSERT_FALSE(NativeFsFake::pathExists("/test_storage/users/u2.json"));
+  driver.clearCache();
+  TEST_ASSERT_EQUAL_STRING("{\"v\":1}", driver.retrieve("users", "u1").c_str());
+  TEST_ASSERT_EQUAL_STRING("{\"v\":3}", driver.retrieve("users", "u2").c_str());
+
+  // And back again
+  driver.setShardingEnabled(false);
+  TEST_ASSERT_EQUAL(2, driver.count("users"));
+  TEST_ASSERT_TRUE(NativeFsFake::pathExists("/test_storage/users/u1.json"));
+  std::vector<std::string> entries =
+      NativeFsFake::immediateChildren("/test_storage/users");
+  TEST_ASSERT_EQUAL(2, entries.size()); // Empty shards are removed
+}
+
+void test_littlefs_driver_sharded_startup_discards_interrupted_write(void) {
+  {
+    LittleFSDatabaseDriver driver("/test_storage");
+    driver.setShardingEnabled(true);
+    driver.store("users", "u1", "{}");
+  }
+  std::string shard = NativeFsFake::immediateChildren("/test_storage/users")[0];
+  NativeFsFake::writeFile(shard + "/u9.json.tmp", "{");
+
+  LittleFSDatabaseDriver driver("/test_storage");
+  driver.setShardingEnabled(true);
+  TEST_ASSERT_EQUAL(1, driver.count("users"));
+  TEST_ASSERT_FALSE(NativeFsFake::pathExists(shard + "/u9.json.tmp"));
+}
+
+void test_littlefs_driver_range_scan_opens_only_matching_records(void) {
+  LittleFSDatabaseDriver driver("/test_storage");
+  for (int hour = 10; hour < 20; hour++) {
+    driver.store("readings", "reading_20261016_" + String(hour) + "00",
+                 "{\"hour\":" + String(hour) + "}");
+  }
+  driver.count("readings"); // Warm up the key directory
+
+  size_t lookupsBefore = NativeFsFake::lookupCount();
+  String seen;
+  size_t visited = driver.scanRange(
+      "readings", "reading_20261016_1300", "reading_20261016_1600",
+      [&seen](const String &key, const String &data) {
+        seen += data;
+        return true;
+      });
+  TEST_ASSERT_EQUAL(3, visited);
+  TEST_ASSERT_EQUAL_STRING("{\"hour\":13}{\"hour\":14}{\"hour\":15}",
+                           seen.c_str());
+  TEST_ASSERT_EQUAL(lookupsBefore + 3, NativeFsFake::lookupCount());
+
+  // Same order with the records spread over shard directories
+  driver.setShardingEnabled(true);
+  seen = "";
+  TEST_ASSERT_EQUAL(2, driver.scanPrefix("readings", "reading_20261016_1",
+                                         [&seen](const String &key,
+                                                 const String &data) {
+                                           seen += data;
+                                           return key < "reading_20261016_11";
+                                         }));
+  TEST_ASSERT_EQUAL_STRING("{\"hour\":10}{\"hour\":11}", seen.c_str());
+}
+
 void register_littlefs_database_driver_tests(void) {
   RUN_TEST(test_littlefs_driver_retrieve_missing_key_returns_empty);
   RUN_TEST(test_littlefs_driver_store_and_retrieve_roundtrip);
   RUN_TEST(test_littlefs_driver_rejects_invalid_names);
+  RUN_TEST(test_littlefs_driver_apply_batch_applies_final_state);
+  RUN_TEST(test_littlefs_driver_apply_batch_is_all_or_nothing_on_invalid_op);
+  RUN_TEST(test_littlefs_driver_startup_finishes_committed_batch);
+  RUN_TEST(test_littlefs_driver_startup_drops_uncommitted_batch);
   RUN_TEST(test_littlefs_driver_exists_reflects_stored_keys);
   RUN_TEST(test_littlefs_driver_remove_deletes_key);
   RUN_TEST(test_littlefs_driver_remove_missing_key_returns_false);
@@ -101,4 +583,24 @@ void register_littlefs_database_driver_tests(void) {
   RUN_TEST(test_littlefs_driver_overwrite_replaces_content);
   RUN_TEST(test_littlefs_driver_get_driver_name);
   RUN_TEST(test_littlefs_driver_remove_collection_removes_all_keys);
+  RUN_TEST(test_littlefs_driver_store_leaves_no_temp_file);
+  RUN_TEST(test_littlefs_driver_startup_discards_interrupted_write);
+  RUN_TEST(test_littlefs_driver_startup_promotes_temp_file_of_removed_record);
+  RUN_TEST(test_littlefs_driver_recover_reports_removed_temp_files);
+  RUN_TEST(test_littlefs_driver_checksum_roundtrip);
+  RUN_TEST(test_littlefs_driver_checksum_mismatch_reads_as_missing);
+  RUN_TEST(test_littlefs_driver_checksum_accepts_legacy_records);
+  RUN_TEST(test_littlefs_driver_for_each_visits_every_record);
+  RUN_TEST(test_littlefs_driver_for_each_stops_when_callback_returns_false);
+  RUN_TEST(test_littlefs_driver_count_ignores_non_record_files);
+  RUN_TEST(test_littlefs_driver_gzip_collection_roundtrip);
+  RUN_TEST(test_littlefs_driver_stream_compressed_yields_stored_gzip);
+  RUN_TEST(test_littlefs_driver_read_range_seeks_into_records);
+  RUN_TEST(test_littlefs_driver_gzip_corruption_reads_as_missing);
+  RUN_TEST(test_littlefs_driver_format_switch_keeps_records_readable);
+  RUN_TEST(test_littlefs_driver_sharding_spreads_records_over_subdirectories);
+  RUN_TEST(test_littlefs_driver_key_directory_answers_without_filesystem);
+  RUN_TEST(test_littlefs_driver_moves_records_when_sharding_changes);
+  RUN_TEST(test_littlefs_driver_sharded_startup_discards_interrupted_write);
+  RUN_TEST(test_littlefs_driver_range_scan_opens_only_matching_records);
 }
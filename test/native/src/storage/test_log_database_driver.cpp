@@ -0,0 +1,208 @@
+#include "storage/log_database_driver.h"
+#include "storage/storage_manager.h"
+#include "storage/write_batch.h"
+#include <LittleFS.h>
+#include <unity.h>
+
+namespace {
+const char SEGMENT_PATH[] = "/test_log/00000001.log";
+
+// Chop bytes off the end of a segment, as a power loss mid-append would
+void truncateSegment(const char *path, size_t bytes) {
+  std::string content = NativeFsFake::readFile(path);
+  NativeFsFake::writeFile(path, content.substr(0, content.size() - bytes));
+}
+} // namespace
+
+void test_log_driver_store_and_retrieve_roundtrip(void) {
+  LogDatabaseDriver driver("/test_log");
+  TEST_ASSERT_TRUE(driver.store("users", "u1", "{\"username\":\"alice\"}"));
+  TEST_ASSERT_TRUE(driver.store("users", "u1", "{\"username\":\"bob\"}"));
+  TEST_ASSERT_EQUAL_STRING("{\"username\":\"bob\"}",
+                           driver.retrieve("users", "u1").c_str());
+  TEST_ASSERT_EQUAL_STRING("", driver.retrieve("users", "nobody").c_str());
+  TEST_ASSERT_FALSE(driver.store("", "u1", "{}"));
+  TEST_ASSERT_FALSE(driver.store("users", "", "{}"));
+}
+
+void test_log_driver_remove_appends_tombstone(void) {
+  LogDatabaseDriver driver("/test_log");
+  driver.store("users", "u1", "{}");
+  TEST_ASSERT_TRUE(driver.remove("users", "u1"));
+  TEST_ASSERT_FALSE(driver.exists("users", "u1"));
+  TEST_ASSERT_FALSE(driver.remove("users", "u1"));
+  TEST_ASSERT_EQUAL(0, driver.count("users"));
+  TEST_ASSERT_EQUAL(1, driver.getSegmentCount());
+}
+
+void test_log_driver_rebuilds_index_at_mount(void) {
+  {
+    LogDatabaseDriver driver("/test_log");
+    driver.store("users", "u1", "{\"v\":1}");
+    driver.store("users", "u2", "{\"v\":2}");
+    driver.store("users", "u1", "{\"v\":3}");
+    driver.remove("users", "u2");
+    driver.store("sessions", "s1", "{}");
+  }
+
+  LogDatabaseDriver remounted("/test_log");
+  TEST_ASSERT_EQUAL_STRING("{\"v\":3}",
+                           remounted.retrieve("users", "u1").c_str());
+  TEST_ASSERT_FALSE(remounted.exists("users", "u2"));
+  TEST_ASSERT_EQUAL(1, remounted.count("users"));
+  TEST_ASSERT_EQUAL(1, remounted.count("sessions"));
+  TEST_ASSERT_TRUE(remounted.getDeadBytes() > 0);
+}
+
+void test_log_driver_torn_append_is_dropped_and_writes_resume(void) {
+  {
+    LogDatabaseDriver driver("/test_log");
+    driver.store("users", "u1", "{\"v\":1}");
+    driver.store("users", "u2", "{\"v\":2}");
+  }
+  truncateSegment(SEGMENT_PATH, 3);
+
+  {
+    LogDatabaseDriver driver("/test_log");
+    TEST_ASSERT_EQUAL_STRING("{\"v\":1}",
+                             driver.retrieve("users", "u1").c_str());
+    TEST_ASSERT_FALSE(driver.exists("users", "u2"));
+    // The damaged segment is sealed; new writes go to a fresh one
+    TEST_ASSERT_TRUE(driver.store("users", "u3", "{\"v\":3}"));
+    TEST_ASSERT_EQUAL(2, driver.getSegmentCount());
+  }
+
+  LogDatabaseDriver remounted("/test_log");
+  TEST_ASSERT_TRUE(remounted.exists("users", "u1"));
+  TEST_ASSERT_EQUAL_STRING("{\"v\":3}",
+                           remounted.retrieve("users", "u3").c_str());
+}
+
+void test_log_driver_apply_batch_replays_all_or_nothing(void) {
+  {
+    LogDatabaseDriver driver("/test_log");
+    driver.store("users", "u1", "{\"v\":1}");
+    size_t writesBefore = NativeFsFake::writeCount();
+
+    WriteBatch batch(&driver);
+    batch.put("users", "u2", "{\"v\":2}")
+        .put("sessions", "s1", "{}")
+        .remove("users", "u1")
+        .remove("users", "missing");
+    TEST_ASSERT_TRUE(batch.commit());
+    TEST_ASSERT_EQUAL(writesBefore + 1, NativeFsFake::writeCount());
+    TEST_ASSERT_FALSE(driver.exists("users", "u1"));
+    TEST_ASSERT_EQUAL_STRING("{\"v\":2}",
+                             driver.retrieve("users", "u2").c_str());
+  }
+
+  {
+    LogDatabaseDriver driver("/test_log");
+    TEST_ASSERT_FALSE(driver.exists("users", "u1"));
+    TEST_ASSERT_TRUE(driver.exists("users", "u2"));
+    TEST_ASSERT_TRUE(driver.exists("sessions", "s1"));
+  }
+
+  // A torn frame loses the whole batch, not just its tail
+  truncateSegment(SEGMENT_PATH, 2);
+  LogDatabaseDriver remounted("/test_log");
+  TEST_ASSERT_TRUE(remounted.exists("users", "u1"));
+  TEST_ASSERT_FALSE(remounted.exists("users", "u2"));
+  TEST_ASSERT_FALSE(remounted.exists("sessions", "s1"));
+}
+
+void test_log_driver_for_each_visits_latest_values(void) {
+  LogDatabaseDriver driver("/test_log", 64);
+  driver.store("users", "u1", "{\"v\":1}");
+  driver.store("users", "u2", "{\"v\":2}");
+  driver.store("users", "u1", "{\"v\":11}");
+  driver.store("other", "o1", "{}");
+  TEST_ASSERT_TRUE(driver.getSegmentCount() > 1);
+
+  std::map<String, String> seen;
+  size_t visited = driver.forEach("users", [&](const String &key,
+                                               const String &data) {
+    seen[key] = data;
+    return true;
+  });
+  TEST_ASSERT_EQUAL(2, visited);
+  TEST_ASSERT_EQUAL_STRING("{\"v\":11}", seen["u1"].c_str());
+  TEST_ASSERT_EQUAL_STRING("{\"v\":2}", seen["u2"].c_str());
+}
+
+void test_log_driver_scans_keys_in_order(void) {
+  LogDatabaseDriver driver("/test_log", 64);
+  driver.store("users", "u3", "{\"v\":3}");
+  driver.store("users", "u1", "{\"v\":1}");
+  driver.store("users", "u2", "{\"v\":2}");
+  driver.store("users", "u1", "{\"v\":11}");
+  driver.store("users", "x1", "{}");
+
+  String seen;
+  auto collect = [&seen](const String &key, const String &data) {
+    seen += key + "=" + data + ";";
+    return true;
+  };
+  TEST_ASSERT_EQUAL(3, driver.scanPrefix("users", "u", collect));
+  TEST_ASSERT_EQUAL_STRING("u1={\"v\":11};u2={\"v\":2};u3={\"v\":3};",
+                           seen.c_str());
+
+  seen = "";
+  TEST_ASSERT_EQUAL(1, driver.scanRange("users", "u2", "u3", collect));
+  TEST_ASSERT_EQUAL_STRING("u2={\"v\":2};", seen.c_str());
+}
+
+void test_log_driver_maintain_compacts_dead_segments(void) {
+  LogDatabaseDriver driver("/test_log", 256);
+  char value[32];
+  for (int round = 0; round < 40; round++) {
+    for (int k = 0; k < 4; k++) {
+      snprintf(value, sizeof(value), "{\"round\":%d}", round);
+      driver.store("counters", String("c") + String(k), value);
+    }
+  }
+  driver.store("counters", "gone", "{}");
+  driver.remove("counters", "gone");
+
+  TEST_ASSERT_TRUE(driver.needsCompaction());
+  size_t segmentsBefore = driver.getSegmentCount();
+  size_t bytesBefore = driver.getTotalBytes();
+
+  for (int i = 0; i < 100 && driver.needsCompaction(); i++) {
+    driver.maintain();
+  }
+  TEST_ASSERT_FALSE(driver.needsCompaction());
+  TEST_ASSERT_TRUE(driver.getSegmentCount() < segmentsBefore);
+  TEST_ASSERT_TRUE(driver.getTotalBytes() < bytesBefore);
+
+  LogDatabaseDriver remounted("/test_log", 256);
+  TEST_ASSERT_EQUAL(4, remounted.count("counters"));
+  TEST_ASSERT_EQUAL_STRING("{\"round\":39}",
+                           remounted.retrieve("counters", "c2").c_str());
+  TEST_ASSERT_FALSE(remounted.exists("counters", "gone"));
+}
+
+void test_log_driver_registers_with_storage_manager(void) {
+  StorageManager::configureDriver(
+      "log",
+      std::unique_ptr<IDatabaseDriver>(new LogDatabaseDriver("/test_log")));
+  StorageManager::driver("log").store("events", "e1", "{\"type\":\"boot\"}");
+
+  QueryBuilder query(&StorageManager::driver("log"), "events");
+  TEST_ASSERT_EQUAL(1, query.where("type", "boot").getAll().size());
+  StorageManager::maintain();
+  TEST_ASSERT_EQUAL_STRING(
+      "log", StorageManager::driver("log").getDriverName().c_str());
+}
+
+void register_log_database_driver_tests(void) {
+  RUN_TEST(test_log_driver_store_and_retrieve_roundtrip);
+  RUN_TEST(test_log_driver_remove_appends_tombstone);
+  RUN_TEST(test_log_driver_rebuilds_index_at_mount);
+  RUN_TEST(test_log_driver_torn_append_is_dropped_and_writes_resume);
+  RUN_TEST(test_log_driver_apply_batch_replays_all_or_nothing);
+  RUN_TEST(test_log_driver_for_each_visits_latest_values);
+  RUN_TEST(test_log_driver_scans_keys_in_order);
+  RUN_TEST(test_log_driver_maintain_compacts_dead_segments);
+  RUN_TEST(test_log_driver_registers_with_storage_manager);
+}
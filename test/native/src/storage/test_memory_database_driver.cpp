@@ -0,0 +1,146 @@
+#include "storage/memory_database_driver.h"
+#include "storage/storage_manager.h"
+#include <Preferences.h>
+#include <unity.h>
+
+void test_memory_driver_store_and_retrieve_roundtrip(void) {
+  MemoryDatabaseDriver driver;
+  TEST_ASSERT_TRUE(driver.store("tokens", "t1", "{\"ip\":\"10.0.0.5\"}"));
+  TEST_ASSERT_TRUE(driver.store("tokens", "t1", "{\"ip\":\"10.0.0.6\"}"));
+  TEST_ASSERT_EQUAL_STRING("{\"ip\":\"10.0.0.6\"}",
+                           driver.retrieve("tokens", "t1").c_str());
+  TEST_ASSERT_EQUAL_STRING("", driver.retrieve("tokens", "nope").c_str());
+  TEST_ASSERT_EQUAL(1, driver.getRecordCount());
+  TEST_ASSERT_EQUAL(2 + 17, driver.getUsedBytes());
+
+  TEST_ASSERT_TRUE(driver.remove("tokens", "t1"));
+  TEST_ASSERT_FALSE(driver.remove("tokens", "t1"));
+  TEST_ASSERT_EQUAL(0, driver.getUsedBytes());
+  TEST_ASSERT_FALSE(driver.store("", "t1", "{}"));
+  TEST_ASSERT_FALSE(driver.store("tokens", "", "{}"));
+}
+
+void test_memory_driver_evicts_least_recently_used(void) {
+  MemoryDatabaseDriver driver(3, 1024);
+  driver.store("tokens", "a", "{}");
+  driver.store("tokens", "b", "{}");
+  driver.store("other", "c", "{}");
+
+  // Reading "a" makes "b" the oldest
+  driver.retrieve("tokens", "a");
+  TEST_ASSERT_TRUE(driver.store("tokens", "d", "{}"));
+
+  TEST_ASSERT_FALSE(driver.exists("tokens", "b"));
+  TEST_ASSERT_TRUE(driver.exists("tokens", "a"));
+  TEST_ASSERT_TRUE(driver.exists("other", "c"));
+  TEST_ASSERT_EQUAL(3, driver.getRecordCount());
+  TEST_ASSERT_EQUAL(1, driver.getEvictionCount());
+}
+
+void test_memory_driver_reject_policy_keeps_existing_records(void) {
+  MemoryDatabaseDriver driver(
+      2, 1024, MemoryDatabaseDriver::EvictionPolicy::RejectWhenFull);
+  driver.store("tokens", "a", "{}");
+  driver.store("tokens", "b", "{}");
+
+  TEST_ASSERT_FALSE(driver.store("tokens", "c", "{}"));
+  // Replacing a held record needs no extra room
+  TEST_ASSERT_TRUE(driver.store("tokens", "a", "{\"v\":2}"));
+  TEST_ASSERT_EQUAL(2, driver.count("tokens"));
+  TEST_ASSERT_EQUAL(0, driver.getEvictionCount());
+}
+
+void test_memory_driver_bounds_bytes(void) {
+  MemoryDatabaseDriver driver(100, 40);
+  TEST_ASSERT_FALSE(driver.store("tokens", "oversized",
+                                 "{\"v\":\"01234567890123456789012345\"}"));
+
+  driver.store("tokens", "a", "{\"v\":\"0123456789\"}"); // 19 bytes
+  driver.store("tokens", "b", "{\"v\":\"0123456789\"}"); // 38 bytes
+  driver.store("tokens", "c", "{\"v\":\"0123456789\"}"); // evicts "a"
+  TEST_ASSERT_FALSE(driver.exists("tokens", "a"));
+  TEST_ASSERT_EQUAL(38, driver.getUsedBytes());
+}
+
+void test_memory_driver_expires_records_after_ttl(void) {
+  MemoryDatabaseDriver driver;
+  time_t now = 1000;
+  driver.setClock([&now]() { return now; });
+  TEST_ASSERT_TRUE(driver.setCollectionTtl("tokens", 60));
+
+  driver.store("tokens", "t1", "{}");
+  driver.store("users", "u1", "{}");
+  now += 59;
+  TEST_ASSERT_TRUE(driver.exists("tokens", "t1"));
+
+  now += 1;
+  TEST_ASSERT_FALSE(driver.exists("tokens", "t1"));
+  TEST_ASSERT_EQUAL_STRING("", driver.retrieve("tokens", "t1").c_str());
+  TEST_ASSERT_EQUAL(0, driver.count("tokens"));
+  TEST_ASSERT_TRUE(driver.exists("users", "u1"));
+}
+
+void test_memory_driver_maintain_frees_expired_records(void) {
+  MemoryDatabaseDriver driver;
+  time_t now = 1000;
+  driver.setClock([&now]() { return now; });
+  driver.setCollectionTtl("tokens", 60);
+  driver.store("tokens", "t1", "{}");
+  driver.store("tokens", "t2", "{}");
+
+  now += 120;
+  TEST_ASSERT_TRUE(driver.listKeys("tokens").empty());
+  TEST_ASSERT_EQUAL(2, driver.getRecordCount()); // Scans don't free
+
+  driver.maintain();
+  TEST_ASSERT_EQUAL(0, driver.getRecordCount());
+  TEST_ASSERT_EQUAL(0, driver.getUsedBytes());
+}
+
+void test_memory_driver_full_store_reclaims_expired_before_evicting(void) {
+  MemoryDatabaseDriver driver(2, 1024);
+  time_t now = 1000;
+  driver.setClock([&now]() { return now; });
+  driver.setCollectionTtl("tokens", 60);
+  driver.store("users", "u1", "{}");
+  driver.store("tokens", "t1", "{}");
+
+  now += 120;
+  driver.retrieve("users", "u1"); // "u1" is now newest, "t1" expired
+  driver.store("users", "u2", "{}");
+  TEST_ASSERT_EQUAL(0, driver.getEvictionCount());
+  TEST_ASSERT_TRUE(driver.exists("users", "u1"));
+}
+
+void test_storage_manager_routes_collection_to_memory_driver(void) {
+  StorageManager::routeCollection("scratch", "memory");
+  StorageManager::declareTtl("scratch", 60);
+  NativePreferencesFake::writeCount() = 0;
+
+  TEST_ASSERT_TRUE(StorageManager::query("scratch").store("k", "{\"a\":1}"));
+  TEST_ASSERT_EQUAL(0, NativePreferencesFake::writeCount());
+  TEST_ASSERT_EQUAL_STRING(
+      "memory", StorageManager::driverFor("scratch").getDriverName().c_str());
+  TEST_ASSERT_EQUAL(1, StorageManager::driver("memory").count("scratch"));
+  TEST_ASSERT_EQUAL(0, StorageManager::driver().count("scratch"));
+
+  // Unrouted collections keep using the fallback driver
+  TEST_ASSERT_EQUAL_STRING(
+      "json", StorageManager::driverFor("widgets").getDriverName().c_str());
+
+  StorageManager::routeCollection("scratch", "");
+  StorageManager::declareTtl("scratch", 0, "memory");
+  TEST_ASSERT_EQUAL_STRING(
+      "json", StorageManager::driverFor("scratch").getDriverName().c_str());
+}
+
+void register_memory_database_driver_tests(void) {
+  RUN_TEST(test_memory_driver_store_and_retrieve_roundtrip);
+  RUN_TEST(test_memory_driver_evicts_least_recently_used);
+  RUN_TEST(test_memory_driver_reject_policy_keeps_existing_records);
+  RUN_TEST(test_memory_driver_bounds_bytes);
+  RUN_TEST(test_memory_driver_expires_records_after_ttl);
+  RUN_TEST(test_memory_driver_maintain_frees_expired_records);
+  RUN_TEST(test_memory_driver_full_store_reclaims_expired_before_evicting);
+  RUN_TEST(test_storage_manager_routes_collection_to_memory_driver);
+}
@@ -56,6 +56,20 @@ public:
   String getDriverName() const override { return "fake"; }
 };
 
+// Iterates newest-first, like a driver reading in storage order
+class ReverseScanDriver : public FakeDatabaseDriver {
+public:
+  size_t forEach(const String &collection, RecordCallback callback) override {
+    std::vector<String> keys = listKeys(collection);
+    size_t visited = 0;
+    for (auto it = keys.rbegin(); it != keys.rend(); ++it) {
+      visited++;
+      if (!callback(*it, retrieve(collection, *it))) break;
+    }
+    return visited;
+  }
+};
+
 } // namespace
 
 void test_query_builder_null_driver_is_safe(void) {
@@ -198,6 +212,264 @@ void test_query_builder_getters_reflect_construction(void) {
   TEST_ASSERT_EQUAL_STRING("sessions", qb.getCollection().c_str());
 }
 
+void test_driver_default_for_each_stops_when_callback_returns_false(void) {
+  // FakeDatabaseDriver doesn't override forEach()/count(), so this covers
+  // the interface's listKeys() + retrieve() fallbacks.
+  FakeDatabaseDriver driver;
+  driver.store("users", "u1", "{}");
+  driver.store("users", "u2", "{}");
+  driver.store("users", "u3", "{}");
+
+  std::vector<String> seen;
+  size_t visited =
+      driver.forEach("users", [&](const String &key, const String &) {
+        seen.push_back(key);
+        return seen.size() < 2;
+      });
+
+  TEST_ASSERT_EQUAL(2, visited);
+  TEST_ASSERT_EQUAL_STRING("u1", seen[0].c_str());
+  TEST_ASSERT_EQUAL_STRING("u2", seen[1].c_str());
+  TEST_ASSERT_EQUAL(3, driver.count("users"));
+}
+
+void test_query_builder_where_numeric_comparisons_are_typed(void) {
+  FakeDatabaseDriver driver;
+  driver.store("items", "a", "{\"qty\":9}");
+  driver.store("items", "b", "{\"qty\":10}");
+  driver.store("items", "c", "{\"qty\":100}");
+
+  // A string comparison would order "10" < "100" < "9"
+  TEST_ASSERT_EQUAL(2, QueryBuilder(&driver, "items")
+                           .where("qty", ">=", 10)
+                           .getAll()
+                           .size());
+  TEST_ASSERT_EQUAL(1,
+                    QueryBuilder(&driver, "items").where("qty", "<", "10").getAll().size());
+  TEST_ASSERT_EQUAL_STRING(
+      "{\"qty\":10}",
+      QueryBuilder(&driver, "items").where("qty", "=", 10.0).get().c_str());
+  TEST_ASSERT_EQUAL(2,
+                    QueryBuilder(&driver, "items").where("qty", "!=", 9).getAll().size());
+}
+
+void test_query_builder_where_string_operators(void) {
+  FakeDatabaseDriver driver;
+  driver.store("users", "u1", "{\"username\":\"alice\"}");
+  driver.store("users", "u2", "{\"username\":\"albert\"}");
+  driver.store("users", "u3", "{\"username\":\"bob\"}");
+
+  TEST_ASSERT_EQUAL(2, QueryBuilder(&driver, "users")
+                           .where("username", "prefix", "al")
+                           .getAll()
+                           .size());
+  TEST_ASSERT_EQUAL(2, QueryBuilder(&driver, "users")
+                           .where("username", "contains", "b")
+                           .getAll()
+                           .size());
+  TEST_ASSERT_EQUAL(2, QueryBuilder(&driver, "users")
+                           .where("username", "<", "b")
+                           .getAll()
+                           .size());
+  TEST_ASSERT_EQUAL(2, QueryBuilder(&driver, "users")
+                           .where("username", "<>", "bob")
+                           .getAll()
+                           .size());
+}
+
+void test_query_builder_where_conditions_combine(void) {
+  FakeDatabaseDriver driver;
+  driver.store("items", "a", "{\"qty\":5,\"kind\":\"bolt\"}");
+  driver.store("items", "b", "{\"qty\":15,\"kind\":\"bolt\"}");
+  driver.store("items", "c", "{\"qty\":25,\"kind\":\"nut\"}");
+
+  std::vector<String> results = QueryBuilder(&driver, "items")
+                                    .where("qty", ">", 1)
+                                    .where("qty", "<", 20)
+                                    .where("kind", "bolt")
+                                    .getAll();
+  TEST_ASSERT_EQUAL(2, results.size());
+}
+
+void test_query_builder_where_missing_field_only_matches_not_equal(void) {
+  FakeDatabaseDriver driver;
+  driver.store("users", "u1", "{\"username\":\"alice\"}");
+
+  QueryBuilder eq(&driver, "users");
+  TEST_ASSERT_FALSE(eq.where("role", "=", "admin").exists());
+  QueryBuilder lt(&driver, "users");
+  TEST_ASSERT_FALSE(lt.where("age", "<", 100).exists());
+  QueryBuilder ne(&driver, "users");
+  TEST_ASSERT_TRUE(ne.where("role", "!=", "admin").exists());
+}
+
+void test_query_builder_where_bool_and_unknown_operator(void) {
+  FakeDatabaseDriver driver;
+  driver.store("users", "u1", "{\"isAdmin\":true}");
+  driver.store("users", "u2", "{\"isAdmin\":false}");
+
+  TEST_ASSERT_EQUAL(1, QueryBuilder(&driver, "users")
+                           .where("isAdmin", "true")
+                           .getAll()
+                           .size());
+  TEST_ASSERT_EQUAL(0, QueryBuilder(&driver, "users")
+                           .where("isAdmin", "~", "true")
+                           .getAll()
+                           .size());
+  TEST_ASSERT_TRUE(QueryBuilder::parseOperator("~") ==
+                   QueryBuilder::Operator::Invalid);
+}
+
+void test_query_builder_where_returns_full_record_despite_filter(void) {
+  // Only "role" is parsed for matching, but callers get the stored record
+  FakeDatabaseDriver driver;
+  driver.store("users", "u1",
+               "{\"role\":\"admin\",\"profile\":{\"name\":\"Al\"}}");
+
+  QueryBuilder qb(&driver, "users");
+  TEST_ASSERT_EQUAL_STRING(
+      "{\"role\":\"admin\",\"profile\":{\"name\":\"Al\"}}",
+      qb.where("role", "admin").get().c_str());
+}
+
+void test_query_builder_limit_counts_matches_not_scanned_records(void) {
+  FakeDatabaseDriver driver;
+  driver.store("users", "u1", "{\"role\":\"guest\"}");
+  driver.store("users", "u2", "{\"role\":\"guest\"}");
+  driver.store("users", "u3", "{\"role\":\"admin\"}");
+  driver.store("users", "u4", "{\"role\":\"admin\"}");
+
+  QueryBuilder qb(&driver, "users");
+  std::vector<String> results = qb.where("role", "admin").limit(1).getAll();
+  TEST_ASSERT_EQUAL(1, results.size());
+  TEST_ASSERT_EQUAL_STRING("{\"role\":\"admin\"}", results[0].c_str());
+  TEST_ASSERT_TRUE(qb.nextCursor().length() > 0);
+
+  // A limit smaller than the non-matching prefix still finds the match
+  TEST_ASSERT_EQUAL_STRING(
+      "{\"role\":\"admin\"}",
+      QueryBuilder(&driver, "users").where("role", "admin").limit(1).get().c_str());
+}
+
+void test_query_builder_order_by_sorts_numbers_and_text(void) {
+  FakeDatabaseDriver driver;
+  driver.store("t", "a", "{\"n\":10,\"s\":\"b\"}");
+  driver.store("t", "b", "{\"n\":9,\"s\":\"c\"}");
+  driver.store("t", "c", "{\"n\":100,\"s\":\"a\"}");
+
+  std::vector<String> keys;
+  QueryBuilder(&driver, "t").orderBy("n").each(
+      [&](const String &key, const String &) {
+        keys.push_back(key);
+        return true;
+      });
+  TEST_ASSERT_EQUAL(3, keys.size());
+  TEST_ASSERT_EQUAL_STRING("b", keys[0].c_str());
+  TEST_ASSERT_EQUAL_STRING("a", keys[1].c_str());
+  TEST_ASSERT_EQUAL_STRING("c", keys[2].c_str());
+
+  keys.clear();
+  QueryBuilder(&driver, "t").orderBy("s", true).each(
+      [&](const String &key, const String &) {
+        keys.push_back(key);
+        return true;
+      });
+  TEST_ASSERT_EQUAL_STRING("b", keys[0].c_str());
+  TEST_ASSERT_EQUAL_STRING("a", keys[1].c_str());
+  TEST_ASSERT_EQUAL_STRING("c", keys[2].c_str());
+
+  TEST_ASSERT_EQUAL_STRING(
+      "{\"n\":100,\"s\":\"a\"}",
+      QueryBuilder(&driver, "t").orderBy("n", true).get().c_str());
+}
+
+void test_query_builder_cursor_pages_through_all_matches(void) {
+  FakeDatabaseDriver driver;
+  for (int i = 0; i < 7; i++) {
+    // Duplicate sort values so ties must be broken by key
+    driver.store("t", String("k") + String(i),
+                 "{\"group\":" + String(i / 2) + "}");
+  }
+
+  std::vector<String> seen;
+  String cursor;
+  int pages = 0;
+  do {
+    QueryBuilder qb(&driver, "t");
+    size_t delivered = qb.orderBy("group", true).limit(3).after(cursor).each(
+        [&](const String &key, const String &) {
+          seen.push_back(key);
+          return true;
+        });
+    TEST_ASSERT_TRUE(delivered <= 3);
+    cursor = qb.nextCursor();
+    pages++;
+  } while (cursor.length() > 0 && pages < 10);
+
+  TEST_ASSERT_EQUAL(3, pages);
+  TEST_ASSERT_EQUAL(7, seen.size());
+  TEST_ASSERT_EQUAL_STRING("k6", seen[0].c_str());
+  TEST_ASSERT_EQUAL_STRING("k5", seen[1].c_str());
+  TEST_ASSERT_EQUAL_STRING("k4", seen[2].c_str());
+  TEST_ASSERT_EQUAL_STRING("k0", seen[6].c_str());
+}
+
+void test_query_builder_each_stop_early_yields_resume_cursor(void) {
+  FakeDatabaseDriver driver;
+  driver.store("t", "a", "{}");
+  driver.store("t", "b", "{}");
+  driver.store("t", "c", "{}");
+
+  QueryBuilder qb(&driver, "t");
+  size_t delivered = qb.limit(10).each([](const String &key, const String &) {
+    return key != "b";
+  });
+  TEST_ASSERT_EQUAL(2, delivered);
+
+  std::vector<String> rest =
+      QueryBuilder(&driver, "t").after(qb.nextCursor()).getAll();
+  TEST_ASSERT_EQUAL(1, rest.size());
+
+  // Garbage cursors are ignored rather than matching nothing
+  TEST_ASSERT_EQUAL(3, QueryBuilder(&driver, "t").after("zz!").getAll().size());
+}
+
+void test_query_builder_key_order_holds_for_unordered_scans(void) {
+  ReverseScanDriver driver;
+  driver.store("t", "a", "{\"n\":1}");
+  driver.store("t", "b", "{\"n\":2}");
+  driver.store("t", "c", "{\"n\":3}");
+
+  std::vector<String> all = QueryBuilder(&driver, "t").getAll();
+  TEST_ASSERT_EQUAL(3, all.size());
+  TEST_ASSERT_EQUAL_STRING("{\"n\":1}", all[0].c_str());
+  TEST_ASSERT_EQUAL_STRING("{\"n\":3}", all[2].c_str());
+
+  // Page one record at a time - each page resumes right after the last
+  String cursor;
+  std::vector<String> paged;
+  for (int page = 0; page < 5; page++) {
+    QueryBuilder qb(&driver, "t");
+    qb.limit(1).after(cursor).each([&](const String &key, const String &) {
+      paged.push_back(key);
+      return true;
+    });
+    cursor = qb.nextCursor();
+    if (cursor.length() == 0) break;
+  }
+  TEST_ASSERT_EQUAL(3, paged.size());
+  TEST_ASSERT_EQUAL_STRING("a", paged[0].c_str());
+  TEST_ASSERT_EQUAL_STRING("b", paged[1].c_str());
+  TEST_ASSERT_EQUAL_STRING("c", paged[2].c_str());
+
+  // get() after a cursor is the next key, not the next one scanned
+  QueryBuilder first(&driver, "t");
+  first.limit(1).getAll();
+  TEST_ASSERT_EQUAL_STRING(
+      "{\"n\":2}",
+      QueryBuilder(&driver, "t").after(first.nextCursor()).get().c_str());
+}
+
 void register_query_builder_tests(void) {
   RUN_TEST(test_query_builder_null_driver_is_safe);
   RUN_TEST(test_query_builder_get_without_conditions_returns_first_key);
@@ -214,4 +486,16 @@ void register_query_builder_tests(void) {
   RUN_TEST(test_query_builder_remove_with_condition_removes_only_matches);
   RUN_TEST(test_query_builder_remove_no_match_returns_false);
   RUN_TEST(test_query_builder_getters_reflect_construction);
+  RUN_TEST(test_driver_default_for_each_stops_when_callback_returns_false);
+  RUN_TEST(test_query_builder_where_numeric_comparisons_are_typed);
+  RUN_TEST(test_query_builder_where_string_operators);
+  RUN_TEST(test_query_builder_where_conditions_combine);
+  RUN_TEST(test_query_builder_where_missing_field_only_matches_not_equal);
+  RUN_TEST(test_query_builder_where_bool_and_unknown_operator);
+  RUN_TEST(test_query_builder_where_returns_full_record_despite_filter);
+  RUN_TEST(test_query_builder_limit_counts_matches_not_scanned_records);
+  RUN_TEST(test_query_builder_order_by_sorts_numbers_and_text);
+  RUN_TEST(test_query_builder_cursor_pages_through_all_matches);
+  RUN_TEST(test_query_builder_each_stop_early_yields_resume_cursor);
+  RUN_TEST(test_query_builder_key_order_holds_for_unordered_scans);
 }
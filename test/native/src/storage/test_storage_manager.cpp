@@ -1,5 +1,7 @@
+#include "storage/json_database_driver.h"
 #include "storage/storage_manager.h"
 #include <map>
+#include <Preferences.h>
 #include <unity.h>
 
 namespace {
@@ -137,6 +139,20 @@ void test_storage_manager_clear_all_drivers_resets_to_defaults(void) {
   TEST_ASSERT_FALSE(hasFake);
 }
 
+void test_storage_manager_declared_format_applies_to_later_drivers(void) {
+  // Declared before the driver exists, and kept across clearAllDrivers()
+  StorageManager::declareFormat("fmt_widgets", RecordFormat::MessagePack,
+                                "json2");
+  StorageManager::clearAllDrivers();
+  StorageManager::configureDriver(
+      "json2", std::unique_ptr<IDatabaseDriver>(new JsonDatabaseDriver()));
+
+  StorageManager::driver("json2").store("fmt_widgets", "w1", "{}");
+  auto &nvs = NativePreferencesFake::store()["storage"];
+  TEST_ASSERT_EQUAL(1, nvs.count("~fmt_widgets"));
+  TEST_ASSERT_EQUAL(0, nvs.count("fmt_widgets"));
+}
+
 void register_storage_manager_tests(void) {
   RUN_TEST(test_storage_manager_default_driver_is_json);
   RUN_TEST(test_storage_manager_ensures_json_and_littlefs_exist_by_default);
@@ -149,4 +165,5 @@ void register_storage_manager_tests(void) {
   RUN_TEST(test_storage_manager_remove_driver_refuses_json);
   RUN_TEST(test_storage_manager_remove_default_driver_falls_back_to_json);
   RUN_TEST(test_storage_manager_clear_all_drivers_resets_to_defaults);
+  RUN_TEST(test_storage_manager_declared_format_applies_to_later_drivers);
 }
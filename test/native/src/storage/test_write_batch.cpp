@@ -0,0 +1,56 @@
+#include "storage/storage_manager.h"
+#include "storage/write_batch.h"
+#include <unity.h>
+
+void test_write_batch_commit_without_driver_fails(void) {
+  WriteBatch batch;
+  batch.put("users", "u1", "{}");
+  TEST_ASSERT_FALSE(batch.commit());
+}
+
+void test_write_batch_tracks_collections_in_first_use_order(void) {
+  WriteBatch batch;
+  batch.put("sessions", "s1", "{}").remove("users", "u1").put("sessions", "s2",
+                                                               "{}");
+  TEST_ASSERT_EQUAL(3, batch.size());
+
+  std::vector<String> collections = batch.collections();
+  TEST_ASSERT_EQUAL(2, collections.size());
+  TEST_ASSERT_EQUAL_STRING("sessions", collections[0].c_str());
+  TEST_ASSERT_EQUAL_STRING("users", collections[1].c_str());
+}
+
+void test_write_batch_collapsed_keeps_last_operation_per_record(void) {
+  WriteBatch batch;
+  batch.put("users", "u1", "{\"v\":1}")
+      .put("users", "u2", "{}")
+      .remove("users", "u1")
+      .put("users", "u1", "{\"v\":3}");
+
+  std::vector<WriteBatch::Operation> ops = batch.collapsed();
+  TEST_ASSERT_EQUAL(2, ops.size());
+  TEST_ASSERT_EQUAL_STRING("u1", ops[0].key.c_str());
+  TEST_ASSERT_FALSE(ops[0].isRemove);
+  TEST_ASSERT_EQUAL_STRING("{\"v\":3}", ops[0].data.c_str());
+  TEST_ASSERT_EQUAL_STRING("u2", ops[1].key.c_str());
+}
+
+void test_write_batch_commit_applies_and_clears(void) {
+  WriteBatch batch = StorageManager::batch("json");
+  IDatabaseDriver &driver = StorageManager::driver("json");
+  driver.store("wb_items", "old", "{}");
+
+  batch.put("wb_items", "a", "{\"n\":1}").remove("wb_items", "old");
+  TEST_ASSERT_TRUE(batch.commit());
+  TEST_ASSERT_TRUE(batch.empty());
+
+  TEST_ASSERT_EQUAL_STRING("{\"n\":1}", driver.retrieve("wb_items", "a").c_str());
+  TEST_ASSERT_FALSE(driver.exists("wb_items", "old"));
+}
+
+void register_write_batch_tests(void) {
+  RUN_TEST(test_write_batch_commit_without_driver_fails);
+  RUN_TEST(test_write_batch_tracks_collections_in_first_use_order);
+  RUN_TEST(test_write_batch_collapsed_keeps_last_operation_per_record);
+  RUN_TEST(test_write_batch_commit_applies_and_clears);
+}
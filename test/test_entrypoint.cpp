@@ -4,6 +4,8 @@
 // via build_src_filter in platformio.ini (no direct includes here)
 void runStringPoolTests();
 void runUrlUtilsTests();
+void runChecksumTests();
+void runGzipTests();
 void register_navigation_types_tests(void);
 void register_redirect_types_tests(void);
 void register_platform_provider_tests(void);
@@ -11,14 +13,33 @@ void register_web_platform_boot_tests(void);
 void runAuthUtilsTests();
 void register_auth_decision_tests(void);
 void register_query_builder_tests(void);
+void register_collection_codec_tests(void);
 void register_json_database_driver_tests(void);
 void register_littlefs_database_driver_tests(void);
+void register_log_database_driver_tests(void);
+void register_memory_database_driver_tests(void);
+void register_async_database_driver_tests(void);
+void register_caching_database_driver_tests(void);
+void register_indexed_database_driver_tests(void);
+void register_write_batch_tests(void);
 void register_storage_manager_tests(void);
 void register_auth_storage_tests(void);
 void register_openapi_spec_helpers_tests(void);
+void register_http_negotiation_tests(void);
+void register_asset_fingerprint_tests(void);
+void register_asset_bundle_tests(void);
+void register_html_template_tests(void);
+void register_response_body_tests(void);
 void register_system_status_helpers_tests(void);
 void register_certificate_loader_tests(void);
 void register_wifi_credentials_store_tests(void);
+#ifdef WEB_PLATFORM_BENCHMARKS
+void register_query_builder_benchmarks(void);
+void register_storage_driver_benchmarks(void);
+void register_record_encoding_benchmarks(void);
+void register_storage_suite_benchmarks(void);
+void register_json_stream_benchmarks(void);
+#endif
 
 // Native entrypoint
 #ifdef NATIVE_PLATFORM
@@ -44,6 +65,8 @@ int main(int argc, char **argv) {
   // Core platform-agnostic tests (no Arduino dependencies)
   runStringPoolTests();
   runUrlUtilsTests();
+  runChecksumTests();
+  runGzipTests();
 
   // Type and provider tests (native-mock variants)
   register_navigation_types_tests();
@@ -52,15 +75,36 @@ int main(int argc, char **argv) {
   runAuthUtilsTests();
   register_auth_decision_tests();
   register_query_builder_tests();
+  register_collection_codec_tests();
   register_json_database_driver_tests();
   register_littlefs_database_driver_tests();
+  register_log_database_driver_tests();
+  register_memory_database_driver_tests();
+  register_async_database_driver_tests();
+  register_caching_database_driver_tests();
+  register_indexed_database_driver_tests();
+  register_write_batch_tests();
   register_storage_manager_tests();
   register_auth_storage_tests();
   register_openapi_spec_helpers_tests();
+  register_http_negotiation_tests();
+  register_asset_fingerprint_tests();
+  register_asset_bundle_tests();
+  register_html_template_tests();
+  register_response_body_tests();
   register_system_status_helpers_tests();
   register_certificate_loader_tests();
   register_wifi_credentials_store_tests();
 
+#ifdef WEB_PLATFORM_BENCHMARKS
+  // Timing runs - only compiled into the bench_native environment
+  register_query_builder_benchmarks();
+  register_storage_driver_benchmarks();
+  register_record_encoding_benchmarks();
+  register_storage_suite_benchmarks();
+  register_json_stream_benchmarks();
+#endif
+
   UNITY_END();
   return 0;
 }